@@ -683,6 +683,516 @@ set(SIMDPP_X86_AVX512VL_TEST_CODE
     }"
 )
 
+list(APPEND SIMDPP_ARCHS_PRI "X86_BMI1")
+if(SIMDPP_CLANG OR SIMDPP_GCC OR SIMDPP_INTEL)
+    set(SIMDPP_X86_BMI1_CXX_FLAGS "-mbmi")
+    #unsupported on MSVC
+endif()
+set(SIMDPP_X86_BMI1_DEFINE "SIMDPP_ARCH_X86_BMI1")
+set(SIMDPP_X86_BMI1_SUFFIX "-x86_bmi1")
+set(SIMDPP_X86_BMI1_TEST_CODE
+    "#include <immintrin.h>
+    #include <iostream>
+
+    unsigned* prevent_optimization(unsigned* ptr)
+    {
+        volatile bool never = false;
+        if (never) {
+            while (*ptr++)
+                std::cout << *ptr;
+        }
+        unsigned* volatile* volatile opaque;
+        opaque = &ptr;
+        return *opaque;
+    }
+
+    int main()
+    {
+        unsigned data;
+        unsigned* p = &data;
+        p = prevent_optimization(p);
+
+        *p = _andn_u32(*p, *p); // only in BMI1
+
+        p = prevent_optimization(p);
+    }"
+)
+
+list(APPEND SIMDPP_ARCHS_PRI "X86_BMI2")
+if(SIMDPP_CLANG OR SIMDPP_GCC OR SIMDPP_INTEL)
+    set(SIMDPP_X86_BMI2_CXX_FLAGS "-mbmi2")
+    #unsupported on MSVC
+endif()
+set(SIMDPP_X86_BMI2_DEFINE "SIMDPP_ARCH_X86_BMI2")
+set(SIMDPP_X86_BMI2_SUFFIX "-x86_bmi2")
+set(SIMDPP_X86_BMI2_TEST_CODE
+    "#include <immintrin.h>
+    #include <iostream>
+
+    unsigned* prevent_optimization(unsigned* ptr)
+    {
+        volatile bool never = false;
+        if (never) {
+            while (*ptr++)
+                std::cout << *ptr;
+        }
+        unsigned* volatile* volatile opaque;
+        opaque = &ptr;
+        return *opaque;
+    }
+
+    int main()
+    {
+        unsigned data;
+        unsigned* p = &data;
+        p = prevent_optimization(p);
+
+        *p = _pdep_u32(*p, *p); // only in BMI2
+
+        p = prevent_optimization(p);
+    }"
+)
+
+list(APPEND SIMDPP_ARCHS_PRI "X86_F16C")
+if(SIMDPP_CLANG OR SIMDPP_GCC OR SIMDPP_INTEL)
+    set(SIMDPP_X86_F16C_CXX_FLAGS "-mavx -mf16c")
+    #unsupported on MSVC
+endif()
+set(SIMDPP_X86_F16C_DEFINE "SIMDPP_ARCH_X86_F16C")
+set(SIMDPP_X86_F16C_SUFFIX "-x86_f16c")
+set(SIMDPP_X86_F16C_TEST_CODE
+    "#include <immintrin.h>
+    #include <iostream>
+
+    char* prevent_optimization(char* ptr)
+    {
+        volatile bool never = false;
+        if (never) {
+            while (*ptr++)
+                std::cout << *ptr;
+        }
+        char* volatile* volatile opaque;
+        opaque = &ptr;
+        return *opaque;
+    }
+
+    int main()
+    {
+        union {
+            char data[16];
+            __m128i align;
+        };
+        char* p = data;
+        p = prevent_optimization(p);
+
+        __m128i v = _mm_load_si128((__m128i*)p);
+        v = _mm_cvtps_ph(_mm_cvtph_ps(v), 0); // only in F16C
+        _mm_store_si128((__m128i*)p, v);
+
+        p = prevent_optimization(p);
+    }"
+)
+
+list(APPEND SIMDPP_ARCHS_PRI "X86_GFNI")
+if(SIMDPP_CLANG OR SIMDPP_GCC OR SIMDPP_INTEL)
+    set(SIMDPP_X86_GFNI_CXX_FLAGS "-msse2 -mgfni")
+    #unsupported on MSVC
+endif()
+set(SIMDPP_X86_GFNI_DEFINE "SIMDPP_ARCH_X86_GFNI")
+set(SIMDPP_X86_GFNI_SUFFIX "-x86_gfni")
+set(SIMDPP_X86_GFNI_TEST_CODE
+    "#include <immintrin.h>
+    #include <iostream>
+
+    char* prevent_optimization(char* ptr)
+    {
+        volatile bool never = false;
+        if (never) {
+            while (*ptr++)
+                std::cout << *ptr;
+        }
+        char* volatile* volatile opaque;
+        opaque = &ptr;
+        return *opaque;
+    }
+
+    int main()
+    {
+        union {
+            char data[16];
+            __m128i align;
+        };
+        char* p = data;
+        p = prevent_optimization(p);
+
+        __m128i v = _mm_load_si128((__m128i*)p);
+        v = _mm_gf2p8mul_epi8(v, v); // only in GFNI
+        _mm_store_si128((__m128i*)p, v);
+
+        p = prevent_optimization(p);
+    }"
+)
+
+list(APPEND SIMDPP_ARCHS_PRI "X86_VAES")
+if(SIMDPP_CLANG OR SIMDPP_GCC OR SIMDPP_INTEL)
+    set(SIMDPP_X86_VAES_CXX_FLAGS "-mavx -mvaes")
+    #unsupported on MSVC
+endif()
+set(SIMDPP_X86_VAES_DEFINE "SIMDPP_ARCH_X86_VAES")
+set(SIMDPP_X86_VAES_SUFFIX "-x86_vaes")
+set(SIMDPP_X86_VAES_TEST_CODE
+    "#include <immintrin.h>
+    #include <iostream>
+
+    char* prevent_optimization(char* ptr)
+    {
+        volatile bool never = false;
+        if (never) {
+            while (*ptr++)
+                std::cout << *ptr;
+        }
+        char* volatile* volatile opaque;
+        opaque = &ptr;
+        return *opaque;
+    }
+
+    int main()
+    {
+        union {
+            char data[32];
+            __m256i align;
+        };
+        char* p = data;
+        p = prevent_optimization(p);
+
+        __m256i v = _mm256_load_si256((__m256i*)p);
+        v = _mm256_aesenc_epi128(v, v); // only in VAES
+        _mm256_store_si256((__m256i*)p, v);
+
+        p = prevent_optimization(p);
+    }"
+)
+
+list(APPEND SIMDPP_ARCHS_PRI "X86_VPCLMULQDQ")
+if(SIMDPP_CLANG OR SIMDPP_GCC OR SIMDPP_INTEL)
+    set(SIMDPP_X86_VPCLMULQDQ_CXX_FLAGS "-mavx -mvpclmulqdq")
+    #unsupported on MSVC
+endif()
+set(SIMDPP_X86_VPCLMULQDQ_DEFINE "SIMDPP_ARCH_X86_VPCLMULQDQ")
+set(SIMDPP_X86_VPCLMULQDQ_SUFFIX "-x86_vpclmul")
+set(SIMDPP_X86_VPCLMULQDQ_TEST_CODE
+    "#include <immintrin.h>
+    #include <iostream>
+
+    char* prevent_optimization(char* ptr)
+    {
+        volatile bool never = false;
+        if (never) {
+            while (*ptr++)
+                std::cout << *ptr;
+        }
+        char* volatile* volatile opaque;
+        opaque = &ptr;
+        return *opaque;
+    }
+
+    int main()
+    {
+        union {
+            char data[32];
+            __m256i align;
+        };
+        char* p = data;
+        p = prevent_optimization(p);
+
+        __m256i v = _mm256_load_si256((__m256i*)p);
+        v = _mm256_clmulepi64_epi128(v, v, 0); // only in VPCLMULQDQ
+        _mm256_store_si256((__m256i*)p, v);
+
+        p = prevent_optimization(p);
+    }"
+)
+
+list(APPEND SIMDPP_ARCHS_PRI "X86_AVX512VBMI")
+if(SIMDPP_CLANG OR SIMDPP_GCC OR SIMDPP_INTEL)
+    set(SIMDPP_X86_AVX512VBMI_CXX_FLAGS "-mavx512bw -mavx512vbmi")
+    #unsupported on MSVC
+endif()
+set(SIMDPP_X86_AVX512VBMI_DEFINE "SIMDPP_ARCH_X86_AVX512VBMI")
+set(SIMDPP_X86_AVX512VBMI_SUFFIX "-x86_vbmi")
+set(SIMDPP_X86_AVX512VBMI_TEST_CODE
+    "#include <immintrin.h>
+    #include <iostream>
+
+    char* prevent_optimization(char* ptr)
+    {
+        volatile bool never = false;
+        if (never) {
+            while (*ptr++)
+                std::cout << *ptr;
+        }
+        char* volatile* volatile opaque;
+        opaque = &ptr;
+        return *opaque;
+    }
+
+    int main()
+    {
+        union {
+            char data[64];
+            __m512i align;
+        };
+        char* p = data;
+        p = prevent_optimization(p);
+
+        __m512i v = _mm512_load_si512((void*)p);
+        v = _mm512_permutexvar_epi8(v, v); // only in AVX512-VBMI
+        _mm512_store_si512((void*)p, v);
+
+        p = prevent_optimization(p);
+    }"
+)
+
+list(APPEND SIMDPP_ARCHS_PRI "X86_AVX512VBMI2")
+if(SIMDPP_CLANG OR SIMDPP_GCC OR SIMDPP_INTEL)
+    set(SIMDPP_X86_AVX512VBMI2_CXX_FLAGS "-mavx512bw -mavx512vbmi2")
+    #unsupported on MSVC
+endif()
+set(SIMDPP_X86_AVX512VBMI2_DEFINE "SIMDPP_ARCH_X86_AVX512VBMI2")
+set(SIMDPP_X86_AVX512VBMI2_SUFFIX "-x86_vbmi2")
+set(SIMDPP_X86_AVX512VBMI2_TEST_CODE
+    "#include <immintrin.h>
+    #include <iostream>
+
+    char* prevent_optimization(char* ptr)
+    {
+        volatile bool never = false;
+        if (never) {
+            while (*ptr++)
+                std::cout << *ptr;
+        }
+        char* volatile* volatile opaque;
+        opaque = &ptr;
+        return *opaque;
+    }
+
+    int main()
+    {
+        union {
+            char data[64];
+            __m512i align;
+        };
+        char* p = data;
+        p = prevent_optimization(p);
+
+        __m512i v = _mm512_load_si512((void*)p);
+        v = _mm512_shldi_epi16(v, v, 3); // only in AVX512-VBMI2
+        _mm512_store_si512((void*)p, v);
+
+        p = prevent_optimization(p);
+    }"
+)
+
+list(APPEND SIMDPP_ARCHS_PRI "X86_AVX512VNNI")
+if(SIMDPP_CLANG OR SIMDPP_GCC OR SIMDPP_INTEL)
+    set(SIMDPP_X86_AVX512VNNI_CXX_FLAGS "-mavx512f -mavx512vnni")
+    #unsupported on MSVC
+endif()
+set(SIMDPP_X86_AVX512VNNI_DEFINE "SIMDPP_ARCH_X86_AVX512VNNI")
+set(SIMDPP_X86_AVX512VNNI_SUFFIX "-x86_vnni")
+set(SIMDPP_X86_AVX512VNNI_TEST_CODE
+    "#include <immintrin.h>
+    #include <iostream>
+
+    char* prevent_optimization(char* ptr)
+    {
+        volatile bool never = false;
+        if (never) {
+            while (*ptr++)
+                std::cout << *ptr;
+        }
+        char* volatile* volatile opaque;
+        opaque = &ptr;
+        return *opaque;
+    }
+
+    int main()
+    {
+        union {
+            char data[64];
+            __m512i align;
+        };
+        char* p = data;
+        p = prevent_optimization(p);
+
+        __m512i v = _mm512_load_si512((void*)p);
+        v = _mm512_dpbusd_epi32(v, v, v); // only in AVX512-VNNI
+        _mm512_store_si512((void*)p, v);
+
+        p = prevent_optimization(p);
+    }"
+)
+
+list(APPEND SIMDPP_ARCHS_PRI "X86_AVX512BITALG")
+if(SIMDPP_CLANG OR SIMDPP_GCC OR SIMDPP_INTEL)
+    set(SIMDPP_X86_AVX512BITALG_CXX_FLAGS "-mavx512bw -mavx512bitalg")
+    #unsupported on MSVC
+endif()
+set(SIMDPP_X86_AVX512BITALG_DEFINE "SIMDPP_ARCH_X86_AVX512BITALG")
+set(SIMDPP_X86_AVX512BITALG_SUFFIX "-x86_bitalg")
+set(SIMDPP_X86_AVX512BITALG_TEST_CODE
+    "#include <immintrin.h>
+    #include <iostream>
+
+    char* prevent_optimization(char* ptr)
+    {
+        volatile bool never = false;
+        if (never) {
+            while (*ptr++)
+                std::cout << *ptr;
+        }
+        char* volatile* volatile opaque;
+        opaque = &ptr;
+        return *opaque;
+    }
+
+    int main()
+    {
+        union {
+            char data[64];
+            __m512i align;
+        };
+        char* p = data;
+        p = prevent_optimization(p);
+
+        __m512i v = _mm512_load_si512((void*)p);
+        v = _mm512_popcnt_epi8(v); // only in AVX512-BITALG
+        _mm512_store_si512((void*)p, v);
+
+        p = prevent_optimization(p);
+    }"
+)
+
+list(APPEND SIMDPP_ARCHS_PRI "X86_AVX512VPOPCNTDQ")
+if(SIMDPP_CLANG OR SIMDPP_GCC OR SIMDPP_INTEL)
+    set(SIMDPP_X86_AVX512VPOPCNTDQ_CXX_FLAGS "-mavx512f -mavx512vpopcntdq")
+    #unsupported on MSVC
+endif()
+set(SIMDPP_X86_AVX512VPOPCNTDQ_DEFINE "SIMDPP_ARCH_X86_AVX512VPOPCNTDQ")
+set(SIMDPP_X86_AVX512VPOPCNTDQ_SUFFIX "-x86_vpopcntdq")
+set(SIMDPP_X86_AVX512VPOPCNTDQ_TEST_CODE
+    "#include <immintrin.h>
+    #include <iostream>
+
+    char* prevent_optimization(char* ptr)
+    {
+        volatile bool never = false;
+        if (never) {
+            while (*ptr++)
+                std::cout << *ptr;
+        }
+        char* volatile* volatile opaque;
+        opaque = &ptr;
+        return *opaque;
+    }
+
+    int main()
+    {
+        union {
+            char data[64];
+            __m512i align;
+        };
+        char* p = data;
+        p = prevent_optimization(p);
+
+        __m512i v = _mm512_load_si512((void*)p);
+        v = _mm512_popcnt_epi32(v); // only in AVX512-VPOPCNTDQ
+        _mm512_store_si512((void*)p, v);
+
+        p = prevent_optimization(p);
+    }"
+)
+
+list(APPEND SIMDPP_ARCHS_PRI "X86_AVX512IFMA")
+if(SIMDPP_CLANG OR SIMDPP_GCC OR SIMDPP_INTEL)
+    set(SIMDPP_X86_AVX512IFMA_CXX_FLAGS "-mavx512f -mavx512ifma")
+    #unsupported on MSVC
+endif()
+set(SIMDPP_X86_AVX512IFMA_DEFINE "SIMDPP_ARCH_X86_AVX512IFMA")
+set(SIMDPP_X86_AVX512IFMA_SUFFIX "-x86_ifma")
+set(SIMDPP_X86_AVX512IFMA_TEST_CODE
+    "#include <immintrin.h>
+    #include <iostream>
+
+    char* prevent_optimization(char* ptr)
+    {
+        volatile bool never = false;
+        if (never) {
+            while (*ptr++)
+                std::cout << *ptr;
+        }
+        char* volatile* volatile opaque;
+        opaque = &ptr;
+        return *opaque;
+    }
+
+    int main()
+    {
+        union {
+            char data[64];
+            __m512i align;
+        };
+        char* p = data;
+        p = prevent_optimization(p);
+
+        __m512i v = _mm512_load_si512((void*)p);
+        v = _mm512_madd52lo_epu64(v, v, v); // only in AVX512-IFMA
+        _mm512_store_si512((void*)p, v);
+
+        p = prevent_optimization(p);
+    }"
+)
+
+list(APPEND SIMDPP_ARCHS_PRI "X86_AVX512CD")
+if(SIMDPP_CLANG OR SIMDPP_GCC OR SIMDPP_INTEL)
+    set(SIMDPP_X86_AVX512CD_CXX_FLAGS "-mavx512f -mavx512cd")
+    #unsupported on MSVC
+endif()
+set(SIMDPP_X86_AVX512CD_DEFINE "SIMDPP_ARCH_X86_AVX512CD")
+set(SIMDPP_X86_AVX512CD_SUFFIX "-x86_avx512cd")
+set(SIMDPP_X86_AVX512CD_TEST_CODE
+    "#include <immintrin.h>
+    #include <iostream>
+
+    char* prevent_optimization(char* ptr)
+    {
+        volatile bool never = false;
+        if (never) {
+            while (*ptr++)
+                std::cout << *ptr;
+        }
+        char* volatile* volatile opaque;
+        opaque = &ptr;
+        return *opaque;
+    }
+
+    int main()
+    {
+        union {
+            char data[64];
+            __m512i align;
+        };
+        char* p = data;
+        p = prevent_optimization(p);
+
+        __m512i v = _mm512_load_si512((void*)p);
+        v = _mm512_conflict_epi32(v); // only in AVX512-CD
+        _mm512_store_si512((void*)p, v);
+
+        p = prevent_optimization(p);
+    }"
+)
+
 list(APPEND SIMDPP_ARCHS_PRI "ARM_NEON")
 if(SIMDPP_CLANG OR SIMDPP_GCC)
     set(SIMDPP_ARM_NEON_CXX_FLAGS "-mfpu=neon")
@@ -1035,6 +1545,9 @@ endfunction()
 #   X86_SSE2, X86_SSE3, X86_SSSE3, X86_SSE4_1,
 #   X86_AVX, X86_AVX2, X86_FMA3, X86_FMA4,
 #   X86_AVX512F, X86_AVX512BW, X86_AVX512DQ, X86_AVX512VL, X86_XOP,
+#   X86_AVX512VBMI, X86_AVX512VBMI2, X86_AVX512VNNI, X86_AVX512BITALG,
+#   X86_AVX512VPOPCNTDQ, X86_AVX512IFMA, X86_AVX512CD,
+#   X86_BMI1, X86_BMI2, X86_F16C, X86_GFNI, X86_VAES, X86_VPCLMULQDQ,
 #   ARM_NEON, ARM_NEON_FLT_SP, ARM64_NEON,
 #   MIPS_MSA, POWER_ALTIVEC, POWER_VSX_206, POWER_VSX_207
 #
@@ -1186,8 +1699,28 @@ function(simdpp_get_arch_perm ALL_ARCHS_VAR)
             if(DEFINED ARCH_SUPPORTED_X86_AVX512DQ)
                 if(DEFINED ARCH_SUPPORTED_X86_AVX512VL)
                     # All Intel processors that support AVX512BW also support
-                    # AVX512DQ and AVX512VL
-                    list(APPEND ALL_ARCHS "X86_AVX512F,X86_FMA3,X86_POPCNT_INSN,X86_AVX512BW,X86_AVX512DQ,X86_AVX512VL")
+                    # AVX512DQ, AVX512VL and AVX512CD
+                    set(ARCH_X86_SKX "X86_AVX512F,X86_FMA3,X86_POPCNT_INSN,X86_AVX512BW,X86_AVX512DQ,X86_AVX512VL")
+                    if(DEFINED ARCH_SUPPORTED_X86_AVX512CD)
+                        set(ARCH_X86_SKX "${ARCH_X86_SKX},X86_AVX512CD")
+                    endif()
+                    list(APPEND ALL_ARCHS "${ARCH_X86_SKX}")
+
+                    if(DEFINED ARCH_SUPPORTED_X86_AVX512VBMI AND
+                            DEFINED ARCH_SUPPORTED_X86_AVX512VBMI2 AND
+                            DEFINED ARCH_SUPPORTED_X86_AVX512VNNI AND
+                            DEFINED ARCH_SUPPORTED_X86_AVX512BITALG AND
+                            DEFINED ARCH_SUPPORTED_X86_AVX512VPOPCNTDQ AND
+                            DEFINED ARCH_SUPPORTED_X86_AVX512IFMA AND
+                            DEFINED ARCH_SUPPORTED_X86_GFNI AND
+                            DEFINED ARCH_SUPPORTED_X86_VAES AND
+                            DEFINED ARCH_SUPPORTED_X86_VPCLMULQDQ AND
+                            DEFINED ARCH_SUPPORTED_X86_BMI1 AND
+                            DEFINED ARCH_SUPPORTED_X86_BMI2 AND
+                            DEFINED ARCH_SUPPORTED_X86_F16C)
+                        # Since Ice Lake and Zen 4
+                        list(APPEND ALL_ARCHS "${ARCH_X86_SKX},X86_AVX512VBMI,X86_AVX512VBMI2,X86_AVX512VNNI,X86_AVX512BITALG,X86_AVX512VPOPCNTDQ,X86_AVX512IFMA,X86_GFNI,X86_VAES,X86_VPCLMULQDQ,X86_BMI1,X86_BMI2,X86_F16C")
+                    endif()
                 endif()
             endif()
         endif()
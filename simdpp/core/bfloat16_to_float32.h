@@ -0,0 +1,43 @@
+/*  Copyright (C) 2017  Povilas Kanapickas <povilas@radix.lt>
+
+    Distributed under the Boost Software License, Version 1.0.
+        (See accompanying file LICENSE_1_0.txt or copy at
+            http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#ifndef LIBSIMDPP_SIMDPP_CORE_BFLOAT16_TO_FLOAT32_H
+#define LIBSIMDPP_SIMDPP_CORE_BFLOAT16_TO_FLOAT32_H
+
+#ifndef LIBSIMDPP_SIMD_H
+    #error "This file must be included through simd.h"
+#endif
+
+#include <simdpp/types.h>
+#include <simdpp/detail/insn/conv_float16.h>
+
+namespace simdpp {
+namespace SIMDPP_ARCH_NAMESPACE {
+
+/** Converts bfloat16 floating-point values to 32-bit floating-point values.
+    The bfloat16 values are given as their bit patterns in 16-bit unsigned
+    integer elements.
+
+    The conversion is exact. It amounts to widening each element and shifting
+    it left by 16 bits.
+
+    @code
+    r0 = (float) a0
+    ...
+    rN = (float) aN
+    @endcode
+*/
+template<unsigned N, class E> SIMDPP_INL
+float32<N,expr_empty> bfloat16_to_float32(const uint16<N,E>& a)
+{
+    return detail::insn::i_bfloat16_to_float32(a.eval());
+}
+
+} // namespace SIMDPP_ARCH_NAMESPACE
+} // namespace simdpp
+
+#endif
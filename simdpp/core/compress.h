@@ -0,0 +1,103 @@
+/*  Copyright (C) 2017  Povilas Kanapickas <povilas@radix.lt>
+
+    Distributed under the Boost Software License, Version 1.0.
+        (See accompanying file LICENSE_1_0.txt or copy at
+            http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#ifndef LIBSIMDPP_SIMDPP_CORE_COMPRESS_H
+#define LIBSIMDPP_SIMDPP_CORE_COMPRESS_H
+
+#ifndef LIBSIMDPP_SIMD_H
+    #error "This file must be included through simd.h"
+#endif
+
+#include <simdpp/types.h>
+#include <simdpp/detail/insn/compress.h>
+
+namespace simdpp {
+namespace SIMDPP_ARCH_NAMESPACE {
+
+/** Moves the elements of @a a that are selected by @a mask to the beginning
+    of the vector preserving their order. The rest of the elements are set to
+    zero.
+
+    @code
+    j = 0
+    for (i = 0; i < N; i++)
+        if (mask(i))
+            r(j++) = a(i)
+    for (; j < N; j++)
+        r(j) = 0
+    @endcode
+
+    @par 8-bit and 16-bit elements:
+    @icost{AVX512VBMI2-AVX512VL, 1}
+    @icost{SSSE3-AVX512BW, NEON, ALTIVEC, MSA, 6-10}
+    @icost{SSE2, ~2N}
+
+    @par 32-bit and 64-bit elements:
+    @icost{AVX512VL, 1}
+    @icost{AVX2, 5}
+    @icost{SSSE3-AVX, NEON, ALTIVEC, MSA, 6-10}
+    @icost{SSE2, ~2N}
+*/
+template<unsigned N, class V, class M> SIMDPP_INL
+typename detail::get_expr_nomask<V>::empty
+        compress(const any_int8<N,V>& a, const mask_int8<N,M>& mask)
+{
+    typename detail::get_expr_nomask_nosign<V>::type ra;
+    ra = a.wrapped().eval();
+    return detail::insn::i_compress(ra, mask.wrapped().eval());
+}
+
+template<unsigned N, class V, class M> SIMDPP_INL
+typename detail::get_expr_nomask<V>::empty
+        compress(const any_int16<N,V>& a, const mask_int16<N,M>& mask)
+{
+    typename detail::get_expr_nomask_nosign<V>::type ra;
+    ra = a.wrapped().eval();
+    return detail::insn::i_compress(ra, mask.wrapped().eval());
+}
+
+template<unsigned N, class V, class M> SIMDPP_INL
+typename detail::get_expr_nomask<V>::empty
+        compress(const any_int32<N,V>& a, const mask_int32<N,M>& mask)
+{
+    typename detail::get_expr_nomask_nosign<V>::type ra;
+    ra = a.wrapped().eval();
+    return detail::insn::i_compress(ra, mask.wrapped().eval());
+}
+
+template<unsigned N, class V, class M> SIMDPP_INL
+typename detail::get_expr_nomask<V>::empty
+        compress(const any_int64<N,V>& a, const mask_int64<N,M>& mask)
+{
+    typename detail::get_expr_nomask_nosign<V>::type ra;
+    ra = a.wrapped().eval();
+    return detail::insn::i_compress(ra, mask.wrapped().eval());
+}
+
+template<unsigned N, class V, class M> SIMDPP_INL
+typename detail::get_expr_nomask<V>::empty
+        compress(const any_float32<N,V>& a, const mask_float32<N,M>& mask)
+{
+    typename detail::get_expr_nomask_nosign<V>::type ra;
+    ra = a.wrapped().eval();
+    return detail::insn::i_compress(ra, mask.wrapped().eval());
+}
+
+template<unsigned N, class V, class M> SIMDPP_INL
+typename detail::get_expr_nomask<V>::empty
+        compress(const any_float64<N,V>& a, const mask_float64<N,M>& mask)
+{
+    typename detail::get_expr_nomask_nosign<V>::type ra;
+    ra = a.wrapped().eval();
+    return detail::insn::i_compress(ra, mask.wrapped().eval());
+}
+
+} // namespace SIMDPP_ARCH_NAMESPACE
+} // namespace simdpp
+
+#endif
+
@@ -0,0 +1,102 @@
+/*  Copyright (C) 2017  Povilas Kanapickas <povilas@radix.lt>
+
+    Distributed under the Boost Software License, Version 1.0.
+        (See accompanying file LICENSE_1_0.txt or copy at
+            http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#ifndef LIBSIMDPP_SIMDPP_CORE_COMPRESS_STORE_H
+#define LIBSIMDPP_SIMDPP_CORE_COMPRESS_STORE_H
+
+#ifndef LIBSIMDPP_SIMD_H
+    #error "This file must be included through simd.h"
+#endif
+
+#include <simdpp/types.h>
+#include <simdpp/detail/insn/compress.h>
+
+namespace simdpp {
+namespace SIMDPP_ARCH_NAMESPACE {
+
+/** Stores the elements of @a a that are selected by @a mask to consecutive
+    memory locations starting at @a p, preserving their order. Returns the
+    number of stored elements. The memory past the stored elements is not
+    accessed.
+
+    @code
+    j = 0
+    for (i = 0; i < N; i++)
+        if (mask(i))
+            *(p + j++) = a(i)
+    return j
+    @endcode
+
+    @a p must be aligned to the element size.
+
+    @par 8-bit and 16-bit elements:
+    @icost{AVX512VBMI2-AVX512VL, 1-2}
+    @icost{SSE2-AVX512BW, NEON, ALTIVEC, MSA, 8-14}
+
+    @par 32-bit and 64-bit elements:
+    @icost{AVX512VL, 1-2}
+    @icost{SSE2-AVX2, NEON, ALTIVEC, MSA, 8-14}
+*/
+template<class T, unsigned N, class V, class M> SIMDPP_INL
+unsigned compress_store(T* p, const any_int8<N,V>& a, const mask_int8<N,M>& mask)
+{
+    uint8<N> ra;
+    ra = a.wrapped().eval();
+    return detail::insn::i_compress_store(reinterpret_cast<char*>(p), ra,
+                                          mask.wrapped().eval());
+}
+
+template<class T, unsigned N, class V, class M> SIMDPP_INL
+unsigned compress_store(T* p, const any_int16<N,V>& a, const mask_int16<N,M>& mask)
+{
+    uint16<N> ra;
+    ra = a.wrapped().eval();
+    return detail::insn::i_compress_store(reinterpret_cast<char*>(p), ra,
+                                          mask.wrapped().eval());
+}
+
+template<class T, unsigned N, class V, class M> SIMDPP_INL
+unsigned compress_store(T* p, const any_int32<N,V>& a, const mask_int32<N,M>& mask)
+{
+    uint32<N> ra;
+    ra = a.wrapped().eval();
+    return detail::insn::i_compress_store(reinterpret_cast<char*>(p), ra,
+                                          mask.wrapped().eval());
+}
+
+template<class T, unsigned N, class V, class M> SIMDPP_INL
+unsigned compress_store(T* p, const any_int64<N,V>& a, const mask_int64<N,M>& mask)
+{
+    uint64<N> ra;
+    ra = a.wrapped().eval();
+    return detail::insn::i_compress_store(reinterpret_cast<char*>(p), ra,
+                                          mask.wrapped().eval());
+}
+
+template<class T, unsigned N, class V, class M> SIMDPP_INL
+unsigned compress_store(T* p, const any_float32<N,V>& a, const mask_float32<N,M>& mask)
+{
+    float32<N> ra;
+    ra = a.wrapped().eval();
+    return detail::insn::i_compress_store(reinterpret_cast<char*>(p), ra,
+                                          mask.wrapped().eval());
+}
+
+template<class T, unsigned N, class V, class M> SIMDPP_INL
+unsigned compress_store(T* p, const any_float64<N,V>& a, const mask_float64<N,M>& mask)
+{
+    float64<N> ra;
+    ra = a.wrapped().eval();
+    return detail::insn::i_compress_store(reinterpret_cast<char*>(p), ra,
+                                          mask.wrapped().eval());
+}
+
+} // namespace SIMDPP_ARCH_NAMESPACE
+} // namespace simdpp
+
+#endif
+
@@ -0,0 +1,169 @@
+/*  Copyright (C) 2017  Povilas Kanapickas <povilas@radix.lt>
+
+    Distributed under the Boost Software License, Version 1.0.
+        (See accompanying file LICENSE_1_0.txt or copy at
+            http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#ifndef LIBSIMDPP_SIMDPP_CORE_DIVIDER_H
+#define LIBSIMDPP_SIMDPP_CORE_DIVIDER_H
+
+#ifndef LIBSIMDPP_SIMD_H
+    #error "This file must be included through simd.h"
+#endif
+
+#include <simdpp/setup_arch.h>
+#include <stdint.h>
+#include <type_traits>
+
+namespace simdpp {
+namespace SIMDPP_ARCH_NAMESPACE {
+namespace detail {
+
+// Returns the index of the most significant set bit of d
+template<class U> SIMDPP_INL
+unsigned divider_log2(U d)
+{
+    unsigned r = 0;
+    while (d >>= 1) {
+        r++;
+    }
+    return r;
+}
+
+// Computes (hi * 2^W) / d where W is the width of U. hi must be less than d.
+template<class U> SIMDPP_INL
+U divider_div_wide(U hi, U d, U& rem)
+{
+    const unsigned bits = sizeof(U) * 8;
+    U q = 0;
+    for (unsigned i = 0; i < bits; i++) {
+        bool carry = (hi >> (bits - 1)) != 0;
+        hi = U(hi << 1);
+        q = U(q << 1);
+        if (carry || hi >= d) {
+            hi = U(hi - d);
+            q = U(q | 1);
+        }
+    }
+    rem = hi;
+    return q;
+}
+
+} // namespace detail
+
+/** Holds precomputed constants for dividing integer vectors by a divisor that
+    stays the same over many operations. The division is then performed as a
+    multiplication by a magic number, keeping the high half of the product,
+    followed by a couple of shifts and additions. The algorithms are the same
+    as in the libdivide library.
+
+    @a T must be one of @c int8_t, @c uint8_t, @c int16_t, @c uint16_t,
+    @c int32_t, @c uint32_t, @c int64_t or @c uint64_t. The divisor must not
+    be zero.
+
+    @code
+    divider<uint32_t> d(7);
+    uint32<4> q = div(a, d);
+    uint32<4> r = mod(a, d);
+    @endcode
+
+    div() costs one high multiplication of the element width and several
+    shifts and additions. Divisors that are powers of two need only shifts.
+    mod() costs the same as div() plus a low multiplication and a subtraction.
+
+    Computing the constants costs roughly as much as several scalar divisions,
+    thus the object should be created once and reused.
+*/
+template<class T>
+class divider {
+public:
+    using element_type = T;
+    using uint_element_type = typename std::make_unsigned<T>::type;
+
+    divider() : d_(1), magic_(0), shift_(0), add_(false), negative_(false) {}
+
+    explicit divider(T d)
+    {
+        d_ = d;
+        init(d, std::is_signed<T>());
+    }
+
+    /// Returns the divisor
+    T divisor() const { return d_; }
+
+    /*  The remaining members describe the selected algorithm. A zero magic
+        number means that the absolute value of the divisor is a power of two
+        and only shifts are needed.
+    */
+    uint_element_type magic() const { return magic_; }
+    unsigned shift() const { return shift_; }
+    bool is_add() const { return add_; }
+    bool is_negative() const { return negative_; }
+
+private:
+    void init(T d, std::false_type /* is_signed */)
+    {
+        using U = uint_element_type;
+        negative_ = false;
+        add_ = false;
+        shift_ = detail::divider_log2(d);
+        if ((d & (d - 1)) == 0) {
+            magic_ = 0;
+            return;
+        }
+
+        U rem;
+        U m = detail::divider_div_wide<U>(U(U(1) << shift_), d, rem);
+        if (U(d - rem) >= U(U(1) << shift_)) {
+            // the magic number does not fit into W bits, the missing bit is
+            // added back in div()
+            U twice_rem = U(rem + rem);
+            m = U(m + m);
+            if (twice_rem >= d || twice_rem < rem) {
+                m = U(m + 1);
+            }
+            add_ = true;
+        }
+        magic_ = U(m + 1);
+    }
+
+    void init(T d, std::true_type /* is_signed */)
+    {
+        using U = uint_element_type;
+        negative_ = d < 0;
+        add_ = false;
+        U abs_d = negative_ ? U(U(0) - U(d)) : U(d);
+        shift_ = detail::divider_log2(abs_d);
+        if ((abs_d & (abs_d - 1)) == 0) {
+            magic_ = 0;
+            return;
+        }
+
+        U rem;
+        U m = detail::divider_div_wide<U>(U(U(1) << (shift_ - 1)), abs_d, rem);
+        if (U(abs_d - rem) < U(U(1) << shift_)) {
+            shift_--;
+        } else {
+            U twice_rem = U(rem + rem);
+            m = U(m + m);
+            if (twice_rem >= abs_d || twice_rem < rem) {
+                m = U(m + 1);
+            }
+            add_ = true;
+        }
+        m = U(m + 1);
+        magic_ = negative_ ? U(U(0) - m) : m;
+    }
+
+    T d_;
+    uint_element_type magic_;
+    unsigned shift_;
+    bool add_;
+    bool negative_;
+};
+
+} // namespace SIMDPP_ARCH_NAMESPACE
+} // namespace simdpp
+
+#endif
@@ -0,0 +1,127 @@
+/*  Copyright (C) 2017  Povilas Kanapickas <povilas@radix.lt>
+
+    Distributed under the Boost Software License, Version 1.0.
+        (See accompanying file LICENSE_1_0.txt or copy at
+            http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#ifndef LIBSIMDPP_SIMDPP_CORE_EXPAND_LOAD_H
+#define LIBSIMDPP_SIMDPP_CORE_EXPAND_LOAD_H
+
+#ifndef LIBSIMDPP_SIMD_H
+    #error "This file must be included through simd.h"
+#endif
+
+#include <simdpp/types.h>
+#include <simdpp/detail/insn/compress.h>
+
+namespace simdpp {
+namespace SIMDPP_ARCH_NAMESPACE {
+
+/** Loads consecutive elements starting at @a p to the elements of the result
+    that are selected by @a mask, preserving their order. The rest of the
+    elements are set to zero. This is the inverse of compress_store(). Only
+    the memory locations of the loaded elements are accessed.
+
+    @code
+    j = 0
+    for (i = 0; i < N; i++)
+        r(i) = mask(i) ? *(p + j++) : 0
+    @endcode
+
+    @a p must be aligned to the element size.
+
+    @par 8-bit and 16-bit elements:
+    @icost{AVX512VBMI2-AVX512VL, 1}
+    @icost{SSE2-AVX512BW, NEON, ALTIVEC, MSA, 8-14}
+
+    @par 32-bit and 64-bit elements:
+    @icost{AVX512VL, 1}
+    @icost{SSE2-AVX2, NEON, ALTIVEC, MSA, 8-14}
+*/
+template<unsigned N, class M> SIMDPP_INL
+uint8<N> expand_load(const uint8_t* p, const mask_int8<N,M>& mask)
+{
+    uint8<N> r;
+    detail::insn::i_expand_load(r, reinterpret_cast<const char*>(p),
+                                mask.wrapped().eval());
+    return r;
+}
+template<unsigned N, class M> SIMDPP_INL
+int8<N> expand_load(const int8_t* p, const mask_int8<N,M>& mask)
+{
+    uint8<N> r;
+    detail::insn::i_expand_load(r, reinterpret_cast<const char*>(p),
+                                mask.wrapped().eval());
+    return (int8<N>) r;
+}
+template<unsigned N, class M> SIMDPP_INL
+uint16<N> expand_load(const uint16_t* p, const mask_int16<N,M>& mask)
+{
+    uint16<N> r;
+    detail::insn::i_expand_load(r, reinterpret_cast<const char*>(p),
+                                mask.wrapped().eval());
+    return r;
+}
+template<unsigned N, class M> SIMDPP_INL
+int16<N> expand_load(const int16_t* p, const mask_int16<N,M>& mask)
+{
+    uint16<N> r;
+    detail::insn::i_expand_load(r, reinterpret_cast<const char*>(p),
+                                mask.wrapped().eval());
+    return (int16<N>) r;
+}
+template<unsigned N, class M> SIMDPP_INL
+uint32<N> expand_load(const uint32_t* p, const mask_int32<N,M>& mask)
+{
+    uint32<N> r;
+    detail::insn::i_expand_load(r, reinterpret_cast<const char*>(p),
+                                mask.wrapped().eval());
+    return r;
+}
+template<unsigned N, class M> SIMDPP_INL
+int32<N> expand_load(const int32_t* p, const mask_int32<N,M>& mask)
+{
+    uint32<N> r;
+    detail::insn::i_expand_load(r, reinterpret_cast<const char*>(p),
+                                mask.wrapped().eval());
+    return (int32<N>) r;
+}
+template<unsigned N, class M> SIMDPP_INL
+uint64<N> expand_load(const uint64_t* p, const mask_int64<N,M>& mask)
+{
+    uint64<N> r;
+    detail::insn::i_expand_load(r, reinterpret_cast<const char*>(p),
+                                mask.wrapped().eval());
+    return r;
+}
+template<unsigned N, class M> SIMDPP_INL
+int64<N> expand_load(const int64_t* p, const mask_int64<N,M>& mask)
+{
+    uint64<N> r;
+    detail::insn::i_expand_load(r, reinterpret_cast<const char*>(p),
+                                mask.wrapped().eval());
+    return (int64<N>) r;
+}
+template<unsigned N, class M> SIMDPP_INL
+float32<N> expand_load(const float* p, const mask_float32<N,M>& mask)
+{
+    float32<N> r;
+    detail::insn::i_expand_load(r, reinterpret_cast<const char*>(p),
+                                mask.wrapped().eval());
+    return r;
+}
+template<unsigned N, class M> SIMDPP_INL
+float64<N> expand_load(const double* p, const mask_float64<N,M>& mask)
+{
+    float64<N> r;
+    detail::insn::i_expand_load(r, reinterpret_cast<const char*>(p),
+                                mask.wrapped().eval());
+    return r;
+}
+
+} // namespace SIMDPP_ARCH_NAMESPACE
+} // namespace simdpp
+
+#endif
+
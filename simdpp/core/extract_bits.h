@@ -13,6 +13,7 @@
 #endif
 
 #include <simdpp/types.h>
+#include <simdpp/detail/insn/conv_to_mask.h>
 #include <simdpp/detail/insn/extract_bits.h>
 
 namespace simdpp {
@@ -59,6 +60,117 @@ uint32_t extract_bits(const uint8<32>& a)
     return detail::insn::i_extract_bits<id>(a);
 }
 
+/** Converts a mask to an integer. Bit i of the result is set if element i of
+    the mask is set. The bits past the number of elements are zero. Masks with
+    more than 64 elements are not supported.
+
+    @code
+    r = (a[0] ? 0x1 : 0) | (a[1] ? 0x2 : 0) | ... | (a[N-1] ? 1 << (N-1) : 0)
+    @endcode
+
+    SSE2-AVX2 use PMOVMSKB, MOVMSKPS or MOVMSKPD. AVX-512 reads the mask
+    register directly. NEON narrows the elements with VMOVN and sums weighted
+    bytes. Vector arrays combine the results of each native vector.
+*/
+template<unsigned N, class E> SIMDPP_INL
+uint64_t extract_mask_bits(const mask_int8<N,E>& a)
+{
+    return detail::insn::i_extract_mask_bits(a.eval());
+}
+template<unsigned N, class E> SIMDPP_INL
+uint64_t extract_mask_bits(const mask_int16<N,E>& a)
+{
+    return detail::insn::i_extract_mask_bits(a.eval());
+}
+template<unsigned N, class E> SIMDPP_INL
+uint64_t extract_mask_bits(const mask_int32<N,E>& a)
+{
+    return detail::insn::i_extract_mask_bits(a.eval());
+}
+template<unsigned N, class E> SIMDPP_INL
+uint64_t extract_mask_bits(const mask_int64<N,E>& a)
+{
+    return detail::insn::i_extract_mask_bits(a.eval());
+}
+template<unsigned N, class E> SIMDPP_INL
+uint64_t extract_mask_bits(const mask_float32<N,E>& a)
+{
+    return detail::insn::i_extract_mask_bits(a.eval());
+}
+template<unsigned N, class E> SIMDPP_INL
+uint64_t extract_mask_bits(const mask_float64<N,E>& a)
+{
+    return detail::insn::i_extract_mask_bits(a.eval());
+}
+
+/** Converts a vector to an integer. Bit i of the result is set if element i
+    of the vector is set. The values of the elements must be either all ones
+    or all zeros, otherwise the behavior is undefined.
+
+    This is equivalent to extract_mask_bits(to_mask(a)). On AVX-512 one
+    additional instruction is needed to move the vector to a mask register.
+*/
+template<unsigned N, class E> SIMDPP_INL
+uint64_t extract_mask_bits(const int8<N,E>& a)
+{
+    return detail::insn::i_extract_mask_bits(
+            detail::insn::i_to_mask(uint8<N>(a.eval())));
+}
+template<unsigned N, class E> SIMDPP_INL
+uint64_t extract_mask_bits(const uint8<N,E>& a)
+{
+    return detail::insn::i_extract_mask_bits(
+            detail::insn::i_to_mask(a.eval()));
+}
+template<unsigned N, class E> SIMDPP_INL
+uint64_t extract_mask_bits(const int16<N,E>& a)
+{
+    return detail::insn::i_extract_mask_bits(
+            detail::insn::i_to_mask(uint16<N>(a.eval())));
+}
+template<unsigned N, class E> SIMDPP_INL
+uint64_t extract_mask_bits(const uint16<N,E>& a)
+{
+    return detail::insn::i_extract_mask_bits(
+            detail::insn::i_to_mask(a.eval()));
+}
+template<unsigned N, class E> SIMDPP_INL
+uint64_t extract_mask_bits(const int32<N,E>& a)
+{
+    return detail::insn::i_extract_mask_bits(
+            detail::insn::i_to_mask(uint32<N>(a.eval())));
+}
+template<unsigned N, class E> SIMDPP_INL
+uint64_t extract_mask_bits(const uint32<N,E>& a)
+{
+    return detail::insn::i_extract_mask_bits(
+            detail::insn::i_to_mask(a.eval()));
+}
+template<unsigned N, class E> SIMDPP_INL
+uint64_t extract_mask_bits(const int64<N,E>& a)
+{
+    return detail::insn::i_extract_mask_bits(
+            detail::insn::i_to_mask(uint64<N>(a.eval())));
+}
+template<unsigned N, class E> SIMDPP_INL
+uint64_t extract_mask_bits(const uint64<N,E>& a)
+{
+    return detail::insn::i_extract_mask_bits(
+            detail::insn::i_to_mask(a.eval()));
+}
+template<unsigned N, class E> SIMDPP_INL
+uint64_t extract_mask_bits(const float32<N,E>& a)
+{
+    return detail::insn::i_extract_mask_bits(
+            detail::insn::i_to_mask(a.eval()));
+}
+template<unsigned N, class E> SIMDPP_INL
+uint64_t extract_mask_bits(const float64<N,E>& a)
+{
+    return detail::insn::i_extract_mask_bits(
+            detail::insn::i_to_mask(a.eval()));
+}
+
 } // namespace SIMDPP_ARCH_NAMESPACE
 } // namespace simdpp
 
@@ -0,0 +1,47 @@
+/*  Copyright (C) 2017  Povilas Kanapickas <povilas@radix.lt>
+
+    Distributed under the Boost Software License, Version 1.0.
+        (See accompanying file LICENSE_1_0.txt or copy at
+            http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#ifndef LIBSIMDPP_SIMDPP_CORE_F_ATAN_H
+#define LIBSIMDPP_SIMDPP_CORE_F_ATAN_H
+
+#ifndef LIBSIMDPP_SIMD_H
+    #error "This file must be included through simd.h"
+#endif
+
+#include <simdpp/types.h>
+#include <simdpp/detail/insn/f_atan.h>
+
+namespace simdpp {
+namespace SIMDPP_ARCH_NAMESPACE {
+
+/** Computes the arc tangent of each element.
+
+    @code
+    r0 = atan(a0)
+    ...
+    rN = atan(aN)
+    @endcode
+
+    The result is in range [-pi/2, pi/2]. The maximum error is 3 ULP for 32-bit
+    and 1 ULP for 64-bit values.
+*/
+template<unsigned N, class E> SIMDPP_INL
+float32<N,expr_empty> atan(const float32<N,E>& a)
+{
+    return detail::insn::i_atan(a.eval());
+}
+template<unsigned N, class E> SIMDPP_INL
+float64<N,expr_empty> atan(const float64<N,E>& a)
+{
+    return detail::insn::i_atan(a.eval());
+}
+
+} // namespace SIMDPP_ARCH_NAMESPACE
+} // namespace simdpp
+
+#endif
+
@@ -0,0 +1,49 @@
+/*  Copyright (C) 2017  Povilas Kanapickas <povilas@radix.lt>
+
+    Distributed under the Boost Software License, Version 1.0.
+        (See accompanying file LICENSE_1_0.txt or copy at
+            http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#ifndef LIBSIMDPP_SIMDPP_CORE_F_ATAN2_H
+#define LIBSIMDPP_SIMDPP_CORE_F_ATAN2_H
+
+#ifndef LIBSIMDPP_SIMD_H
+    #error "This file must be included through simd.h"
+#endif
+
+#include <simdpp/types.h>
+#include <simdpp/detail/insn/f_atan.h>
+
+namespace simdpp {
+namespace SIMDPP_ARCH_NAMESPACE {
+
+/** Computes the arc tangent of @a a / @a b using the signs of the arguments to
+    determine the quadrant of the result.
+
+    @code
+    r0 = atan2(a0, b0)
+    ...
+    rN = atan2(aN, bN)
+    @endcode
+
+    The result is in range [-pi, pi]. The maximum error is 3 ULP for 32-bit and
+    2 ULP for 64-bit values. Zero and infinite arguments are handled as
+    specified by C99.
+*/
+template<unsigned N, class E1, class E2> SIMDPP_INL
+float32<N,expr_empty> atan2(const float32<N,E1>& a, const float32<N,E2>& b)
+{
+    return detail::insn::i_atan2(a.eval(), b.eval());
+}
+template<unsigned N, class E1, class E2> SIMDPP_INL
+float64<N,expr_empty> atan2(const float64<N,E1>& a, const float64<N,E2>& b)
+{
+    return detail::insn::i_atan2(a.eval(), b.eval());
+}
+
+} // namespace SIMDPP_ARCH_NAMESPACE
+} // namespace simdpp
+
+#endif
+
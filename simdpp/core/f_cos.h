@@ -0,0 +1,47 @@
+/*  Copyright (C) 2017  Povilas Kanapickas <povilas@radix.lt>
+
+    Distributed under the Boost Software License, Version 1.0.
+        (See accompanying file LICENSE_1_0.txt or copy at
+            http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#ifndef LIBSIMDPP_SIMDPP_CORE_F_COS_H
+#define LIBSIMDPP_SIMDPP_CORE_F_COS_H
+
+#ifndef LIBSIMDPP_SIMD_H
+    #error "This file must be included through simd.h"
+#endif
+
+#include <simdpp/types.h>
+#include <simdpp/detail/insn/f_trig.h>
+
+namespace simdpp {
+namespace SIMDPP_ARCH_NAMESPACE {
+
+/** Computes the cosine of each element. The argument is in radians.
+
+    @code
+    r0 = cos(a0)
+    ...
+    rN = cos(aN)
+    @endcode
+
+    The precision and the argument range are the same as of sin(): the result
+    is NaN for |a| > 8192 (32-bit) and |a| > 2^30 (64-bit).
+*/
+template<unsigned N, class E> SIMDPP_INL
+float32<N,expr_empty> cos(const float32<N,E>& a)
+{
+    return detail::insn::i_cos(a.eval());
+}
+template<unsigned N, class E> SIMDPP_INL
+float64<N,expr_empty> cos(const float64<N,E>& a)
+{
+    return detail::insn::i_cos(a.eval());
+}
+
+} // namespace SIMDPP_ARCH_NAMESPACE
+} // namespace simdpp
+
+#endif
+
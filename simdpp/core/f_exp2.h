@@ -0,0 +1,48 @@
+/*  Copyright (C) 2017  Povilas Kanapickas <povilas@radix.lt>
+
+    Distributed under the Boost Software License, Version 1.0.
+        (See accompanying file LICENSE_1_0.txt or copy at
+            http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#ifndef LIBSIMDPP_SIMDPP_CORE_F_EXP2_H
+#define LIBSIMDPP_SIMDPP_CORE_F_EXP2_H
+
+#ifndef LIBSIMDPP_SIMD_H
+    #error "This file must be included through simd.h"
+#endif
+
+#include <simdpp/types.h>
+#include <simdpp/detail/insn/f_exp.h>
+
+namespace simdpp {
+namespace SIMDPP_ARCH_NAMESPACE {
+
+/** Computes 2 raised to the power of each element.
+
+    @code
+    r0 = exp2(a0)
+    ...
+    rN = exp2(aN)
+    @endcode
+
+    The maximum error is 1.5 ULP. Overflow results in infinity, underflow
+    produces denormals and zero. NaN inputs are propagated. See exp2_e() for a
+    faster, less precise variant.
+*/
+template<unsigned N, class E> SIMDPP_INL
+float32<N,expr_empty> exp2(const float32<N,E>& a)
+{
+    return detail::insn::i_exp2(a.eval());
+}
+template<unsigned N, class E> SIMDPP_INL
+float64<N,expr_empty> exp2(const float64<N,E>& a)
+{
+    return detail::insn::i_exp2(a.eval());
+}
+
+} // namespace SIMDPP_ARCH_NAMESPACE
+} // namespace simdpp
+
+#endif
+
@@ -0,0 +1,47 @@
+/*  Copyright (C) 2017  Povilas Kanapickas <povilas@radix.lt>
+
+    Distributed under the Boost Software License, Version 1.0.
+        (See accompanying file LICENSE_1_0.txt or copy at
+            http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#ifndef LIBSIMDPP_SIMDPP_CORE_F_EXP2_E_H
+#define LIBSIMDPP_SIMDPP_CORE_F_EXP2_E_H
+
+#ifndef LIBSIMDPP_SIMD_H
+    #error "This file must be included through simd.h"
+#endif
+
+#include <simdpp/types.h>
+#include <simdpp/detail/insn/f_exp.h>
+
+namespace simdpp {
+namespace SIMDPP_ARCH_NAMESPACE {
+
+/** Computes approximate 2 raised to the power of each element.
+
+    @code
+    r0 = approx(exp2(a0))
+    ...
+    rN = approx(exp2(aN))
+    @endcode
+
+    The relative error is below 8e-5. Special values are handled in the same
+    way as in exp2().
+*/
+template<unsigned N, class E> SIMDPP_INL
+float32<N,expr_empty> exp2_e(const float32<N,E>& a)
+{
+    return detail::insn::i_exp2_e(a.eval());
+}
+template<unsigned N, class E> SIMDPP_INL
+float64<N,expr_empty> exp2_e(const float64<N,E>& a)
+{
+    return detail::insn::i_exp2_e(a.eval());
+}
+
+} // namespace SIMDPP_ARCH_NAMESPACE
+} // namespace simdpp
+
+#endif
+
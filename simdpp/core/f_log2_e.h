@@ -0,0 +1,47 @@
+/*  Copyright (C) 2017  Povilas Kanapickas <povilas@radix.lt>
+
+    Distributed under the Boost Software License, Version 1.0.
+        (See accompanying file LICENSE_1_0.txt or copy at
+            http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#ifndef LIBSIMDPP_SIMDPP_CORE_F_LOG2_E_H
+#define LIBSIMDPP_SIMDPP_CORE_F_LOG2_E_H
+
+#ifndef LIBSIMDPP_SIMD_H
+    #error "This file must be included through simd.h"
+#endif
+
+#include <simdpp/types.h>
+#include <simdpp/detail/insn/f_log.h>
+
+namespace simdpp {
+namespace SIMDPP_ARCH_NAMESPACE {
+
+/** Computes approximate base 2 logarithm.
+
+    @code
+    r0 = approx(log2(a0))
+    ...
+    rN = approx(log2(aN))
+    @endcode
+
+    The relative error is below 6e-5. Special values are handled in the same
+    way as in log().
+*/
+template<unsigned N, class E> SIMDPP_INL
+float32<N,expr_empty> log2_e(const float32<N,E>& a)
+{
+    return detail::insn::i_log2_e(a.eval());
+}
+template<unsigned N, class E> SIMDPP_INL
+float64<N,expr_empty> log2_e(const float64<N,E>& a)
+{
+    return detail::insn::i_log2_e(a.eval());
+}
+
+} // namespace SIMDPP_ARCH_NAMESPACE
+} // namespace simdpp
+
+#endif
+
@@ -0,0 +1,56 @@
+/*  Copyright (C) 2017  Povilas Kanapickas <povilas@radix.lt>
+
+    Distributed under the Boost Software License, Version 1.0.
+        (See accompanying file LICENSE_1_0.txt or copy at
+            http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#ifndef LIBSIMDPP_SIMDPP_CORE_F_POW_H
+#define LIBSIMDPP_SIMDPP_CORE_F_POW_H
+
+#ifndef LIBSIMDPP_SIMD_H
+    #error "This file must be included through simd.h"
+#endif
+
+#include <simdpp/types.h>
+#include <simdpp/detail/insn/f_pow.h>
+
+namespace simdpp {
+namespace SIMDPP_ARCH_NAMESPACE {
+
+/** Raises the elements of @a a to the power of the corresponding elements of
+    @a b.
+
+    @code
+    r0 = pow(a0, b0)
+    ...
+    rN = pow(aN, bN)
+    @endcode
+
+    The special cases are handled as specified by C99, e.g. a negative base
+    produces NaN unless the exponent is an integer.
+
+    @par 32-bit version:
+    The computation is done in double precision. The maximum error is 1 ULP.
+
+    @par 64-bit version:
+    log2(a) and its product with b are computed in double-double precision,
+    thus the error does not grow with the magnitude of the result. The
+    maximum error is 1.5 ULP.
+*/
+template<unsigned N, class E1, class E2> SIMDPP_INL
+float32<N,expr_empty> pow(const float32<N,E1>& a, const float32<N,E2>& b)
+{
+    return detail::insn::i_pow(a.eval(), b.eval());
+}
+template<unsigned N, class E1, class E2> SIMDPP_INL
+float64<N,expr_empty> pow(const float64<N,E1>& a, const float64<N,E2>& b)
+{
+    return detail::insn::i_pow(a.eval(), b.eval());
+}
+
+} // namespace SIMDPP_ARCH_NAMESPACE
+} // namespace simdpp
+
+#endif
+
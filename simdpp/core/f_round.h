@@ -0,0 +1,54 @@
+/*  Copyright (C) 2017  Povilas Kanapickas <povilas@radix.lt>
+
+    Distributed under the Boost Software License, Version 1.0.
+        (See accompanying file LICENSE_1_0.txt or copy at
+            http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#ifndef LIBSIMDPP_SIMDPP_CORE_F_ROUND_H
+#define LIBSIMDPP_SIMDPP_CORE_F_ROUND_H
+
+#ifndef LIBSIMDPP_SIMD_H
+    #error "This file must be included through simd.h"
+#endif
+
+#include <simdpp/types.h>
+#include <simdpp/detail/insn/f_round.h>
+
+namespace simdpp {
+namespace SIMDPP_ARCH_NAMESPACE {
+
+/** Rounds the values of a vector to the nearest integer. Halfway cases are
+    rounded to the nearest even value. Note that this differs from std::round
+    which rounds halfway cases away from zero.
+
+    @code
+    r0 = nearbyint(a0)
+    ...
+    rN = nearbyint(aN)
+    @endcode
+
+    @par 128-bit version:
+    @icost{SSE2-SSSE3, 6}
+    @icost{NEON, 6}
+
+    @par 256-bit version:
+    @icost{SSE2-SSSE3, 12}
+    @icost{NEON, 12}
+    @icost{SSE4.1, ALTIVEC, 2}
+*/
+template<unsigned N, class E> SIMDPP_INL
+float32<N,expr_empty> round(const float32<N,E>& a)
+{
+    return detail::insn::i_round(a.eval());
+}
+template<unsigned N, class E> SIMDPP_INL
+float64<N,expr_empty> round(const float64<N,E>& a)
+{
+    return detail::insn::i_round(a.eval());
+}
+
+} // namespace SIMDPP_ARCH_NAMESPACE
+} // namespace simdpp
+
+#endif
@@ -0,0 +1,46 @@
+/*  Copyright (C) 2017  Povilas Kanapickas <povilas@radix.lt>
+
+    Distributed under the Boost Software License, Version 1.0.
+        (See accompanying file LICENSE_1_0.txt or copy at
+            http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#ifndef LIBSIMDPP_SIMDPP_CORE_F_SIGMOID_H
+#define LIBSIMDPP_SIMDPP_CORE_F_SIGMOID_H
+
+#ifndef LIBSIMDPP_SIMD_H
+    #error "This file must be included through simd.h"
+#endif
+
+#include <simdpp/types.h>
+#include <simdpp/detail/insn/f_tanh.h>
+
+namespace simdpp {
+namespace SIMDPP_ARCH_NAMESPACE {
+
+/** Computes the logistic sigmoid function of each element.
+
+    @code
+    r0 = 1 / (1 + exp(-a0))
+    ...
+    rN = 1 / (1 + exp(-aN))
+    @endcode
+
+    The maximum error is 2.5 ULP.
+*/
+template<unsigned N, class E> SIMDPP_INL
+float32<N,expr_empty> sigmoid(const float32<N,E>& a)
+{
+    return detail::insn::i_sigmoid(a.eval());
+}
+template<unsigned N, class E> SIMDPP_INL
+float64<N,expr_empty> sigmoid(const float64<N,E>& a)
+{
+    return detail::insn::i_sigmoid(a.eval());
+}
+
+} // namespace SIMDPP_ARCH_NAMESPACE
+} // namespace simdpp
+
+#endif
+
@@ -0,0 +1,47 @@
+/*  Copyright (C) 2017  Povilas Kanapickas <povilas@radix.lt>
+
+    Distributed under the Boost Software License, Version 1.0.
+        (See accompanying file LICENSE_1_0.txt or copy at
+            http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#ifndef LIBSIMDPP_SIMDPP_CORE_F_SIN_H
+#define LIBSIMDPP_SIMDPP_CORE_F_SIN_H
+
+#ifndef LIBSIMDPP_SIMD_H
+    #error "This file must be included through simd.h"
+#endif
+
+#include <simdpp/types.h>
+#include <simdpp/detail/insn/f_trig.h>
+
+namespace simdpp {
+namespace SIMDPP_ARCH_NAMESPACE {
+
+/** Computes the sine of each element. The argument is in radians.
+
+    @code
+    r0 = sin(a0)
+    ...
+    rN = sin(aN)
+    @endcode
+
+    The maximum error is 2.5 ULP for |a| <= 8192 (32-bit) and |a| <= 2^30
+    (64-bit). Larger arguments, infinity and NaN result in NaN.
+*/
+template<unsigned N, class E> SIMDPP_INL
+float32<N,expr_empty> sin(const float32<N,E>& a)
+{
+    return detail::insn::i_sin(a.eval());
+}
+template<unsigned N, class E> SIMDPP_INL
+float64<N,expr_empty> sin(const float64<N,E>& a)
+{
+    return detail::insn::i_sin(a.eval());
+}
+
+} // namespace SIMDPP_ARCH_NAMESPACE
+} // namespace simdpp
+
+#endif
+
@@ -0,0 +1,48 @@
+/*  Copyright (C) 2017  Povilas Kanapickas <povilas@radix.lt>
+
+    Distributed under the Boost Software License, Version 1.0.
+        (See accompanying file LICENSE_1_0.txt or copy at
+            http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#ifndef LIBSIMDPP_SIMDPP_CORE_F_SINCOS_H
+#define LIBSIMDPP_SIMDPP_CORE_F_SINCOS_H
+
+#ifndef LIBSIMDPP_SIMD_H
+    #error "This file must be included through simd.h"
+#endif
+
+#include <simdpp/types.h>
+#include <simdpp/detail/insn/f_trig.h>
+
+namespace simdpp {
+namespace SIMDPP_ARCH_NAMESPACE {
+
+/** Computes the sine and the cosine of each element at the same time. The
+    argument is in radians. The results are the same as of sin() and cos(),
+    but the range reduction is shared.
+
+    @code
+    s0 = sin(a0)    c0 = cos(a0)
+    ...
+    sN = sin(aN)    cN = cos(aN)
+    @endcode
+
+    Both results are NaN for |a| > 8192 (32-bit) and |a| > 2^30 (64-bit).
+*/
+template<unsigned N, class E> SIMDPP_INL
+void sincos(const float32<N,E>& a, float32<N>& s, float32<N>& c)
+{
+    detail::insn::i_sincos(a.eval(), s, c);
+}
+template<unsigned N, class E> SIMDPP_INL
+void sincos(const float64<N,E>& a, float64<N>& s, float64<N>& c)
+{
+    detail::insn::i_sincos(a.eval(), s, c);
+}
+
+} // namespace SIMDPP_ARCH_NAMESPACE
+} // namespace simdpp
+
+#endif
+
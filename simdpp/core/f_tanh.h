@@ -0,0 +1,46 @@
+/*  Copyright (C) 2017  Povilas Kanapickas <povilas@radix.lt>
+
+    Distributed under the Boost Software License, Version 1.0.
+        (See accompanying file LICENSE_1_0.txt or copy at
+            http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#ifndef LIBSIMDPP_SIMDPP_CORE_F_TANH_H
+#define LIBSIMDPP_SIMDPP_CORE_F_TANH_H
+
+#ifndef LIBSIMDPP_SIMD_H
+    #error "This file must be included through simd.h"
+#endif
+
+#include <simdpp/types.h>
+#include <simdpp/detail/insn/f_tanh.h>
+
+namespace simdpp {
+namespace SIMDPP_ARCH_NAMESPACE {
+
+/** Computes the hyperbolic tangent of each element.
+
+    @code
+    r0 = tanh(a0)
+    ...
+    rN = tanh(aN)
+    @endcode
+
+    The maximum error is 1.5 ULP.
+*/
+template<unsigned N, class E> SIMDPP_INL
+float32<N,expr_empty> tanh(const float32<N,E>& a)
+{
+    return detail::insn::i_tanh(a.eval());
+}
+template<unsigned N, class E> SIMDPP_INL
+float64<N,expr_empty> tanh(const float64<N,E>& a)
+{
+    return detail::insn::i_tanh(a.eval());
+}
+
+} // namespace SIMDPP_ARCH_NAMESPACE
+} // namespace simdpp
+
+#endif
+
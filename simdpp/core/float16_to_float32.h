@@ -0,0 +1,46 @@
+/*  Copyright (C) 2017  Povilas Kanapickas <povilas@radix.lt>
+
+    Distributed under the Boost Software License, Version 1.0.
+        (See accompanying file LICENSE_1_0.txt or copy at
+            http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#ifndef LIBSIMDPP_SIMDPP_CORE_FLOAT16_TO_FLOAT32_H
+#define LIBSIMDPP_SIMDPP_CORE_FLOAT16_TO_FLOAT32_H
+
+#ifndef LIBSIMDPP_SIMD_H
+    #error "This file must be included through simd.h"
+#endif
+
+#include <simdpp/types.h>
+#include <simdpp/detail/insn/conv_float16.h>
+
+namespace simdpp {
+namespace SIMDPP_ARCH_NAMESPACE {
+
+/** Converts IEEE half-precision floating-point values to 32-bit
+    floating-point values. The half-precision values are given as their bit
+    patterns in 16-bit unsigned integer elements, thus they can be loaded and
+    stored with the regular 16-bit loads and stores.
+
+    The conversion is exact. Infinities, NaNs and denormals are preserved.
+
+    @code
+    r0 = (float) a0
+    ...
+    rN = (float) aN
+    @endcode
+
+    F16C and AVX512F use a single instruction per vector. Other
+    instruction sets except NEON64 use a sequence of integer operations.
+*/
+template<unsigned N, class E> SIMDPP_INL
+float32<N,expr_empty> float16_to_float32(const uint16<N,E>& a)
+{
+    return detail::insn::i_float16_to_float32(a.eval());
+}
+
+} // namespace SIMDPP_ARCH_NAMESPACE
+} // namespace simdpp
+
+#endif
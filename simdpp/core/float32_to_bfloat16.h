@@ -0,0 +1,42 @@
+/*  Copyright (C) 2017  Povilas Kanapickas <povilas@radix.lt>
+
+    Distributed under the Boost Software License, Version 1.0.
+        (See accompanying file LICENSE_1_0.txt or copy at
+            http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#ifndef LIBSIMDPP_SIMDPP_CORE_FLOAT32_TO_BFLOAT16_H
+#define LIBSIMDPP_SIMDPP_CORE_FLOAT32_TO_BFLOAT16_H
+
+#ifndef LIBSIMDPP_SIMD_H
+    #error "This file must be included through simd.h"
+#endif
+
+#include <simdpp/types.h>
+#include <simdpp/detail/insn/conv_float16.h>
+
+namespace simdpp {
+namespace SIMDPP_ARCH_NAMESPACE {
+
+/** Converts 32-bit floating-point values to bfloat16 floating-point values.
+    The results are returned as their bit patterns in 16-bit unsigned integer
+    elements.
+
+    The values are rounded to nearest even. NaNs become quiet NaNs.
+
+    @code
+    r0 = (bfloat16) a0
+    ...
+    rN = (bfloat16) aN
+    @endcode
+*/
+template<unsigned N, class E> SIMDPP_INL
+uint16<N,expr_empty> float32_to_bfloat16(const float32<N,E>& a)
+{
+    return detail::insn::i_float32_to_bfloat16(a.eval());
+}
+
+} // namespace SIMDPP_ARCH_NAMESPACE
+} // namespace simdpp
+
+#endif
@@ -0,0 +1,46 @@
+/*  Copyright (C) 2017  Povilas Kanapickas <povilas@radix.lt>
+
+    Distributed under the Boost Software License, Version 1.0.
+        (See accompanying file LICENSE_1_0.txt or copy at
+            http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#ifndef LIBSIMDPP_SIMDPP_CORE_FLOAT32_TO_FLOAT16_H
+#define LIBSIMDPP_SIMDPP_CORE_FLOAT32_TO_FLOAT16_H
+
+#ifndef LIBSIMDPP_SIMD_H
+    #error "This file must be included through simd.h"
+#endif
+
+#include <simdpp/types.h>
+#include <simdpp/detail/insn/conv_float16.h>
+
+namespace simdpp {
+namespace SIMDPP_ARCH_NAMESPACE {
+
+/** Converts 32-bit floating-point values to IEEE half-precision
+    floating-point values. The results are returned as their bit patterns in
+    16-bit unsigned integer elements.
+
+    The values are rounded to nearest even. Values that are too large become
+    infinities and NaNs become quiet NaNs.
+
+    @code
+    r0 = (half) a0
+    ...
+    rN = (half) aN
+    @endcode
+
+    F16C and AVX512F use a single instruction per vector. Other
+    instruction sets except NEON64 use a sequence of integer operations.
+*/
+template<unsigned N, class E> SIMDPP_INL
+uint16<N,expr_empty> float32_to_float16(const float32<N,E>& a)
+{
+    return detail::insn::i_float32_to_float16(a.eval());
+}
+
+} // namespace SIMDPP_ARCH_NAMESPACE
+} // namespace simdpp
+
+#endif
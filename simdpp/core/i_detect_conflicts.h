@@ -0,0 +1,84 @@
+/*  Copyright (C) 2017  Povilas Kanapickas <povilas@radix.lt>
+
+    Distributed under the Boost Software License, Version 1.0.
+        (See accompanying file LICENSE_1_0.txt or copy at
+            http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#ifndef LIBSIMDPP_SIMDPP_CORE_I_DETECT_CONFLICTS_H
+#define LIBSIMDPP_SIMDPP_CORE_I_DETECT_CONFLICTS_H
+
+#ifndef LIBSIMDPP_SIMD_H
+    #error "This file must be included through simd.h"
+#endif
+
+#include <simdpp/types.h>
+#include <simdpp/detail/insn/i_detect_conflicts.h>
+
+namespace simdpp {
+namespace SIMDPP_ARCH_NAMESPACE {
+
+/** Detects elements that are equal to preceding elements in the vector. Bit
+    @a j of the resulting element @a i is set if @a j is less than @a i and
+    the elements @a i and @a j are equal.
+
+    @code
+    r0 = 0
+    r1 = (a1 == a0) << 0
+    r2 = (a2 == a0) << 0 | (a2 == a1) << 1
+    ...
+    rN = (aN == a0) << 0 | ... | (aN == aN-1) << (N-1)
+    @endcode
+
+    This is useful when the vector is used as the index of store_scatter()
+    and the stored values depend on the previous contents of the memory, e.g.
+    when computing histograms. Elements with zero result don't have
+    duplicates among the preceding elements and can be processed at once.
+
+    The vector must have at most 32 32-bit or 64 64-bit elements.
+
+    @par 128-bit version:
+    @icost{AVX512CD-AVX512VL, 1}
+    @icost{SSE2-AVX2, NEON, ALTIVEC, MSA, 4-16}
+
+    @par 256-bit version:
+    @icost{AVX512CD-AVX512VL, 1}
+    @icost{SSE2-AVX2, NEON, ALTIVEC, MSA, 8-40}
+
+    @par 512-bit version:
+    @icost{AVX512CD, 1}
+    @icost{SSE2-AVX2, NEON, ALTIVEC, MSA, 16-100}
+*/
+template<unsigned N, class E> SIMDPP_INL
+uint32<N,expr_empty> detect_conflicts(const uint32<N,E>& a)
+{
+    static_assert(N <= 32, "The vector has too many elements");
+    return detail::insn::i_detect_conflicts(a.eval());
+}
+
+template<unsigned N, class E> SIMDPP_INL
+int32<N,expr_empty> detect_conflicts(const int32<N,E>& a)
+{
+    static_assert(N <= 32, "The vector has too many elements");
+    return detail::insn::i_detect_conflicts(uint32<N>(a.eval()));
+}
+
+template<unsigned N, class E> SIMDPP_INL
+uint64<N,expr_empty> detect_conflicts(const uint64<N,E>& a)
+{
+    static_assert(N <= 64, "The vector has too many elements");
+    return detail::insn::i_detect_conflicts(a.eval());
+}
+
+template<unsigned N, class E> SIMDPP_INL
+int64<N,expr_empty> detect_conflicts(const int64<N,E>& a)
+{
+    static_assert(N <= 64, "The vector has too many elements");
+    return detail::insn::i_detect_conflicts(uint64<N>(a.eval()));
+}
+
+} // namespace SIMDPP_ARCH_NAMESPACE
+} // namespace simdpp
+
+#endif
+
@@ -0,0 +1,331 @@
+/*  Copyright (C) 2017  Povilas Kanapickas <povilas@radix.lt>
+
+    Distributed under the Boost Software License, Version 1.0.
+        (See accompanying file LICENSE_1_0.txt or copy at
+            http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#ifndef LIBSIMDPP_SIMDPP_CORE_I_DIV_H
+#define LIBSIMDPP_SIMDPP_CORE_I_DIV_H
+
+#ifndef LIBSIMDPP_SIMD_H
+    #error "This file must be included through simd.h"
+#endif
+
+#include <simdpp/types.h>
+#include <simdpp/core/divider.h>
+#include <simdpp/detail/insn/i_div.h>
+
+namespace simdpp {
+namespace SIMDPP_ARCH_NAMESPACE {
+
+// -----------------------------------------------------------------------------
+// division by an invariant divisor
+
+/** Divides signed 8-bit values by the divisor represented by @a d.
+
+    @code
+    r0 = a0 / d.divisor()
+    ...
+    rN = aN / d.divisor()
+    @endcode
+
+    The quotient is rounded towards zero. Dividing the smallest representable
+    value by -1 wraps around.
+
+    See divider for the cost of the operation.
+*/
+template<unsigned N, class E> SIMDPP_INL
+int8<N,expr_empty> div(const int8<N,E>& a, const divider<int8_t>& d)
+{
+    return detail::insn::i_div_signed(a.eval(), d);
+}
+
+/** Divides unsigned 8-bit values by the divisor represented by @a d.
+
+    @code
+    r0 = a0 / d.divisor()
+    ...
+    rN = aN / d.divisor()
+    @endcode
+
+    See divider for the cost of the operation.
+*/
+template<unsigned N, class E> SIMDPP_INL
+uint8<N,expr_empty> div(const uint8<N,E>& a, const divider<uint8_t>& d)
+{
+    return detail::insn::i_div_unsigned(a.eval(), d);
+}
+
+/** Divides signed 16-bit values by the divisor represented by @a d.
+
+    @code
+    r0 = a0 / d.divisor()
+    ...
+    rN = aN / d.divisor()
+    @endcode
+
+    The quotient is rounded towards zero. Dividing the smallest representable
+    value by -1 wraps around.
+
+    See divider for the cost of the operation.
+*/
+template<unsigned N, class E> SIMDPP_INL
+int16<N,expr_empty> div(const int16<N,E>& a, const divider<int16_t>& d)
+{
+    return detail::insn::i_div_signed(a.eval(), d);
+}
+
+/** Divides unsigned 16-bit values by the divisor represented by @a d.
+
+    @code
+    r0 = a0 / d.divisor()
+    ...
+    rN = aN / d.divisor()
+    @endcode
+
+    See divider for the cost of the operation.
+*/
+template<unsigned N, class E> SIMDPP_INL
+uint16<N,expr_empty> div(const uint16<N,E>& a, const divider<uint16_t>& d)
+{
+    return detail::insn::i_div_unsigned(a.eval(), d);
+}
+
+/** Divides signed 32-bit values by the divisor represented by @a d.
+
+    @code
+    r0 = a0 / d.divisor()
+    ...
+    rN = aN / d.divisor()
+    @endcode
+
+    The quotient is rounded towards zero. Dividing the smallest representable
+    value by -1 wraps around.
+
+    See divider for the cost of the operation.
+*/
+template<unsigned N, class E> SIMDPP_INL
+int32<N,expr_empty> div(const int32<N,E>& a, const divider<int32_t>& d)
+{
+    return detail::insn::i_div_signed(a.eval(), d);
+}
+
+/** Divides unsigned 32-bit values by the divisor represented by @a d.
+
+    @code
+    r0 = a0 / d.divisor()
+    ...
+    rN = aN / d.divisor()
+    @endcode
+
+    See divider for the cost of the operation.
+*/
+template<unsigned N, class E> SIMDPP_INL
+uint32<N,expr_empty> div(const uint32<N,E>& a, const divider<uint32_t>& d)
+{
+    return detail::insn::i_div_unsigned(a.eval(), d);
+}
+
+/** Divides signed 64-bit values by the divisor represented by @a d.
+
+    @code
+    r0 = a0 / d.divisor()
+    ...
+    rN = aN / d.divisor()
+    @endcode
+
+    The quotient is rounded towards zero. Dividing the smallest representable
+    value by -1 wraps around.
+
+    See divider for the cost of the operation.
+*/
+template<unsigned N, class E> SIMDPP_INL
+int64<N,expr_empty> div(const int64<N,E>& a, const divider<int64_t>& d)
+{
+    return detail::insn::i_div_signed(a.eval(), d);
+}
+
+/** Divides unsigned 64-bit values by the divisor represented by @a d.
+
+    @code
+    r0 = a0 / d.divisor()
+    ...
+    rN = aN / d.divisor()
+    @endcode
+
+    See divider for the cost of the operation.
+*/
+template<unsigned N, class E> SIMDPP_INL
+uint64<N,expr_empty> div(const uint64<N,E>& a, const divider<uint64_t>& d)
+{
+    return detail::insn::i_div_unsigned(a.eval(), d);
+}
+
+// -----------------------------------------------------------------------------
+// remainder of division by an invariant divisor
+
+/** Computes the remainder of division of signed 8-bit values by the divisor
+    represented by @a d.
+
+    @code
+    r0 = a0 % d.divisor()
+    ...
+    rN = aN % d.divisor()
+    @endcode
+
+    The remainder has the same sign as the dividend.
+
+    See divider for the cost of the operation.
+*/
+template<unsigned N, class E> SIMDPP_INL
+int8<N,expr_empty> mod(const int8<N,E>& a, const divider<int8_t>& d)
+{
+    int8<N> ra = a.eval();
+    int8<N> q = div(ra, d);
+    return detail::insn::i_mod(ra, q, d.divisor());
+}
+
+/** Computes the remainder of division of unsigned 8-bit values by the divisor
+    represented by @a d.
+
+    @code
+    r0 = a0 % d.divisor()
+    ...
+    rN = aN % d.divisor()
+    @endcode
+
+    See divider for the cost of the operation.
+*/
+template<unsigned N, class E> SIMDPP_INL
+uint8<N,expr_empty> mod(const uint8<N,E>& a, const divider<uint8_t>& d)
+{
+    uint8<N> ra = a.eval();
+    uint8<N> q = div(ra, d);
+    return detail::insn::i_mod(ra, q, d.divisor());
+}
+
+/** Computes the remainder of division of signed 16-bit values by the divisor
+    represented by @a d.
+
+    @code
+    r0 = a0 % d.divisor()
+    ...
+    rN = aN % d.divisor()
+    @endcode
+
+    The remainder has the same sign as the dividend.
+
+    See divider for the cost of the operation.
+*/
+template<unsigned N, class E> SIMDPP_INL
+int16<N,expr_empty> mod(const int16<N,E>& a, const divider<int16_t>& d)
+{
+    int16<N> ra = a.eval();
+    int16<N> q = div(ra, d);
+    return detail::insn::i_mod(ra, q, d.divisor());
+}
+
+/** Computes the remainder of division of unsigned 16-bit values by the divisor
+    represented by @a d.
+
+    @code
+    r0 = a0 % d.divisor()
+    ...
+    rN = aN % d.divisor()
+    @endcode
+
+    See divider for the cost of the operation.
+*/
+template<unsigned N, class E> SIMDPP_INL
+uint16<N,expr_empty> mod(const uint16<N,E>& a, const divider<uint16_t>& d)
+{
+    uint16<N> ra = a.eval();
+    uint16<N> q = div(ra, d);
+    return detail::insn::i_mod(ra, q, d.divisor());
+}
+
+/** Computes the remainder of division of signed 32-bit values by the divisor
+    represented by @a d.
+
+    @code
+    r0 = a0 % d.divisor()
+    ...
+    rN = aN % d.divisor()
+    @endcode
+
+    The remainder has the same sign as the dividend.
+
+    See divider for the cost of the operation.
+*/
+template<unsigned N, class E> SIMDPP_INL
+int32<N,expr_empty> mod(const int32<N,E>& a, const divider<int32_t>& d)
+{
+    int32<N> ra = a.eval();
+    int32<N> q = div(ra, d);
+    return detail::insn::i_mod(ra, q, d.divisor());
+}
+
+/** Computes the remainder of division of unsigned 32-bit values by the divisor
+    represented by @a d.
+
+    @code
+    r0 = a0 % d.divisor()
+    ...
+    rN = aN % d.divisor()
+    @endcode
+
+    See divider for the cost of the operation.
+*/
+template<unsigned N, class E> SIMDPP_INL
+uint32<N,expr_empty> mod(const uint32<N,E>& a, const divider<uint32_t>& d)
+{
+    uint32<N> ra = a.eval();
+    uint32<N> q = div(ra, d);
+    return detail::insn::i_mod(ra, q, d.divisor());
+}
+
+/** Computes the remainder of division of signed 64-bit values by the divisor
+    represented by @a d.
+
+    @code
+    r0 = a0 % d.divisor()
+    ...
+    rN = aN % d.divisor()
+    @endcode
+
+    The remainder has the same sign as the dividend.
+
+    See divider for the cost of the operation.
+*/
+template<unsigned N, class E> SIMDPP_INL
+int64<N,expr_empty> mod(const int64<N,E>& a, const divider<int64_t>& d)
+{
+    int64<N> ra = a.eval();
+    int64<N> q = div(ra, d);
+    return detail::insn::i_mod(ra, q, d.divisor());
+}
+
+/** Computes the remainder of division of unsigned 64-bit values by the divisor
+    represented by @a d.
+
+    @code
+    r0 = a0 % d.divisor()
+    ...
+    rN = aN % d.divisor()
+    @endcode
+
+    See divider for the cost of the operation.
+*/
+template<unsigned N, class E> SIMDPP_INL
+uint64<N,expr_empty> mod(const uint64<N,E>& a, const divider<uint64_t>& d)
+{
+    uint64<N> ra = a.eval();
+    uint64<N> q = div(ra, d);
+    return detail::insn::i_mod(ra, q, d.divisor());
+}
+
+} // namespace SIMDPP_ARCH_NAMESPACE
+} // namespace simdpp
+
+#endif
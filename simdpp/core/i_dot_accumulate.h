@@ -0,0 +1,102 @@
+/*  Copyright (C) 2017  Povilas Kanapickas <povilas@radix.lt>
+
+    Distributed under the Boost Software License, Version 1.0.
+        (See accompanying file LICENSE_1_0.txt or copy at
+            http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#ifndef LIBSIMDPP_SIMDPP_CORE_I_DOT_ACCUMULATE_H
+#define LIBSIMDPP_SIMDPP_CORE_I_DOT_ACCUMULATE_H
+
+#ifndef LIBSIMDPP_SIMD_H
+    #error "This file must be included through simd.h"
+#endif
+
+#include <simdpp/types.h>
+#include <simdpp/detail/insn/i_dot_accumulate.h>
+
+namespace simdpp {
+namespace SIMDPP_ARCH_NAMESPACE {
+
+/** Multiplies unsigned 8-bit values in @a a by the corresponding signed 8-bit
+    values in @a b, sums each group of four adjacent products and adds the sums
+    to the corresponding 32-bit values in @a c.
+
+    @code
+    r0 = c0 + a0*b0 + a1*b1 + a2*b2 + a3*b3
+    r1 = c1 + a4*b4 + a5*b5 + a6*b6 + a7*b7
+    ...
+    rN = cN + a(4N)*b(4N) + ... + a(4N+3)*b(4N+3)
+    @endcode
+
+    The sums of products are computed exactly. The addition to @a c wraps
+    around on overflow.
+
+    @par 128-bit version:
+    @icost{SSE2, 9}
+    @icost{SSSE3-AVX2, NEON, 6-8}
+    @icost{AVX512VNNI with AVX512VL, ALTIVEC, 1}
+
+    @par 256-bit version:
+    @icost{SSE2, 18}
+    @icost{SSSE3-AVX, NEON, 12-16}
+    @icost{AVX2, 6-8}
+    @icost{AVX512VNNI with AVX512VL, 1}
+    @icost{ALTIVEC, 2}
+
+    @par 512-bit version:
+    @icost{AVX512BW, 6-8}
+    @icost{AVX512VNNI, 1}
+*/
+template<unsigned N, class E1, class E2, class E3> SIMDPP_INL
+int32<N,expr_empty> dot_accumulate(const uint8<N*4,E1>& a,
+                                   const int8<N*4,E2>& b,
+                                   const int32<N,E3>& c)
+{
+    return detail::insn::i_dot_accumulate(a.eval(), b.eval(), c.eval());
+}
+
+/** Multiplies signed 16-bit values in @a a by the corresponding signed 16-bit
+    values in @a b, sums each pair of adjacent products and adds the sums to
+    the corresponding 32-bit values in @a c.
+
+    @code
+    r0 = c0 + a0*b0 + a1*b1
+    r1 = c1 + a2*b2 + a3*b3
+    ...
+    rN = cN + a(2N)*b(2N) + a(2N+1)*b(2N+1)
+    @endcode
+
+    The sum of the two products wraps around only if all of a(2N), b(2N),
+    a(2N+1) and b(2N+1) are equal to -32768. The addition to @a c wraps around
+    on overflow.
+
+    @par 128-bit version:
+    @icost{SSE2-AVX2, 2}
+    @icost{NEON, 5}
+    @icost{AVX512VNNI with AVX512VL, ALTIVEC, MSA, 1}
+
+    @par 256-bit version:
+    @icost{SSE2-AVX, 4}
+    @icost{AVX2, 2}
+    @icost{NEON, 10}
+    @icost{AVX512VNNI with AVX512VL, 1}
+    @icost{ALTIVEC, MSA, 2}
+
+    @par 512-bit version:
+    @icost{AVX512BW, 2}
+    @icost{AVX512VNNI, 1}
+*/
+template<unsigned N, class E1, class E2, class E3> SIMDPP_INL
+int32<N,expr_empty> dot_accumulate(const int16<N*2,E1>& a,
+                                   const int16<N*2,E2>& b,
+                                   const int32<N,E3>& c)
+{
+    return detail::insn::i_dot_accumulate(a.eval(), b.eval(), c.eval());
+}
+
+} // namespace SIMDPP_ARCH_NAMESPACE
+} // namespace simdpp
+
+#endif
+
@@ -93,6 +93,95 @@ uint16<N, expr_mul_hi<uint16<N,E1>,
 
 SIMDPP_SCALAR_ARG_IMPL_EXPR(mul_hi, expr_mul_hi, uint16, uint16)
 
+/** Multiplies signed 32-bit values and returns the higher half of the result.
+
+    @code
+    r0 = high(a0 * b0)
+    ...
+    rN = high(aN * bN)
+    @endcode
+
+    @par 128-bit version:
+    @icost{SSE4.1-AVX, 4}
+    @icost{NEON, 3}
+    @icost{SSE2-SSSE3, ALTIVEC, 10-14}
+*/
+template<unsigned N, class E1, class E2> SIMDPP_INL
+int32<N, expr_mul_hi<int32<N,E1>,
+                     int32<N,E2>>> mul_hi(const int32<N,E1>& a,
+                                          const int32<N,E2>& b)
+{
+    return { { a, b } };
+}
+
+SIMDPP_SCALAR_ARG_IMPL_EXPR(mul_hi, expr_mul_hi, int32, int32)
+
+/** Multiplies unsigned 32-bit values and returns the higher half of the
+    result.
+
+    @code
+    r0 = high(a0 * b0)
+    ...
+    rN = high(aN * bN)
+    @endcode
+
+    @par 128-bit version:
+    @icost{SSE4.1-AVX, 4}
+    @icost{SSE2-SSSE3, 8}
+    @icost{NEON, 3}
+*/
+template<unsigned N, class E1, class E2> SIMDPP_INL
+uint32<N, expr_mul_hi<uint32<N,E1>,
+                      uint32<N,E2>>> mul_hi(const uint32<N,E1>& a,
+                                            const uint32<N,E2>& b)
+{
+    return { { a, b } };
+}
+
+SIMDPP_SCALAR_ARG_IMPL_EXPR(mul_hi, expr_mul_hi, uint32, uint32)
+
+/** Multiplies signed 64-bit values and returns the higher half of the result.
+
+    @code
+    r0 = high(a0 * b0)
+    ...
+    rN = high(aN * bN)
+    @endcode
+
+    The result is computed from four 32x32->64-bit multiplications and a
+    correction for the signs of the operands.
+*/
+template<unsigned N, class E1, class E2> SIMDPP_INL
+int64<N, expr_mul_hi<int64<N,E1>,
+                     int64<N,E2>>> mul_hi(const int64<N,E1>& a,
+                                          const int64<N,E2>& b)
+{
+    return { { a, b } };
+}
+
+SIMDPP_SCALAR_ARG_IMPL_EXPR(mul_hi, expr_mul_hi, int64, int64)
+
+/** Multiplies unsigned 64-bit values and returns the higher half of the
+    result.
+
+    @code
+    r0 = high(a0 * b0)
+    ...
+    rN = high(aN * bN)
+    @endcode
+
+    The result is computed from four 32x32->64-bit multiplications.
+*/
+template<unsigned N, class E1, class E2> SIMDPP_INL
+uint64<N, expr_mul_hi<uint64<N,E1>,
+                      uint64<N,E2>>> mul_hi(const uint64<N,E1>& a,
+                                            const uint64<N,E2>& b)
+{
+    return { { a, b } };
+}
+
+SIMDPP_SCALAR_ARG_IMPL_EXPR(mul_hi, expr_mul_hi, uint64, uint64)
+
 
 /** Multiplies 32-bit values and returns the lower half of the result.
 
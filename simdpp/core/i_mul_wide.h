@@ -0,0 +1,62 @@
+/*  Copyright (C) 2017  Povilas Kanapickas <povilas@radix.lt>
+
+    Distributed under the Boost Software License, Version 1.0.
+        (See accompanying file LICENSE_1_0.txt or copy at
+            http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#ifndef LIBSIMDPP_SIMDPP_CORE_I_MUL_WIDE_H
+#define LIBSIMDPP_SIMDPP_CORE_I_MUL_WIDE_H
+
+#ifndef LIBSIMDPP_SIMD_H
+    #error "This file must be included through simd.h"
+#endif
+
+#include <simdpp/types.h>
+#include <simdpp/detail/insn/i_mul_wide.h>
+
+namespace simdpp {
+namespace SIMDPP_ARCH_NAMESPACE {
+
+/** Multiplies unsigned 64-bit values and returns the full 128-bit results as
+    a pair of vectors holding the lower and the higher halves.
+
+    @code
+    lo0 = low(a0 * b0)      hi0 = high(a0 * b0)
+    ...
+    loN = low(aN * bN)      hiN = high(aN * bN)
+    @endcode
+
+    The result is computed from four 32x32->64-bit multiplications. Use
+    mul_hi() if only the higher half is needed.
+*/
+template<unsigned N, class E1, class E2> SIMDPP_INL
+void mul_wide(const uint64<N,E1>& a, const uint64<N,E2>& b,
+              uint64<N>& lo, uint64<N>& hi)
+{
+    detail::insn::i_mul_wide(a.eval(), b.eval(), lo, hi);
+}
+
+/** Multiplies signed 64-bit values and returns the full 128-bit results as
+    a pair of vectors holding the lower and the higher halves.
+
+    @code
+    lo0 = low(a0 * b0)      hi0 = high(a0 * b0)
+    ...
+    loN = low(aN * bN)      hiN = high(aN * bN)
+    @endcode
+
+    The higher half is computed as for unsigned values and then corrected for
+    the signs of the operands.
+*/
+template<unsigned N, class E1, class E2> SIMDPP_INL
+void mul_wide(const int64<N,E1>& a, const int64<N,E2>& b,
+              int64<N>& lo, int64<N>& hi)
+{
+    detail::insn::i_mul_wide(a.eval(), b.eval(), lo, hi);
+}
+
+} // namespace SIMDPP_ARCH_NAMESPACE
+} // namespace simdpp
+
+#endif
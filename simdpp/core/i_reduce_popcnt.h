@@ -64,13 +64,13 @@ uint32_t reduce_popcnt(const uint32<N,E>& a)
 template<unsigned N, class E> SIMDPP_INL
 uint32_t reduce_popcnt(const int64<N,E>& a)
 {
-    return detail::insn::i_reduce_popcnt(uint32<N*2>(a.eval()));
+    return detail::insn::i_reduce_popcnt(uint64<N>(a.eval()));
 }
 
 template<unsigned N, class E> SIMDPP_INL
 uint32_t reduce_popcnt(const uint64<N,E>& a)
 {
-    return detail::insn::i_reduce_popcnt(uint32<N*2>(a.eval()));
+    return detail::insn::i_reduce_popcnt(a.eval());
 }
 
 } // namespace SIMDPP_ARCH_NAMESPACE
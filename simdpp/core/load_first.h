@@ -0,0 +1,55 @@
+/*  Copyright (C) 2017  Povilas Kanapickas <povilas@radix.lt>
+
+    Distributed under the Boost Software License, Version 1.0.
+        (See accompanying file LICENSE_1_0.txt or copy at
+            http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#ifndef LIBSIMDPP_SIMDPP_CORE_LOAD_FIRST_H
+#define LIBSIMDPP_SIMDPP_CORE_LOAD_FIRST_H
+
+#ifndef LIBSIMDPP_SIMD_H
+    #error "This file must be included through simd.h"
+#endif
+
+#include <simdpp/types.h>
+#include <simdpp/detail/insn/load_first.h>
+
+namespace simdpp {
+namespace SIMDPP_ARCH_NAMESPACE {
+
+/** Loads the first @a n elements of a vector from memory. The rest of the
+    elements are set to zero. @a n must be in range [0..N] where @a N is the
+    number of elements in the vector.
+
+    @code
+    for (i = 0; i < N; i++)
+        r(i) = i < n ? *(p + i) : 0
+    @endcode
+
+    @a p must be aligned to the element size. Memory past the first @a n
+    elements is accessed only if it resides in the same 4096-byte page as
+    a loaded element, thus the function is safe to use for loading the tail
+    of an array.
+
+    @par 8-bit and 16-bit elements:
+    @icost{AVX512VL, 1}
+    @icost{SSE2-AVX512BW, NEON, ALTIVEC, MSA, 3-4}
+
+    @par 32-bit and 64-bit elements:
+    @icost{AVX-AVX512VL, 1}
+    @icost{SSE2-SSE4.1, NEON, ALTIVEC, MSA, 3-4}
+*/
+template<class V, class T> SIMDPP_INL
+V load_first(const T* p, unsigned n)
+{
+    static_assert(is_vector<V>::value && !is_mask<V>::value,
+                  "V must be a non-mask vector");
+    return detail::insn::i_load_first_any<V>(reinterpret_cast<const char*>(p), n);
+}
+
+} // namespace SIMDPP_ARCH_NAMESPACE
+} // namespace simdpp
+
+#endif
+
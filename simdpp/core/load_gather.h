@@ -0,0 +1,173 @@
+/*  Copyright (C) 2017  Povilas Kanapickas <povilas@radix.lt>
+
+    Distributed under the Boost Software License, Version 1.0.
+        (See accompanying file LICENSE_1_0.txt or copy at
+            http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#ifndef LIBSIMDPP_SIMDPP_CORE_LOAD_GATHER_H
+#define LIBSIMDPP_SIMDPP_CORE_LOAD_GATHER_H
+
+#ifndef LIBSIMDPP_SIMD_H
+    #error "This file must be included through simd.h"
+#endif
+
+#include <simdpp/types.h>
+#include <simdpp/detail/insn/load_gather.h>
+
+namespace simdpp {
+namespace SIMDPP_ARCH_NAMESPACE {
+
+/** Loads elements from memory locations identified by a vector of indices.
+
+    @code
+    r0 = base[index0]
+    ...
+    rN = base[indexN]
+    @endcode
+
+    The indices are signed and are expressed in units of the element size.
+    Indices of 32-bit elements are 32-bit values and indices of 64-bit
+    elements are 64-bit values. @a base must have the alignment of the element.
+
+    @par 128-bit version:
+    @icost{AVX2-AVX512VL, 1}
+    @icost{SSE2-AVX, NEON, ALTIVEC, MSA, 2-6}
+
+    @par 256-bit version:
+    @icost{AVX2-AVX512VL, 1}
+    @icost{SSE2-AVX, NEON, ALTIVEC, MSA, 4-12}
+
+    @par 512-bit version:
+    @icost{AVX512F, 1}
+    @icost{AVX2, 2}
+    @icost{SSE2-AVX, NEON, ALTIVEC, MSA, 8-24}
+*/
+template<unsigned N, class I> SIMDPP_INL
+uint32<N> load_gather(const uint32_t* base, const any_int32<N,I>& index)
+{
+    int32<N> ri;
+    ri = index.wrapped().eval();
+    return detail::insn::i_load_gather(base, ri);
+}
+template<unsigned N, class I> SIMDPP_INL
+int32<N> load_gather(const int32_t* base, const any_int32<N,I>& index)
+{
+    int32<N> ri;
+    ri = index.wrapped().eval();
+    return (int32<N>) detail::insn::i_load_gather(
+            reinterpret_cast<const uint32_t*>(base), ri);
+}
+template<unsigned N, class I> SIMDPP_INL
+uint64<N> load_gather(const uint64_t* base, const any_int64<N,I>& index)
+{
+    int64<N> ri;
+    ri = index.wrapped().eval();
+    return detail::insn::i_load_gather(base, ri);
+}
+template<unsigned N, class I> SIMDPP_INL
+int64<N> load_gather(const int64_t* base, const any_int64<N,I>& index)
+{
+    int64<N> ri;
+    ri = index.wrapped().eval();
+    return (int64<N>) detail::insn::i_load_gather(
+            reinterpret_cast<const uint64_t*>(base), ri);
+}
+template<unsigned N, class I> SIMDPP_INL
+float32<N> load_gather(const float* base, const any_int32<N,I>& index)
+{
+    int32<N> ri;
+    ri = index.wrapped().eval();
+    return detail::insn::i_load_gather(base, ri);
+}
+template<unsigned N, class I> SIMDPP_INL
+float64<N> load_gather(const double* base, const any_int64<N,I>& index)
+{
+    int64<N> ri;
+    ri = index.wrapped().eval();
+    return detail::insn::i_load_gather(base, ri);
+}
+
+/** Loads elements from memory locations identified by a vector of indices.
+    Only the elements selected by @a mask are loaded, the rest are set to
+    zero. Memory locations corresponding to the unselected elements are not
+    accessed.
+
+    @code
+    r0 = mask0 ? base[index0] : 0
+    ...
+    rN = maskN ? base[indexN] : 0
+    @endcode
+
+    The indices are signed and are expressed in units of the element size.
+    @a base must have the alignment of the element.
+
+    @par 128-bit version:
+    @icost{AVX2-AVX512VL, 1}
+    @icost{SSE2-AVX, NEON, ALTIVEC, MSA, 4-10}
+
+    @par 256-bit version:
+    @icost{AVX2-AVX512VL, 1}
+    @icost{SSE2-AVX, NEON, ALTIVEC, MSA, 8-20}
+
+    @par 512-bit version:
+    @icost{AVX512F, 1}
+    @icost{AVX2, 2}
+    @icost{SSE2-AVX, NEON, ALTIVEC, MSA, 16-40}
+*/
+template<unsigned N, class I, class M> SIMDPP_INL
+uint32<N> load_gather_masked(const uint32_t* base, const any_int32<N,I>& index,
+                             const mask_int32<N,M>& mask)
+{
+    int32<N> ri;
+    ri = index.wrapped().eval();
+    return detail::insn::i_load_gather_masked(base, ri, mask.eval());
+}
+template<unsigned N, class I, class M> SIMDPP_INL
+int32<N> load_gather_masked(const int32_t* base, const any_int32<N,I>& index,
+                            const mask_int32<N,M>& mask)
+{
+    int32<N> ri;
+    ri = index.wrapped().eval();
+    return (int32<N>) detail::insn::i_load_gather_masked(
+            reinterpret_cast<const uint32_t*>(base), ri, mask.eval());
+}
+template<unsigned N, class I, class M> SIMDPP_INL
+uint64<N> load_gather_masked(const uint64_t* base, const any_int64<N,I>& index,
+                             const mask_int64<N,M>& mask)
+{
+    int64<N> ri;
+    ri = index.wrapped().eval();
+    return detail::insn::i_load_gather_masked(base, ri, mask.eval());
+}
+template<unsigned N, class I, class M> SIMDPP_INL
+int64<N> load_gather_masked(const int64_t* base, const any_int64<N,I>& index,
+                            const mask_int64<N,M>& mask)
+{
+    int64<N> ri;
+    ri = index.wrapped().eval();
+    return (int64<N>) detail::insn::i_load_gather_masked(
+            reinterpret_cast<const uint64_t*>(base), ri, mask.eval());
+}
+template<unsigned N, class I, class M> SIMDPP_INL
+float32<N> load_gather_masked(const float* base, const any_int32<N,I>& index,
+                              const mask_float32<N,M>& mask)
+{
+    int32<N> ri;
+    ri = index.wrapped().eval();
+    return detail::insn::i_load_gather_masked(base, ri, mask.eval());
+}
+template<unsigned N, class I, class M> SIMDPP_INL
+float64<N> load_gather_masked(const double* base, const any_int64<N,I>& index,
+                              const mask_float64<N,M>& mask)
+{
+    int64<N> ri;
+    ri = index.wrapped().eval();
+    return detail::insn::i_load_gather_masked(base, ri, mask.eval());
+}
+
+} // namespace SIMDPP_ARCH_NAMESPACE
+} // namespace simdpp
+
+#endif
+
@@ -0,0 +1,128 @@
+/*  Copyright (C) 2017  Povilas Kanapickas <povilas@radix.lt>
+
+    Distributed under the Boost Software License, Version 1.0.
+        (See accompanying file LICENSE_1_0.txt or copy at
+            http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#ifndef LIBSIMDPP_SIMDPP_CORE_LOAD_MASKED_H
+#define LIBSIMDPP_SIMDPP_CORE_LOAD_MASKED_H
+
+#ifndef LIBSIMDPP_SIMD_H
+    #error "This file must be included through simd.h"
+#endif
+
+#include <simdpp/types.h>
+#include <simdpp/detail/insn/load_masked.h>
+
+namespace simdpp {
+namespace SIMDPP_ARCH_NAMESPACE {
+
+/** Loads the elements of a vector that are selected by @a mask from memory.
+    The rest of the elements are set to zero. This is the counterpart of
+    store_masked().
+
+    @code
+    for (i = 0; i < N; i++)
+        r(i) = mask(i) ? *(p + i) : 0
+    @endcode
+
+    The pointer must be aligned to the native vector size. If no elements of
+    a native vector are selected, the corresponding memory is not accessed.
+    Otherwise, memory of unselected elements within that native vector may be
+    accessed, which never faults as such memory resides in the same page.
+
+    @par 8-bit and 16-bit elements:
+    @icost{AVX512VL, 1}
+    @icost{SSE2-AVX512BW, NEON, ALTIVEC, MSA, 3-4}
+
+    @par 32-bit and 64-bit elements:
+    @icost{AVX-AVX512VL, 1}
+    @icost{SSE2-SSE4.1, NEON, ALTIVEC, MSA, 3-4}
+*/
+template<unsigned N, class M> SIMDPP_INL
+uint8<N> load_masked(const uint8_t* p, const mask_int8<N,M>& mask)
+{
+    uint8<N> r;
+    detail::insn::i_load_masked(r, reinterpret_cast<const char*>(p),
+                                mask.wrapped().eval());
+    return r;
+}
+template<unsigned N, class M> SIMDPP_INL
+int8<N> load_masked(const int8_t* p, const mask_int8<N,M>& mask)
+{
+    uint8<N> r;
+    detail::insn::i_load_masked(r, reinterpret_cast<const char*>(p),
+                                mask.wrapped().eval());
+    return (int8<N>) r;
+}
+template<unsigned N, class M> SIMDPP_INL
+uint16<N> load_masked(const uint16_t* p, const mask_int16<N,M>& mask)
+{
+    uint16<N> r;
+    detail::insn::i_load_masked(r, reinterpret_cast<const char*>(p),
+                                mask.wrapped().eval());
+    return r;
+}
+template<unsigned N, class M> SIMDPP_INL
+int16<N> load_masked(const int16_t* p, const mask_int16<N,M>& mask)
+{
+    uint16<N> r;
+    detail::insn::i_load_masked(r, reinterpret_cast<const char*>(p),
+                                mask.wrapped().eval());
+    return (int16<N>) r;
+}
+template<unsigned N, class M> SIMDPP_INL
+uint32<N> load_masked(const uint32_t* p, const mask_int32<N,M>& mask)
+{
+    uint32<N> r;
+    detail::insn::i_load_masked(r, reinterpret_cast<const char*>(p),
+                                mask.wrapped().eval());
+    return r;
+}
+template<unsigned N, class M> SIMDPP_INL
+int32<N> load_masked(const int32_t* p, const mask_int32<N,M>& mask)
+{
+    uint32<N> r;
+    detail::insn::i_load_masked(r, reinterpret_cast<const char*>(p),
+                                mask.wrapped().eval());
+    return (int32<N>) r;
+}
+template<unsigned N, class M> SIMDPP_INL
+uint64<N> load_masked(const uint64_t* p, const mask_int64<N,M>& mask)
+{
+    uint64<N> r;
+    detail::insn::i_load_masked(r, reinterpret_cast<const char*>(p),
+                                mask.wrapped().eval());
+    return r;
+}
+template<unsigned N, class M> SIMDPP_INL
+int64<N> load_masked(const int64_t* p, const mask_int64<N,M>& mask)
+{
+    uint64<N> r;
+    detail::insn::i_load_masked(r, reinterpret_cast<const char*>(p),
+                                mask.wrapped().eval());
+    return (int64<N>) r;
+}
+template<unsigned N, class M> SIMDPP_INL
+float32<N> load_masked(const float* p, const mask_float32<N,M>& mask)
+{
+    float32<N> r;
+    detail::insn::i_load_masked(r, reinterpret_cast<const char*>(p),
+                                mask.wrapped().eval());
+    return r;
+}
+template<unsigned N, class M> SIMDPP_INL
+float64<N> load_masked(const double* p, const mask_float64<N,M>& mask)
+{
+    float64<N> r;
+    detail::insn::i_load_masked(r, reinterpret_cast<const char*>(p),
+                                mask.wrapped().eval());
+    return r;
+}
+
+} // namespace SIMDPP_ARCH_NAMESPACE
+} // namespace simdpp
+
+#endif
+
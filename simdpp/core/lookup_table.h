@@ -0,0 +1,96 @@
+/*  Copyright (C) 2017  Povilas Kanapickas <povilas@radix.lt>
+
+    Distributed under the Boost Software License, Version 1.0.
+        (See accompanying file LICENSE_1_0.txt or copy at
+            http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#ifndef LIBSIMDPP_SIMDPP_CORE_LOOKUP_TABLE_H
+#define LIBSIMDPP_SIMDPP_CORE_LOOKUP_TABLE_H
+
+#ifndef LIBSIMDPP_SIMD_H
+    #error "This file must be included through simd.h"
+#endif
+
+#include <simdpp/types.h>
+#include <simdpp/detail/insn/combine.h>
+#include <simdpp/detail/insn/lookup_table.h>
+
+namespace simdpp {
+namespace SIMDPP_ARCH_NAMESPACE {
+
+/** Looks up 8-bit elements in a table of T elements. The table is a vector
+    that may be of different width than the vector of indices. Only the low
+    log2(T) bits of each index are used.
+
+    @code
+    r0 = table[idx0 % T]
+    ...
+    rN = table[idxN % T]
+    @endcode
+
+    Tables with more than 256 elements or with a number of elements that is
+    not a power of two are not supported.
+
+    AVX512VBMI uses VPERMI2B for 128-entry tables. NEON64 uses TBL with up to
+    four table registers and TBX for each further 64 entries. Other
+    architectures look up each native part of the table using permute_bytes
+    and select the results according to the upper index bits.
+*/
+template<unsigned T, unsigned N, class E1, class E2> SIMDPP_INL
+uint8<N,expr_empty> lookup_table(const uint8<T,E1>& table, const uint8<N,E2>& idx)
+{
+    static_assert(T <= 256, "Tables with more than 256 elements are not supported");
+    static_assert((T & (T-1)) == 0, "The number of table elements must be a power of two");
+    return detail::insn::i_lookup_table(table.eval(), idx.eval());
+}
+
+template<unsigned T, unsigned N, class E1, class E2> SIMDPP_INL
+int8<N,expr_empty> lookup_table(const int8<T,E1>& table, const uint8<N,E2>& idx)
+{
+    static_assert(T <= 256, "Tables with more than 256 elements are not supported");
+    static_assert((T & (T-1)) == 0, "The number of table elements must be a power of two");
+    return (int8<N>) detail::insn::i_lookup_table(uint8<T>(table.eval()),
+                                                  idx.eval());
+}
+
+/** Looks up 8-bit elements in the concatenation of two tables of T elements
+    each. Only the low log2(2*T) bits of each index are used.
+
+    @code
+    r0 = (idx0 % 2T < T) ? table0[idx0 % 2T] : table1[idx0 % 2T - T]
+    ...
+    rN = (idxN % 2T < T) ? table0[idxN % 2T] : table1[idxN % 2T - T]
+    @endcode
+
+    Tables with more than 128 elements or with a number of elements that is
+    not a power of two are not supported.
+*/
+template<unsigned T, unsigned N, class E1, class E2, class E3> SIMDPP_INL
+uint8<N,expr_empty> lookup_table(const uint8<T,E1>& table0,
+                                 const uint8<T,E2>& table1,
+                                 const uint8<N,E3>& idx)
+{
+    static_assert(T <= 128, "Tables with more than 128 elements are not supported");
+    static_assert((T & (T-1)) == 0, "The number of table elements must be a power of two");
+    uint8<T*2> table = detail::insn::i_combine<uint8<T*2>>(table0.eval(),
+                                                           table1.eval());
+    return detail::insn::i_lookup_table(table, idx.eval());
+}
+
+template<unsigned T, unsigned N, class E1, class E2, class E3> SIMDPP_INL
+int8<N,expr_empty> lookup_table(const int8<T,E1>& table0,
+                                const int8<T,E2>& table1,
+                                const uint8<N,E3>& idx)
+{
+    static_assert(T <= 128, "Tables with more than 128 elements are not supported");
+    static_assert((T & (T-1)) == 0, "The number of table elements must be a power of two");
+    uint8<T*2> table = detail::insn::i_combine<uint8<T*2>>(uint8<T>(table0.eval()),
+                                                           uint8<T>(table1.eval()));
+    return (int8<N>) detail::insn::i_lookup_table(table, idx.eval());
+}
+
+} // namespace SIMDPP_ARCH_NAMESPACE
+} // namespace simdpp
+
+#endif
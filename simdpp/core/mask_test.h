@@ -0,0 +1,113 @@
+/*  Copyright (C) 2017  Povilas Kanapickas <povilas@radix.lt>
+
+    Distributed under the Boost Software License, Version 1.0.
+        (See accompanying file LICENSE_1_0.txt or copy at
+            http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#ifndef LIBSIMDPP_SIMDPP_CORE_MASK_TEST_H
+#define LIBSIMDPP_SIMDPP_CORE_MASK_TEST_H
+
+#ifndef LIBSIMDPP_SIMD_H
+    #error "This file must be included through simd.h"
+#endif
+
+#include <simdpp/types.h>
+#include <simdpp/detail/insn/mask_test.h>
+
+namespace simdpp {
+namespace SIMDPP_ARCH_NAMESPACE {
+
+/** Returns true if any element of a mask is set.
+
+    @code
+    r = a0 || a1 || ... || aN
+    @endcode
+
+    SSE4.1 and AVX use PTEST, AVX-512 tests the mask register directly. NEON64
+    uses VMAXV.
+*/
+template<unsigned N, class V> SIMDPP_INL
+bool any_true(const any_vec<N,V>& a)
+{
+    static_assert(is_mask<V>::value, "Only mask types are supported");
+    return detail::insn::i_any_true(a.wrapped().eval());
+}
+
+/** Returns true if all elements of a mask are set.
+
+    @code
+    r = a0 && a1 && ... && aN
+    @endcode
+
+    On non-AVX-512 architectures the mask is inverted and tested as in
+    any_true.
+*/
+template<unsigned N, class V> SIMDPP_INL
+bool all_true(const any_vec<N,V>& a)
+{
+    static_assert(is_mask<V>::value, "Only mask types are supported");
+    return detail::insn::i_all_true(a.wrapped().eval());
+}
+
+/** Returns true if no elements of a mask are set.
+
+    @code
+    r = !(a0 || a1 || ... || aN)
+    @endcode
+*/
+template<unsigned N, class V> SIMDPP_INL
+bool none_true(const any_vec<N,V>& a)
+{
+    static_assert(is_mask<V>::value, "Only mask types are supported");
+    return !detail::insn::i_any_true(a.wrapped().eval());
+}
+
+/** Returns the number of set elements in a mask.
+
+    @code
+    r = (a0 ? 1 : 0) + (a1 ? 1 : 0) + ... + (aN ? 1 : 0)
+    @endcode
+
+    The mask is converted to an integer as in extract_mask_bits and the bits
+    are counted with POPCNT if available.
+*/
+template<unsigned N, class V> SIMDPP_INL
+unsigned count_true(const any_vec<N,V>& a)
+{
+    static_assert(is_mask<V>::value, "Only mask types are supported");
+    return detail::insn::i_count_true(a.wrapped().eval());
+}
+
+/** Returns the index of the first set element of a mask, or the number of
+    elements in the mask if no elements are set.
+
+    @code
+    r = min { i : ai is set }
+    @endcode
+*/
+template<unsigned N, class V> SIMDPP_INL
+unsigned find_first_set(const any_vec<N,V>& a)
+{
+    static_assert(is_mask<V>::value, "Only mask types are supported");
+    return detail::insn::i_find_first_set(a.wrapped().eval());
+}
+
+/** Returns the index of the last set element of a mask, or the number of
+    elements in the mask if no elements are set.
+
+    @code
+    r = max { i : ai is set }
+    @endcode
+*/
+template<unsigned N, class V> SIMDPP_INL
+unsigned find_last_set(const any_vec<N,V>& a)
+{
+    static_assert(is_mask<V>::value, "Only mask types are supported");
+    return detail::insn::i_find_last_set(a.wrapped().eval());
+}
+
+} // namespace SIMDPP_ARCH_NAMESPACE
+} // namespace simdpp
+
+#endif
@@ -0,0 +1,81 @@
+/*  Copyright (C) 2017  Povilas Kanapickas <povilas@radix.lt>
+
+    Distributed under the Boost Software License, Version 1.0.
+        (See accompanying file LICENSE_1_0.txt or copy at
+            http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#ifndef LIBSIMDPP_SIMDPP_CORE_PERMUTE_BYTES_H
+#define LIBSIMDPP_SIMDPP_CORE_PERMUTE_BYTES_H
+
+#ifndef LIBSIMDPP_SIMD_H
+    #error "This file must be included through simd.h"
+#endif
+
+#include <simdpp/types.h>
+#include <simdpp/detail/get_expr.h>
+#include <simdpp/detail/insn/permute_bytes.h>
+
+namespace simdpp {
+namespace SIMDPP_ARCH_NAMESPACE {
+
+/** Selects 8-bit elements from anywhere within a vector according to runtime
+    indices. Unlike permute_bytes16, the selection is not restricted to
+    128-bit lanes. Only the low log2(N) bits of each index are used, thus the
+    vector may be used as a lookup table with N entries.
+
+    @code
+    r0 = a[idx0 % N]
+    ...
+    rN = a[idxN % N]
+    @endcode
+
+    Vectors with more than 64 elements or with a number of elements that is
+    not a power of two are not supported.
+
+    AVX512VBMI uses VPERMB. AVX512BW uses four PSHUFB and mask blends, AVX2
+    uses two PSHUFB and PBLENDVB. NEON64 uses TBL with two or four table
+    registers. Other architectures shuffle each 128-bit part of the table
+    separately and select the results according to the upper index bits.
+*/
+template<unsigned N, class V1, class E2> SIMDPP_INL
+typename detail::get_expr_nomask<V1>::empty
+    permute_bytes(const any_vec8<N,V1>& a, const uint8<N,E2>& idx)
+{
+    static_assert(N <= 64, "Vectors with more than 64 elements are not supported");
+    static_assert((N & (N-1)) == 0, "The number of elements must be a power of two");
+    uint8<N> ra = a.wrapped().eval();
+    return (typename detail::get_expr_nomask<V1>::empty)
+            detail::insn::i_permute_bytes(ra, idx.eval());
+}
+
+/** Selects 16-bit elements from anywhere within a vector according to
+    runtime indices. Only the low log2(N) bits of each index are used.
+
+    @code
+    r0 = a[idx0 % N]
+    ...
+    rN = a[idxN % N]
+    @endcode
+
+    Vectors with more than 32 elements or with a number of elements that is
+    not a power of two are not supported.
+
+    AVX512BW uses VPERMW. Other architectures convert the indices to byte
+    indices and use permute_bytes.
+*/
+template<unsigned N, class V1, class E2> SIMDPP_INL
+typename detail::get_expr_nomask<V1>::empty
+    permute_words(const any_vec16<N,V1>& a, const uint16<N,E2>& idx)
+{
+    static_assert(N <= 32, "Vectors with more than 32 elements are not supported");
+    static_assert((N & (N-1)) == 0, "The number of elements must be a power of two");
+    uint16<N> ra = a.wrapped().eval();
+    return (typename detail::get_expr_nomask<V1>::empty)
+            detail::insn::i_permute_words(ra, idx.eval());
+}
+
+} // namespace SIMDPP_ARCH_NAMESPACE
+} // namespace simdpp
+
+#endif
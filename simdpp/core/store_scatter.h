@@ -0,0 +1,207 @@
+/*  Copyright (C) 2017  Povilas Kanapickas <povilas@radix.lt>
+
+    Distributed under the Boost Software License, Version 1.0.
+        (See accompanying file LICENSE_1_0.txt or copy at
+            http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#ifndef LIBSIMDPP_SIMDPP_CORE_STORE_SCATTER_H
+#define LIBSIMDPP_SIMDPP_CORE_STORE_SCATTER_H
+
+#ifndef LIBSIMDPP_SIMD_H
+    #error "This file must be included through simd.h"
+#endif
+
+#include <simdpp/types.h>
+#include <simdpp/detail/insn/store_scatter.h>
+
+namespace simdpp {
+namespace SIMDPP_ARCH_NAMESPACE {
+
+/** Stores elements to memory locations identified by a vector of indices.
+
+    @code
+    base[index0] = a0
+    ...
+    base[indexN] = aN
+    @endcode
+
+    The indices are signed and are expressed in units of the element size.
+    Indices of 32-bit elements are 32-bit values and indices of 64-bit
+    elements are 64-bit values. @a base must have the alignment of the element.
+
+    The elements are stored in order from the first to the last. If several
+    indices are equal, the memory location receives the value of the last of
+    the corresponding elements. See detect_conflicts() for a way to handle
+    such indices.
+
+    @par 128-bit version:
+    @icost{AVX512VL, 1}
+    @icost{SSE2-AVX2, NEON, ALTIVEC, MSA, 2-6}
+
+    @par 256-bit version:
+    @icost{AVX512VL, 1}
+    @icost{SSE2-AVX2, NEON, ALTIVEC, MSA, 4-12}
+
+    @par 512-bit version:
+    @icost{AVX512F, 1}
+    @icost{SSE2-AVX2, NEON, ALTIVEC, MSA, 8-24}
+*/
+template<unsigned N, class I, class V> SIMDPP_INL
+void store_scatter(uint32_t* base, const any_int32<N,I>& index,
+                   const any_int32<N,V>& a)
+{
+    int32<N> ri;
+    uint32<N> ra;
+    ri = index.wrapped().eval();
+    ra = a.wrapped().eval();
+    detail::insn::i_store_scatter(base, ri, ra);
+}
+template<unsigned N, class I, class V> SIMDPP_INL
+void store_scatter(int32_t* base, const any_int32<N,I>& index,
+                   const any_int32<N,V>& a)
+{
+    int32<N> ri;
+    uint32<N> ra;
+    ri = index.wrapped().eval();
+    ra = a.wrapped().eval();
+    detail::insn::i_store_scatter(reinterpret_cast<uint32_t*>(base), ri, ra);
+}
+template<unsigned N, class I, class V> SIMDPP_INL
+void store_scatter(uint64_t* base, const any_int64<N,I>& index,
+                   const any_int64<N,V>& a)
+{
+    int64<N> ri;
+    uint64<N> ra;
+    ri = index.wrapped().eval();
+    ra = a.wrapped().eval();
+    detail::insn::i_store_scatter(base, ri, ra);
+}
+template<unsigned N, class I, class V> SIMDPP_INL
+void store_scatter(int64_t* base, const any_int64<N,I>& index,
+                   const any_int64<N,V>& a)
+{
+    int64<N> ri;
+    uint64<N> ra;
+    ri = index.wrapped().eval();
+    ra = a.wrapped().eval();
+    detail::insn::i_store_scatter(reinterpret_cast<uint64_t*>(base), ri, ra);
+}
+template<unsigned N, class I, class V> SIMDPP_INL
+void store_scatter(float* base, const any_int32<N,I>& index,
+                   const any_float32<N,V>& a)
+{
+    int32<N> ri;
+    float32<N> ra;
+    ri = index.wrapped().eval();
+    ra = a.wrapped().eval();
+    detail::insn::i_store_scatter(base, ri, ra);
+}
+template<unsigned N, class I, class V> SIMDPP_INL
+void store_scatter(double* base, const any_int64<N,I>& index,
+                   const any_float64<N,V>& a)
+{
+    int64<N> ri;
+    float64<N> ra;
+    ri = index.wrapped().eval();
+    ra = a.wrapped().eval();
+    detail::insn::i_store_scatter(base, ri, ra);
+}
+
+/** Stores elements to memory locations identified by a vector of indices.
+    Only the elements selected by @a mask are stored. Memory locations
+    corresponding to the unselected elements are not accessed.
+
+    @code
+    if (mask0) base[index0] = a0
+    ...
+    if (maskN) base[indexN] = aN
+    @endcode
+
+    The indices are signed and are expressed in units of the element size.
+    @a base must have the alignment of the element. If several selected
+    indices are equal, the memory location receives the value of the last of
+    the corresponding elements.
+
+    @par 128-bit version:
+    @icost{AVX512VL, 1}
+    @icost{SSE2-AVX2, NEON, ALTIVEC, MSA, 4-10}
+
+    @par 256-bit version:
+    @icost{AVX512VL, 1}
+    @icost{SSE2-AVX2, NEON, ALTIVEC, MSA, 8-20}
+
+    @par 512-bit version:
+    @icost{AVX512F, 1}
+    @icost{SSE2-AVX2, NEON, ALTIVEC, MSA, 16-40}
+*/
+template<unsigned N, class I, class V, class M> SIMDPP_INL
+void store_scatter_masked(uint32_t* base, const any_int32<N,I>& index,
+                          const any_int32<N,V>& a, const mask_int32<N,M>& mask)
+{
+    int32<N> ri;
+    uint32<N> ra;
+    ri = index.wrapped().eval();
+    ra = a.wrapped().eval();
+    detail::insn::i_store_scatter_masked(base, ri, ra, mask.eval());
+}
+template<unsigned N, class I, class V, class M> SIMDPP_INL
+void store_scatter_masked(int32_t* base, const any_int32<N,I>& index,
+                          const any_int32<N,V>& a, const mask_int32<N,M>& mask)
+{
+    int32<N> ri;
+    uint32<N> ra;
+    ri = index.wrapped().eval();
+    ra = a.wrapped().eval();
+    detail::insn::i_store_scatter_masked(reinterpret_cast<uint32_t*>(base),
+                                         ri, ra, mask.eval());
+}
+template<unsigned N, class I, class V, class M> SIMDPP_INL
+void store_scatter_masked(uint64_t* base, const any_int64<N,I>& index,
+                          const any_int64<N,V>& a, const mask_int64<N,M>& mask)
+{
+    int64<N> ri;
+    uint64<N> ra;
+    ri = index.wrapped().eval();
+    ra = a.wrapped().eval();
+    detail::insn::i_store_scatter_masked(base, ri, ra, mask.eval());
+}
+template<unsigned N, class I, class V, class M> SIMDPP_INL
+void store_scatter_masked(int64_t* base, const any_int64<N,I>& index,
+                          const any_int64<N,V>& a, const mask_int64<N,M>& mask)
+{
+    int64<N> ri;
+    uint64<N> ra;
+    ri = index.wrapped().eval();
+    ra = a.wrapped().eval();
+    detail::insn::i_store_scatter_masked(reinterpret_cast<uint64_t*>(base),
+                                         ri, ra, mask.eval());
+}
+template<unsigned N, class I, class V, class M> SIMDPP_INL
+void store_scatter_masked(float* base, const any_int32<N,I>& index,
+                          const any_float32<N,V>& a,
+                          const mask_float32<N,M>& mask)
+{
+    int32<N> ri;
+    float32<N> ra;
+    ri = index.wrapped().eval();
+    ra = a.wrapped().eval();
+    detail::insn::i_store_scatter_masked(base, ri, ra, mask.eval());
+}
+template<unsigned N, class I, class V, class M> SIMDPP_INL
+void store_scatter_masked(double* base, const any_int64<N,I>& index,
+                          const any_float64<N,V>& a,
+                          const mask_float64<N,M>& mask)
+{
+    int64<N> ri;
+    float64<N> ra;
+    ri = index.wrapped().eval();
+    ra = a.wrapped().eval();
+    detail::insn::i_store_scatter_masked(base, ri, ra, mask.eval());
+}
+
+} // namespace SIMDPP_ARCH_NAMESPACE
+} // namespace simdpp
+
+#endif
+
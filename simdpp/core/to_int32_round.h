@@ -0,0 +1,104 @@
+/*  Copyright (C) 2017  Povilas Kanapickas <povilas@radix.lt>
+
+    Distributed under the Boost Software License, Version 1.0.
+        (See accompanying file LICENSE_1_0.txt or copy at
+            http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#ifndef LIBSIMDPP_SIMDPP_CORE_TO_INT32_ROUND_H
+#define LIBSIMDPP_SIMDPP_CORE_TO_INT32_ROUND_H
+
+#ifndef LIBSIMDPP_SIMD_H
+    #error "This file must be included through simd.h"
+#endif
+
+#include <simdpp/types.h>
+#include <simdpp/detail/insn/conv_float_to_int32_round.h>
+
+namespace simdpp {
+namespace SIMDPP_ARCH_NAMESPACE {
+
+/** Converts floating-point elements within a vector to 32-bit signed values,
+    rounding to the nearest integer. Halfway cases are rounded to the nearest
+    even value.
+
+    @code
+    r0 = (int32_t) nearbyint(a0)
+    ...
+    rN = (int32_t) nearbyint(aN)
+    @endcode
+
+    If the value can not be represented in 32-bit signed integer, the behavior
+    is the same as of to_int32().
+
+    SSE2-AVX2 use CVTPS2DQ which rounds according to the current rounding
+    mode, round to nearest even by default. AVX512F uses embedded rounding.
+    NEON64 uses FCVTNS.
+*/
+template<unsigned N, class E> SIMDPP_INL
+int32<N,expr_empty> to_int32_round(const float32<N,E>& a)
+{
+    return detail::insn::i_to_int32_round(a.eval());
+}
+template<unsigned N, class E> SIMDPP_INL
+int32<N,expr_empty> to_int32_round(const float64<N,E>& a)
+{
+    return detail::insn::i_to_int32_round(a.eval());
+}
+
+/** Converts floating-point elements within a vector to 32-bit signed values,
+    rounding towards negative infinity.
+
+    @code
+    r0 = (int32_t) floor(a0)
+    ...
+    rN = (int32_t) floor(aN)
+    @endcode
+
+    If the value can not be represented in 32-bit signed integer, the behavior
+    is the same as of to_int32().
+
+    SSE2-SSSE3 adjust the result of truncating conversion. AVX512F uses
+    embedded rounding. NEON64 uses FCVTMS.
+*/
+template<unsigned N, class E> SIMDPP_INL
+int32<N,expr_empty> to_int32_floor(const float32<N,E>& a)
+{
+    return detail::insn::i_to_int32_floor(a.eval());
+}
+template<unsigned N, class E> SIMDPP_INL
+int32<N,expr_empty> to_int32_floor(const float64<N,E>& a)
+{
+    return detail::insn::i_to_int32_floor(a.eval());
+}
+
+/** Converts floating-point elements within a vector to 32-bit signed values,
+    rounding towards positive infinity.
+
+    @code
+    r0 = (int32_t) ceil(a0)
+    ...
+    rN = (int32_t) ceil(aN)
+    @endcode
+
+    If the value can not be represented in 32-bit signed integer, the behavior
+    is the same as of to_int32().
+
+    SSE2-SSSE3 adjust the result of truncating conversion. AVX512F uses
+    embedded rounding. NEON64 uses FCVTPS.
+*/
+template<unsigned N, class E> SIMDPP_INL
+int32<N,expr_empty> to_int32_ceil(const float32<N,E>& a)
+{
+    return detail::insn::i_to_int32_ceil(a.eval());
+}
+template<unsigned N, class E> SIMDPP_INL
+int32<N,expr_empty> to_int32_ceil(const float64<N,E>& a)
+{
+    return detail::insn::i_to_int32_ceil(a.eval());
+}
+
+} // namespace SIMDPP_ARCH_NAMESPACE
+} // namespace simdpp
+
+#endif
@@ -0,0 +1,99 @@
+/*  Copyright (C) 2017  Povilas Kanapickas <povilas@radix.lt>
+
+    Distributed under the Boost Software License, Version 1.0.
+        (See accompanying file LICENSE_1_0.txt or copy at
+            http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#ifndef LIBSIMDPP_SIMDPP_CORE_TO_INT32_SAT_H
+#define LIBSIMDPP_SIMDPP_CORE_TO_INT32_SAT_H
+
+#ifndef LIBSIMDPP_SIMD_H
+    #error "This file must be included through simd.h"
+#endif
+
+#include <simdpp/types.h>
+#include <simdpp/detail/insn/conv_float_to_int32_round.h>
+#include <simdpp/detail/insn/conv_shrink_sat_to_int32.h>
+
+namespace simdpp {
+namespace SIMDPP_ARCH_NAMESPACE {
+
+/** Converts elements within a vector to 32-bit signed values. Values that are
+    out of range of the destination type are saturated.
+
+    @code
+    r0 = clamp(a0, -0x80000000, 0x7fffffff)
+    ...
+    rN = clamp(aN, -0x80000000, 0x7fffffff)
+    @endcode
+
+    The source elements may be signed or unsigned 64-bit integers.
+
+    AVX512F uses VPMOVSQD. NEON uses VQMOVN. Other instruction sets compare
+    the high halves of the source elements.
+*/
+template<unsigned N, class E> SIMDPP_INL
+int32<N,expr_empty> to_int32_sat(const int64<N,E>& a)
+{
+    return detail::insn::i_to_int32_sat(a.eval());
+}
+template<unsigned N, class E> SIMDPP_INL
+int32<N,expr_empty> to_int32_sat(const uint64<N,E>& a)
+{
+    return detail::insn::i_to_int32_sat(a.eval());
+}
+
+/** Converts floating-point elements within a vector to 32-bit signed values,
+    truncating towards zero. Values that are out of range of the destination
+    type are saturated. NaNs are converted to zero.
+
+    @code
+    r0 = isnan(a0) ? 0 : (int32_t) clamp(trunc(a0), -0x80000000, 0x7fffffff)
+    ...
+    rN = isnan(aN) ? 0 : (int32_t) clamp(trunc(aN), -0x80000000, 0x7fffffff)
+    @endcode
+
+    x86 fixes up the 0x80000000 value returned by CVTTPS2DQ for out of range
+    inputs. NEON and ALTIVEC conversion instructions saturate natively.
+*/
+template<unsigned N, class E> SIMDPP_INL
+int32<N,expr_empty> to_int32_sat(const float32<N,E>& a)
+{
+    return detail::insn::i_to_int32_sat(a.eval());
+}
+template<unsigned N, class E> SIMDPP_INL
+int32<N,expr_empty> to_int32_sat(const float64<N,E>& a)
+{
+    return detail::insn::i_to_int32_sat(a.eval());
+}
+
+/** Converts elements within a vector to 32-bit unsigned values. Values that
+    are out of range of the destination type are saturated.
+
+    @code
+    r0 = clamp(a0, 0x0, 0xffffffff)
+    ...
+    rN = clamp(aN, 0x0, 0xffffffff)
+    @endcode
+
+    The source elements may be signed or unsigned 64-bit integers.
+
+    AVX512F uses VPMOVUSQD. NEON uses VQMOVN and VQMOVUN. Other instruction
+    sets compare the high halves of the source elements.
+*/
+template<unsigned N, class E> SIMDPP_INL
+uint32<N,expr_empty> to_uint32_sat(const int64<N,E>& a)
+{
+    return detail::insn::i_to_uint32_sat(a.eval());
+}
+template<unsigned N, class E> SIMDPP_INL
+uint32<N,expr_empty> to_uint32_sat(const uint64<N,E>& a)
+{
+    return detail::insn::i_to_uint32_sat(a.eval());
+}
+
+} // namespace SIMDPP_ARCH_NAMESPACE
+} // namespace simdpp
+
+#endif
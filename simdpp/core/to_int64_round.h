@@ -0,0 +1,129 @@
+/*  Copyright (C) 2017  Povilas Kanapickas <povilas@radix.lt>
+
+    Distributed under the Boost Software License, Version 1.0.
+        (See accompanying file LICENSE_1_0.txt or copy at
+            http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#ifndef LIBSIMDPP_SIMDPP_CORE_TO_INT64_ROUND_H
+#define LIBSIMDPP_SIMDPP_CORE_TO_INT64_ROUND_H
+
+#ifndef LIBSIMDPP_SIMD_H
+    #error "This file must be included through simd.h"
+#endif
+
+#include <simdpp/types.h>
+#include <simdpp/capabilities.h>
+#include <simdpp/detail/insn/conv_float_to_int64_round.h>
+#include <simdpp/detail/not_implemented.h>
+
+namespace simdpp {
+namespace SIMDPP_ARCH_NAMESPACE {
+
+/** Converts floating-point elements within a vector to 64-bit signed values,
+    rounding to the nearest integer. Halfway cases are rounded to the nearest
+    even value.
+
+    @code
+    r0 = (int64_t) nearbyint(a0)
+    ...
+    rN = (int64_t) nearbyint(aN)
+    @endcode
+
+    If the value can not be represented in 64-bit signed integer, the behavior
+    is the same as of to_int64(). The function is available only if the
+    corresponding to_int64() conversion is available.
+
+    AVX512DQ uses embedded rounding. NEON64 uses FCVTNS.
+*/
+template<unsigned N, class E> SIMDPP_INL
+int64<N,expr_empty> to_int64_round(const float32<N,E>& a)
+{
+#if SIMDPP_HAS_FLOAT32_TO_INT64_CONVERSION
+    return detail::insn::i_to_int64_round(a.eval());
+#else
+    return SIMDPP_NOT_IMPLEMENTED_TEMPLATE1(E, a);
+#endif
+}
+template<unsigned N, class E> SIMDPP_INL
+int64<N,expr_empty> to_int64_round(const float64<N,E>& a)
+{
+#if SIMDPP_HAS_FLOAT64_TO_INT64_CONVERSION
+    return detail::insn::i_to_int64_round(a.eval());
+#else
+    return SIMDPP_NOT_IMPLEMENTED_TEMPLATE1(E, a);
+#endif
+}
+
+/** Converts floating-point elements within a vector to 64-bit signed values,
+    rounding towards negative infinity.
+
+    @code
+    r0 = (int64_t) floor(a0)
+    ...
+    rN = (int64_t) floor(aN)
+    @endcode
+
+    If the value can not be represented in 64-bit signed integer, the behavior
+    is the same as of to_int64(). The function is available only if the
+    corresponding to_int64() conversion is available.
+
+    AVX512DQ uses embedded rounding. NEON64 uses FCVTMS.
+*/
+template<unsigned N, class E> SIMDPP_INL
+int64<N,expr_empty> to_int64_floor(const float32<N,E>& a)
+{
+#if SIMDPP_HAS_FLOAT32_TO_INT64_CONVERSION
+    return detail::insn::i_to_int64_floor(a.eval());
+#else
+    return SIMDPP_NOT_IMPLEMENTED_TEMPLATE1(E, a);
+#endif
+}
+template<unsigned N, class E> SIMDPP_INL
+int64<N,expr_empty> to_int64_floor(const float64<N,E>& a)
+{
+#if SIMDPP_HAS_FLOAT64_TO_INT64_CONVERSION
+    return detail::insn::i_to_int64_floor(a.eval());
+#else
+    return SIMDPP_NOT_IMPLEMENTED_TEMPLATE1(E, a);
+#endif
+}
+
+/** Converts floating-point elements within a vector to 64-bit signed values,
+    rounding towards positive infinity.
+
+    @code
+    r0 = (int64_t) ceil(a0)
+    ...
+    rN = (int64_t) ceil(aN)
+    @endcode
+
+    If the value can not be represented in 64-bit signed integer, the behavior
+    is the same as of to_int64(). The function is available only if the
+    corresponding to_int64() conversion is available.
+
+    AVX512DQ uses embedded rounding. NEON64 uses FCVTPS.
+*/
+template<unsigned N, class E> SIMDPP_INL
+int64<N,expr_empty> to_int64_ceil(const float32<N,E>& a)
+{
+#if SIMDPP_HAS_FLOAT32_TO_INT64_CONVERSION
+    return detail::insn::i_to_int64_ceil(a.eval());
+#else
+    return SIMDPP_NOT_IMPLEMENTED_TEMPLATE1(E, a);
+#endif
+}
+template<unsigned N, class E> SIMDPP_INL
+int64<N,expr_empty> to_int64_ceil(const float64<N,E>& a)
+{
+#if SIMDPP_HAS_FLOAT64_TO_INT64_CONVERSION
+    return detail::insn::i_to_int64_ceil(a.eval());
+#else
+    return SIMDPP_NOT_IMPLEMENTED_TEMPLATE1(E, a);
+#endif
+}
+
+} // namespace SIMDPP_ARCH_NAMESPACE
+} // namespace simdpp
+
+#endif
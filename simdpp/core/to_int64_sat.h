@@ -0,0 +1,61 @@
+/*  Copyright (C) 2017  Povilas Kanapickas <povilas@radix.lt>
+
+    Distributed under the Boost Software License, Version 1.0.
+        (See accompanying file LICENSE_1_0.txt or copy at
+            http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#ifndef LIBSIMDPP_SIMDPP_CORE_TO_INT64_SAT_H
+#define LIBSIMDPP_SIMDPP_CORE_TO_INT64_SAT_H
+
+#ifndef LIBSIMDPP_SIMD_H
+    #error "This file must be included through simd.h"
+#endif
+
+#include <simdpp/types.h>
+#include <simdpp/capabilities.h>
+#include <simdpp/detail/insn/conv_float_to_int64_round.h>
+#include <simdpp/detail/not_implemented.h>
+
+namespace simdpp {
+namespace SIMDPP_ARCH_NAMESPACE {
+
+/** Converts floating-point elements within a vector to 64-bit signed values,
+    truncating towards zero. Values that are out of range of the destination
+    type are saturated. NaNs are converted to zero.
+
+    @code
+    r0 = isnan(a0) ? 0 : (int64_t) clamp(trunc(a0), -2^63, 2^63-1)
+    ...
+    rN = isnan(aN) ? 0 : (int64_t) clamp(trunc(aN), -2^63, 2^63-1)
+    @endcode
+
+    The function is available only if the corresponding to_int64() conversion
+    is available.
+
+    AVX512DQ fixes up the 0x8000000000000000 value returned by VCVTTPD2QQ for
+    out of range inputs. NEON64 conversion instructions saturate natively.
+*/
+template<unsigned N, class E> SIMDPP_INL
+int64<N,expr_empty> to_int64_sat(const float32<N,E>& a)
+{
+#if SIMDPP_HAS_FLOAT32_TO_INT64_CONVERSION
+    return detail::insn::i_to_int64_sat(a.eval());
+#else
+    return SIMDPP_NOT_IMPLEMENTED_TEMPLATE1(E, a);
+#endif
+}
+template<unsigned N, class E> SIMDPP_INL
+int64<N,expr_empty> to_int64_sat(const float64<N,E>& a)
+{
+#if SIMDPP_HAS_FLOAT64_TO_INT64_CONVERSION
+    return detail::insn::i_to_int64_sat(a.eval());
+#else
+    return SIMDPP_NOT_IMPLEMENTED_TEMPLATE1(E, a);
+#endif
+}
+
+} // namespace SIMDPP_ARCH_NAMESPACE
+} // namespace simdpp
+
+#endif
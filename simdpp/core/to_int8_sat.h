@@ -0,0 +1,118 @@
+/*  Copyright (C) 2017  Povilas Kanapickas <povilas@radix.lt>
+
+    Distributed under the Boost Software License, Version 1.0.
+        (See accompanying file LICENSE_1_0.txt or copy at
+            http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#ifndef LIBSIMDPP_SIMDPP_CORE_TO_INT8_SAT_H
+#define LIBSIMDPP_SIMDPP_CORE_TO_INT8_SAT_H
+
+#ifndef LIBSIMDPP_SIMD_H
+    #error "This file must be included through simd.h"
+#endif
+
+#include <simdpp/types.h>
+#include <simdpp/detail/insn/conv_shrink_sat_to_int8.h>
+
+namespace simdpp {
+namespace SIMDPP_ARCH_NAMESPACE {
+
+/** Converts elements within a vector to 8-bit signed values. Values that are
+    out of range of the destination type are saturated.
+
+    @code
+    r0 = clamp(a0, -0x80, 0x7f)
+    ...
+    rN = clamp(aN, -0x80, 0x7f)
+    @endcode
+
+    The source elements may be signed or unsigned 16, 32 or 64-bit integers.
+    Wider source elements are saturated in several steps, each halving the
+    width.
+
+    x86 uses PACKSSWB for 16-bit source elements. AVX512BW uses VPMOVSWB.
+    NEON uses VQMOVN.
+*/
+template<unsigned N, class E> SIMDPP_INL
+int8<N,expr_empty> to_int8_sat(const int16<N,E>& a)
+{
+    return detail::insn::i_to_int8_sat(a.eval());
+}
+template<unsigned N, class E> SIMDPP_INL
+int8<N,expr_empty> to_int8_sat(const uint16<N,E>& a)
+{
+    return detail::insn::i_to_int8_sat(a.eval());
+}
+template<unsigned N, class E> SIMDPP_INL
+int8<N,expr_empty> to_int8_sat(const int32<N,E>& a)
+{
+    return detail::insn::i_to_int8_sat(a.eval());
+}
+template<unsigned N, class E> SIMDPP_INL
+int8<N,expr_empty> to_int8_sat(const uint32<N,E>& a)
+{
+    return detail::insn::i_to_int8_sat(a.eval());
+}
+template<unsigned N, class E> SIMDPP_INL
+int8<N,expr_empty> to_int8_sat(const int64<N,E>& a)
+{
+    return detail::insn::i_to_int8_sat(a.eval());
+}
+template<unsigned N, class E> SIMDPP_INL
+int8<N,expr_empty> to_int8_sat(const uint64<N,E>& a)
+{
+    return detail::insn::i_to_int8_sat(a.eval());
+}
+
+/** Converts elements within a vector to 8-bit unsigned values. Values that
+    are out of range of the destination type are saturated.
+
+    @code
+    r0 = clamp(a0, 0x0, 0xff)
+    ...
+    rN = clamp(aN, 0x0, 0xff)
+    @endcode
+
+    The source elements may be signed or unsigned 16, 32 or 64-bit integers.
+    Wider source elements are saturated in several steps, each halving the
+    width.
+
+    x86 uses PACKUSWB for signed 16-bit source elements. AVX512BW uses
+    VPMOVUSWB. NEON uses VQMOVN and VQMOVUN.
+*/
+template<unsigned N, class E> SIMDPP_INL
+uint8<N,expr_empty> to_uint8_sat(const int16<N,E>& a)
+{
+    return detail::insn::i_to_uint8_sat(a.eval());
+}
+template<unsigned N, class E> SIMDPP_INL
+uint8<N,expr_empty> to_uint8_sat(const uint16<N,E>& a)
+{
+    return detail::insn::i_to_uint8_sat(a.eval());
+}
+template<unsigned N, class E> SIMDPP_INL
+uint8<N,expr_empty> to_uint8_sat(const int32<N,E>& a)
+{
+    return detail::insn::i_to_uint8_sat(a.eval());
+}
+template<unsigned N, class E> SIMDPP_INL
+uint8<N,expr_empty> to_uint8_sat(const uint32<N,E>& a)
+{
+    return detail::insn::i_to_uint8_sat(a.eval());
+}
+template<unsigned N, class E> SIMDPP_INL
+uint8<N,expr_empty> to_uint8_sat(const int64<N,E>& a)
+{
+    return detail::insn::i_to_uint8_sat(a.eval());
+}
+template<unsigned N, class E> SIMDPP_INL
+uint8<N,expr_empty> to_uint8_sat(const uint64<N,E>& a)
+{
+    return detail::insn::i_to_uint8_sat(a.eval());
+}
+
+} // namespace SIMDPP_ARCH_NAMESPACE
+} // namespace simdpp
+
+#endif
@@ -0,0 +1,1454 @@
+/*  Copyright (C) 2017  Povilas Kanapickas <povilas@radix.lt>
+
+    Distributed under the Boost Software License, Version 1.0.
+        (See accompanying file LICENSE_1_0.txt or copy at
+            http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#ifndef LIBSIMDPP_SIMDPP_DETAIL_INSN_COMPRESS_H
+#define LIBSIMDPP_SIMDPP_DETAIL_INSN_COMPRESS_H
+
+#ifndef LIBSIMDPP_SIMD_H
+    #error "This file must be included through simd.h"
+#endif
+
+#include <simdpp/types.h>
+#include <simdpp/core/bit_or.h>
+#include <simdpp/core/cast.h>
+#include <simdpp/core/combine.h>
+#include <simdpp/core/i_add_sat.h>
+#include <simdpp/core/load.h>
+#include <simdpp/core/load_splat.h>
+#include <simdpp/core/load_u.h>
+#include <simdpp/core/make_uint.h>
+#include <simdpp/core/permute_zbytes16.h>
+#include <simdpp/core/split.h>
+#include <simdpp/core/store.h>
+#include <simdpp/core/store_u.h>
+#include <simdpp/core/zip_lo.h>
+#include <simdpp/detail/insn/extract_bits.h>
+#include <simdpp/detail/mem_block.h>
+#include <cstring>
+
+namespace simdpp {
+namespace SIMDPP_ARCH_NAMESPACE {
+namespace detail {
+namespace insn {
+
+/*  The compress operations work on the mask converted to an integer by
+    i_extract_mask_bits. Where the instruction set has no native compress
+    instruction, the 128-bit vectors are permuted using permute_zbytes16 with
+    the byte indices computed from the following tables. Each table has an
+    entry for each combination of 8 mask bits.
+
+    The entries of the compress table contain the indices of the set bits in
+    ascending order. The entries of the expand table contain the number of
+    lower set bits for each set bit. In both tables the remaining bytes are
+    set to 0x80, which causes permute_zbytes16 to zero the corresponding
+    bytes.
+*/
+static SIMDPP_INL
+const uint8_t* compress_table_entry(unsigned bits)
+{
+    static const uint8_t SIMDPP_ALIGN(8) table[256][8] = {
+        {0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80},
+        {0x00,0x80,0x80,0x80,0x80,0x80,0x80,0x80},
+        {0x01,0x80,0x80,0x80,0x80,0x80,0x80,0x80},
+        {0x00,0x01,0x80,0x80,0x80,0x80,0x80,0x80},
+        {0x02,0x80,0x80,0x80,0x80,0x80,0x80,0x80},
+        {0x00,0x02,0x80,0x80,0x80,0x80,0x80,0x80},
+        {0x01,0x02,0x80,0x80,0x80,0x80,0x80,0x80},
+        {0x00,0x01,0x02,0x80,0x80,0x80,0x80,0x80},
+        {0x03,0x80,0x80,0x80,0x80,0x80,0x80,0x80},
+        {0x00,0x03,0x80,0x80,0x80,0x80,0x80,0x80},
+        {0x01,0x03,0x80,0x80,0x80,0x80,0x80,0x80},
+        {0x00,0x01,0x03,0x80,0x80,0x80,0x80,0x80},
+        {0x02,0x03,0x80,0x80,0x80,0x80,0x80,0x80},
+        {0x00,0x02,0x03,0x80,0x80,0x80,0x80,0x80},
+        {0x01,0x02,0x03,0x80,0x80,0x80,0x80,0x80},
+        {0x00,0x01,0x02,0x03,0x80,0x80,0x80,0x80},
+        {0x04,0x80,0x80,0x80,0x80,0x80,0x80,0x80},
+        {0x00,0x04,0x80,0x80,0x80,0x80,0x80,0x80},
+        {0x01,0x04,0x80,0x80,0x80,0x80,0x80,0x80},
+        {0x00,0x01,0x04,0x80,0x80,0x80,0x80,0x80},
+        {0x02,0x04,0x80,0x80,0x80,0x80,0x80,0x80},
+        {0x00,0x02,0x04,0x80,0x80,0x80,0x80,0x80},
+        {0x01,0x02,0x04,0x80,0x80,0x80,0x80,0x80},
+        {0x00,0x01,0x02,0x04,0x80,0x80,0x80,0x80},
+        {0x03,0x04,0x80,0x80,0x80,0x80,0x80,0x80},
+        {0x00,0x03,0x04,0x80,0x80,0x80,0x80,0x80},
+        {0x01,0x03,0x04,0x80,0x80,0x80,0x80,0x80},
+        {0x00,0x01,0x03,0x04,0x80,0x80,0x80,0x80},
+        {0x02,0x03,0x04,0x80,0x80,0x80,0x80,0x80},
+        {0x00,0x02,0x03,0x04,0x80,0x80,0x80,0x80},
+        {0x01,0x02,0x03,0x04,0x80,0x80,0x80,0x80},
+        {0x00,0x01,0x02,0x03,0x04,0x80,0x80,0x80},
+        {0x05,0x80,0x80,0x80,0x80,0x80,0x80,0x80},
+        {0x00,0x05,0x80,0x80,0x80,0x80,0x80,0x80},
+        {0x01,0x05,0x80,0x80,0x80,0x80,0x80,0x80},
+        {0x00,0x01,0x05,0x80,0x80,0x80,0x80,0x80},
+        {0x02,0x05,0x80,0x80,0x80,0x80,0x80,0x80},
+        {0x00,0x02,0x05,0x80,0x80,0x80,0x80,0x80},
+        {0x01,0x02,0x05,0x80,0x80,0x80,0x80,0x80},
+        {0x00,0x01,0x02,0x05,0x80,0x80,0x80,0x80},
+        {0x03,0x05,0x80,0x80,0x80,0x80,0x80,0x80},
+        {0x00,0x03,0x05,0x80,0x80,0x80,0x80,0x80},
+        {0x01,0x03,0x05,0x80,0x80,0x80,0x80,0x80},
+        {0x00,0x01,0x03,0x05,0x80,0x80,0x80,0x80},
+        {0x02,0x03,0x05,0x80,0x80,0x80,0x80,0x80},
+        {0x00,0x02,0x03,0x05,0x80,0x80,0x80,0x80},
+        {0x01,0x02,0x03,0x05,0x80,0x80,0x80,0x80},
+        {0x00,0x01,0x02,0x03,0x05,0x80,0x80,0x80},
+        {0x04,0x05,0x80,0x80,0x80,0x80,0x80,0x80},
+        {0x00,0x04,0x05,0x80,0x80,0x80,0x80,0x80},
+        {0x01,0x04,0x05,0x80,0x80,0x80,0x80,0x80},
+        {0x00,0x01,0x04,0x05,0x80,0x80,0x80,0x80},
+        {0x02,0x04,0x05,0x80,0x80,0x80,0x80,0x80},
+        {0x00,0x02,0x04,0x05,0x80,0x80,0x80,0x80},
+        {0x01,0x02,0x04,0x05,0x80,0x80,0x80,0x80},
+        {0x00,0x01,0x02,0x04,0x05,0x80,0x80,0x80},
+        {0x03,0x04,0x05,0x80,0x80,0x80,0x80,0x80},
+        {0x00,0x03,0x04,0x05,0x80,0x80,0x80,0x80},
+        {0x01,0x03,0x04,0x05,0x80,0x80,0x80,0x80},
+        {0x00,0x01,0x03,0x04,0x05,0x80,0x80,0x80},
+        {0x02,0x03,0x04,0x05,0x80,0x80,0x80,0x80},
+        {0x00,0x02,0x03,0x04,0x05,0x80,0x80,0x80},
+        {0x01,0x02,0x03,0x04,0x05,0x80,0x80,0x80},
+        {0x00,0x01,0x02,0x03,0x04,0x05,0x80,0x80},
+        {0x06,0x80,0x80,0x80,0x80,0x80,0x80,0x80},
+        {0x00,0x06,0x80,0x80,0x80,0x80,0x80,0x80},
+        {0x01,0x06,0x80,0x80,0x80,0x80,0x80,0x80},
+        {0x00,0x01,0x06,0x80,0x80,0x80,0x80,0x80},
+        {0x02,0x06,0x80,0x80,0x80,0x80,0x80,0x80},
+        {0x00,0x02,0x06,0x80,0x80,0x80,0x80,0x80},
+        {0x01,0x02,0x06,0x80,0x80,0x80,0x80,0x80},
+        {0x00,0x01,0x02,0x06,0x80,0x80,0x80,0x80},
+        {0x03,0x06,0x80,0x80,0x80,0x80,0x80,0x80},
+        {0x00,0x03,0x06,0x80,0x80,0x80,0x80,0x80},
+        {0x01,0x03,0x06,0x80,0x80,0x80,0x80,0x80},
+        {0x00,0x01,0x03,0x06,0x80,0x80,0x80,0x80},
+        {0x02,0x03,0x06,0x80,0x80,0x80,0x80,0x80},
+        {0x00,0x02,0x03,0x06,0x80,0x80,0x80,0x80},
+        {0x01,0x02,0x03,0x06,0x80,0x80,0x80,0x80},
+        {0x00,0x01,0x02,0x03,0x06,0x80,0x80,0x80},
+        {0x04,0x06,0x80,0x80,0x80,0x80,0x80,0x80},
+        {0x00,0x04,0x06,0x80,0x80,0x80,0x80,0x80},
+        {0x01,0x04,0x06,0x80,0x80,0x80,0x80,0x80},
+        {0x00,0x01,0x04,0x06,0x80,0x80,0x80,0x80},
+        {0x02,0x04,0x06,0x80,0x80,0x80,0x80,0x80},
+        {0x00,0x02,0x04,0x06,0x80,0x80,0x80,0x80},
+        {0x01,0x02,0x04,0x06,0x80,0x80,0x80,0x80},
+        {0x00,0x01,0x02,0x04,0x06,0x80,0x80,0x80},
+        {0x03,0x04,0x06,0x80,0x80,0x80,0x80,0x80},
+        {0x00,0x03,0x04,0x06,0x80,0x80,0x80,0x80},
+        {0x01,0x03,0x04,0x06,0x80,0x80,0x80,0x80},
+        {0x00,0x01,0x03,0x04,0x06,0x80,0x80,0x80},
+        {0x02,0x03,0x04,0x06,0x80,0x80,0x80,0x80},
+        {0x00,0x02,0x03,0x04,0x06,0x80,0x80,0x80},
+        {0x01,0x02,0x03,0x04,0x06,0x80,0x80,0x80},
+        {0x00,0x01,0x02,0x03,0x04,0x06,0x80,0x80},
+        {0x05,0x06,0x80,0x80,0x80,0x80,0x80,0x80},
+        {0x00,0x05,0x06,0x80,0x80,0x80,0x80,0x80},
+        {0x01,0x05,0x06,0x80,0x80,0x80,0x80,0x80},
+        {0x00,0x01,0x05,0x06,0x80,0x80,0x80,0x80},
+        {0x02,0x05,0x06,0x80,0x80,0x80,0x80,0x80},
+        {0x00,0x02,0x05,0x06,0x80,0x80,0x80,0x80},
+        {0x01,0x02,0x05,0x06,0x80,0x80,0x80,0x80},
+        {0x00,0x01,0x02,0x05,0x06,0x80,0x80,0x80},
+        {0x03,0x05,0x06,0x80,0x80,0x80,0x80,0x80},
+        {0x00,0x03,0x05,0x06,0x80,0x80,0x80,0x80},
+        {0x01,0x03,0x05,0x06,0x80,0x80,0x80,0x80},
+        {0x00,0x01,0x03,0x05,0x06,0x80,0x80,0x80},
+        {0x02,0x03,0x05,0x06,0x80,0x80,0x80,0x80},
+        {0x00,0x02,0x03,0x05,0x06,0x80,0x80,0x80},
+        {0x01,0x02,0x03,0x05,0x06,0x80,0x80,0x80},
+        {0x00,0x01,0x02,0x03,0x05,0x06,0x80,0x80},
+        {0x04,0x05,0x06,0x80,0x80,0x80,0x80,0x80},
+        {0x00,0x04,0x05,0x06,0x80,0x80,0x80,0x80},
+        {0x01,0x04,0x05,0x06,0x80,0x80,0x80,0x80},
+        {0x00,0x01,0x04,0x05,0x06,0x80,0x80,0x80},
+        {0x02,0x04,0x05,0x06,0x80,0x80,0x80,0x80},
+        {0x00,0x02,0x04,0x05,0x06,0x80,0x80,0x80},
+        {0x01,0x02,0x04,0x05,0x06,0x80,0x80,0x80},
+        {0x00,0x01,0x02,0x04,0x05,0x06,0x80,0x80},
+        {0x03,0x04,0x05,0x06,0x80,0x80,0x80,0x80},
+        {0x00,0x03,0x04,0x05,0x06,0x80,0x80,0x80},
+        {0x01,0x03,0x04,0x05,0x06,0x80,0x80,0x80},
+        {0x00,0x01,0x03,0x04,0x05,0x06,0x80,0x80},
+        {0x02,0x03,0x04,0x05,0x06,0x80,0x80,0x80},
+        {0x00,0x02,0x03,0x04,0x05,0x06,0x80,0x80},
+        {0x01,0x02,0x03,0x04,0x05,0x06,0x80,0x80},
+        {0x00,0x01,0x02,0x03,0x04,0x05,0x06,0x80},
+        {0x07,0x80,0x80,0x80,0x80,0x80,0x80,0x80},
+        {0x00,0x07,0x80,0x80,0x80,0x80,0x80,0x80},
+        {0x01,0x07,0x80,0x80,0x80,0x80,0x80,0x80},
+        {0x00,0x01,0x07,0x80,0x80,0x80,0x80,0x80},
+        {0x02,0x07,0x80,0x80,0x80,0x80,0x80,0x80},
+        {0x00,0x02,0x07,0x80,0x80,0x80,0x80,0x80},
+        {0x01,0x02,0x07,0x80,0x80,0x80,0x80,0x80},
+        {0x00,0x01,0x02,0x07,0x80,0x80,0x80,0x80},
+        {0x03,0x07,0x80,0x80,0x80,0x80,0x80,0x80},
+        {0x00,0x03,0x07,0x80,0x80,0x80,0x80,0x80},
+        {0x01,0x03,0x07,0x80,0x80,0x80,0x80,0x80},
+        {0x00,0x01,0x03,0x07,0x80,0x80,0x80,0x80},
+        {0x02,0x03,0x07,0x80,0x80,0x80,0x80,0x80},
+        {0x00,0x02,0x03,0x07,0x80,0x80,0x80,0x80},
+        {0x01,0x02,0x03,0x07,0x80,0x80,0x80,0x80},
+        {0x00,0x01,0x02,0x03,0x07,0x80,0x80,0x80},
+        {0x04,0x07,0x80,0x80,0x80,0x80,0x80,0x80},
+        {0x00,0x04,0x07,0x80,0x80,0x80,0x80,0x80},
+        {0x01,0x04,0x07,0x80,0x80,0x80,0x80,0x80},
+        {0x00,0x01,0x04,0x07,0x80,0x80,0x80,0x80},
+        {0x02,0x04,0x07,0x80,0x80,0x80,0x80,0x80},
+        {0x00,0x02,0x04,0x07,0x80,0x80,0x80,0x80},
+        {0x01,0x02,0x04,0x07,0x80,0x80,0x80,0x80},
+        {0x00,0x01,0x02,0x04,0x07,0x80,0x80,0x80},
+        {0x03,0x04,0x07,0x80,0x80,0x80,0x80,0x80},
+        {0x00,0x03,0x04,0x07,0x80,0x80,0x80,0x80},
+        {0x01,0x03,0x04,0x07,0x80,0x80,0x80,0x80},
+        {0x00,0x01,0x03,0x04,0x07,0x80,0x80,0x80},
+        {0x02,0x03,0x04,0x07,0x80,0x80,0x80,0x80},
+        {0x00,0x02,0x03,0x04,0x07,0x80,0x80,0x80},
+        {0x01,0x02,0x03,0x04,0x07,0x80,0x80,0x80},
+        {0x00,0x01,0x02,0x03,0x04,0x07,0x80,0x80},
+        {0x05,0x07,0x80,0x80,0x80,0x80,0x80,0x80},
+        {0x00,0x05,0x07,0x80,0x80,0x80,0x80,0x80},
+        {0x01,0x05,0x07,0x80,0x80,0x80,0x80,0x80},
+        {0x00,0x01,0x05,0x07,0x80,0x80,0x80,0x80},
+        {0x02,0x05,0x07,0x80,0x80,0x80,0x80,0x80},
+        {0x00,0x02,0x05,0x07,0x80,0x80,0x80,0x80},
+        {0x01,0x02,0x05,0x07,0x80,0x80,0x80,0x80},
+        {0x00,0x01,0x02,0x05,0x07,0x80,0x80,0x80},
+        {0x03,0x05,0x07,0x80,0x80,0x80,0x80,0x80},
+        {0x00,0x03,0x05,0x07,0x80,0x80,0x80,0x80},
+        {0x01,0x03,0x05,0x07,0x80,0x80,0x80,0x80},
+        {0x00,0x01,0x03,0x05,0x07,0x80,0x80,0x80},
+        {0x02,0x03,0x05,0x07,0x80,0x80,0x80,0x80},
+        {0x00,0x02,0x03,0x05,0x07,0x80,0x80,0x80},
+        {0x01,0x02,0x03,0x05,0x07,0x80,0x80,0x80},
+        {0x00,0x01,0x02,0x03,0x05,0x07,0x80,0x80},
+        {0x04,0x05,0x07,0x80,0x80,0x80,0x80,0x80},
+        {0x00,0x04,0x05,0x07,0x80,0x80,0x80,0x80},
+        {0x01,0x04,0x05,0x07,0x80,0x80,0x80,0x80},
+        {0x00,0x01,0x04,0x05,0x07,0x80,0x80,0x80},
+        {0x02,0x04,0x05,0x07,0x80,0x80,0x80,0x80},
+        {0x00,0x02,0x04,0x05,0x07,0x80,0x80,0x80},
+        {0x01,0x02,0x04,0x05,0x07,0x80,0x80,0x80},
+        {0x00,0x01,0x02,0x04,0x05,0x07,0x80,0x80},
+        {0x03,0x04,0x05,0x07,0x80,0x80,0x80,0x80},
+        {0x00,0x03,0x04,0x05,0x07,0x80,0x80,0x80},
+        {0x01,0x03,0x04,0x05,0x07,0x80,0x80,0x80},
+        {0x00,0x01,0x03,0x04,0x05,0x07,0x80,0x80},
+        {0x02,0x03,0x04,0x05,0x07,0x80,0x80,0x80},
+        {0x00,0x02,0x03,0x04,0x05,0x07,0x80,0x80},
+        {0x01,0x02,0x03,0x04,0x05,0x07,0x80,0x80},
+        {0x00,0x01,0x02,0x03,0x04,0x05,0x07,0x80},
+        {0x06,0x07,0x80,0x80,0x80,0x80,0x80,0x80},
+        {0x00,0x06,0x07,0x80,0x80,0x80,0x80,0x80},
+        {0x01,0x06,0x07,0x80,0x80,0x80,0x80,0x80},
+        {0x00,0x01,0x06,0x07,0x80,0x80,0x80,0x80},
+        {0x02,0x06,0x07,0x80,0x80,0x80,0x80,0x80},
+        {0x00,0x02,0x06,0x07,0x80,0x80,0x80,0x80},
+        {0x01,0x02,0x06,0x07,0x80,0x80,0x80,0x80},
+        {0x00,0x01,0x02,0x06,0x07,0x80,0x80,0x80},
+        {0x03,0x06,0x07,0x80,0x80,0x80,0x80,0x80},
+        {0x00,0x03,0x06,0x07,0x80,0x80,0x80,0x80},
+        {0x01,0x03,0x06,0x07,0x80,0x80,0x80,0x80},
+        {0x00,0x01,0x03,0x06,0x07,0x80,0x80,0x80},
+        {0x02,0x03,0x06,0x07,0x80,0x80,0x80,0x80},
+        {0x00,0x02,0x03,0x06,0x07,0x80,0x80,0x80},
+        {0x01,0x02,0x03,0x06,0x07,0x80,0x80,0x80},
+        {0x00,0x01,0x02,0x03,0x06,0x07,0x80,0x80},
+        {0x04,0x06,0x07,0x80,0x80,0x80,0x80,0x80},
+        {0x00,0x04,0x06,0x07,0x80,0x80,0x80,0x80},
+        {0x01,0x04,0x06,0x07,0x80,0x80,0x80,0x80},
+        {0x00,0x01,0x04,0x06,0x07,0x80,0x80,0x80},
+        {0x02,0x04,0x06,0x07,0x80,0x80,0x80,0x80},
+        {0x00,0x02,0x04,0x06,0x07,0x80,0x80,0x80},
+        {0x01,0x02,0x04,0x06,0x07,0x80,0x80,0x80},
+        {0x00,0x01,0x02,0x04,0x06,0x07,0x80,0x80},
+        {0x03,0x04,0x06,0x07,0x80,0x80,0x80,0x80},
+        {0x00,0x03,0x04,0x06,0x07,0x80,0x80,0x80},
+        {0x01,0x03,0x04,0x06,0x07,0x80,0x80,0x80},
+        {0x00,0x01,0x03,0x04,0x06,0x07,0x80,0x80},
+        {0x02,0x03,0x04,0x06,0x07,0x80,0x80,0x80},
+        {0x00,0x02,0x03,0x04,0x06,0x07,0x80,0x80},
+        {0x01,0x02,0x03,0x04,0x06,0x07,0x80,0x80},
+        {0x00,0x01,0x02,0x03,0x04,0x06,0x07,0x80},
+        {0x05,0x06,0x07,0x80,0x80,0x80,0x80,0x80},
+        {0x00,0x05,0x06,0x07,0x80,0x80,0x80,0x80},
+        {0x01,0x05,0x06,0x07,0x80,0x80,0x80,0x80},
+        {0x00,0x01,0x05,0x06,0x07,0x80,0x80,0x80},
+        {0x02,0x05,0x06,0x07,0x80,0x80,0x80,0x80},
+        {0x00,0x02,0x05,0x06,0x07,0x80,0x80,0x80},
+        {0x01,0x02,0x05,0x06,0x07,0x80,0x80,0x80},
+        {0x00,0x01,0x02,0x05,0x06,0x07,0x80,0x80},
+        {0x03,0x05,0x06,0x07,0x80,0x80,0x80,0x80},
+        {0x00,0x03,0x05,0x06,0x07,0x80,0x80,0x80},
+        {0x01,0x03,0x05,0x06,0x07,0x80,0x80,0x80},
+        {0x00,0x01,0x03,0x05,0x06,0x07,0x80,0x80},
+        {0x02,0x03,0x05,0x06,0x07,0x80,0x80,0x80},
+        {0x00,0x02,0x03,0x05,0x06,0x07,0x80,0x80},
+        {0x01,0x02,0x03,0x05,0x06,0x07,0x80,0x80},
+        {0x00,0x01,0x02,0x03,0x05,0x06,0x07,0x80},
+        {0x04,0x05,0x06,0x07,0x80,0x80,0x80,0x80},
+        {0x00,0x04,0x05,0x06,0x07,0x80,0x80,0x80},
+        {0x01,0x04,0x05,0x06,0x07,0x80,0x80,0x80},
+        {0x00,0x01,0x04,0x05,0x06,0x07,0x80,0x80},
+        {0x02,0x04,0x05,0x06,0x07,0x80,0x80,0x80},
+        {0x00,0x02,0x04,0x05,0x06,0x07,0x80,0x80},
+        {0x01,0x02,0x04,0x05,0x06,0x07,0x80,0x80},
+        {0x00,0x01,0x02,0x04,0x05,0x06,0x07,0x80},
+        {0x03,0x04,0x05,0x06,0x07,0x80,0x80,0x80},
+        {0x00,0x03,0x04,0x05,0x06,0x07,0x80,0x80},
+        {0x01,0x03,0x04,0x05,0x06,0x07,0x80,0x80},
+        {0x00,0x01,0x03,0x04,0x05,0x06,0x07,0x80},
+        {0x02,0x03,0x04,0x05,0x06,0x07,0x80,0x80},
+        {0x00,0x02,0x03,0x04,0x05,0x06,0x07,0x80},
+        {0x01,0x02,0x03,0x04,0x05,0x06,0x07,0x80},
+        {0x00,0x01,0x02,0x03,0x04,0x05,0x06,0x07}
+    };
+    return table[bits];
+}
+
+static SIMDPP_INL
+const uint8_t* expand_table_entry(unsigned bits)
+{
+    static const uint8_t SIMDPP_ALIGN(8) table[256][8] = {
+        {0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x80},
+        {0x00,0x80,0x80,0x80,0x80,0x80,0x80,0x80},
+        {0x80,0x00,0x80,0x80,0x80,0x80,0x80,0x80},
+        {0x00,0x01,0x80,0x80,0x80,0x80,0x80,0x80},
+        {0x80,0x80,0x00,0x80,0x80,0x80,0x80,0x80},
+        {0x00,0x80,0x01,0x80,0x80,0x80,0x80,0x80},
+        {0x80,0x00,0x01,0x80,0x80,0x80,0x80,0x80},
+        {0x00,0x01,0x02,0x80,0x80,0x80,0x80,0x80},
+        {0x80,0x80,0x80,0x00,0x80,0x80,0x80,0x80},
+        {0x00,0x80,0x80,0x01,0x80,0x80,0x80,0x80},
+        {0x80,0x00,0x80,0x01,0x80,0x80,0x80,0x80},
+        {0x00,0x01,0x80,0x02,0x80,0x80,0x80,0x80},
+        {0x80,0x80,0x00,0x01,0x80,0x80,0x80,0x80},
+        {0x00,0x80,0x01,0x02,0x80,0x80,0x80,0x80},
+        {0x80,0x00,0x01,0x02,0x80,0x80,0x80,0x80},
+        {0x00,0x01,0x02,0x03,0x80,0x80,0x80,0x80},
+        {0x80,0x80,0x80,0x80,0x00,0x80,0x80,0x80},
+        {0x00,0x80,0x80,0x80,0x01,0x80,0x80,0x80},
+        {0x80,0x00,0x80,0x80,0x01,0x80,0x80,0x80},
+        {0x00,0x01,0x80,0x80,0x02,0x80,0x80,0x80},
+        {0x80,0x80,0x00,0x80,0x01,0x80,0x80,0x80},
+        {0x00,0x80,0x01,0x80,0x02,0x80,0x80,0x80},
+        {0x80,0x00,0x01,0x80,0x02,0x80,0x80,0x80},
+        {0x00,0x01,0x02,0x80,0x03,0x80,0x80,0x80},
+        {0x80,0x80,0x80,0x00,0x01,0x80,0x80,0x80},
+        {0x00,0x80,0x80,0x01,0x02,0x80,0x80,0x80},
+        {0x80,0x00,0x80,0x01,0x02,0x80,0x80,0x80},
+        {0x00,0x01,0x80,0x02,0x03,0x80,0x80,0x80},
+        {0x80,0x80,0x00,0x01,0x02,0x80,0x80,0x80},
+        {0x00,0x80,0x01,0x02,0x03,0x80,0x80,0x80},
+        {0x80,0x00,0x01,0x02,0x03,0x80,0x80,0x80},
+        {0x00,0x01,0x02,0x03,0x04,0x80,0x80,0x80},
+        {0x80,0x80,0x80,0x80,0x80,0x00,0x80,0x80},
+        {0x00,0x80,0x80,0x80,0x80,0x01,0x80,0x80},
+        {0x80,0x00,0x80,0x80,0x80,0x01,0x80,0x80},
+        {0x00,0x01,0x80,0x80,0x80,0x02,0x80,0x80},
+        {0x80,0x80,0x00,0x80,0x80,0x01,0x80,0x80},
+        {0x00,0x80,0x01,0x80,0x80,0x02,0x80,0x80},
+        {0x80,0x00,0x01,0x80,0x80,0x02,0x80,0x80},
+        {0x00,0x01,0x02,0x80,0x80,0x03,0x80,0x80},
+        {0x80,0x80,0x80,0x00,0x80,0x01,0x80,0x80},
+        {0x00,0x80,0x80,0x01,0x80,0x02,0x80,0x80},
+        {0x80,0x00,0x80,0x01,0x80,0x02,0x80,0x80},
+        {0x00,0x01,0x80,0x02,0x80,0x03,0x80,0x80},
+        {0x80,0x80,0x00,0x01,0x80,0x02,0x80,0x80},
+        {0x00,0x80,0x01,0x02,0x80,0x03,0x80,0x80},
+        {0x80,0x00,0x01,0x02,0x80,0x03,0x80,0x80},
+        {0x00,0x01,0x02,0x03,0x80,0x04,0x80,0x80},
+        {0x80,0x80,0x80,0x80,0x00,0x01,0x80,0x80},
+        {0x00,0x80,0x80,0x80,0x01,0x02,0x80,0x80},
+        {0x80,0x00,0x80,0x80,0x01,0x02,0x80,0x80},
+        {0x00,0x01,0x80,0x80,0x02,0x03,0x80,0x80},
+        {0x80,0x80,0x00,0x80,0x01,0x02,0x80,0x80},
+        {0x00,0x80,0x01,0x80,0x02,0x03,0x80,0x80},
+        {0x80,0x00,0x01,0x80,0x02,0x03,0x80,0x80},
+        {0x00,0x01,0x02,0x80,0x03,0x04,0x80,0x80},
+        {0x80,0x80,0x80,0x00,0x01,0x02,0x80,0x80},
+        {0x00,0x80,0x80,0x01,0x02,0x03,0x80,0x80},
+        {0x80,0x00,0x80,0x01,0x02,0x03,0x80,0x80},
+        {0x00,0x01,0x80,0x02,0x03,0x04,0x80,0x80},
+        {0x80,0x80,0x00,0x01,0x02,0x03,0x80,0x80},
+        {0x00,0x80,0x01,0x02,0x03,0x04,0x80,0x80},
+        {0x80,0x00,0x01,0x02,0x03,0x04,0x80,0x80},
+        {0x00,0x01,0x02,0x03,0x04,0x05,0x80,0x80},
+        {0x80,0x80,0x80,0x80,0x80,0x80,0x00,0x80},
+        {0x00,0x80,0x80,0x80,0x80,0x80,0x01,0x80},
+        {0x80,0x00,0x80,0x80,0x80,0x80,0x01,0x80},
+        {0x00,0x01,0x80,0x80,0x80,0x80,0x02,0x80},
+        {0x80,0x80,0x00,0x80,0x80,0x80,0x01,0x80},
+        {0x00,0x80,0x01,0x80,0x80,0x80,0x02,0x80},
+        {0x80,0x00,0x01,0x80,0x80,0x80,0x02,0x80},
+        {0x00,0x01,0x02,0x80,0x80,0x80,0x03,0x80},
+        {0x80,0x80,0x80,0x00,0x80,0x80,0x01,0x80},
+        {0x00,0x80,0x80,0x01,0x80,0x80,0x02,0x80},
+        {0x80,0x00,0x80,0x01,0x80,0x80,0x02,0x80},
+        {0x00,0x01,0x80,0x02,0x80,0x80,0x03,0x80},
+        {0x80,0x80,0x00,0x01,0x80,0x80,0x02,0x80},
+        {0x00,0x80,0x01,0x02,0x80,0x80,0x03,0x80},
+        {0x80,0x00,0x01,0x02,0x80,0x80,0x03,0x80},
+        {0x00,0x01,0x02,0x03,0x80,0x80,0x04,0x80},
+        {0x80,0x80,0x80,0x80,0x00,0x80,0x01,0x80},
+        {0x00,0x80,0x80,0x80,0x01,0x80,0x02,0x80},
+        {0x80,0x00,0x80,0x80,0x01,0x80,0x02,0x80},
+        {0x00,0x01,0x80,0x80,0x02,0x80,0x03,0x80},
+        {0x80,0x80,0x00,0x80,0x01,0x80,0x02,0x80},
+        {0x00,0x80,0x01,0x80,0x02,0x80,0x03,0x80},
+        {0x80,0x00,0x01,0x80,0x02,0x80,0x03,0x80},
+        {0x00,0x01,0x02,0x80,0x03,0x80,0x04,0x80},
+        {0x80,0x80,0x80,0x00,0x01,0x80,0x02,0x80},
+        {0x00,0x80,0x80,0x01,0x02,0x80,0x03,0x80},
+        {0x80,0x00,0x80,0x01,0x02,0x80,0x03,0x80},
+        {0x00,0x01,0x80,0x02,0x03,0x80,0x04,0x80},
+        {0x80,0x80,0x00,0x01,0x02,0x80,0x03,0x80},
+        {0x00,0x80,0x01,0x02,0x03,0x80,0x04,0x80},
+        {0x80,0x00,0x01,0x02,0x03,0x80,0x04,0x80},
+        {0x00,0x01,0x02,0x03,0x04,0x80,0x05,0x80},
+        {0x80,0x80,0x80,0x80,0x80,0x00,0x01,0x80},
+        {0x00,0x80,0x80,0x80,0x80,0x01,0x02,0x80},
+        {0x80,0x00,0x80,0x80,0x80,0x01,0x02,0x80},
+        {0x00,0x01,0x80,0x80,0x80,0x02,0x03,0x80},
+        {0x80,0x80,0x00,0x80,0x80,0x01,0x02,0x80},
+        {0x00,0x80,0x01,0x80,0x80,0x02,0x03,0x80},
+        {0x80,0x00,0x01,0x80,0x80,0x02,0x03,0x80},
+        {0x00,0x01,0x02,0x80,0x80,0x03,0x04,0x80},
+        {0x80,0x80,0x80,0x00,0x80,0x01,0x02,0x80},
+        {0x00,0x80,0x80,0x01,0x80,0x02,0x03,0x80},
+        {0x80,0x00,0x80,0x01,0x80,0x02,0x03,0x80},
+        {0x00,0x01,0x80,0x02,0x80,0x03,0x04,0x80},
+        {0x80,0x80,0x00,0x01,0x80,0x02,0x03,0x80},
+        {0x00,0x80,0x01,0x02,0x80,0x03,0x04,0x80},
+        {0x80,0x00,0x01,0x02,0x80,0x03,0x04,0x80},
+        {0x00,0x01,0x02,0x03,0x80,0x04,0x05,0x80},
+        {0x80,0x80,0x80,0x80,0x00,0x01,0x02,0x80},
+        {0x00,0x80,0x80,0x80,0x01,0x02,0x03,0x80},
+        {0x80,0x00,0x80,0x80,0x01,0x02,0x03,0x80},
+        {0x00,0x01,0x80,0x80,0x02,0x03,0x04,0x80},
+        {0x80,0x80,0x00,0x80,0x01,0x02,0x03,0x80},
+        {0x00,0x80,0x01,0x80,0x02,0x03,0x04,0x80},
+        {0x80,0x00,0x01,0x80,0x02,0x03,0x04,0x80},
+        {0x00,0x01,0x02,0x80,0x03,0x04,0x05,0x80},
+        {0x80,0x80,0x80,0x00,0x01,0x02,0x03,0x80},
+        {0x00,0x80,0x80,0x01,0x02,0x03,0x04,0x80},
+        {0x80,0x00,0x80,0x01,0x02,0x03,0x04,0x80},
+        {0x00,0x01,0x80,0x02,0x03,0x04,0x05,0x80},
+        {0x80,0x80,0x00,0x01,0x02,0x03,0x04,0x80},
+        {0x00,0x80,0x01,0x02,0x03,0x04,0x05,0x80},
+        {0x80,0x00,0x01,0x02,0x03,0x04,0x05,0x80},
+        {0x00,0x01,0x02,0x03,0x04,0x05,0x06,0x80},
+        {0x80,0x80,0x80,0x80,0x80,0x80,0x80,0x00},
+        {0x00,0x80,0x80,0x80,0x80,0x80,0x80,0x01},
+        {0x80,0x00,0x80,0x80,0x80,0x80,0x80,0x01},
+        {0x00,0x01,0x80,0x80,0x80,0x80,0x80,0x02},
+        {0x80,0x80,0x00,0x80,0x80,0x80,0x80,0x01},
+        {0x00,0x80,0x01,0x80,0x80,0x80,0x80,0x02},
+        {0x80,0x00,0x01,0x80,0x80,0x80,0x80,0x02},
+        {0x00,0x01,0x02,0x80,0x80,0x80,0x80,0x03},
+        {0x80,0x80,0x80,0x00,0x80,0x80,0x80,0x01},
+        {0x00,0x80,0x80,0x01,0x80,0x80,0x80,0x02},
+        {0x80,0x00,0x80,0x01,0x80,0x80,0x80,0x02},
+        {0x00,0x01,0x80,0x02,0x80,0x80,0x80,0x03},
+        {0x80,0x80,0x00,0x01,0x80,0x80,0x80,0x02},
+        {0x00,0x80,0x01,0x02,0x80,0x80,0x80,0x03},
+        {0x80,0x00,0x01,0x02,0x80,0x80,0x80,0x03},
+        {0x00,0x01,0x02,0x03,0x80,0x80,0x80,0x04},
+        {0x80,0x80,0x80,0x80,0x00,0x80,0x80,0x01},
+        {0x00,0x80,0x80,0x80,0x01,0x80,0x80,0x02},
+        {0x80,0x00,0x80,0x80,0x01,0x80,0x80,0x02},
+        {0x00,0x01,0x80,0x80,0x02,0x80,0x80,0x03},
+        {0x80,0x80,0x00,0x80,0x01,0x80,0x80,0x02},
+        {0x00,0x80,0x01,0x80,0x02,0x80,0x80,0x03},
+        {0x80,0x00,0x01,0x80,0x02,0x80,0x80,0x03},
+        {0x00,0x01,0x02,0x80,0x03,0x80,0x80,0x04},
+        {0x80,0x80,0x80,0x00,0x01,0x80,0x80,0x02},
+        {0x00,0x80,0x80,0x01,0x02,0x80,0x80,0x03},
+        {0x80,0x00,0x80,0x01,0x02,0x80,0x80,0x03},
+        {0x00,0x01,0x80,0x02,0x03,0x80,0x80,0x04},
+        {0x80,0x80,0x00,0x01,0x02,0x80,0x80,0x03},
+        {0x00,0x80,0x01,0x02,0x03,0x80,0x80,0x04},
+        {0x80,0x00,0x01,0x02,0x03,0x80,0x80,0x04},
+        {0x00,0x01,0x02,0x03,0x04,0x80,0x80,0x05},
+        {0x80,0x80,0x80,0x80,0x80,0x00,0x80,0x01},
+        {0x00,0x80,0x80,0x80,0x80,0x01,0x80,0x02},
+        {0x80,0x00,0x80,0x80,0x80,0x01,0x80,0x02},
+        {0x00,0x01,0x80,0x80,0x80,0x02,0x80,0x03},
+        {0x80,0x80,0x00,0x80,0x80,0x01,0x80,0x02},
+        {0x00,0x80,0x01,0x80,0x80,0x02,0x80,0x03},
+        {0x80,0x00,0x01,0x80,0x80,0x02,0x80,0x03},
+        {0x00,0x01,0x02,0x80,0x80,0x03,0x80,0x04},
+        {0x80,0x80,0x80,0x00,0x80,0x01,0x80,0x02},
+        {0x00,0x80,0x80,0x01,0x80,0x02,0x80,0x03},
+        {0x80,0x00,0x80,0x01,0x80,0x02,0x80,0x03},
+        {0x00,0x01,0x80,0x02,0x80,0x03,0x80,0x04},
+        {0x80,0x80,0x00,0x01,0x80,0x02,0x80,0x03},
+        {0x00,0x80,0x01,0x02,0x80,0x03,0x80,0x04},
+        {0x80,0x00,0x01,0x02,0x80,0x03,0x80,0x04},
+        {0x00,0x01,0x02,0x03,0x80,0x04,0x80,0x05},
+        {0x80,0x80,0x80,0x80,0x00,0x01,0x80,0x02},
+        {0x00,0x80,0x80,0x80,0x01,0x02,0x80,0x03},
+        {0x80,0x00,0x80,0x80,0x01,0x02,0x80,0x03},
+        {0x00,0x01,0x80,0x80,0x02,0x03,0x80,0x04},
+        {0x80,0x80,0x00,0x80,0x01,0x02,0x80,0x03},
+        {0x00,0x80,0x01,0x80,0x02,0x03,0x80,0x04},
+        {0x80,0x00,0x01,0x80,0x02,0x03,0x80,0x04},
+        {0x00,0x01,0x02,0x80,0x03,0x04,0x80,0x05},
+        {0x80,0x80,0x80,0x00,0x01,0x02,0x80,0x03},
+        {0x00,0x80,0x80,0x01,0x02,0x03,0x80,0x04},
+        {0x80,0x00,0x80,0x01,0x02,0x03,0x80,0x04},
+        {0x00,0x01,0x80,0x02,0x03,0x04,0x80,0x05},
+        {0x80,0x80,0x00,0x01,0x02,0x03,0x80,0x04},
+        {0x00,0x80,0x01,0x02,0x03,0x04,0x80,0x05},
+        {0x80,0x00,0x01,0x02,0x03,0x04,0x80,0x05},
+        {0x00,0x01,0x02,0x03,0x04,0x05,0x80,0x06},
+        {0x80,0x80,0x80,0x80,0x80,0x80,0x00,0x01},
+        {0x00,0x80,0x80,0x80,0x80,0x80,0x01,0x02},
+        {0x80,0x00,0x80,0x80,0x80,0x80,0x01,0x02},
+        {0x00,0x01,0x80,0x80,0x80,0x80,0x02,0x03},
+        {0x80,0x80,0x00,0x80,0x80,0x80,0x01,0x02},
+        {0x00,0x80,0x01,0x80,0x80,0x80,0x02,0x03},
+        {0x80,0x00,0x01,0x80,0x80,0x80,0x02,0x03},
+        {0x00,0x01,0x02,0x80,0x80,0x80,0x03,0x04},
+        {0x80,0x80,0x80,0x00,0x80,0x80,0x01,0x02},
+        {0x00,0x80,0x80,0x01,0x80,0x80,0x02,0x03},
+        {0x80,0x00,0x80,0x01,0x80,0x80,0x02,0x03},
+        {0x00,0x01,0x80,0x02,0x80,0x80,0x03,0x04},
+        {0x80,0x80,0x00,0x01,0x80,0x80,0x02,0x03},
+        {0x00,0x80,0x01,0x02,0x80,0x80,0x03,0x04},
+        {0x80,0x00,0x01,0x02,0x80,0x80,0x03,0x04},
+        {0x00,0x01,0x02,0x03,0x80,0x80,0x04,0x05},
+        {0x80,0x80,0x80,0x80,0x00,0x80,0x01,0x02},
+        {0x00,0x80,0x80,0x80,0x01,0x80,0x02,0x03},
+        {0x80,0x00,0x80,0x80,0x01,0x80,0x02,0x03},
+        {0x00,0x01,0x80,0x80,0x02,0x80,0x03,0x04},
+        {0x80,0x80,0x00,0x80,0x01,0x80,0x02,0x03},
+        {0x00,0x80,0x01,0x80,0x02,0x80,0x03,0x04},
+        {0x80,0x00,0x01,0x80,0x02,0x80,0x03,0x04},
+        {0x00,0x01,0x02,0x80,0x03,0x80,0x04,0x05},
+        {0x80,0x80,0x80,0x00,0x01,0x80,0x02,0x03},
+        {0x00,0x80,0x80,0x01,0x02,0x80,0x03,0x04},
+        {0x80,0x00,0x80,0x01,0x02,0x80,0x03,0x04},
+        {0x00,0x01,0x80,0x02,0x03,0x80,0x04,0x05},
+        {0x80,0x80,0x00,0x01,0x02,0x80,0x03,0x04},
+        {0x00,0x80,0x01,0x02,0x03,0x80,0x04,0x05},
+        {0x80,0x00,0x01,0x02,0x03,0x80,0x04,0x05},
+        {0x00,0x01,0x02,0x03,0x04,0x80,0x05,0x06},
+        {0x80,0x80,0x80,0x80,0x80,0x00,0x01,0x02},
+        {0x00,0x80,0x80,0x80,0x80,0x01,0x02,0x03},
+        {0x80,0x00,0x80,0x80,0x80,0x01,0x02,0x03},
+        {0x00,0x01,0x80,0x80,0x80,0x02,0x03,0x04},
+        {0x80,0x80,0x00,0x80,0x80,0x01,0x02,0x03},
+        {0x00,0x80,0x01,0x80,0x80,0x02,0x03,0x04},
+        {0x80,0x00,0x01,0x80,0x80,0x02,0x03,0x04},
+        {0x00,0x01,0x02,0x80,0x80,0x03,0x04,0x05},
+        {0x80,0x80,0x80,0x00,0x80,0x01,0x02,0x03},
+        {0x00,0x80,0x80,0x01,0x80,0x02,0x03,0x04},
+        {0x80,0x00,0x80,0x01,0x80,0x02,0x03,0x04},
+        {0x00,0x01,0x80,0x02,0x80,0x03,0x04,0x05},
+        {0x80,0x80,0x00,0x01,0x80,0x02,0x03,0x04},
+        {0x00,0x80,0x01,0x02,0x80,0x03,0x04,0x05},
+        {0x80,0x00,0x01,0x02,0x80,0x03,0x04,0x05},
+        {0x00,0x01,0x02,0x03,0x80,0x04,0x05,0x06},
+        {0x80,0x80,0x80,0x80,0x00,0x01,0x02,0x03},
+        {0x00,0x80,0x80,0x80,0x01,0x02,0x03,0x04},
+        {0x80,0x00,0x80,0x80,0x01,0x02,0x03,0x04},
+        {0x00,0x01,0x80,0x80,0x02,0x03,0x04,0x05},
+        {0x80,0x80,0x00,0x80,0x01,0x02,0x03,0x04},
+        {0x00,0x80,0x01,0x80,0x02,0x03,0x04,0x05},
+        {0x80,0x00,0x01,0x80,0x02,0x03,0x04,0x05},
+        {0x00,0x01,0x02,0x80,0x03,0x04,0x05,0x06},
+        {0x80,0x80,0x80,0x00,0x01,0x02,0x03,0x04},
+        {0x00,0x80,0x80,0x01,0x02,0x03,0x04,0x05},
+        {0x80,0x00,0x80,0x01,0x02,0x03,0x04,0x05},
+        {0x00,0x01,0x80,0x02,0x03,0x04,0x05,0x06},
+        {0x80,0x80,0x00,0x01,0x02,0x03,0x04,0x05},
+        {0x00,0x80,0x01,0x02,0x03,0x04,0x05,0x06},
+        {0x80,0x00,0x01,0x02,0x03,0x04,0x05,0x06},
+        {0x00,0x01,0x02,0x03,0x04,0x05,0x06,0x07}
+    };
+    return table[bits];
+}
+
+template<class V> SIMDPP_INL
+V v_emul_compress_bits(const V& a, uint64_t bits)
+{
+    mem_block<V> ai(a);
+    mem_block<V> r;
+    unsigned j = 0;
+    for (unsigned i = 0; i < V::length; ++i) {
+        if ((bits >> i) & 1)
+            r[j++] = ai[i];
+    }
+    for (; j < V::length; ++j)
+        r[j] = 0;
+    return r;
+}
+
+template<class V> SIMDPP_INL
+V v_emul_expand_bits(const V& a, uint64_t bits)
+{
+    mem_block<V> ai(a);
+    mem_block<V> r;
+    unsigned j = 0;
+    for (unsigned i = 0; i < V::length; ++i) {
+        if ((bits >> i) & 1)
+            r[i] = ai[j++];
+        else
+            r[i] = 0;
+    }
+    return r;
+}
+
+#if SIMDPP_USE_SSSE3 || SIMDPP_USE_NEON || SIMDPP_USE_ALTIVEC || SIMDPP_USE_MSA
+/*  Converts the element indices in a table entry to the byte indices for
+    permute_zbytes16. Each index is duplicated and scaled by the element size
+    and the byte offsets within the element are added. Saturating addition
+    is used so that the 0x80 values stay negative.
+*/
+static SIMDPP_INL
+uint8<16> v_compress_idx16(const uint8_t* entry)
+{
+    uint8<16> idx = (uint8<16>) load_splat<uint64<2>>(entry);
+    uint8<16> offsets = make_uint(0, 1);
+    idx = zip16_lo(idx, idx);
+    idx = add_sat(idx, idx);
+    return bit_or(idx, offsets);
+}
+
+static SIMDPP_INL
+uint8<16> v_compress_idx32(const uint8_t* entry)
+{
+    uint8<16> idx = (uint8<16>) load_splat<uint64<2>>(entry);
+    uint8<16> offsets = make_uint(0, 1, 2, 3);
+    idx = zip16_lo(idx, idx);
+    idx = zip8_lo(uint16<8>(idx), uint16<8>(idx));
+    idx = add_sat(idx, idx);
+    idx = add_sat(idx, idx);
+    return bit_or(idx, offsets);
+}
+
+static SIMDPP_INL
+uint8<16> v_compress_idx64(const uint8_t* entry)
+{
+    uint8<16> idx = (uint8<16>) load_splat<uint64<2>>(entry);
+    uint8<16> offsets = make_uint(0, 1, 2, 3, 4, 5, 6, 7);
+    idx = zip16_lo(idx, idx);
+    idx = zip8_lo(uint16<8>(idx), uint16<8>(idx));
+    idx = zip4_lo(uint32<4>(idx), uint32<4>(idx));
+    idx = add_sat(idx, idx);
+    idx = add_sat(idx, idx);
+    idx = add_sat(idx, idx);
+    return bit_or(idx, offsets);
+}
+#endif
+
+#if SIMDPP_USE_AVX2 && !SIMDPP_USE_AVX512VL
+/*  Converts a table entry to the indices for _mm256_permutevar8x32_epi32.
+    The elements that must be zeroed have the highest bit set.
+*/
+static SIMDPP_INL
+__m256i v_compress_permutevar_idx32(const uint8_t* entry)
+{
+    __m128i e = _mm_loadl_epi64(reinterpret_cast<const __m128i*>(entry));
+    return _mm256_cvtepi8_epi32(e);
+}
+
+static SIMDPP_INL
+__m256i v_compress_permutevar_idx64(const uint8_t* entry)
+{
+    __m128i e = _mm_loadl_epi64(reinterpret_cast<const __m128i*>(entry));
+    __m256i idx = _mm256_cvtepi8_epi64(e);
+    idx = _mm256_add_epi64(idx, idx);
+    __m256i idx_hi = _mm256_add_epi64(idx, _mm256_set1_epi64x(1));
+    return _mm256_or_si256(idx, _mm256_slli_epi64(idx_hi, 32));
+}
+
+static SIMDPP_INL
+__m256i v_permutevar_zero(__m256i a, __m256i idx)
+{
+    __m256i r = _mm256_permutevar8x32_epi32(a, idx);
+    return _mm256_andnot_si256(_mm256_srai_epi32(idx, 31), r);
+}
+#endif
+
+// -----------------------------------------------------------------------------
+
+static SIMDPP_INL
+uint8<16> i_compress_bits(const uint8<16>& a, uint64_t bits)
+{
+#if SIMDPP_USE_AVX512VBMI2 && SIMDPP_USE_AVX512VL
+    return _mm_maskz_compress_epi8(bits, a.native());
+#elif SIMDPP_USE_SSSE3 || SIMDPP_USE_NEON || SIMDPP_USE_ALTIVEC || SIMDPP_USE_MSA
+    // The indices of the higher half are placed immediately after the
+    // indices of the lower half. The 0x80 values stay negative.
+    uint64_t idx_lo, idx_hi;
+    uint64_t zero_idx = 0x8080808080808080;
+    std::memcpy(&idx_lo, compress_table_entry(bits & 0xff), 8);
+    std::memcpy(&idx_hi, compress_table_entry((bits >> 8) & 0xff), 8);
+    idx_hi += 0x0808080808080808;
+
+    uint8_t SIMDPP_ALIGN(16) idx[16];
+    std::memcpy(idx, &idx_lo, 8);
+    std::memcpy(idx + 8, &zero_idx, 8);
+    std::memcpy(idx + v_mask_bits_count(bits & 0xff), &idx_hi, 8);
+    return permute_zbytes16(a, load<uint8<16>>(idx));
+#else
+    return v_emul_compress_bits(a, bits);
+#endif
+}
+
+static SIMDPP_INL
+uint16<8> i_compress_bits(const uint16<8>& a, uint64_t bits)
+{
+#if SIMDPP_USE_AVX512VBMI2 && SIMDPP_USE_AVX512VL
+    return _mm_maskz_compress_epi16(bits, a.native());
+#elif SIMDPP_USE_SSSE3 || SIMDPP_USE_NEON || SIMDPP_USE_ALTIVEC || SIMDPP_USE_MSA
+    return (uint16<8>) permute_zbytes16(uint8<16>(a),
+                                        v_compress_idx16(compress_table_entry(bits)));
+#else
+    return v_emul_compress_bits(a, bits);
+#endif
+}
+
+static SIMDPP_INL
+uint32<4> i_compress_bits(const uint32<4>& a, uint64_t bits)
+{
+#if SIMDPP_USE_AVX512VL
+    return _mm_maskz_compress_epi32(bits, a.native());
+#elif SIMDPP_USE_SSSE3 || SIMDPP_USE_NEON || SIMDPP_USE_ALTIVEC || SIMDPP_USE_MSA
+    return (uint32<4>) permute_zbytes16(uint8<16>(a),
+                                        v_compress_idx32(compress_table_entry(bits)));
+#else
+    return v_emul_compress_bits(a, bits);
+#endif
+}
+
+static SIMDPP_INL
+uint64<2> i_compress_bits(const uint64<2>& a, uint64_t bits)
+{
+#if SIMDPP_USE_AVX512VL
+    return _mm_maskz_compress_epi64(bits, a.native());
+#elif SIMDPP_USE_SSSE3 || SIMDPP_USE_NEON || SIMDPP_USE_VSX_207 || SIMDPP_USE_MSA
+    return (uint64<2>) permute_zbytes16(uint8<16>(a),
+                                        v_compress_idx64(compress_table_entry(bits)));
+#else
+    return v_emul_compress_bits(a, bits);
+#endif
+}
+
+static SIMDPP_INL
+float32<4> i_compress_bits(const float32<4>& a, uint64_t bits)
+{
+#if SIMDPP_USE_NULL
+    return v_emul_compress_bits(a, bits);
+#elif SIMDPP_USE_AVX512VL
+    return _mm_maskz_compress_ps(bits, a.native());
+#else
+    return bit_cast<float32<4>>(i_compress_bits(bit_cast<uint32<4>>(a), bits));
+#endif
+}
+
+static SIMDPP_INL
+float64<2> i_compress_bits(const float64<2>& a, uint64_t bits)
+{
+#if SIMDPP_USE_NULL
+    return v_emul_compress_bits(a, bits);
+#elif SIMDPP_USE_AVX512VL
+    return _mm_maskz_compress_pd(bits, a.native());
+#else
+    return bit_cast<float64<2>>(i_compress_bits(bit_cast<uint64<2>>(a), bits));
+#endif
+}
+
+// -----------------------------------------------------------------------------
+
+static SIMDPP_INL
+uint8<16> i_expand_bits(const uint8<16>& a, uint64_t bits)
+{
+#if SIMDPP_USE_AVX512VBMI2 && SIMDPP_USE_AVX512VL
+    return _mm_maskz_expand_epi8(bits, a.native());
+#elif SIMDPP_USE_SSSE3 || SIMDPP_USE_NEON || SIMDPP_USE_ALTIVEC || SIMDPP_USE_MSA
+    // The elements of the higher half start after the elements selected by
+    // the lower half. The 0x80 values stay negative.
+    uint64_t idx_lo, idx_hi;
+    std::memcpy(&idx_lo, expand_table_entry(bits & 0xff), 8);
+    std::memcpy(&idx_hi, expand_table_entry((bits >> 8) & 0xff), 8);
+    idx_hi += v_mask_bits_count(bits & 0xff) * uint64_t(0x0101010101010101);
+
+    uint8_t SIMDPP_ALIGN(16) idx[16];
+    std::memcpy(idx, &idx_lo, 8);
+    std::memcpy(idx + 8, &idx_hi, 8);
+    return permute_zbytes16(a, load<uint8<16>>(idx));
+#else
+    return v_emul_expand_bits(a, bits);
+#endif
+}
+
+static SIMDPP_INL
+uint16<8> i_expand_bits(const uint16<8>& a, uint64_t bits)
+{
+#if SIMDPP_USE_AVX512VBMI2 && SIMDPP_USE_AVX512VL
+    return _mm_maskz_expand_epi16(bits, a.native());
+#elif SIMDPP_USE_SSSE3 || SIMDPP_USE_NEON || SIMDPP_USE_ALTIVEC || SIMDPP_USE_MSA
+    return (uint16<8>) permute_zbytes16(uint8<16>(a),
+                                        v_compress_idx16(expand_table_entry(bits)));
+#else
+    return v_emul_expand_bits(a, bits);
+#endif
+}
+
+static SIMDPP_INL
+uint32<4> i_expand_bits(const uint32<4>& a, uint64_t bits)
+{
+#if SIMDPP_USE_AVX512VL
+    return _mm_maskz_expand_epi32(bits, a.native());
+#elif SIMDPP_USE_SSSE3 || SIMDPP_USE_NEON || SIMDPP_USE_ALTIVEC || SIMDPP_USE_MSA
+    return (uint32<4>) permute_zbytes16(uint8<16>(a),
+                                        v_compress_idx32(expand_table_entry(bits)));
+#else
+    return v_emul_expand_bits(a, bits);
+#endif
+}
+
+static SIMDPP_INL
+uint64<2> i_expand_bits(const uint64<2>& a, uint64_t bits)
+{
+#if SIMDPP_USE_AVX512VL
+    return _mm_maskz_expand_epi64(bits, a.native());
+#elif SIMDPP_USE_SSSE3 || SIMDPP_USE_NEON || SIMDPP_USE_VSX_207 || SIMDPP_USE_MSA
+    return (uint64<2>) permute_zbytes16(uint8<16>(a),
+                                        v_compress_idx64(expand_table_entry(bits)));
+#else
+    return v_emul_expand_bits(a, bits);
+#endif
+}
+
+static SIMDPP_INL
+float32<4> i_expand_bits(const float32<4>& a, uint64_t bits)
+{
+#if SIMDPP_USE_NULL
+    return v_emul_expand_bits(a, bits);
+#elif SIMDPP_USE_AVX512VL
+    return _mm_maskz_expand_ps(bits, a.native());
+#else
+    return bit_cast<float32<4>>(i_expand_bits(bit_cast<uint32<4>>(a), bits));
+#endif
+}
+
+static SIMDPP_INL
+float64<2> i_expand_bits(const float64<2>& a, uint64_t bits)
+{
+#if SIMDPP_USE_NULL
+    return v_emul_expand_bits(a, bits);
+#elif SIMDPP_USE_AVX512VL
+    return _mm_maskz_expand_pd(bits, a.native());
+#else
+    return bit_cast<float64<2>>(i_expand_bits(bit_cast<uint64<2>>(a), bits));
+#endif
+}
+
+// -----------------------------------------------------------------------------
+
+#if SIMDPP_USE_AVX2
+static SIMDPP_INL
+uint8<32> i_compress_bits(const uint8<32>& a, uint64_t bits);
+static SIMDPP_INL
+uint16<16> i_compress_bits(const uint16<16>& a, uint64_t bits);
+static SIMDPP_INL
+uint8<32> i_expand_bits(const uint8<32>& a, uint64_t bits);
+static SIMDPP_INL
+uint16<16> i_expand_bits(const uint16<16>& a, uint64_t bits);
+#endif
+
+// Processes the vector as two halves of type H
+template<class H, class V> SIMDPP_INL
+V v_compress_bits_split(const V& a, uint64_t bits)
+{
+    using E = typename V::element_type;
+    H a0, a1;
+    split(a, a0, a1);
+    uint64_t bits0 = bits & ((uint64_t(1) << H::length) - 1);
+    uint64_t bits1 = bits >> H::length;
+
+    mem_block<V> r;
+    E* p = &r[0];
+    store(p, i_compress_bits(a0, bits0));
+    store(p + H::length, (H) make_zero());
+    store_u(p + v_mask_bits_count(bits0), i_compress_bits(a1, bits1));
+    return r;
+}
+
+template<class H, class V> SIMDPP_INL
+V v_expand_bits_split(const V& a, uint64_t bits)
+{
+    uint64_t bits0 = bits & ((uint64_t(1) << H::length) - 1);
+    uint64_t bits1 = bits >> H::length;
+
+    mem_block<V> ai(a);
+    H r0 = i_expand_bits(load<H>(ai.data()), bits0);
+    H r1 = i_expand_bits(load_u<H>(ai.data() + v_mask_bits_count(bits0)), bits1);
+    return combine(r0, r1);
+}
+
+#if SIMDPP_USE_AVX2
+static SIMDPP_INL
+uint8<32> i_compress_bits(const uint8<32>& a, uint64_t bits)
+{
+#if SIMDPP_USE_AVX512VBMI2 && SIMDPP_USE_AVX512VL
+    return _mm256_maskz_compress_epi8(bits, a.native());
+#else
+    return v_compress_bits_split<uint8<16>>(a, bits);
+#endif
+}
+
+static SIMDPP_INL
+uint16<16> i_compress_bits(const uint16<16>& a, uint64_t bits)
+{
+#if SIMDPP_USE_AVX512VBMI2 && SIMDPP_USE_AVX512VL
+    return _mm256_maskz_compress_epi16(bits, a.native());
+#else
+    return v_compress_bits_split<uint16<8>>(a, bits);
+#endif
+}
+
+static SIMDPP_INL
+uint32<8> i_compress_bits(const uint32<8>& a, uint64_t bits)
+{
+#if SIMDPP_USE_AVX512VL
+    return _mm256_maskz_compress_epi32(bits, a.native());
+#else
+    return v_permutevar_zero(a.native(),
+                             v_compress_permutevar_idx32(compress_table_entry(bits)));
+#endif
+}
+
+static SIMDPP_INL
+uint64<4> i_compress_bits(const uint64<4>& a, uint64_t bits)
+{
+#if SIMDPP_USE_AVX512VL
+    return _mm256_maskz_compress_epi64(bits, a.native());
+#else
+    return v_permutevar_zero(a.native(),
+                             v_compress_permutevar_idx64(compress_table_entry(bits)));
+#endif
+}
+
+static SIMDPP_INL
+uint8<32> i_expand_bits(const uint8<32>& a, uint64_t bits)
+{
+#if SIMDPP_USE_AVX512VBMI2 && SIMDPP_USE_AVX512VL
+    return _mm256_maskz_expand_epi8(bits, a.native());
+#else
+    return v_expand_bits_split<uint8<16>>(a, bits);
+#endif
+}
+
+static SIMDPP_INL
+uint16<16> i_expand_bits(const uint16<16>& a, uint64_t bits)
+{
+#if SIMDPP_USE_AVX512VBMI2 && SIMDPP_USE_AVX512VL
+    return _mm256_maskz_expand_epi16(bits, a.native());
+#else
+    return v_expand_bits_split<uint16<8>>(a, bits);
+#endif
+}
+
+static SIMDPP_INL
+uint32<8> i_expand_bits(const uint32<8>& a, uint64_t bits)
+{
+#if SIMDPP_USE_AVX512VL
+    return _mm256_maskz_expand_epi32(bits, a.native());
+#else
+    return v_permutevar_zero(a.native(),
+                             v_compress_permutevar_idx32(expand_table_entry(bits)));
+#endif
+}
+
+static SIMDPP_INL
+uint64<4> i_expand_bits(const uint64<4>& a, uint64_t bits)
+{
+#if SIMDPP_USE_AVX512VL
+    return _mm256_maskz_expand_epi64(bits, a.native());
+#else
+    return v_permutevar_zero(a.native(),
+                             v_compress_permutevar_idx64(expand_table_entry(bits)));
+#endif
+}
+#endif
+
+#if SIMDPP_USE_AVX
+static SIMDPP_INL
+float32<8> i_compress_bits(const float32<8>& a, uint64_t bits)
+{
+#if SIMDPP_USE_AVX512VL
+    return _mm256_maskz_compress_ps(bits, a.native());
+#elif SIMDPP_USE_AVX2
+    return bit_cast<float32<8>>(i_compress_bits(bit_cast<uint32<8>>(a), bits));
+#else
+    return v_compress_bits_split<float32<4>>(a, bits);
+#endif
+}
+
+static SIMDPP_INL
+float64<4> i_compress_bits(const float64<4>& a, uint64_t bits)
+{
+#if SIMDPP_USE_AVX512VL
+    return _mm256_maskz_compress_pd(bits, a.native());
+#elif SIMDPP_USE_AVX2
+    return bit_cast<float64<4>>(i_compress_bits(bit_cast<uint64<4>>(a), bits));
+#else
+    return v_compress_bits_split<float64<2>>(a, bits);
+#endif
+}
+
+static SIMDPP_INL
+float32<8> i_expand_bits(const float32<8>& a, uint64_t bits)
+{
+#if SIMDPP_USE_AVX512VL
+    return _mm256_maskz_expand_ps(bits, a.native());
+#elif SIMDPP_USE_AVX2
+    return bit_cast<float32<8>>(i_expand_bits(bit_cast<uint32<8>>(a), bits));
+#else
+    return v_expand_bits_split<float32<4>>(a, bits);
+#endif
+}
+
+static SIMDPP_INL
+float64<4> i_expand_bits(const float64<4>& a, uint64_t bits)
+{
+#if SIMDPP_USE_AVX512VL
+    return _mm256_maskz_expand_pd(bits, a.native());
+#elif SIMDPP_USE_AVX2
+    return bit_cast<float64<4>>(i_expand_bits(bit_cast<uint64<4>>(a), bits));
+#else
+    return v_expand_bits_split<float64<2>>(a, bits);
+#endif
+}
+#endif
+
+#if SIMDPP_USE_AVX512BW
+static SIMDPP_INL
+uint8<64> i_compress_bits(const uint8<64>& a, uint64_t bits)
+{
+#if SIMDPP_USE_AVX512VBMI2
+    return _mm512_maskz_compress_epi8(bits, a.native());
+#else
+    return v_compress_bits_split<uint8<32>>(a, bits);
+#endif
+}
+
+static SIMDPP_INL
+uint16<32> i_compress_bits(const uint16<32>& a, uint64_t bits)
+{
+#if SIMDPP_USE_AVX512VBMI2
+    return _mm512_maskz_compress_epi16(bits, a.native());
+#else
+    return v_compress_bits_split<uint16<16>>(a, bits);
+#endif
+}
+
+static SIMDPP_INL
+uint8<64> i_expand_bits(const uint8<64>& a, uint64_t bits)
+{
+#if SIMDPP_USE_AVX512VBMI2
+    return _mm512_maskz_expand_epi8(bits, a.native());
+#else
+    return v_expand_bits_split<uint8<32>>(a, bits);
+#endif
+}
+
+static SIMDPP_INL
+uint16<32> i_expand_bits(const uint16<32>& a, uint64_t bits)
+{
+#if SIMDPP_USE_AVX512VBMI2
+    return _mm512_maskz_expand_epi16(bits, a.native());
+#else
+    return v_expand_bits_split<uint16<16>>(a, bits);
+#endif
+}
+#endif
+
+#if SIMDPP_USE_AVX512F
+static SIMDPP_INL
+uint32<16> i_compress_bits(const uint32<16>& a, uint64_t bits)
+{
+    return _mm512_maskz_compress_epi32(bits, a.native());
+}
+
+static SIMDPP_INL
+uint64<8> i_compress_bits(const uint64<8>& a, uint64_t bits)
+{
+    return _mm512_maskz_compress_epi64(bits, a.native());
+}
+
+static SIMDPP_INL
+float32<16> i_compress_bits(const float32<16>& a, uint64_t bits)
+{
+    return _mm512_maskz_compress_ps(bits, a.native());
+}
+
+static SIMDPP_INL
+float64<8> i_compress_bits(const float64<8>& a, uint64_t bits)
+{
+    return _mm512_maskz_compress_pd(bits, a.native());
+}
+
+static SIMDPP_INL
+uint32<16> i_expand_bits(const uint32<16>& a, uint64_t bits)
+{
+    return _mm512_maskz_expand_epi32(bits, a.native());
+}
+
+static SIMDPP_INL
+uint64<8> i_expand_bits(const uint64<8>& a, uint64_t bits)
+{
+    return _mm512_maskz_expand_epi64(bits, a.native());
+}
+
+static SIMDPP_INL
+float32<16> i_expand_bits(const float32<16>& a, uint64_t bits)
+{
+    return _mm512_maskz_expand_ps(bits, a.native());
+}
+
+static SIMDPP_INL
+float64<8> i_expand_bits(const float64<8>& a, uint64_t bits)
+{
+    return _mm512_maskz_expand_pd(bits, a.native());
+}
+#endif
+
+// -----------------------------------------------------------------------------
+
+/*  The native compress-store and expand-load instructions access only the
+    selected elements. Elsewhere the data is compressed or expanded within a
+    register and only the selected elements are copied from or to memory.
+*/
+template<class V> SIMDPP_INL
+unsigned i_compress_store_bits(char* p, const V& a, uint64_t bits)
+{
+    using E = typename V::element_type;
+    unsigned n = v_mask_bits_count(bits);
+    mem_block<V> r = i_compress_bits(a, bits);
+    std::memcpy(p, r.data(), n * sizeof(E));
+    return n;
+}
+
+template<class V> SIMDPP_INL
+void i_expand_load_bits(V& r, const char* p, uint64_t bits)
+{
+    using E = typename V::element_type;
+    mem_block<V> a = (V) make_zero();
+    std::memcpy(&a[0], p, v_mask_bits_count(bits) * sizeof(E));
+    r = i_expand_bits((V) a, bits);
+}
+
+#if SIMDPP_USE_AVX512VBMI2 && SIMDPP_USE_AVX512VL
+static SIMDPP_INL
+unsigned i_compress_store_bits(char* p, const uint8<16>& a, uint64_t bits)
+{
+    _mm_mask_compressstoreu_epi8(p, bits, a.native());
+    return v_mask_bits_count(bits);
+}
+
+static SIMDPP_INL
+unsigned i_compress_store_bits(char* p, const uint16<8>& a, uint64_t bits)
+{
+    _mm_mask_compressstoreu_epi16(p, bits, a.native());
+    return v_mask_bits_count(bits);
+}
+
+static SIMDPP_INL
+unsigned i_compress_store_bits(char* p, const uint8<32>& a, uint64_t bits)
+{
+    _mm256_mask_compressstoreu_epi8(p, bits, a.native());
+    return v_mask_bits_count(bits);
+}
+
+static SIMDPP_INL
+unsigned i_compress_store_bits(char* p, const uint16<16>& a, uint64_t bits)
+{
+    _mm256_mask_compressstoreu_epi16(p, bits, a.native());
+    return v_mask_bits_count(bits);
+}
+
+static SIMDPP_INL
+void i_expand_load_bits(uint8<16>& r, const char* p, uint64_t bits)
+{
+    r = _mm_maskz_expandloadu_epi8(bits, p);
+}
+
+static SIMDPP_INL
+void i_expand_load_bits(uint16<8>& r, const char* p, uint64_t bits)
+{
+    r = _mm_maskz_expandloadu_epi16(bits, p);
+}
+
+static SIMDPP_INL
+void i_expand_load_bits(uint8<32>& r, const char* p, uint64_t bits)
+{
+    r = _mm256_maskz_expandloadu_epi8(bits, p);
+}
+
+static SIMDPP_INL
+void i_expand_load_bits(uint16<16>& r, const char* p, uint64_t bits)
+{
+    r = _mm256_maskz_expandloadu_epi16(bits, p);
+}
+#endif
+
+#if SIMDPP_USE_AVX512VBMI2
+static SIMDPP_INL
+unsigned i_compress_store_bits(char* p, const uint8<64>& a, uint64_t bits)
+{
+    _mm512_mask_compressstoreu_epi8(p, bits, a.native());
+    return v_mask_bits_count(bits);
+}
+
+static SIMDPP_INL
+unsigned i_compress_store_bits(char* p, const uint16<32>& a, uint64_t bits)
+{
+    _mm512_mask_compressstoreu_epi16(p, bits, a.native());
+    return v_mask_bits_count(bits);
+}
+
+static SIMDPP_INL
+void i_expand_load_bits(uint8<64>& r, const char* p, uint64_t bits)
+{
+    r = _mm512_maskz_expandloadu_epi8(bits, p);
+}
+
+static SIMDPP_INL
+void i_expand_load_bits(uint16<32>& r, const char* p, uint64_t bits)
+{
+    r = _mm512_maskz_expandloadu_epi16(bits, p);
+}
+#endif
+
+#if SIMDPP_USE_AVX512VL
+static SIMDPP_INL
+unsigned i_compress_store_bits(char* p, const uint32<4>& a, uint64_t bits)
+{
+    _mm_mask_compressstoreu_epi32(p, bits, a.native());
+    return v_mask_bits_count(bits);
+}
+
+static SIMDPP_INL
+unsigned i_compress_store_bits(char* p, const uint64<2>& a, uint64_t bits)
+{
+    _mm_mask_compressstoreu_epi64(p, bits, a.native());
+    return v_mask_bits_count(bits);
+}
+
+static SIMDPP_INL
+unsigned i_compress_store_bits(char* p, const float32<4>& a, uint64_t bits)
+{
+    _mm_mask_compressstoreu_ps(p, bits, a.native());
+    return v_mask_bits_count(bits);
+}
+
+static SIMDPP_INL
+unsigned i_compress_store_bits(char* p, const float64<2>& a, uint64_t bits)
+{
+    _mm_mask_compressstoreu_pd(p, bits, a.native());
+    return v_mask_bits_count(bits);
+}
+
+static SIMDPP_INL
+unsigned i_compress_store_bits(char* p, const uint32<8>& a, uint64_t bits)
+{
+    _mm256_mask_compressstoreu_epi32(p, bits, a.native());
+    return v_mask_bits_count(bits);
+}
+
+static SIMDPP_INL
+unsigned i_compress_store_bits(char* p, const uint64<4>& a, uint64_t bits)
+{
+    _mm256_mask_compressstoreu_epi64(p, bits, a.native());
+    return v_mask_bits_count(bits);
+}
+
+static SIMDPP_INL
+unsigned i_compress_store_bits(char* p, const float32<8>& a, uint64_t bits)
+{
+    _mm256_mask_compressstoreu_ps(p, bits, a.native());
+    return v_mask_bits_count(bits);
+}
+
+static SIMDPP_INL
+unsigned i_compress_store_bits(char* p, const float64<4>& a, uint64_t bits)
+{
+    _mm256_mask_compressstoreu_pd(p, bits, a.native());
+    return v_mask_bits_count(bits);
+}
+
+static SIMDPP_INL
+void i_expand_load_bits(uint32<4>& r, const char* p, uint64_t bits)
+{
+    r = _mm_maskz_expandloadu_epi32(bits, p);
+}
+
+static SIMDPP_INL
+void i_expand_load_bits(uint64<2>& r, const char* p, uint64_t bits)
+{
+    r = _mm_maskz_expandloadu_epi64(bits, p);
+}
+
+static SIMDPP_INL
+void i_expand_load_bits(float32<4>& r, const char* p, uint64_t bits)
+{
+    r = _mm_maskz_expandloadu_ps(bits, p);
+}
+
+static SIMDPP_INL
+void i_expand_load_bits(float64<2>& r, const char* p, uint64_t bits)
+{
+    r = _mm_maskz_expandloadu_pd(bits, p);
+}
+
+static SIMDPP_INL
+void i_expand_load_bits(uint32<8>& r, const char* p, uint64_t bits)
+{
+    r = _mm256_maskz_expandloadu_epi32(bits, p);
+}
+
+static SIMDPP_INL
+void i_expand_load_bits(uint64<4>& r, const char* p, uint64_t bits)
+{
+    r = _mm256_maskz_expandloadu_epi64(bits, p);
+}
+
+static SIMDPP_INL
+void i_expand_load_bits(float32<8>& r, const char* p, uint64_t bits)
+{
+    r = _mm256_maskz_expandloadu_ps(bits, p);
+}
+
+static SIMDPP_INL
+void i_expand_load_bits(float64<4>& r, const char* p, uint64_t bits)
+{
+    r = _mm256_maskz_expandloadu_pd(bits, p);
+}
+#endif
+
+#if SIMDPP_USE_AVX512F
+static SIMDPP_INL
+unsigned i_compress_store_bits(char* p, const uint32<16>& a, uint64_t bits)
+{
+    _mm512_mask_compressstoreu_epi32(p, bits, a.native());
+    return v_mask_bits_count(bits);
+}
+
+static SIMDPP_INL
+unsigned i_compress_store_bits(char* p, const uint64<8>& a, uint64_t bits)
+{
+    _mm512_mask_compressstoreu_epi64(p, bits, a.native());
+    return v_mask_bits_count(bits);
+}
+
+static SIMDPP_INL
+unsigned i_compress_store_bits(char* p, const float32<16>& a, uint64_t bits)
+{
+    _mm512_mask_compressstoreu_ps(p, bits, a.native());
+    return v_mask_bits_count(bits);
+}
+
+static SIMDPP_INL
+unsigned i_compress_store_bits(char* p, const float64<8>& a, uint64_t bits)
+{
+    _mm512_mask_compressstoreu_pd(p, bits, a.native());
+    return v_mask_bits_count(bits);
+}
+
+static SIMDPP_INL
+void i_expand_load_bits(uint32<16>& r, const char* p, uint64_t bits)
+{
+    r = _mm512_maskz_expandloadu_epi32(bits, p);
+}
+
+static SIMDPP_INL
+void i_expand_load_bits(uint64<8>& r, const char* p, uint64_t bits)
+{
+    r = _mm512_maskz_expandloadu_epi64(bits, p);
+}
+
+static SIMDPP_INL
+void i_expand_load_bits(float32<16>& r, const char* p, uint64_t bits)
+{
+    r = _mm512_maskz_expandloadu_ps(bits, p);
+}
+
+static SIMDPP_INL
+void i_expand_load_bits(float64<8>& r, const char* p, uint64_t bits)
+{
+    r = _mm512_maskz_expandloadu_pd(bits, p);
+}
+#endif
+
+// -----------------------------------------------------------------------------
+
+// The elements selected from each native vector are placed immediately after
+// the elements selected from the preceding native vectors
+template<class V, class M> SIMDPP_INL
+V i_compress(const V& a, const M& mask)
+{
+    using B = typename V::base_vector_type;
+    using E = typename V::element_type;
+
+    V r;
+    if (V::vec_length == 1) {
+        r.vec(0) = i_compress_bits(a.vec(0), i_extract_mask_bits(mask.vec(0)));
+        return r;
+    }
+
+    mem_block<V> rm;
+    E* p = &rm[0];
+    unsigned n = 0;
+    for (unsigned i = 0; i < V::vec_length; ++i) {
+        uint64_t bits = i_extract_mask_bits(mask.vec(i));
+        store(p + i * B::length, (B) make_zero());
+        store_u(p + n, i_compress_bits(a.vec(i), bits));
+        n += v_mask_bits_count(bits);
+    }
+    r = rm;
+    return r;
+}
+
+template<class V, class M> SIMDPP_INL
+unsigned i_compress_store(char* p, const V& a, const M& mask)
+{
+    using E = typename V::element_type;
+
+    unsigned n = 0;
+    for (unsigned i = 0; i < V::vec_length; ++i) {
+        n += i_compress_store_bits(p + n * sizeof(E), a.vec(i),
+                                   i_extract_mask_bits(mask.vec(i)));
+    }
+    return n;
+}
+
+template<class V, class M> SIMDPP_INL
+void i_expand_load(V& r, const char* p, const M& mask)
+{
+    using E = typename V::element_type;
+
+    for (unsigned i = 0; i < V::vec_length; ++i) {
+        uint64_t bits = i_extract_mask_bits(mask.vec(i));
+        i_expand_load_bits(r.vec(i), p, bits);
+        p += v_mask_bits_count(bits) * sizeof(E);
+    }
+}
+
+} // namespace insn
+} // namespace detail
+} // namespace SIMDPP_ARCH_NAMESPACE
+} // namespace simdpp
+
+#endif
+
@@ -0,0 +1,232 @@
+/*  Copyright (C) 2017  Povilas Kanapickas <povilas@radix.lt>
+
+    Distributed under the Boost Software License, Version 1.0.
+        (See accompanying file LICENSE_1_0.txt or copy at
+            http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#ifndef LIBSIMDPP_SIMDPP_DETAIL_INSN_CONV_FLOAT16_H
+#define LIBSIMDPP_SIMDPP_DETAIL_INSN_CONV_FLOAT16_H
+
+#ifndef LIBSIMDPP_SIMD_H
+    #error "This file must be included through simd.h"
+#endif
+
+#include <simdpp/types.h>
+#include <simdpp/core/bit_and.h>
+#include <simdpp/core/bit_or.h>
+#include <simdpp/core/bit_xor.h>
+#include <simdpp/core/blend.h>
+#include <simdpp/core/cast.h>
+#include <simdpp/core/cmp_eq.h>
+#include <simdpp/core/cmp_gt.h>
+#include <simdpp/core/cmp_lt.h>
+#include <simdpp/core/combine.h>
+#include <simdpp/core/f_add.h>
+#include <simdpp/core/f_sub.h>
+#include <simdpp/core/i_add.h>
+#include <simdpp/core/i_shift_l.h>
+#include <simdpp/core/i_shift_r.h>
+#include <simdpp/core/i_sub.h>
+#include <simdpp/core/set_splat.h>
+#include <simdpp/core/split.h>
+#include <simdpp/detail/insn/conv_extend_to_int32.h>
+#include <simdpp/detail/insn/conv_shrink_to_int16.h>
+#include <simdpp/detail/vector_array_conv_macros.h>
+
+namespace simdpp {
+namespace SIMDPP_ARCH_NAMESPACE {
+namespace detail {
+namespace insn {
+
+/*  Converts IEEE half-precision values held in the low 16 bits of each
+    element. The exponent and mantissa are moved to their single-precision
+    positions and the exponent is rebiased. Infinities and NaNs get the
+    maximum exponent. Denormals are renormalized by a floating-point
+    subtraction.
+*/
+template<unsigned N> SIMDPP_INL
+float32<N> v_emul_float16_to_float32(const uint32<N>& h)
+{
+    using U = uint32<N>;
+    U o = shift_l<13>(bit_and(h, splat<U>(0x7fff)));
+    U e = bit_and(o, splat<U>(0x0f800000));
+    o = add(o, splat<U>(0x38000000));
+
+    U inf_adj = bit_and(cmp_eq(e, splat<U>(0x0f800000)), splat<U>(0x38000000));
+    o = add(o, inf_adj);
+
+    float32<N> den = sub(bit_cast<float32<N>>(add(o, splat<U>(0x00800000))),
+                         bit_cast<float32<N>>(splat<U>(0x38800000)));
+    o = blend(bit_cast<U>(den), o, cmp_eq(e, (U) make_zero()));
+    o = bit_or(o, shift_l<16>(bit_and(h, splat<U>(0x8000))));
+    return bit_cast<float32<N>>(o);
+}
+
+/*  Converts to half-precision with rounding to nearest even. Values that are
+    too large become infinity and NaNs become a quiet NaN. Results that are
+    denormal in half-precision are rounded by a floating-point addition that
+    aligns the mantissa. Otherwise the mantissa is rounded by adding 0xfff
+    plus the lowest retained bit.
+*/
+template<unsigned N> SIMDPP_INL
+uint32<N> v_emul_float32_to_float16(const float32<N>& a)
+{
+    using U = uint32<N>;
+    using S = int32<N>;
+    U f = bit_cast<U>(a);
+    U sign = bit_and(f, splat<U>(0x80000000));
+    f = bit_xor(f, sign);
+    S fs = f;
+
+    U den = bit_cast<U>(add(bit_cast<float32<N>>(f),
+                            bit_cast<float32<N>>(splat<U>(0x3f000000))));
+    den = sub(den, splat<U>(0x3f000000));
+
+    U odd = bit_and(shift_r<13>(f), splat<U>(1));
+    U nrm = shift_r<13>(add(add(f, splat<U>(0xc8000fff)), odd));
+
+    U inf = blend(splat<U>(0x7e00), splat<U>(0x7c00),
+                  cmp_gt(fs, splat<S>(0x7f800000)));
+
+    U r = blend(den, nrm, cmp_lt(fs, splat<S>(0x38800000)));
+    r = blend(r, inf, cmp_lt(fs, splat<S>(0x47800000)));
+    return bit_or(r, shift_r<16>(sign));
+}
+
+// -----------------------------------------------------------------------------
+
+static SIMDPP_INL
+float32<8> i_float16_to_float32(const uint16<8>& a)
+{
+#if SIMDPP_USE_F16C
+    return _mm256_cvtph_ps(a.native());
+#elif SIMDPP_USE_NEON64
+    float32<8> r;
+    float16x8_t h = vreinterpretq_f16_u16(a.native());
+    r.vec(0) = vcvt_f32_f16(vget_low_f16(h));
+    r.vec(1) = vcvt_high_f32_f16(h);
+    return r;
+#else
+    return v_emul_float16_to_float32(i_to_uint32(a));
+#endif
+}
+
+#if SIMDPP_USE_AVX2
+static SIMDPP_INL
+float32<16> i_float16_to_float32(const uint16<16>& a)
+{
+#if SIMDPP_USE_AVX512F
+    return _mm512_cvtph_ps(a.native());
+#else
+    float32<16> r;
+    uint16<8> a0, a1;
+    split(a, a0, a1);
+    r.vec(0) = i_float16_to_float32(a0);
+    r.vec(1) = i_float16_to_float32(a1);
+    return r;
+#endif
+}
+#endif
+
+#if SIMDPP_USE_AVX512BW
+static SIMDPP_INL
+float32<32> i_float16_to_float32(const uint16<32>& a)
+{
+    float32<32> r;
+    uint16<16> a0, a1;
+    split(a, a0, a1);
+    r.vec(0) = _mm512_cvtph_ps(a0.native());
+    r.vec(1) = _mm512_cvtph_ps(a1.native());
+    return r;
+}
+#endif
+
+template<unsigned N> SIMDPP_INL
+float32<N> i_float16_to_float32(const uint16<N>& a)
+{
+    SIMDPP_VEC_ARRAY_IMPL_CONV_INSERT(float32<N>, i_float16_to_float32, a)
+}
+
+// -----------------------------------------------------------------------------
+
+static SIMDPP_INL
+uint16<8> i_float32_to_float16(const float32<8>& a)
+{
+#if SIMDPP_USE_F16C
+    return _mm256_cvtps_ph(a.native(), _MM_FROUND_TO_NEAREST_INT);
+#elif SIMDPP_USE_NEON64
+    float16x4_t lo = vcvt_f16_f32(a.vec(0).native());
+    return vreinterpretq_u16_f16(vcvt_high_f16_f32(lo, a.vec(1).native()));
+#else
+    return i_to_uint16(v_emul_float32_to_float16(a));
+#endif
+}
+
+#if SIMDPP_USE_AVX2
+static SIMDPP_INL
+uint16<16> i_float32_to_float16(const float32<16>& a)
+{
+#if SIMDPP_USE_AVX512F
+    return _mm512_cvtps_ph(a.native(), _MM_FROUND_TO_NEAREST_INT);
+#else
+    uint16<8> r0 = i_float32_to_float16(a.vec(0));
+    uint16<8> r1 = i_float32_to_float16(a.vec(1));
+    return combine(r0, r1);
+#endif
+}
+#endif
+
+#if SIMDPP_USE_AVX512BW
+static SIMDPP_INL
+uint16<32> i_float32_to_float16(const float32<32>& a)
+{
+    uint16<16> r0 = _mm512_cvtps_ph(a.vec(0).native(), _MM_FROUND_TO_NEAREST_INT);
+    uint16<16> r1 = _mm512_cvtps_ph(a.vec(1).native(), _MM_FROUND_TO_NEAREST_INT);
+    return combine(r0, r1);
+}
+#endif
+
+template<unsigned N> SIMDPP_INL
+uint16<N> i_float32_to_float16(const float32<N>& a)
+{
+    SIMDPP_VEC_ARRAY_IMPL_CONV_EXTRACT(uint16<N>, i_float32_to_float16, a)
+}
+
+// -----------------------------------------------------------------------------
+
+// bfloat16 values are the upper halves of single-precision values
+template<unsigned N> SIMDPP_INL
+float32<N> i_bfloat16_to_float32(const uint16<N>& a)
+{
+    return bit_cast<float32<N>>(shift_l<16>(i_to_uint32(a)));
+}
+
+/*  The value is rounded to nearest even by adding 0x7fff plus the lowest
+    retained bit. NaNs are made quiet so that the truncation does not turn
+    them into infinities.
+
+    The AVX512-BF16 vcvtneps2bf16 instruction is not used: the library has no
+    instruction set flag for it, and it would save only about two integer
+    operations.
+*/
+template<unsigned N> SIMDPP_INL
+uint16<N> i_float32_to_bfloat16(const float32<N>& a)
+{
+    using U = uint32<N>;
+    using S = int32<N>;
+    U u = bit_cast<U>(a);
+    U odd = bit_and(shift_r<16>(u), splat<U>(1));
+    U r = shift_r<16>(add(u, add(odd, splat<U>(0x7fff))));
+    U nan = bit_or(shift_r<16>(u), splat<U>(0x40));
+    S abs_u = bit_and(u, splat<U>(0x7fffffff));
+    r = blend(nan, r, cmp_gt(abs_u, splat<S>(0x7f800000)));
+    return i_to_uint16(r);
+}
+
+} // namespace insn
+} // namespace detail
+} // namespace SIMDPP_ARCH_NAMESPACE
+} // namespace simdpp
+
+#endif
@@ -0,0 +1,347 @@
+/*  Copyright (C) 2017  Povilas Kanapickas <povilas@radix.lt>
+
+    Distributed under the Boost Software License, Version 1.0.
+        (See accompanying file LICENSE_1_0.txt or copy at
+            http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#ifndef LIBSIMDPP_SIMDPP_DETAIL_INSN_CONV_FLOAT_TO_INT32_ROUND_H
+#define LIBSIMDPP_SIMDPP_DETAIL_INSN_CONV_FLOAT_TO_INT32_ROUND_H
+
+#ifndef LIBSIMDPP_SIMD_H
+    #error "This file must be included through simd.h"
+#endif
+
+#include <cmath>
+#include <limits>
+#include <simdpp/types.h>
+#include <simdpp/core/bit_and.h>
+#include <simdpp/core/bit_xor.h>
+#include <simdpp/core/blend.h>
+#include <simdpp/core/cmp_eq.h>
+#include <simdpp/core/cmp_ge.h>
+#include <simdpp/core/cmp_gt.h>
+#include <simdpp/core/cmp_lt.h>
+#include <simdpp/core/f_ceil.h>
+#include <simdpp/core/f_floor.h>
+#include <simdpp/core/f_max.h>
+#include <simdpp/core/f_min.h>
+#include <simdpp/core/f_round.h>
+#include <simdpp/core/i_add.h>
+#include <simdpp/core/i_sub.h>
+#include <simdpp/core/make_int.h>
+#include <simdpp/detail/insn/conv_any_to_float32.h>
+#include <simdpp/detail/insn/conv_float_to_int32.h>
+#include <simdpp/detail/vector_array_conv_macros.h>
+
+namespace simdpp {
+namespace SIMDPP_ARCH_NAMESPACE {
+namespace detail {
+namespace insn {
+
+// Converts a scalar floating-point value to an integer, saturating out of
+// range values and converting NaN to zero
+template<class R, class F> SIMDPP_INL
+R v_scalar_to_int_sat(F x)
+{
+    if (x != x)
+        return 0;
+    // the limits of R are powers of two, thus representable exactly
+    if (x <= F(std::numeric_limits<R>::min()))
+        return std::numeric_limits<R>::min();
+    if (x >= -F(std::numeric_limits<R>::min()))
+        return std::numeric_limits<R>::max();
+    return R(x);
+}
+
+/*  Adjusts the result of truncating conversion to get the result of rounding
+    towards negative or positive infinity. The truncated value is converted
+    back to floating-point which is exact for all values within the range of
+    int32. The comparison masks are all ones where an adjustment is needed.
+*/
+template<unsigned N> SIMDPP_INL
+int32<N> v_emul_to_int32_floor(const float32<N>& a)
+{
+    int32<N> r = i_to_int32(a);
+    float32<N> f = i_to_float32(r);
+    int32<N> adj = int32<N>(cmp_gt(f, a).eval().unmask());
+    return add(r, adj);
+}
+
+template<unsigned N> SIMDPP_INL
+int32<N> v_emul_to_int32_ceil(const float32<N>& a)
+{
+    int32<N> r = i_to_int32(a);
+    float32<N> f = i_to_float32(r);
+    int32<N> adj = int32<N>(cmp_lt(f, a).eval().unmask());
+    return sub(r, adj);
+}
+
+#if SIMDPP_USE_SSE2
+/*  CVTTPS2DQ returns 0x80000000 for NaN and out of range values. This is
+    already the correct result for large negative values. Large positive
+    values are flipped to 0x7fffffff and NaNs are cleared.
+*/
+template<unsigned N> SIMDPP_INL
+int32<N> v_sse_to_int32_sat(const float32<N>& a)
+{
+    int32<N> r = i_to_int32(a);
+    int32<N> too_large = int32<N>(cmp_ge(a, 2147483648.0f).eval().unmask());
+    int32<N> not_nan = int32<N>(cmp_eq(a, a).eval().unmask());
+    r = bit_xor(r, too_large);
+    return bit_and(r, not_nan);
+}
+#endif
+
+// -----------------------------------------------------------------------------
+
+static SIMDPP_INL
+int32<4> i_to_int32_round(const float32<4>& a)
+{
+#if SIMDPP_USE_NULL || SIMDPP_USE_NEON_NO_FLT_SP
+    int32<4> r;
+    for (unsigned i = 0; i < a.length; i++) {
+        r.el(i) = int32_t(std::nearbyint(a.el(i)));
+    }
+    return r;
+#elif SIMDPP_USE_SSE2
+    // uses the rounding mode in MXCSR, which is round to nearest by default
+    return _mm_cvtps_epi32(a.native());
+#elif SIMDPP_USE_NEON64
+    return vcvtnq_s32_f32(a.native());
+#else
+    return i_to_int32(i_round(a));
+#endif
+}
+
+#if SIMDPP_USE_AVX
+static SIMDPP_INL
+int32<8> i_to_int32_round(const float32<8>& a)
+{
+#if SIMDPP_USE_AVX2
+    return _mm256_cvtps_epi32(a.native());
+#else
+    __m256i r = _mm256_cvtps_epi32(a.native());
+    uint32<4> r1, r2;
+    r1 = _mm256_castsi256_si128(r);
+    r2 = _mm256_extractf128_si256(r, 1);
+    return combine(r1, r2);
+#endif
+}
+#endif
+
+#if SIMDPP_USE_AVX512F
+static SIMDPP_INL
+int32<16> i_to_int32_round(const float32<16>& a)
+{
+    return _mm512_cvt_roundps_epi32(a.native(), _MM_FROUND_TO_NEAREST_INT |
+                                                _MM_FROUND_NO_EXC);
+}
+#endif
+
+template<unsigned N> SIMDPP_INL
+int32<N> i_to_int32_round(const float32<N>& a)
+{
+    SIMDPP_VEC_ARRAY_IMPL_CONV_INSERT(int32<N>, i_to_int32_round, a)
+}
+
+// -----------------------------------------------------------------------------
+
+static SIMDPP_INL
+int32<4> i_to_int32_floor(const float32<4>& a)
+{
+#if SIMDPP_USE_NULL || SIMDPP_USE_NEON_NO_FLT_SP
+    int32<4> r;
+    for (unsigned i = 0; i < a.length; i++) {
+        r.el(i) = int32_t(std::floor(a.el(i)));
+    }
+    return r;
+#elif SIMDPP_USE_SSE4_1
+    return _mm_cvttps_epi32(_mm_floor_ps(a.native()));
+#elif SIMDPP_USE_NEON64
+    return vcvtmq_s32_f32(a.native());
+#elif SIMDPP_USE_SSE2 || SIMDPP_USE_NEON_FLT_SP || SIMDPP_USE_MSA
+    return v_emul_to_int32_floor(a);
+#elif SIMDPP_USE_ALTIVEC
+    return i_to_int32(i_floor(a));
+#endif
+}
+
+#if SIMDPP_USE_AVX
+static SIMDPP_INL
+int32<8> i_to_int32_floor(const float32<8>& a)
+{
+    return i_to_int32(i_floor(a));
+}
+#endif
+
+#if SIMDPP_USE_AVX512F
+static SIMDPP_INL
+int32<16> i_to_int32_floor(const float32<16>& a)
+{
+    return _mm512_cvt_roundps_epi32(a.native(), _MM_FROUND_TO_NEG_INF |
+                                                _MM_FROUND_NO_EXC);
+}
+#endif
+
+template<unsigned N> SIMDPP_INL
+int32<N> i_to_int32_floor(const float32<N>& a)
+{
+    SIMDPP_VEC_ARRAY_IMPL_CONV_INSERT(int32<N>, i_to_int32_floor, a)
+}
+
+// -----------------------------------------------------------------------------
+
+static SIMDPP_INL
+int32<4> i_to_int32_ceil(const float32<4>& a)
+{
+#if SIMDPP_USE_NULL || SIMDPP_USE_NEON_NO_FLT_SP
+    int32<4> r;
+    for (unsigned i = 0; i < a.length; i++) {
+        r.el(i) = int32_t(std::ceil(a.el(i)));
+    }
+    return r;
+#elif SIMDPP_USE_SSE4_1
+    return _mm_cvttps_epi32(_mm_ceil_ps(a.native()));
+#elif SIMDPP_USE_NEON64
+    return vcvtpq_s32_f32(a.native());
+#elif SIMDPP_USE_SSE2 || SIMDPP_USE_NEON_FLT_SP || SIMDPP_USE_MSA
+    return v_emul_to_int32_ceil(a);
+#elif SIMDPP_USE_ALTIVEC
+    return i_to_int32(i_ceil(a));
+#endif
+}
+
+#if SIMDPP_USE_AVX
+static SIMDPP_INL
+int32<8> i_to_int32_ceil(const float32<8>& a)
+{
+    return i_to_int32(i_ceil(a));
+}
+#endif
+
+#if SIMDPP_USE_AVX512F
+static SIMDPP_INL
+int32<16> i_to_int32_ceil(const float32<16>& a)
+{
+    return _mm512_cvt_roundps_epi32(a.native(), _MM_FROUND_TO_POS_INF |
+                                                _MM_FROUND_NO_EXC);
+}
+#endif
+
+template<unsigned N> SIMDPP_INL
+int32<N> i_to_int32_ceil(const float32<N>& a)
+{
+    SIMDPP_VEC_ARRAY_IMPL_CONV_INSERT(int32<N>, i_to_int32_ceil, a)
+}
+
+// -----------------------------------------------------------------------------
+
+static SIMDPP_INL
+int32<4> i_to_int32_sat(const float32<4>& a)
+{
+#if SIMDPP_USE_NULL || SIMDPP_USE_NEON_NO_FLT_SP
+    int32<4> r;
+    for (unsigned i = 0; i < a.length; i++) {
+        r.el(i) = v_scalar_to_int_sat<int32_t>(a.el(i));
+    }
+    return r;
+#elif SIMDPP_USE_SSE2
+    return v_sse_to_int32_sat(a);
+#elif SIMDPP_USE_NEON_FLT_SP || SIMDPP_USE_ALTIVEC
+    // VCVT and VCTSXS saturate and convert NaN to zero
+    return i_to_int32(a);
+#elif SIMDPP_USE_MSA
+    float32<4> c = bit_and(a, cmp_eq(a, a)); // NaN to zero
+    c = max(c, -2147483648.0f);
+    c = min(c, 2147483520.0f); // largest float below 2^31
+    int32<4> r = i_to_int32(c);
+    int32<4> too_large = int32<4>(cmp_ge(a, 2147483648.0f).eval().unmask());
+    int32<4> int_max = make_int(0x7fffffff);
+    return blend(int_max, r, too_large);
+#endif
+}
+
+#if SIMDPP_USE_AVX
+static SIMDPP_INL
+int32<8> i_to_int32_sat(const float32<8>& a)
+{
+    return v_sse_to_int32_sat(a);
+}
+#endif
+
+#if SIMDPP_USE_AVX512F
+static SIMDPP_INL
+int32<16> i_to_int32_sat(const float32<16>& a)
+{
+    return v_sse_to_int32_sat(a);
+}
+#endif
+
+template<unsigned N> SIMDPP_INL
+int32<N> i_to_int32_sat(const float32<N>& a)
+{
+    SIMDPP_VEC_ARRAY_IMPL_CONV_INSERT(int32<N>, i_to_int32_sat, a)
+}
+
+// -----------------------------------------------------------------------------
+
+/*  All int32 values are exactly representable in float64, thus rounding can be
+    done before the conversion and saturation can be done by clamping.
+*/
+#if SIMDPP_USE_AVX512F
+static SIMDPP_INL
+int32<8> i_to_int32_round(const float64<8>& a)
+{
+    return _mm512_cvt_roundpd_epi32(a.native(), _MM_FROUND_TO_NEAREST_INT |
+                                                _MM_FROUND_NO_EXC);
+}
+
+static SIMDPP_INL
+int32<8> i_to_int32_floor(const float64<8>& a)
+{
+    return _mm512_cvt_roundpd_epi32(a.native(), _MM_FROUND_TO_NEG_INF |
+                                                _MM_FROUND_NO_EXC);
+}
+
+static SIMDPP_INL
+int32<8> i_to_int32_ceil(const float64<8>& a)
+{
+    return _mm512_cvt_roundpd_epi32(a.native(), _MM_FROUND_TO_POS_INF |
+                                                _MM_FROUND_NO_EXC);
+}
+#endif
+
+template<unsigned N> SIMDPP_INL
+int32<N> i_to_int32_round(const float64<N>& a)
+{
+    return i_to_int32(i_round(a));
+}
+
+template<unsigned N> SIMDPP_INL
+int32<N> i_to_int32_floor(const float64<N>& a)
+{
+    return i_to_int32(i_floor(a));
+}
+
+template<unsigned N> SIMDPP_INL
+int32<N> i_to_int32_ceil(const float64<N>& a)
+{
+    return i_to_int32(i_ceil(a));
+}
+
+template<unsigned N> SIMDPP_INL
+int32<N> i_to_int32_sat(const float64<N>& a)
+{
+    float64<N> c = bit_and(a, cmp_eq(a, a)); // NaN to zero
+    c = max(c, -2147483648.0);
+    c = min(c, 2147483647.0);
+    return i_to_int32(c);
+}
+
+} // namespace insn
+} // namespace detail
+} // namespace SIMDPP_ARCH_NAMESPACE
+} // namespace simdpp
+
+#endif
@@ -0,0 +1,283 @@
+/*  Copyright (C) 2017  Povilas Kanapickas <povilas@radix.lt>
+
+    Distributed under the Boost Software License, Version 1.0.
+        (See accompanying file LICENSE_1_0.txt or copy at
+            http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#ifndef LIBSIMDPP_SIMDPP_DETAIL_INSN_CONV_FLOAT_TO_INT64_ROUND_H
+#define LIBSIMDPP_SIMDPP_DETAIL_INSN_CONV_FLOAT_TO_INT64_ROUND_H
+
+#ifndef LIBSIMDPP_SIMD_H
+    #error "This file must be included through simd.h"
+#endif
+
+#include <cmath>
+#include <simdpp/types.h>
+#include <simdpp/core/bit_and.h>
+#include <simdpp/core/bit_xor.h>
+#include <simdpp/core/blend.h>
+#include <simdpp/core/cmp_eq.h>
+#include <simdpp/core/cmp_ge.h>
+#include <simdpp/core/f_ceil.h>
+#include <simdpp/core/f_floor.h>
+#include <simdpp/core/f_max.h>
+#include <simdpp/core/f_min.h>
+#include <simdpp/core/f_round.h>
+#include <simdpp/core/make_int.h>
+#include <simdpp/detail/insn/conv_any_to_float64.h>
+#include <simdpp/detail/insn/conv_float_to_int32_round.h>
+#include <simdpp/detail/insn/conv_float_to_int64.h>
+#include <simdpp/detail/not_implemented.h>
+#include <simdpp/detail/vector_array_conv_macros.h>
+
+namespace simdpp {
+namespace SIMDPP_ARCH_NAMESPACE {
+namespace detail {
+namespace insn {
+
+#if SIMDPP_USE_AVX512DQ
+/*  VCVTTPD2QQ returns 0x8000000000000000 for NaN and out of range values. See
+    v_sse_to_int32_sat for details.
+*/
+template<unsigned N> SIMDPP_INL
+int64<N> v_sse_to_int64_sat(const float64<N>& a)
+{
+    int64<N> r = i_to_int64(a);
+    int64<N> too_large =
+            int64<N>(cmp_ge(a, 9223372036854775808.0).eval().unmask());
+    int64<N> not_nan = int64<N>(cmp_eq(a, a).eval().unmask());
+    r = bit_xor(r, too_large);
+    return bit_and(r, not_nan);
+}
+#endif
+
+// -----------------------------------------------------------------------------
+
+static SIMDPP_INL
+int64<2> i_to_int64_round(const float64<2>& a)
+{
+#if SIMDPP_USE_NULL || SIMDPP_USE_NEON32 || SIMDPP_USE_ALTIVEC
+    int64<2> r;
+    for (unsigned i = 0; i < a.length; i++) {
+        r.el(i) = int64_t(std::nearbyint(a.el(i)));
+    }
+    return r;
+#elif SIMDPP_USE_NEON64
+    return vcvtnq_s64_f64(a.native());
+#else
+    return i_to_int64(i_round(a));
+#endif
+}
+
+#if SIMDPP_USE_AVX
+static SIMDPP_INL
+int64<4> i_to_int64_round(const float64<4>& a)
+{
+    return i_to_int64(i_round(a));
+}
+#endif
+
+#if SIMDPP_USE_AVX512F
+static SIMDPP_INL
+int64<8> i_to_int64_round(const float64<8>& a)
+{
+#if SIMDPP_USE_AVX512DQ
+    return _mm512_cvt_roundpd_epi64(a.native(), _MM_FROUND_TO_NEAREST_INT |
+                                                _MM_FROUND_NO_EXC);
+#else
+    return SIMDPP_NOT_IMPLEMENTED1(a);
+#endif
+}
+#endif
+
+template<unsigned N> SIMDPP_INL
+int64<N> i_to_int64_round(const float64<N>& a)
+{
+    SIMDPP_VEC_ARRAY_IMPL_CONV_EXTRACT(int64<N>, i_to_int64_round, a)
+}
+
+// -----------------------------------------------------------------------------
+
+static SIMDPP_INL
+int64<2> i_to_int64_floor(const float64<2>& a)
+{
+#if SIMDPP_USE_NULL || SIMDPP_USE_NEON32 || SIMDPP_USE_ALTIVEC
+    int64<2> r;
+    for (unsigned i = 0; i < a.length; i++) {
+        r.el(i) = int64_t(std::floor(a.el(i)));
+    }
+    return r;
+#elif SIMDPP_USE_NEON64
+    return vcvtmq_s64_f64(a.native());
+#else
+    return i_to_int64(i_floor(a));
+#endif
+}
+
+#if SIMDPP_USE_AVX
+static SIMDPP_INL
+int64<4> i_to_int64_floor(const float64<4>& a)
+{
+    return i_to_int64(i_floor(a));
+}
+#endif
+
+#if SIMDPP_USE_AVX512F
+static SIMDPP_INL
+int64<8> i_to_int64_floor(const float64<8>& a)
+{
+#if SIMDPP_USE_AVX512DQ
+    return _mm512_cvt_roundpd_epi64(a.native(), _MM_FROUND_TO_NEG_INF |
+                                                _MM_FROUND_NO_EXC);
+#else
+    return SIMDPP_NOT_IMPLEMENTED1(a);
+#endif
+}
+#endif
+
+template<unsigned N> SIMDPP_INL
+int64<N> i_to_int64_floor(const float64<N>& a)
+{
+    SIMDPP_VEC_ARRAY_IMPL_CONV_EXTRACT(int64<N>, i_to_int64_floor, a)
+}
+
+// -----------------------------------------------------------------------------
+
+static SIMDPP_INL
+int64<2> i_to_int64_ceil(const float64<2>& a)
+{
+#if SIMDPP_USE_NULL || SIMDPP_USE_NEON32 || SIMDPP_USE_ALTIVEC
+    int64<2> r;
+    for (unsigned i = 0; i < a.length; i++) {
+        r.el(i) = int64_t(std::ceil(a.el(i)));
+    }
+    return r;
+#elif SIMDPP_USE_NEON64
+    return vcvtpq_s64_f64(a.native());
+#else
+    return i_to_int64(i_ceil(a));
+#endif
+}
+
+#if SIMDPP_USE_AVX
+static SIMDPP_INL
+int64<4> i_to_int64_ceil(const float64<4>& a)
+{
+    return i_to_int64(i_ceil(a));
+}
+#endif
+
+#if SIMDPP_USE_AVX512F
+static SIMDPP_INL
+int64<8> i_to_int64_ceil(const float64<8>& a)
+{
+#if SIMDPP_USE_AVX512DQ
+    return _mm512_cvt_roundpd_epi64(a.native(), _MM_FROUND_TO_POS_INF |
+                                                _MM_FROUND_NO_EXC);
+#else
+    return SIMDPP_NOT_IMPLEMENTED1(a);
+#endif
+}
+#endif
+
+template<unsigned N> SIMDPP_INL
+int64<N> i_to_int64_ceil(const float64<N>& a)
+{
+    SIMDPP_VEC_ARRAY_IMPL_CONV_EXTRACT(int64<N>, i_to_int64_ceil, a)
+}
+
+// -----------------------------------------------------------------------------
+
+static SIMDPP_INL
+int64<2> i_to_int64_sat(const float64<2>& a)
+{
+#if SIMDPP_USE_NULL || SIMDPP_USE_NEON32 || SIMDPP_USE_ALTIVEC
+    int64<2> r;
+    for (unsigned i = 0; i < a.length; i++) {
+        r.el(i) = v_scalar_to_int_sat<int64_t>(a.el(i));
+    }
+    return r;
+#elif SIMDPP_USE_AVX512DQ
+    return v_sse_to_int64_sat(a);
+#elif SIMDPP_USE_NEON64
+    // VCVTZS saturates and converts NaN to zero
+    return vcvtq_s64_f64(a.native());
+#elif SIMDPP_USE_VSX_207 || SIMDPP_USE_MSA
+    float64<2> c = bit_and(a, cmp_eq(a, a)); // NaN to zero
+    c = max(c, -9223372036854775808.0);
+    c = min(c, 9223372036854774784.0); // largest double below 2^63
+    int64<2> r = i_to_int64(c);
+    int64<2> too_large =
+            int64<2>(cmp_ge(a, 9223372036854775808.0).eval().unmask());
+    int64<2> int_max = make_int(0x7fffffffffffffff);
+    return blend(int_max, r, too_large);
+#else
+    return SIMDPP_NOT_IMPLEMENTED1(a);
+#endif
+}
+
+#if SIMDPP_USE_AVX
+static SIMDPP_INL
+int64<4> i_to_int64_sat(const float64<4>& a)
+{
+#if SIMDPP_USE_AVX512DQ
+    return v_sse_to_int64_sat(a);
+#else
+    return SIMDPP_NOT_IMPLEMENTED1(a);
+#endif
+}
+#endif
+
+#if SIMDPP_USE_AVX512F
+static SIMDPP_INL
+int64<8> i_to_int64_sat(const float64<8>& a)
+{
+#if SIMDPP_USE_AVX512DQ
+    return v_sse_to_int64_sat(a);
+#else
+    return SIMDPP_NOT_IMPLEMENTED1(a);
+#endif
+}
+#endif
+
+template<unsigned N> SIMDPP_INL
+int64<N> i_to_int64_sat(const float64<N>& a)
+{
+    SIMDPP_VEC_ARRAY_IMPL_CONV_EXTRACT(int64<N>, i_to_int64_sat, a)
+}
+
+// -----------------------------------------------------------------------------
+
+// float32 values are widened to float64 exactly, thus rounding and saturation
+// give the same result when done after the widening
+template<unsigned N> SIMDPP_INL
+int64<N> i_to_int64_round(const float32<N>& a)
+{
+    return i_to_int64_round(i_to_float64(a));
+}
+
+template<unsigned N> SIMDPP_INL
+int64<N> i_to_int64_floor(const float32<N>& a)
+{
+    return i_to_int64_floor(i_to_float64(a));
+}
+
+template<unsigned N> SIMDPP_INL
+int64<N> i_to_int64_ceil(const float32<N>& a)
+{
+    return i_to_int64_ceil(i_to_float64(a));
+}
+
+template<unsigned N> SIMDPP_INL
+int64<N> i_to_int64_sat(const float32<N>& a)
+{
+    return i_to_int64_sat(i_to_float64(a));
+}
+
+} // namespace insn
+} // namespace detail
+} // namespace SIMDPP_ARCH_NAMESPACE
+} // namespace simdpp
+
+#endif
@@ -0,0 +1,220 @@
+/*  Copyright (C) 2017  Povilas Kanapickas <povilas@radix.lt>
+
+    Distributed under the Boost Software License, Version 1.0.
+        (See accompanying file LICENSE_1_0.txt or copy at
+            http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#ifndef LIBSIMDPP_SIMDPP_DETAIL_INSN_CONV_SHRINK_SAT_TO_INT16_H
+#define LIBSIMDPP_SIMDPP_DETAIL_INSN_CONV_SHRINK_SAT_TO_INT16_H
+
+#ifndef LIBSIMDPP_SIMD_H
+    #error "This file must be included through simd.h"
+#endif
+
+#include <simdpp/types.h>
+#include <simdpp/core/combine.h>
+#include <simdpp/core/i_max.h>
+#include <simdpp/core/i_min.h>
+#include <simdpp/core/permute4.h>
+#include <simdpp/core/set_splat.h>
+#include <simdpp/detail/insn/conv_shrink_to_int16.h>
+#include <simdpp/detail/insn/conv_shrink_sat_to_int32.h>
+#include <simdpp/detail/vector_array_conv_macros.h>
+
+namespace simdpp {
+namespace SIMDPP_ARCH_NAMESPACE {
+namespace detail {
+namespace insn {
+
+// -----------------------------------------------------------------------------
+
+SIMDPP_INL int16<8> i_to_int16_sat(const int32<8>& a)
+{
+#if SIMDPP_USE_AVX512VL
+    return _mm256_cvtsepi32_epi16(a.native());
+#elif SIMDPP_USE_AVX2
+    return _mm_packs_epi32(_mm256_castsi256_si128(a.native()),
+                           _mm256_extracti128_si256(a.native(), 1));
+#elif SIMDPP_USE_SSE2
+    return _mm_packs_epi32(a.vec(0).native(), a.vec(1).native());
+#elif SIMDPP_USE_NEON64
+    int16x4_t low = vqmovn_s32(a.vec(0).native());
+    return vqmovn_high_s32(low, a.vec(1).native());
+#elif SIMDPP_USE_NEON
+    int16x4_t low = vqmovn_s32(a.vec(0).native());
+    int16x4_t high = vqmovn_s32(a.vec(1).native());
+    return vcombine_s16(low, high);
+#elif SIMDPP_USE_ALTIVEC
+    return vec_packs(a.vec(0).native(), a.vec(1).native());
+#elif SIMDPP_USE_NULL || SIMDPP_USE_MSA
+    int32<8> r = min(max(a, splat<int32<8>>(-0x8000)), splat<int32<8>>(0x7fff));
+    return (int16<8>) i_to_uint16(uint32<8>(r));
+#endif
+}
+
+#if SIMDPP_USE_AVX2
+SIMDPP_INL int16<16> i_to_int16_sat(const int32<16>& a)
+{
+#if SIMDPP_USE_AVX512F
+    return _mm512_cvtsepi32_epi16(a.native());
+#else
+    uint64<4> r = _mm256_packs_epi32(a.vec(0).native(), a.vec(1).native());
+    return (int16<16>) permute4<0,2,1,3>(r);
+#endif
+}
+#endif
+
+#if SIMDPP_USE_AVX512BW
+SIMDPP_INL int16<32> i_to_int16_sat(const int32<32>& a)
+{
+    int16<16> r1 = _mm512_cvtsepi32_epi16(a.vec(0).native());
+    int16<16> r2 = _mm512_cvtsepi32_epi16(a.vec(1).native());
+    return combine(r1, r2);
+}
+#endif
+
+template<unsigned N> SIMDPP_INL
+int16<N> i_to_int16_sat(const int32<N>& a)
+{
+    SIMDPP_VEC_ARRAY_IMPL_CONV_EXTRACT(int16<N>, i_to_int16_sat, a)
+}
+
+// -----------------------------------------------------------------------------
+
+SIMDPP_INL uint16<8> i_to_uint16_sat(const int32<8>& a)
+{
+#if SIMDPP_USE_AVX512VL
+    __m256i z = _mm256_setzero_si256();
+    return _mm256_cvtusepi32_epi16(_mm256_max_epi32(a.native(), z));
+#elif SIMDPP_USE_AVX2
+    return _mm_packus_epi32(_mm256_castsi256_si128(a.native()),
+                            _mm256_extracti128_si256(a.native(), 1));
+#elif SIMDPP_USE_SSE4_1
+    return _mm_packus_epi32(a.vec(0).native(), a.vec(1).native());
+#elif SIMDPP_USE_NEON64
+    uint16x4_t low = vqmovun_s32(a.vec(0).native());
+    return vqmovun_high_s32(low, a.vec(1).native());
+#elif SIMDPP_USE_NEON
+    uint16x4_t low = vqmovun_s32(a.vec(0).native());
+    uint16x4_t high = vqmovun_s32(a.vec(1).native());
+    return vcombine_u16(low, high);
+#elif SIMDPP_USE_ALTIVEC
+    return vec_packsu(a.vec(0).native(), a.vec(1).native());
+#elif SIMDPP_USE_NULL || SIMDPP_USE_SSE2 || SIMDPP_USE_MSA
+    int32<8> r = min(max(a, (int32<8>) make_zero()), splat<int32<8>>(0xffff));
+    return i_to_uint16(uint32<8>(r));
+#endif
+}
+
+#if SIMDPP_USE_AVX2
+SIMDPP_INL uint16<16> i_to_uint16_sat(const int32<16>& a)
+{
+#if SIMDPP_USE_AVX512F
+    __m512i z = _mm512_setzero_si512();
+    return _mm512_cvtusepi32_epi16(_mm512_max_epi32(a.native(), z));
+#else
+    uint64<4> r = _mm256_packus_epi32(a.vec(0).native(), a.vec(1).native());
+    return (uint16<16>) permute4<0,2,1,3>(r);
+#endif
+}
+#endif
+
+#if SIMDPP_USE_AVX512BW
+SIMDPP_INL uint16<32> i_to_uint16_sat(const int32<32>& a)
+{
+    return combine(i_to_uint16_sat(a.vec(0)), i_to_uint16_sat(a.vec(1)));
+}
+#endif
+
+template<unsigned N> SIMDPP_INL
+uint16<N> i_to_uint16_sat(const int32<N>& a)
+{
+    SIMDPP_VEC_ARRAY_IMPL_CONV_EXTRACT(uint16<N>, i_to_uint16_sat, a)
+}
+
+// -----------------------------------------------------------------------------
+
+SIMDPP_INL uint16<8> i_to_uint16_sat(const uint32<8>& a)
+{
+#if SIMDPP_USE_AVX512VL
+    return _mm256_cvtusepi32_epi16(a.native());
+#elif SIMDPP_USE_NEON64
+    uint16x4_t low = vqmovn_u32(a.vec(0).native());
+    return vqmovn_high_u32(low, a.vec(1).native());
+#elif SIMDPP_USE_NEON
+    uint16x4_t low = vqmovn_u32(a.vec(0).native());
+    uint16x4_t high = vqmovn_u32(a.vec(1).native());
+    return vcombine_u16(low, high);
+#elif SIMDPP_USE_ALTIVEC
+    return vec_packs(a.vec(0).native(), a.vec(1).native());
+#else
+    return i_to_uint16(min(a, splat<uint32<8>>(0xffff)));
+#endif
+}
+
+#if SIMDPP_USE_AVX2
+SIMDPP_INL uint16<16> i_to_uint16_sat(const uint32<16>& a)
+{
+#if SIMDPP_USE_AVX512F
+    return _mm512_cvtusepi32_epi16(a.native());
+#else
+    return i_to_uint16(min(a, splat<uint32<16>>(0xffff)));
+#endif
+}
+#endif
+
+#if SIMDPP_USE_AVX512BW
+SIMDPP_INL uint16<32> i_to_uint16_sat(const uint32<32>& a)
+{
+    uint16<16> r1 = _mm512_cvtusepi32_epi16(a.vec(0).native());
+    uint16<16> r2 = _mm512_cvtusepi32_epi16(a.vec(1).native());
+    return combine(r1, r2);
+}
+#endif
+
+template<unsigned N> SIMDPP_INL
+uint16<N> i_to_uint16_sat(const uint32<N>& a)
+{
+    SIMDPP_VEC_ARRAY_IMPL_CONV_EXTRACT(uint16<N>, i_to_uint16_sat, a)
+}
+
+// -----------------------------------------------------------------------------
+
+template<unsigned N> SIMDPP_INL
+int16<N> i_to_int16_sat(const uint32<N>& a)
+{
+    return (int16<N>) min(i_to_uint16_sat(a), splat<uint16<N>>(0x7fff));
+}
+
+// Saturation to a narrower type is applied in steps of halving the width
+template<unsigned N> SIMDPP_INL
+int16<N> i_to_int16_sat(const int64<N>& a)
+{
+    return i_to_int16_sat(i_to_int32_sat(a));
+}
+
+template<unsigned N> SIMDPP_INL
+uint16<N> i_to_uint16_sat(const int64<N>& a)
+{
+    return i_to_uint16_sat(i_to_int32_sat(a));
+}
+
+template<unsigned N> SIMDPP_INL
+int16<N> i_to_int16_sat(const uint64<N>& a)
+{
+    return i_to_int16_sat(i_to_uint32_sat(a));
+}
+
+template<unsigned N> SIMDPP_INL
+uint16<N> i_to_uint16_sat(const uint64<N>& a)
+{
+    return i_to_uint16_sat(i_to_uint32_sat(a));
+}
+
+} // namespace insn
+} // namespace detail
+} // namespace SIMDPP_ARCH_NAMESPACE
+} // namespace simdpp
+
+#endif
@@ -0,0 +1,213 @@
+/*  Copyright (C) 2017  Povilas Kanapickas <povilas@radix.lt>
+
+    Distributed under the Boost Software License, Version 1.0.
+        (See accompanying file LICENSE_1_0.txt or copy at
+            http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#ifndef LIBSIMDPP_SIMDPP_DETAIL_INSN_CONV_SHRINK_SAT_TO_INT32_H
+#define LIBSIMDPP_SIMDPP_DETAIL_INSN_CONV_SHRINK_SAT_TO_INT32_H
+
+#ifndef LIBSIMDPP_SIMD_H
+    #error "This file must be included through simd.h"
+#endif
+
+#include <simdpp/types.h>
+#include <simdpp/core/bit_not.h>
+#include <simdpp/core/bit_xor.h>
+#include <simdpp/core/blend.h>
+#include <simdpp/core/cmp_eq.h>
+#include <simdpp/core/combine.h>
+#include <simdpp/core/i_min.h>
+#include <simdpp/core/i_shift_r.h>
+#include <simdpp/core/make_int.h>
+#include <simdpp/core/set_splat.h>
+#include <simdpp/detail/insn/conv_shrink_to_int32.h>
+#include <simdpp/detail/vector_array_conv_macros.h>
+
+namespace simdpp {
+namespace SIMDPP_ARCH_NAMESPACE {
+namespace detail {
+namespace insn {
+
+/*  The 64-bit values are split into the low and high 32-bit halves. A value
+    fits into 32 bits if the high half is the sign extension of the low half
+    (or zero for unsigned results). Otherwise the saturated value is derived
+    from the sign of the high half.
+*/
+template<unsigned N> SIMDPP_INL
+int32<N> v_emul_to_int32_sat(const int64<N>& a)
+{
+    uint64<N> ua = a;
+    int32<N> lo = i_to_uint32(ua);
+    int32<N> hi = i_to_uint32(uint64<N>(shift_r<32>(ua)));
+    int32<N> ovf = bit_xor(shift_r<31>(hi), splat<int32<N>>(0x7fffffff));
+    return blend(lo, ovf, cmp_eq(hi, shift_r<31>(lo)));
+}
+
+template<unsigned N> SIMDPP_INL
+uint32<N> v_emul_to_uint32_sat(const int64<N>& a)
+{
+    uint64<N> ua = a;
+    uint32<N> lo = i_to_uint32(ua);
+    int32<N> hi = i_to_uint32(uint64<N>(shift_r<32>(ua)));
+    uint32<N> ovf = bit_not(shift_r<31>(hi));
+    return blend(lo, ovf, cmp_eq(hi, (int32<N>) make_zero()));
+}
+
+template<unsigned N> SIMDPP_INL
+uint32<N> v_emul_to_uint32_sat(const uint64<N>& a)
+{
+    uint32<N> lo = i_to_uint32(a);
+    uint32<N> hi = i_to_uint32(uint64<N>(shift_r<32>(a)));
+    uint32<N> ovf = make_ones();
+    return blend(lo, ovf, cmp_eq(hi, (uint32<N>) make_zero()));
+}
+
+// -----------------------------------------------------------------------------
+
+SIMDPP_INL int32<4> i_to_int32_sat(const int64<4>& a)
+{
+#if SIMDPP_USE_AVX512VL
+    return _mm256_cvtsepi64_epi32(a.native());
+#elif SIMDPP_USE_NEON64
+    int32x2_t low = vqmovn_s64(a.vec(0).native());
+    return vqmovn_high_s64(low, a.vec(1).native());
+#elif SIMDPP_USE_NEON
+    int32x2_t low = vqmovn_s64(a.vec(0).native());
+    int32x2_t high = vqmovn_s64(a.vec(1).native());
+    return vcombine_s32(low, high);
+#else
+    return v_emul_to_int32_sat(a);
+#endif
+}
+
+#if SIMDPP_USE_AVX2
+SIMDPP_INL int32<8> i_to_int32_sat(const int64<8>& a)
+{
+#if SIMDPP_USE_AVX512F
+    return _mm512_cvtsepi64_epi32(a.native());
+#else
+    return v_emul_to_int32_sat(a);
+#endif
+}
+#endif
+
+#if SIMDPP_USE_AVX512F
+SIMDPP_INL int32<16> i_to_int32_sat(const int64<16>& a)
+{
+    int32<8> r1 = _mm512_cvtsepi64_epi32(a.vec(0).native());
+    int32<8> r2 = _mm512_cvtsepi64_epi32(a.vec(1).native());
+    return combine(r1, r2);
+}
+#endif
+
+template<unsigned N> SIMDPP_INL
+int32<N> i_to_int32_sat(const int64<N>& a)
+{
+    SIMDPP_VEC_ARRAY_IMPL_CONV_EXTRACT(int32<N>, i_to_int32_sat, a)
+}
+
+// -----------------------------------------------------------------------------
+
+SIMDPP_INL uint32<4> i_to_uint32_sat(const int64<4>& a)
+{
+#if SIMDPP_USE_AVX512VL
+    __m256i z = _mm256_setzero_si256();
+    return _mm256_cvtusepi64_epi32(_mm256_max_epi64(a.native(), z));
+#elif SIMDPP_USE_NEON64
+    uint32x2_t low = vqmovun_s64(a.vec(0).native());
+    return vqmovun_high_s64(low, a.vec(1).native());
+#elif SIMDPP_USE_NEON
+    uint32x2_t low = vqmovun_s64(a.vec(0).native());
+    uint32x2_t high = vqmovun_s64(a.vec(1).native());
+    return vcombine_u32(low, high);
+#else
+    return v_emul_to_uint32_sat(a);
+#endif
+}
+
+#if SIMDPP_USE_AVX2
+SIMDPP_INL uint32<8> i_to_uint32_sat(const int64<8>& a)
+{
+#if SIMDPP_USE_AVX512F
+    __m512i z = _mm512_setzero_si512();
+    return _mm512_cvtusepi64_epi32(_mm512_max_epi64(a.native(), z));
+#else
+    return v_emul_to_uint32_sat(a);
+#endif
+}
+#endif
+
+#if SIMDPP_USE_AVX512F
+SIMDPP_INL uint32<16> i_to_uint32_sat(const int64<16>& a)
+{
+    return combine(i_to_uint32_sat(a.vec(0)), i_to_uint32_sat(a.vec(1)));
+}
+#endif
+
+template<unsigned N> SIMDPP_INL
+uint32<N> i_to_uint32_sat(const int64<N>& a)
+{
+    SIMDPP_VEC_ARRAY_IMPL_CONV_EXTRACT(uint32<N>, i_to_uint32_sat, a)
+}
+
+// -----------------------------------------------------------------------------
+
+SIMDPP_INL uint32<4> i_to_uint32_sat(const uint64<4>& a)
+{
+#if SIMDPP_USE_AVX512VL
+    return _mm256_cvtusepi64_epi32(a.native());
+#elif SIMDPP_USE_NEON64
+    uint32x2_t low = vqmovn_u64(a.vec(0).native());
+    return vqmovn_high_u64(low, a.vec(1).native());
+#elif SIMDPP_USE_NEON
+    uint32x2_t low = vqmovn_u64(a.vec(0).native());
+    uint32x2_t high = vqmovn_u64(a.vec(1).native());
+    return vcombine_u32(low, high);
+#else
+    return v_emul_to_uint32_sat(a);
+#endif
+}
+
+#if SIMDPP_USE_AVX2
+SIMDPP_INL uint32<8> i_to_uint32_sat(const uint64<8>& a)
+{
+#if SIMDPP_USE_AVX512F
+    return _mm512_cvtusepi64_epi32(a.native());
+#else
+    return v_emul_to_uint32_sat(a);
+#endif
+}
+#endif
+
+#if SIMDPP_USE_AVX512F
+SIMDPP_INL uint32<16> i_to_uint32_sat(const uint64<16>& a)
+{
+    uint32<8> r1 = _mm512_cvtusepi64_epi32(a.vec(0).native());
+    uint32<8> r2 = _mm512_cvtusepi64_epi32(a.vec(1).native());
+    return combine(r1, r2);
+}
+#endif
+
+template<unsigned N> SIMDPP_INL
+uint32<N> i_to_uint32_sat(const uint64<N>& a)
+{
+    SIMDPP_VEC_ARRAY_IMPL_CONV_EXTRACT(uint32<N>, i_to_uint32_sat, a)
+}
+
+// -----------------------------------------------------------------------------
+
+// Saturating to the unsigned range first leaves only the upper bound to check
+template<unsigned N> SIMDPP_INL
+int32<N> i_to_int32_sat(const uint64<N>& a)
+{
+    return (int32<N>) min(i_to_uint32_sat(a), splat<uint32<N>>(0x7fffffff));
+}
+
+} // namespace insn
+} // namespace detail
+} // namespace SIMDPP_ARCH_NAMESPACE
+} // namespace simdpp
+
+#endif
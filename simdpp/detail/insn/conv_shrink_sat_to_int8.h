@@ -0,0 +1,241 @@
+/*  Copyright (C) 2017  Povilas Kanapickas <povilas@radix.lt>
+
+    Distributed under the Boost Software License, Version 1.0.
+        (See accompanying file LICENSE_1_0.txt or copy at
+            http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#ifndef LIBSIMDPP_SIMDPP_DETAIL_INSN_CONV_SHRINK_SAT_TO_INT8_H
+#define LIBSIMDPP_SIMDPP_DETAIL_INSN_CONV_SHRINK_SAT_TO_INT8_H
+
+#ifndef LIBSIMDPP_SIMD_H
+    #error "This file must be included through simd.h"
+#endif
+
+#include <simdpp/types.h>
+#include <simdpp/core/combine.h>
+#include <simdpp/core/i_max.h>
+#include <simdpp/core/i_min.h>
+#include <simdpp/core/permute4.h>
+#include <simdpp/core/set_splat.h>
+#include <simdpp/detail/insn/conv_shrink_to_int8.h>
+#include <simdpp/detail/insn/conv_shrink_sat_to_int16.h>
+#include <simdpp/detail/vector_array_conv_macros.h>
+
+namespace simdpp {
+namespace SIMDPP_ARCH_NAMESPACE {
+namespace detail {
+namespace insn {
+
+// -----------------------------------------------------------------------------
+
+SIMDPP_INL int8<16> i_to_int8_sat(const int16<16>& a)
+{
+#if SIMDPP_USE_AVX512VL && SIMDPP_USE_AVX512BW
+    return _mm256_cvtsepi16_epi8(a.native());
+#elif SIMDPP_USE_AVX2
+    return _mm_packs_epi16(_mm256_castsi256_si128(a.native()),
+                           _mm256_extracti128_si256(a.native(), 1));
+#elif SIMDPP_USE_SSE2
+    return _mm_packs_epi16(a.vec(0).native(), a.vec(1).native());
+#elif SIMDPP_USE_NEON64
+    int8x8_t low = vqmovn_s16(a.vec(0).native());
+    return vqmovn_high_s16(low, a.vec(1).native());
+#elif SIMDPP_USE_NEON
+    int8x8_t low = vqmovn_s16(a.vec(0).native());
+    int8x8_t high = vqmovn_s16(a.vec(1).native());
+    return vcombine_s8(low, high);
+#elif SIMDPP_USE_ALTIVEC
+    return vec_packs(a.vec(0).native(), a.vec(1).native());
+#elif SIMDPP_USE_NULL || SIMDPP_USE_MSA
+    int16<16> r = min(max(a, splat<int16<16>>(-0x80)), splat<int16<16>>(0x7f));
+    return (int8<16>) i_to_uint8(uint16<16>(r));
+#endif
+}
+
+#if SIMDPP_USE_AVX2
+SIMDPP_INL int8<32> i_to_int8_sat(const int16<32>& a)
+{
+#if SIMDPP_USE_AVX512BW
+    return _mm512_cvtsepi16_epi8(a.native());
+#else
+    uint64<4> r = _mm256_packs_epi16(a.vec(0).native(), a.vec(1).native());
+    return (int8<32>) permute4<0,2,1,3>(r);
+#endif
+}
+#endif
+
+#if SIMDPP_USE_AVX512BW
+SIMDPP_INL int8<64> i_to_int8_sat(const int16<64>& a)
+{
+    int8<32> r1 = _mm512_cvtsepi16_epi8(a.vec(0).native());
+    int8<32> r2 = _mm512_cvtsepi16_epi8(a.vec(1).native());
+    return combine(r1, r2);
+}
+#endif
+
+template<unsigned N> SIMDPP_INL
+int8<N> i_to_int8_sat(const int16<N>& a)
+{
+    SIMDPP_VEC_ARRAY_IMPL_CONV_EXTRACT(int8<N>, i_to_int8_sat, a)
+}
+
+// -----------------------------------------------------------------------------
+
+SIMDPP_INL uint8<16> i_to_uint8_sat(const int16<16>& a)
+{
+#if SIMDPP_USE_AVX2
+    return _mm_packus_epi16(_mm256_castsi256_si128(a.native()),
+                            _mm256_extracti128_si256(a.native(), 1));
+#elif SIMDPP_USE_SSE2
+    return _mm_packus_epi16(a.vec(0).native(), a.vec(1).native());
+#elif SIMDPP_USE_NEON64
+    uint8x8_t low = vqmovun_s16(a.vec(0).native());
+    return vqmovun_high_s16(low, a.vec(1).native());
+#elif SIMDPP_USE_NEON
+    uint8x8_t low = vqmovun_s16(a.vec(0).native());
+    uint8x8_t high = vqmovun_s16(a.vec(1).native());
+    return vcombine_u8(low, high);
+#elif SIMDPP_USE_ALTIVEC
+    return vec_packsu(a.vec(0).native(), a.vec(1).native());
+#elif SIMDPP_USE_NULL || SIMDPP_USE_MSA
+    int16<16> r = min(max(a, (int16<16>) make_zero()), splat<int16<16>>(0xff));
+    return i_to_uint8(uint16<16>(r));
+#endif
+}
+
+#if SIMDPP_USE_AVX2
+SIMDPP_INL uint8<32> i_to_uint8_sat(const int16<32>& a)
+{
+#if SIMDPP_USE_AVX512BW
+    __m512i z = _mm512_setzero_si512();
+    return _mm512_cvtusepi16_epi8(_mm512_max_epi16(a.native(), z));
+#else
+    uint64<4> r = _mm256_packus_epi16(a.vec(0).native(), a.vec(1).native());
+    return (uint8<32>) permute4<0,2,1,3>(r);
+#endif
+}
+#endif
+
+#if SIMDPP_USE_AVX512BW
+SIMDPP_INL uint8<64> i_to_uint8_sat(const int16<64>& a)
+{
+    return combine(i_to_uint8_sat(a.vec(0)), i_to_uint8_sat(a.vec(1)));
+}
+#endif
+
+template<unsigned N> SIMDPP_INL
+uint8<N> i_to_uint8_sat(const int16<N>& a)
+{
+    SIMDPP_VEC_ARRAY_IMPL_CONV_EXTRACT(uint8<N>, i_to_uint8_sat, a)
+}
+
+// -----------------------------------------------------------------------------
+
+SIMDPP_INL uint8<16> i_to_uint8_sat(const uint16<16>& a)
+{
+#if SIMDPP_USE_AVX512VL && SIMDPP_USE_AVX512BW
+    return _mm256_cvtusepi16_epi8(a.native());
+#elif SIMDPP_USE_NEON64
+    uint8x8_t low = vqmovn_u16(a.vec(0).native());
+    return vqmovn_high_u16(low, a.vec(1).native());
+#elif SIMDPP_USE_NEON
+    uint8x8_t low = vqmovn_u16(a.vec(0).native());
+    uint8x8_t high = vqmovn_u16(a.vec(1).native());
+    return vcombine_u8(low, high);
+#elif SIMDPP_USE_ALTIVEC
+    return vec_packs(a.vec(0).native(), a.vec(1).native());
+#else
+    return i_to_uint8(min(a, splat<uint16<16>>(0xff)));
+#endif
+}
+
+#if SIMDPP_USE_AVX2
+SIMDPP_INL uint8<32> i_to_uint8_sat(const uint16<32>& a)
+{
+#if SIMDPP_USE_AVX512BW
+    return _mm512_cvtusepi16_epi8(a.native());
+#else
+    return i_to_uint8(min(a, splat<uint16<32>>(0xff)));
+#endif
+}
+#endif
+
+#if SIMDPP_USE_AVX512BW
+SIMDPP_INL uint8<64> i_to_uint8_sat(const uint16<64>& a)
+{
+    uint8<32> r1 = _mm512_cvtusepi16_epi8(a.vec(0).native());
+    uint8<32> r2 = _mm512_cvtusepi16_epi8(a.vec(1).native());
+    return combine(r1, r2);
+}
+#endif
+
+template<unsigned N> SIMDPP_INL
+uint8<N> i_to_uint8_sat(const uint16<N>& a)
+{
+    SIMDPP_VEC_ARRAY_IMPL_CONV_EXTRACT(uint8<N>, i_to_uint8_sat, a)
+}
+
+// -----------------------------------------------------------------------------
+
+template<unsigned N> SIMDPP_INL
+int8<N> i_to_int8_sat(const uint16<N>& a)
+{
+    return (int8<N>) min(i_to_uint8_sat(a), splat<uint8<N>>(0x7f));
+}
+
+// Saturation to a narrower type is applied in steps of halving the width
+template<unsigned N> SIMDPP_INL
+int8<N> i_to_int8_sat(const int32<N>& a)
+{
+    return i_to_int8_sat(i_to_int16_sat(a));
+}
+
+template<unsigned N> SIMDPP_INL
+uint8<N> i_to_uint8_sat(const int32<N>& a)
+{
+    return i_to_uint8_sat(i_to_int16_sat(a));
+}
+
+template<unsigned N> SIMDPP_INL
+int8<N> i_to_int8_sat(const uint32<N>& a)
+{
+    return i_to_int8_sat(i_to_uint16_sat(a));
+}
+
+template<unsigned N> SIMDPP_INL
+uint8<N> i_to_uint8_sat(const uint32<N>& a)
+{
+    return i_to_uint8_sat(i_to_uint16_sat(a));
+}
+
+template<unsigned N> SIMDPP_INL
+int8<N> i_to_int8_sat(const int64<N>& a)
+{
+    return i_to_int8_sat(i_to_int16_sat(a));
+}
+
+template<unsigned N> SIMDPP_INL
+uint8<N> i_to_uint8_sat(const int64<N>& a)
+{
+    return i_to_uint8_sat(i_to_int16_sat(a));
+}
+
+template<unsigned N> SIMDPP_INL
+int8<N> i_to_int8_sat(const uint64<N>& a)
+{
+    return i_to_int8_sat(i_to_uint16_sat(a));
+}
+
+template<unsigned N> SIMDPP_INL
+uint8<N> i_to_uint8_sat(const uint64<N>& a)
+{
+    return i_to_uint8_sat(i_to_uint16_sat(a));
+}
+
+} // namespace insn
+} // namespace detail
+} // namespace SIMDPP_ARCH_NAMESPACE
+} // namespace simdpp
+
+#endif
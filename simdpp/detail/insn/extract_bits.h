@@ -141,6 +141,332 @@ uint32_t i_extract_bits(const uint8<32>& ca)
 #endif
 }
 
+// -----------------------------------------------------------------------------
+
+/*  The following functions return the mask as an integer: bit i of the result
+    is set if element i of the mask is set. The unused bits are zero. Note
+    that the bits of AVX-512 mask registers past the number of elements are
+    not necessarily zero.
+*/
+
+static SIMDPP_INL
+unsigned v_mask_bits_count(uint64_t bits)
+{
+#if SIMDPP_USE_X86_POPCNT_INSN && SIMDPP_64_BITS
+    return (unsigned) _mm_popcnt_u64(bits);
+#elif SIMDPP_USE_X86_POPCNT_INSN
+    return _mm_popcnt_u32(uint32_t(bits)) + _mm_popcnt_u32(uint32_t(bits >> 32));
+#else
+    bits = bits - ((bits >> 1) & 0x5555555555555555);
+    bits = (bits & 0x3333333333333333) + ((bits >> 2) & 0x3333333333333333);
+    bits = (bits + (bits >> 4)) & 0x0f0f0f0f0f0f0f0f;
+    return unsigned((bits * 0x0101010101010101) >> 56);
+#endif
+}
+
+// Returns the index of the lowest set bit. bits must not be zero
+static SIMDPP_INL
+unsigned v_mask_bits_find_first(uint64_t bits)
+{
+#if __GNUC__
+    return (unsigned) __builtin_ctzll(bits);
+#else
+    unsigned r = 0;
+    while ((bits & 1) == 0) {
+        bits >>= 1;
+        r++;
+    }
+    return r;
+#endif
+}
+
+// Returns the index of the highest set bit. bits must not be zero
+static SIMDPP_INL
+unsigned v_mask_bits_find_last(uint64_t bits)
+{
+#if __GNUC__
+    return 63 - (unsigned) __builtin_clzll(bits);
+#else
+    unsigned r = 63;
+    while ((bits >> 63) == 0) {
+        bits <<= 1;
+        r--;
+    }
+    return r;
+#endif
+}
+
+template<class M> SIMDPP_INL
+uint64_t v_null_extract_mask_bits(const M& a)
+{
+    uint64_t r = 0;
+    for (unsigned i = 0; i < a.length; i++) {
+        if (a.el(i))
+            r |= uint64_t(1) << i;
+    }
+    return r;
+}
+
+// Keeps each step-th bit of a 16-bit value as returned by i_extract_bits_any
+template<unsigned step> SIMDPP_INL
+uint64_t v_pack_mask_bits(uint64_t bits)
+{
+    uint64_t r = 0;
+    for (unsigned i = 0; i < 16 / step; i++) {
+        r |= ((bits >> (i * step)) & 1) << i;
+    }
+    return r;
+}
+
+#if SIMDPP_USE_NEON
+/*  Converts 8 bytes, each either 0x00 or 0xff, to an 8-bit integer. Wider
+    mask elements are first narrowed to bytes with VMOVN which is cheaper than
+    extracting a bit per byte of the full vector.
+*/
+static SIMDPP_INL
+uint64_t v_neon_extract_mask_bits(uint8x8_t a)
+{
+    a = vand_u8(a, vcreate_u8(0x8040201008040201));
+#if SIMDPP_USE_NEON64
+    return vaddv_u8(a);
+#else
+    a = vpadd_u8(a, a);
+    a = vpadd_u8(a, a);
+    a = vpadd_u8(a, a);
+    return vget_lane_u8(a, 0);
+#endif
+}
+
+static SIMDPP_INL
+uint64_t v_neon_extract_mask_bits(const uint16<8>& a)
+{
+    return v_neon_extract_mask_bits(vmovn_u16(a.native()));
+}
+
+static SIMDPP_INL
+uint64_t v_neon_extract_mask_bits(const uint32<4>& a)
+{
+    uint16x4_t a16 = vmovn_u32(a.native());
+    return v_neon_extract_mask_bits(vmovn_u16(vcombine_u16(a16, a16))) & 0xf;
+}
+
+static SIMDPP_INL
+uint64_t v_neon_extract_mask_bits(const uint64<2>& a)
+{
+    return (vgetq_lane_u64(a.native(), 0) & 1) |
+           (vgetq_lane_u64(a.native(), 1) & 2);
+}
+#endif
+
+#if SIMDPP_USE_AVX512F
+// Converts an AVX-512 mask of up to 32 bits to an integer
+static SIMDPP_INL
+uint64_t v_mask_to_bits(uint32_t m)
+{
+#if SIMDPP_WORKAROUND_AVX512_MASK_ZERO_EXTEND
+    __asm__("" : "+r"(m));
+#endif
+    return m;
+}
+#endif
+
+static SIMDPP_INL
+uint64_t i_extract_mask_bits(const mask_int8<16>& a)
+{
+#if SIMDPP_USE_NULL
+    return v_null_extract_mask_bits(a);
+#elif SIMDPP_USE_AVX512VL
+    return v_mask_to_bits(a.native());
+#elif SIMDPP_USE_NEON64
+    uint8x16_t m = vandq_u8(a.native(), vreinterpretq_u8_u64(
+                                vdupq_n_u64(0x8040201008040201)));
+    return vaddv_u8(vget_low_u8(m)) | (vaddv_u8(vget_high_u8(m)) << 8);
+#else
+    return i_extract_bits_any(a.unmask());
+#endif
+}
+
+static SIMDPP_INL
+uint64_t i_extract_mask_bits(const mask_int16<8>& a)
+{
+#if SIMDPP_USE_NULL
+    return v_null_extract_mask_bits(a);
+#elif SIMDPP_USE_AVX512VL
+    return v_mask_to_bits(a.native());
+#elif SIMDPP_USE_SSE2
+    return _mm_movemask_epi8(_mm_packs_epi16(a.native(), _mm_setzero_si128()));
+#elif SIMDPP_USE_NEON
+    return v_neon_extract_mask_bits(uint16<8>(a.unmask()));
+#else
+    return v_pack_mask_bits<2>(i_extract_bits_any(uint8<16>(a.unmask())));
+#endif
+}
+
+static SIMDPP_INL
+uint64_t i_extract_mask_bits(const mask_int32<4>& a)
+{
+#if SIMDPP_USE_NULL
+    return v_null_extract_mask_bits(a);
+#elif SIMDPP_USE_AVX512VL
+    return v_mask_to_bits(a.native()) & 0xf;
+#elif SIMDPP_USE_SSE2
+    return _mm_movemask_ps(_mm_castsi128_ps(a.native()));
+#elif SIMDPP_USE_NEON
+    return v_neon_extract_mask_bits(uint32<4>(a.unmask()));
+#else
+    return v_pack_mask_bits<4>(i_extract_bits_any(uint8<16>(a.unmask())));
+#endif
+}
+
+static SIMDPP_INL
+uint64_t i_extract_mask_bits(const mask_int64<2>& a)
+{
+#if SIMDPP_USE_NULL || (SIMDPP_USE_ALTIVEC && !SIMDPP_USE_VSX_207)
+    return v_null_extract_mask_bits(a);
+#elif SIMDPP_USE_AVX512VL
+    return v_mask_to_bits(a.native()) & 0x3;
+#elif SIMDPP_USE_SSE2
+    return _mm_movemask_pd(_mm_castsi128_pd(a.native()));
+#elif SIMDPP_USE_NEON
+    return v_neon_extract_mask_bits(uint64<2>(a.unmask()));
+#else
+    return v_pack_mask_bits<8>(i_extract_bits_any(uint8<16>(a.unmask())));
+#endif
+}
+
+static SIMDPP_INL
+uint64_t i_extract_mask_bits(const mask_float32<4>& a)
+{
+#if SIMDPP_USE_NULL || (SIMDPP_USE_NEON && !SIMDPP_USE_NEON_FLT_SP)
+    return v_null_extract_mask_bits(a);
+#elif SIMDPP_USE_AVX512VL
+    return v_mask_to_bits(a.native()) & 0xf;
+#elif SIMDPP_USE_SSE2
+    return _mm_movemask_ps(a.native());
+#elif SIMDPP_USE_NEON
+    return v_neon_extract_mask_bits(uint32<4>(a.unmask()));
+#else
+    return v_pack_mask_bits<4>(i_extract_bits_any(uint8<16>(a.unmask())));
+#endif
+}
+
+static SIMDPP_INL
+uint64_t i_extract_mask_bits(const mask_float64<2>& a)
+{
+#if SIMDPP_USE_NULL || SIMDPP_USE_NEON32 || (SIMDPP_USE_ALTIVEC && !SIMDPP_USE_VSX_206)
+    return v_null_extract_mask_bits(a);
+#elif SIMDPP_USE_AVX512VL
+    return v_mask_to_bits(a.native()) & 0x3;
+#elif SIMDPP_USE_SSE2
+    return _mm_movemask_pd(a.native());
+#elif SIMDPP_USE_NEON64
+    return v_neon_extract_mask_bits(uint64<2>(a.unmask()));
+#else
+    return v_pack_mask_bits<8>(i_extract_bits_any(uint8<16>(a.unmask())));
+#endif
+}
+
+#if SIMDPP_USE_AVX2
+static SIMDPP_INL
+uint64_t i_extract_mask_bits(const mask_int8<32>& a)
+{
+#if SIMDPP_USE_AVX512VL
+    return v_mask_to_bits(a.native());
+#else
+    return uint32_t(_mm256_movemask_epi8(a.native()));
+#endif
+}
+
+static SIMDPP_INL
+uint64_t i_extract_mask_bits(const mask_int16<16>& a)
+{
+#if SIMDPP_USE_AVX512VL
+    return v_mask_to_bits(a.native());
+#else
+    __m128i lo = _mm256_castsi256_si128(a.native());
+    __m128i hi = _mm256_extracti128_si256(a.native(), 1);
+    return _mm_movemask_epi8(_mm_packs_epi16(lo, hi));
+#endif
+}
+
+static SIMDPP_INL
+uint64_t i_extract_mask_bits(const mask_int32<8>& a)
+{
+#if SIMDPP_USE_AVX512VL
+    return v_mask_to_bits(a.native());
+#else
+    return _mm256_movemask_ps(_mm256_castsi256_ps(a.native()));
+#endif
+}
+
+static SIMDPP_INL
+uint64_t i_extract_mask_bits(const mask_int64<4>& a)
+{
+#if SIMDPP_USE_AVX512VL
+    return v_mask_to_bits(a.native()) & 0xf;
+#else
+    return _mm256_movemask_pd(_mm256_castsi256_pd(a.native()));
+#endif
+}
+#endif
+
+#if SIMDPP_USE_AVX
+static SIMDPP_INL
+uint64_t i_extract_mask_bits(const mask_float32<8>& a)
+{
+#if SIMDPP_USE_AVX512VL
+    return v_mask_to_bits(a.native());
+#else
+    return _mm256_movemask_ps(a.native());
+#endif
+}
+
+static SIMDPP_INL
+uint64_t i_extract_mask_bits(const mask_float64<4>& a)
+{
+#if SIMDPP_USE_AVX512VL
+    return v_mask_to_bits(a.native()) & 0xf;
+#else
+    return _mm256_movemask_pd(a.native());
+#endif
+}
+#endif
+
+#if SIMDPP_USE_AVX512BW
+static SIMDPP_INL
+uint64_t i_extract_mask_bits(const mask_int8<64>& a) { return a.native(); }
+
+static SIMDPP_INL
+uint64_t i_extract_mask_bits(const mask_int16<32>& a) { return v_mask_to_bits(a.native()); }
+#endif
+
+#if SIMDPP_USE_AVX512F
+static SIMDPP_INL
+uint64_t i_extract_mask_bits(const mask_int32<16>& a) { return v_mask_to_bits(a.native()); }
+
+static SIMDPP_INL
+uint64_t i_extract_mask_bits(const mask_int64<8>& a) { return v_mask_to_bits(a.native()); }
+
+static SIMDPP_INL
+uint64_t i_extract_mask_bits(const mask_float32<16>& a) { return v_mask_to_bits(a.native()); }
+
+static SIMDPP_INL
+uint64_t i_extract_mask_bits(const mask_float64<8>& a) { return v_mask_to_bits(a.native()); }
+#endif
+
+// Combines the results of the native vectors of a vector array
+template<class M> SIMDPP_INL
+uint64_t i_extract_mask_bits(const M& a)
+{
+    static_assert(M::length <= 64, "Too many elements to fit into uint64_t");
+    const unsigned base_length = M::base_vector_type::length;
+    uint64_t r = 0;
+    for (unsigned i = 0; i < M::vec_length; ++i) {
+        r |= i_extract_mask_bits(a.vec(i)) << (i * base_length);
+    }
+    return r;
+}
+
 } // namespace insn
 } // namespace detail
 } // namespace SIMDPP_ARCH_NAMESPACE
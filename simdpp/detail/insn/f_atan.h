@@ -0,0 +1,160 @@
+/*  Copyright (C) 2017  Povilas Kanapickas <povilas@radix.lt>
+
+    Distributed under the Boost Software License, Version 1.0.
+        (See accompanying file LICENSE_1_0.txt or copy at
+            http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#ifndef LIBSIMDPP_SIMDPP_DETAIL_INSN_F_ATAN_H
+#define LIBSIMDPP_SIMDPP_DETAIL_INSN_F_ATAN_H
+
+#ifndef LIBSIMDPP_SIMD_H
+    #error "This file must be included through simd.h"
+#endif
+
+#include <limits>
+#include <simdpp/types.h>
+#include <simdpp/core/bit_and.h>
+#include <simdpp/core/bit_or.h>
+#include <simdpp/core/bit_xor.h>
+#include <simdpp/core/blend.h>
+#include <simdpp/core/cast.h>
+#include <simdpp/core/cmp_eq.h>
+#include <simdpp/core/cmp_gt.h>
+#include <simdpp/core/f_abs.h>
+#include <simdpp/core/f_add.h>
+#include <simdpp/core/f_div.h>
+#include <simdpp/core/f_isnan.h>
+#include <simdpp/core/f_max.h>
+#include <simdpp/core/f_min.h>
+#include <simdpp/core/f_mul.h>
+#include <simdpp/core/f_sub.h>
+#include <simdpp/core/i_shift_r.h>
+#include <simdpp/core/make_uint.h>
+#include <simdpp/core/set_splat.h>
+#include <simdpp/detail/insn/f_poly.h>
+#include <simdpp/detail/insn/f_trig.h>
+
+namespace simdpp {
+namespace SIMDPP_ARCH_NAMESPACE {
+namespace detail {
+namespace insn {
+
+/*  Computes atan(x) for non-negative x. The argument is reduced to range
+    [-tan(pi/8), tan(pi/8)] using atan(x) = pi/2 + atan(-1/x) and
+    atan(x) = pi/4 + atan((x-1)/(x+1)). The branches are selected per element,
+    so that a single division is needed. The polynomials are from the Cephes
+    library.
+*/
+template<unsigned N> SIMDPP_INL
+float32<N> v_atan_positive(const float32<N>& ax)
+{
+    using V = float32<N>;
+    static const float c[] = {
+        8.05374449538e-2f, -1.38776856032e-1f, 1.99777106478e-1f,
+        -3.33329491539e-1f
+    };
+    V one = splat<V>(1.0f);
+    mask_float32<N> big = cmp_gt(ax, splat<V>(2.414213562373095f));
+    mask_float32<N> mid = cmp_gt(ax, splat<V>(0.4142135623730950f));
+
+    V num = blend(splat<V>(-1.0f), blend(sub(ax, one), ax, mid), big);
+    V den = blend(ax, blend(add(ax, one), one, mid), big);
+    V y0 = blend(splat<V>(1.5707963267948966f),
+                 blend(splat<V>(0.7853981633974483f), (V) make_zero(), mid),
+                 big);
+
+    V x = div(num, den);
+    V z = mul(x, x);
+    V y = v_mul_add(V(mul(z, x)), v_poly_eval(z, c), x);
+    return add(y0, y);
+}
+
+// The rational approximation uses the range [-0.66, 0.66] for the reduced
+// argument. The additional terms correct the rounding error of pi/2 and pi/4.
+template<unsigned N> SIMDPP_INL
+float64<N> v_atan_positive(const float64<N>& ax)
+{
+    using V = float64<N>;
+    static const double p[] = {
+        -8.750608600031904122785e-1, -1.615753718733365076637e1,
+        -7.500855792314704667340e1, -1.228866684490136173410e2,
+        -6.485021904942025371773e1
+    };
+    static const double q[] = {
+        1.0, 2.485846490142306297962e1, 1.650270098316988542046e2,
+        4.328810604912902668951e2, 4.853903996359136964868e2,
+        1.945506571482613964425e2
+    };
+    const double morebits = 6.123233995736765886130e-17;
+    V one = splat<V>(1.0);
+    mask_float64<N> big = cmp_gt(ax, splat<V>(2.41421356237309504880));
+    mask_float64<N> mid = cmp_gt(ax, splat<V>(0.66));
+
+    V num = blend(splat<V>(-1.0), blend(sub(ax, one), ax, mid), big);
+    V den = blend(ax, blend(add(ax, one), one, mid), big);
+    V y0 = blend(splat<V>(1.57079632679489661923),
+                 blend(splat<V>(0.78539816339744830962), (V) make_zero(), mid),
+                 big);
+    V y1 = blend(splat<V>(morebits),
+                 blend(splat<V>(0.5 * morebits), (V) make_zero(), mid), big);
+
+    V x = div(num, den);
+    V z = mul(x, x);
+    V y = div(mul(z, v_poly_eval(z, p)), v_poly_eval(z, q));
+    y = v_mul_add(x, y, x);
+    return add(y0, add(y, y1));
+}
+
+template<class V> SIMDPP_INL
+V i_atan(const V& a)
+{
+    V sign;
+    V ax = v_split_sign(a, sign);
+    return bit_xor(v_atan_positive(ax), sign);
+}
+
+// Returns all ones in the elements that have the sign bit set
+template<unsigned N> SIMDPP_INL
+float32<N> v_sign_to_mask(const float32<N>& a)
+{
+    return bit_cast<float32<N>>(shift_r<31>(bit_cast<int32<N>>(a)));
+}
+
+template<unsigned N> SIMDPP_INL
+float64<N> v_sign_to_mask(const float64<N>& a)
+{
+    return bit_cast<float64<N>>(shift_r<63>(bit_cast<int64<N>>(a)));
+}
+
+/*  The angle is computed as atan(min(|x|,|y|) / max(|x|,|y|)) and then
+    moved to the correct octant. The case when both arguments are zero or
+    both are infinite are handled separately, as C99 specifies.
+*/
+template<class V> SIMDPP_INL
+V i_atan2(const V& y, const V& x)
+{
+    using E = typename V::element_type;
+    V ax = abs(x);
+    V ay = abs(y);
+    V zero = make_zero();
+    V inf = splat<V>(std::numeric_limits<E>::infinity());
+    V t = div(min(ax, ay), max(ax, ay));
+    V r = v_atan_positive(t);
+
+    r = blend(zero, r, bit_and(cmp_eq(ax, zero), cmp_eq(ay, zero)));
+    r = blend(splat<V>(0.78539816339744830962), r,
+              bit_and(cmp_eq(ax, inf), cmp_eq(ay, inf)));
+    r = blend(sub(splat<V>(1.57079632679489661923), r), r, cmp_gt(ay, ax));
+    r = blend(sub(splat<V>(3.14159265358979323846), r), r, v_sign_to_mask(x));
+    r = bit_or(r, bit_and(y, splat<V>(-0.0)));
+    return blend(add(x, y), r, bit_or(isnan(x), isnan(y)));
+}
+
+} // namespace insn
+} // namespace detail
+} // namespace SIMDPP_ARCH_NAMESPACE
+} // namespace simdpp
+
+#endif
+
@@ -122,7 +122,7 @@ float64x2 i_ceil(const float64x2& a)
     float64x2 add1 = make_float(1.0);
     add1 = bit_and(add1, mask_add1);
 
-    a2 = bit_andnot(a, mask_1to1);
+    a2 = bit_andnot(a2, mask_1to1);
     a2 = add(a2, add1);
 
     return blend(a2, a, mask_range);
@@ -0,0 +1,180 @@
+/*  Copyright (C) 2017  Povilas Kanapickas <povilas@radix.lt>
+
+    Distributed under the Boost Software License, Version 1.0.
+        (See accompanying file LICENSE_1_0.txt or copy at
+            http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#ifndef LIBSIMDPP_SIMDPP_DETAIL_INSN_F_EXP_H
+#define LIBSIMDPP_SIMDPP_DETAIL_INSN_F_EXP_H
+
+#ifndef LIBSIMDPP_SIMD_H
+    #error "This file must be included through simd.h"
+#endif
+
+#include <simdpp/types.h>
+#include <simdpp/core/bit_and.h>
+#include <simdpp/core/blend.h>
+#include <simdpp/core/cast.h>
+#include <simdpp/core/f_add.h>
+#include <simdpp/core/f_floor.h>
+#include <simdpp/core/f_isnan.h>
+#include <simdpp/core/f_max.h>
+#include <simdpp/core/f_min.h>
+#include <simdpp/core/f_mul.h>
+#include <simdpp/core/f_sub.h>
+#include <simdpp/core/i_shift_l.h>
+#include <simdpp/core/i_shift_r.h>
+#include <simdpp/core/i_sub.h>
+#include <simdpp/core/set_splat.h>
+#include <simdpp/detail/insn/f_poly.h>
+
+namespace simdpp {
+namespace SIMDPP_ARCH_NAMESPACE {
+namespace detail {
+namespace insn {
+
+/*  Computes p * 2^n for integral n in range [-151, 129]. The scale is applied
+    as two factors that are both normal numbers, so that the result overflows
+    to infinity and underflows to denormals and zero correctly.
+
+    The low mantissa bits of 1.5*2^23 + 254 + n hold n + 254.
+*/
+template<unsigned N> SIMDPP_INL
+float32<N> v_ldexp_split(const float32<N>& p, const float32<N>& n)
+{
+    float32<N> t = add(n, splat<float32<N>>(12583166.0f));
+    uint32<N> u = bit_and(bit_cast<uint32<N>>(t), splat<uint32<N>>(0x3fffff));
+    uint32<N> e1 = shift_r<1>(u);
+    uint32<N> e2 = sub(u, e1);
+    float32<N> s1 = bit_cast<float32<N>>(shift_l<23>(e1));
+    float32<N> s2 = bit_cast<float32<N>>(shift_l<23>(e2));
+    return mul(mul(p, s1), s2);
+}
+
+// Same as above for n in range [-1080, 1025]
+template<unsigned N> SIMDPP_INL
+float64<N> v_ldexp_split(const float64<N>& p, const float64<N>& n)
+{
+    float64<N> t = add(n, splat<float64<N>>(6755399441057790.0));
+    uint64<N> u = bit_and(bit_cast<uint64<N>>(t),
+                          splat<uint64<N>>(uint64_t(0x7ffffffffffff)));
+    uint64<N> e1 = shift_r<1>(u);
+    uint64<N> e2 = sub(u, e1);
+    float64<N> s1 = bit_cast<float64<N>>(shift_l<52>(e1));
+    float64<N> s2 = bit_cast<float64<N>>(shift_l<52>(e2));
+    return mul(mul(p, s1), s2);
+}
+
+// Computes exp(r) for r in range [-ln(2)/2, ln(2)/2]. The polynomial is from
+// the Cephes library.
+template<unsigned N> SIMDPP_INL
+float32<N> v_exp_reduced(const float32<N>& r)
+{
+    static const float c[] = {
+        1.9875691500e-4f, 1.3981999507e-3f, 8.3334519073e-3f,
+        4.1665795894e-2f, 1.6666665459e-1f, 5.0000001201e-1f
+    };
+    float32<N> z = mul(r, r);
+    float32<N> p = v_poly_eval(r, c);
+    p = v_mul_add(p, z, r);
+    return add(p, splat<float32<N>>(1.0f));
+}
+
+// The Taylor series truncated at the 13th power. The truncation error is
+// below 2^-57.
+template<unsigned N> SIMDPP_INL
+float64<N> v_exp_reduced(const float64<N>& r)
+{
+    static const double c[] = {
+        1.0 / 6227020800.0, 1.0 / 479001600.0, 1.0 / 39916800.0,
+        1.0 / 3628800.0, 1.0 / 362880.0, 1.0 / 40320.0, 1.0 / 5040.0,
+        1.0 / 720.0, 1.0 / 120.0, 1.0 / 24.0, 1.0 / 6.0, 1.0 / 2.0
+    };
+    float64<N> z = mul(r, r);
+    float64<N> p = v_poly_eval(r, c);
+    p = v_mul_add(p, z, r);
+    return add(p, splat<float64<N>>(1.0));
+}
+
+template<class V> SIMDPP_INL
+V v_exp_clamp(const V& a, typename V::element_type lo,
+              typename V::element_type hi)
+{
+    return min(max(a, splat<V>(lo)), splat<V>(hi));
+}
+
+/*  The argument is reduced to r = x - n*ln(2) where n is an integer and
+    r is in range [-ln(2)/2, ln(2)/2]. ln(2) is split into two parts so that
+    n*ln(2) is computed with extra precision. Arguments are clamped to a
+    range where the result is still guaranteed to overflow or underflow.
+*/
+template<unsigned N> SIMDPP_INL
+float32<N> i_exp(const float32<N>& a)
+{
+    float32<N> x = v_exp_clamp(a, -104.0f, 89.0f);
+    float32<N> n = floor(v_mul_add(x, splat<float32<N>>(1.44269504088896341f),
+                                   0.5f));
+    x = v_mul_add(n, splat<float32<N>>(-0.693359375f), x);
+    x = v_mul_add(n, splat<float32<N>>(2.12194440e-4f), x);
+    float32<N> r = v_ldexp_split(v_exp_reduced(x), n);
+    return blend(a, r, isnan(a));
+}
+
+template<unsigned N> SIMDPP_INL
+float64<N> i_exp(const float64<N>& a)
+{
+    float64<N> x = v_exp_clamp(a, -746.0, 710.0);
+    float64<N> n = floor(v_mul_add(x, splat<float64<N>>(1.4426950408889634),
+                                   0.5));
+    x = v_mul_add(n, splat<float64<N>>(-6.93147180369123816490e-01), x);
+    x = v_mul_add(n, splat<float64<N>>(-1.90821492927058770002e-10), x);
+    float64<N> r = v_ldexp_split(v_exp_reduced(x), n);
+    return blend(a, r, isnan(a));
+}
+
+// The fractional part of the argument is exact, thus only the multiplication
+// by ln(2) introduces additional error.
+template<class V> SIMDPP_INL
+V i_exp2(const V& a)
+{
+    using E = typename V::element_type;
+    V x = sizeof(E) == 4 ? v_exp_clamp(a, E(-151), E(129))
+                         : v_exp_clamp(a, E(-1080), E(1025));
+    V n = floor(add(x, splat<V>(0.5)));
+    x = mul(sub(x, n), splat<V>(0.693147180559945309));
+    V r = v_ldexp_split(v_exp_reduced(x), n);
+    return blend(a, r, isnan(a));
+}
+
+// A minimax approximation of 2^x for x in range [-0.5, 0.5]. The relative
+// error is below 7.5e-5.
+template<class V> SIMDPP_INL
+V i_exp2_e(const V& a)
+{
+    using E = typename V::element_type;
+    static const E c[] = {
+        E(0.05517166909261175), E(0.2426111222237535),
+        E(0.6932609854542457), E(0.9999280735351597)
+    };
+    V x = sizeof(E) == 4 ? v_exp_clamp(a, E(-151), E(129))
+                         : v_exp_clamp(a, E(-1080), E(1025));
+    V n = floor(add(x, splat<V>(0.5)));
+    V f = sub(x, n);
+    V r = v_ldexp_split(v_poly_eval(f, c), n);
+    return blend(a, r, isnan(a));
+}
+
+template<class V> SIMDPP_INL
+V i_exp_e(const V& a)
+{
+    return i_exp2_e(V(mul(a, splat<V>(1.4426950408889634))));
+}
+
+} // namespace insn
+} // namespace detail
+} // namespace SIMDPP_ARCH_NAMESPACE
+} // namespace simdpp
+
+#endif
+
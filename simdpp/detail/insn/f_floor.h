@@ -116,15 +116,15 @@ float64x2 i_floor(const float64x2& a)
     // one special case is when 'a' is in the range of (-1.0, 0.0) in which
     // a & clearbits may still yield to zero. Thus this additional check
     mask_sub1 = bit_or(mask_sub1, bit_and(mask_1to1, mask_neg));
-    float64x2 sub1 = make_float(-1.0);
+    float64x2 sub1 = make_float(1.0);
     sub1 = bit_and(sub1, mask_sub1);
 
-    a2 = bit_andnot(a, mask_1to1);
+    a2 = bit_andnot(a2, mask_1to1);
     a2 = sub(a2, sub1);
 
     return blend(a2, a, mask_range);
 #elif SIMDPP_USE_NEON64
-    return vrndnq_f64(a.native());
+    return vrndmq_f64(a.native());
 #elif SIMDPP_USE_VSX_206
     return vec_floor(a.native());
 #elif SIMDPP_USE_NULL || SIMDPP_USE_NEON32 || SIMDPP_USE_ALTIVEC
@@ -0,0 +1,253 @@
+/*  Copyright (C) 2017  Povilas Kanapickas <povilas@radix.lt>
+
+    Distributed under the Boost Software License, Version 1.0.
+        (See accompanying file LICENSE_1_0.txt or copy at
+            http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#ifndef LIBSIMDPP_SIMDPP_DETAIL_INSN_F_LOG_H
+#define LIBSIMDPP_SIMDPP_DETAIL_INSN_F_LOG_H
+
+#ifndef LIBSIMDPP_SIMD_H
+    #error "This file must be included through simd.h"
+#endif
+
+#include <limits>
+#include <simdpp/types.h>
+#include <simdpp/core/bit_and.h>
+#include <simdpp/core/bit_or.h>
+#include <simdpp/core/blend.h>
+#include <simdpp/core/cast.h>
+#include <simdpp/core/cmp_eq.h>
+#include <simdpp/core/cmp_lt.h>
+#include <simdpp/core/f_add.h>
+#include <simdpp/core/f_div.h>
+#include <simdpp/core/f_isnan.h>
+#include <simdpp/core/f_mul.h>
+#include <simdpp/core/f_neg.h>
+#include <simdpp/core/f_sub.h>
+#include <simdpp/core/i_shift_r.h>
+#include <simdpp/core/make_uint.h>
+#include <simdpp/core/set_splat.h>
+#include <simdpp/detail/insn/f_poly.h>
+
+namespace simdpp {
+namespace SIMDPP_ARCH_NAMESPACE {
+namespace detail {
+namespace insn {
+
+/*  Splits a positive number into 2^e * (1 + f) where f is in range
+    [sqrt(0.5) - 1, sqrt(2) - 1). Denormals are scaled into the normal range
+    first. The exponent is converted to floating-point by placing it into the
+    low mantissa bits of 2^23.
+*/
+template<unsigned N> SIMDPP_INL
+float32<N> v_log_split(const float32<N>& a, float32<N>& e)
+{
+    using V = float32<N>;
+    using U = uint32<N>;
+    mask_float32<N> denorm = cmp_lt(a, splat<V>(1.17549435e-38f));
+    V x = blend(mul(a, splat<V>(8388608.0f)), a, denorm);
+    U bits = bit_cast<U>(x);
+
+    V ef = bit_cast<V>(bit_or(shift_r<23>(bits), splat<U>(0x4b000000)));
+    e = sub(ef, splat<V>(8388608.0f + 126.0f));
+    e = sub(e, bit_and(splat<V>(23.0f), denorm));
+
+    // m is in range [0.5, 1)
+    V m = bit_cast<V>(bit_or(bit_and(bits, splat<U>(0x007fffff)),
+                             splat<U>(0x3f000000)));
+    mask_float32<N> lt = cmp_lt(m, splat<V>(0.707106781186547524f));
+    e = sub(e, bit_and(splat<V>(1.0f), lt));
+    m = add(m, bit_and(m, lt));
+    return sub(m, splat<V>(1.0f));
+}
+
+template<unsigned N> SIMDPP_INL
+float64<N> v_log_split(const float64<N>& a, float64<N>& e)
+{
+    using V = float64<N>;
+    using U = uint64<N>;
+    mask_float64<N> denorm = cmp_lt(a, splat<V>(2.2250738585072014e-308));
+    V x = blend(mul(a, splat<V>(4503599627370496.0)), a, denorm);
+    U bits = bit_cast<U>(x);
+
+    V ef = bit_cast<V>(bit_or(shift_r<52>(bits),
+                              splat<U>(uint64_t(0x4330000000000000))));
+    e = sub(ef, splat<V>(4503599627370496.0 + 1022.0));
+    e = sub(e, bit_and(splat<V>(52.0), denorm));
+
+    V m = bit_cast<V>(bit_or(bit_and(bits, splat<U>(uint64_t(0x000fffffffffffff))),
+                             splat<U>(uint64_t(0x3fe0000000000000))));
+    mask_float64<N> lt = cmp_lt(m, splat<V>(0.707106781186547524));
+    e = sub(e, bit_and(splat<V>(1.0), lt));
+    m = add(m, bit_and(m, lt));
+    return sub(m, splat<V>(1.0));
+}
+
+// Computes log(1 + f) + c for f returned by v_log_split(). The polynomial is
+// from the Cephes library. c is a small correction added before the final
+// rounding.
+template<unsigned N> SIMDPP_INL
+float32<N> v_log1p_reduced(const float32<N>& f, const float32<N>& c)
+{
+    static const float p[] = {
+        7.0376836292e-2f, -1.1514610310e-1f, 1.1676998740e-1f,
+        -1.2420140846e-1f, 1.4249322787e-1f, -1.6668057665e-1f,
+        2.0000714765e-1f, -2.4999993993e-1f, 3.3333331174e-1f
+    };
+    float32<N> z = mul(f, f);
+    float32<N> y = mul(mul(f, z), v_poly_eval(f, p));
+    y = add(y, c);
+    y = v_mul_add(z, splat<float32<N>>(-0.5f), y);
+    return add(f, y);
+}
+
+// Same as above, the algorithm and the polynomial are from fdlibm.
+template<unsigned N> SIMDPP_INL
+float64<N> v_log1p_reduced(const float64<N>& f, const float64<N>& c)
+{
+    static const double lg[] = {
+        1.479819860511658591e-01, 1.531383769920937332e-01,
+        1.818357216161805012e-01, 2.222219843214978396e-01,
+        2.857142874366239149e-01, 3.999999999940941908e-01,
+        6.666666666666735130e-01
+    };
+    using V = float64<N>;
+    V s = div(f, add(f, splat<V>(2.0)));
+    V z = mul(s, s);
+    V r = mul(z, v_poly_eval(z, lg));
+    V hfsq = mul(mul(f, f), splat<V>(0.5));
+    V t = v_mul_add(s, V(add(hfsq, r)), c);
+    return sub(f, sub(hfsq, t));
+}
+
+template<class V> SIMDPP_INL
+V v_log_fixup(const V& a, const V& r)
+{
+    using E = typename V::element_type;
+    V zero = make_zero();
+    V inf = splat<V>(std::numeric_limits<E>::infinity());
+    V res = blend(neg(inf), r, cmp_eq(a, zero));
+    res = blend(inf, res, cmp_eq(a, inf));
+    res = blend(splat<V>(std::numeric_limits<E>::quiet_NaN()), res,
+                cmp_lt(a, zero));
+    return blend(a, res, isnan(a));
+}
+
+// ln(2) is split into two parts so that e*ln(2) is computed with extra
+// precision
+template<class V> SIMDPP_INL
+V i_log(const V& a)
+{
+    using E = typename V::element_type;
+    const E ln2_hi = sizeof(E) == 4 ? E(0.693359375)
+                                    : E(6.93147180369123816490e-01);
+    const E ln2_lo = sizeof(E) == 4 ? E(-2.12194440e-4)
+                                    : E(1.90821492927058770002e-10);
+    V e;
+    V f = v_log_split(a, e);
+    V r = v_log1p_reduced(f, V(mul(e, splat<V>(ln2_lo))));
+    r = v_mul_add(e, splat<V>(ln2_hi), r);
+    return v_log_fixup(a, r);
+}
+
+template<class V> SIMDPP_INL
+V i_log2(const V& a)
+{
+    V e;
+    V f = v_log_split(a, e);
+    V r = v_log1p_reduced(f, V(make_zero()));
+    r = v_mul_add(r, splat<V>(1.44269504088896340736), e);
+    return v_log_fixup(a, r);
+}
+
+/*  Computes log2(a) for finite positive a as an unevaluated sum of the
+    returned value and lo. The absolute error is below 2^-64. The result is
+    meaningless for zero, infinite and NaN inputs.
+
+    log(1 + f) = 2*atanh(s) = 2*s + 2/3*s^3 + 2/5*s^5 + ... where
+    s = f / (2 + f) is below 0.172 in magnitude. s and the first two terms are
+    computed as double-doubles, the remaining terms are small enough to be
+    computed in working precision. The series is truncated after the 25th
+    power.
+*/
+template<unsigned N> SIMDPP_INL
+float64<N> v_log2_dd(const float64<N>& a, float64<N>& lo)
+{
+    static const double c[] = {
+        2.0 / 25, 2.0 / 23, 2.0 / 21, 2.0 / 19, 2.0 / 17, 2.0 / 15,
+        2.0 / 13, 2.0 / 11, 2.0 / 9, 2.0 / 7, 2.0 / 5
+    };
+    using V = float64<N>;
+    V e;
+    V f = v_log_split(a, e);
+
+    V ul;
+    V u = v_fast_two_sum(splat<V>(2.0), f, ul);
+    V s = div(f, u);
+    V pl;
+    V p = v_two_prod(s, u, pl);
+    V sl = div(sub(sub(sub(f, p), pl), mul(s, ul)), u);
+
+    // s^2 and s^3 including the low part of s
+    V zl;
+    V z = v_two_prod(s, s, zl);
+    zl = v_mul_add(V(add(s, s)), sl, zl);
+    V cl;
+    V c3 = v_two_prod(z, s, cl);
+    cl = v_mul_add(zl, s, v_mul_add(z, sl, cl));
+
+    // 2/3 * s^3 with 2/3 split into two parts
+    V tl;
+    V t = v_two_prod(c3, splat<V>(0.6666666666666666), tl);
+    tl = v_mul_add(c3, splat<V>(3.700743415417188e-17), tl);
+    tl = v_mul_add(cl, splat<V>(0.6666666666666666), tl);
+
+    V w = mul(mul(c3, z), v_poly_eval(z, c));
+    V gl;
+    V g = v_fast_two_sum(V(add(s, s)), t, gl);
+    gl = add(gl, add(add(sl, sl), add(tl, w)));
+    V hl;
+    V h = v_fast_two_sum(g, gl, hl);
+
+    // multiply by 1/ln(2) split into two parts and add the exponent
+    V rl;
+    V r = v_two_prod(h, splat<V>(1.4426950408889634), rl);
+    rl = v_mul_add(h, splat<V>(2.0355273740931033e-17), rl);
+    rl = v_mul_add(hl, splat<V>(1.4426950408889634), rl);
+    V el;
+    r = v_two_sum(e, r, el);
+    return v_fast_two_sum(r, V(add(el, rl)), lo);
+}
+
+// A minimax approximation of log2(1 + f) / f for f in range
+// [sqrt(0.5) - 1, sqrt(2) - 1]. The relative error is below 5.1e-5.
+template<class V> SIMDPP_INL
+V i_log2_e(const V& a)
+{
+    using E = typename V::element_type;
+    static const E c[] = {
+        E(0.25475187501199825), E(-0.39089244315129495),
+        E(0.48530651442801254), E(-0.7205549723003627),
+        E(1.4426462509128337)
+    };
+    V e;
+    V f = v_log_split(a, e);
+    V r = v_mul_add(f, v_poly_eval(f, c), e);
+    return v_log_fixup(a, r);
+}
+
+template<class V> SIMDPP_INL
+V i_log_e(const V& a)
+{
+    return mul(i_log2_e(a), splat<V>(0.693147180559945309));
+}
+
+} // namespace insn
+} // namespace detail
+} // namespace SIMDPP_ARCH_NAMESPACE
+} // namespace simdpp
+
+#endif
+
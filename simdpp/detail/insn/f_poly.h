@@ -0,0 +1,125 @@
+/*  Copyright (C) 2017  Povilas Kanapickas <povilas@radix.lt>
+
+    Distributed under the Boost Software License, Version 1.0.
+        (See accompanying file LICENSE_1_0.txt or copy at
+            http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#ifndef LIBSIMDPP_SIMDPP_DETAIL_INSN_F_POLY_H
+#define LIBSIMDPP_SIMDPP_DETAIL_INSN_F_POLY_H
+
+#ifndef LIBSIMDPP_SIMD_H
+    #error "This file must be included through simd.h"
+#endif
+
+#include <simdpp/types.h>
+#include <simdpp/core/f_add.h>
+#include <simdpp/core/f_fmadd.h>
+#include <simdpp/core/f_mul.h>
+#include <simdpp/core/f_neg.h>
+#include <simdpp/core/f_sub.h>
+#include <simdpp/core/set_splat.h>
+
+namespace simdpp {
+namespace SIMDPP_ARCH_NAMESPACE {
+namespace detail {
+namespace insn {
+
+/*  Computes a * b + c. A fused multiply-add is used where the instruction set
+    provides one, thus the results may differ in the last bit between
+    architectures.
+*/
+template<unsigned N> SIMDPP_INL
+float32<N> v_mul_add(const float32<N>& a, const float32<N>& b,
+                     const float32<N>& c)
+{
+#if SIMDPP_USE_FMA3 || SIMDPP_USE_FMA4 || SIMDPP_USE_NEON64 || SIMDPP_USE_MSA
+    return fmadd(a, b, c);
+#else
+    return add(mul(a, b), c);
+#endif
+}
+
+template<unsigned N> SIMDPP_INL
+float64<N> v_mul_add(const float64<N>& a, const float64<N>& b,
+                     const float64<N>& c)
+{
+#if SIMDPP_USE_FMA3 || SIMDPP_USE_FMA4 || SIMDPP_USE_NEON64 || SIMDPP_USE_MSA
+    return fmadd(a, b, c);
+#else
+    return add(mul(a, b), c);
+#endif
+}
+
+template<class V> SIMDPP_INL
+V v_mul_add(const V& a, const V& b, typename V::element_type c)
+{
+    return v_mul_add(a, b, splat<V>(c));
+}
+
+/*  Computes a * b as an unevaluated sum of the rounded product and the exact
+    rounding error stored to lo. Without a fused multiply-add the error is
+    computed from the Dekker split of the operands, which requires that
+    neither a nor b is close to overflow.
+*/
+template<class V> SIMDPP_INL
+V v_two_prod(const V& a, const V& b, V& lo)
+{
+    V p = mul(a, b);
+#if SIMDPP_USE_FMA3 || SIMDPP_USE_FMA4 || SIMDPP_USE_NEON64 || SIMDPP_USE_MSA
+    lo = fmadd(a, b, V(neg(p)));
+#else
+    using E = typename V::element_type;
+    V split = splat<V>(sizeof(E) == 4 ? E(4097.0) : E(134217729.0));
+    V ta = mul(a, split);
+    V tb = mul(b, split);
+    V ah = sub(ta, sub(ta, a));
+    V bh = sub(tb, sub(tb, b));
+    V al = sub(a, ah);
+    V bl = sub(b, bh);
+    lo = sub(mul(ah, bh), p);
+    lo = add(lo, mul(ah, bl));
+    lo = add(lo, mul(al, bh));
+    lo = add(lo, mul(al, bl));
+#endif
+    return p;
+}
+
+// Computes a + b as an unevaluated sum of the rounded sum and the exact
+// rounding error stored to lo
+template<class V> SIMDPP_INL
+V v_two_sum(const V& a, const V& b, V& lo)
+{
+    V s = add(a, b);
+    V bb = sub(s, a);
+    lo = add(sub(a, sub(s, bb)), sub(b, bb));
+    return s;
+}
+
+// Same as v_two_sum, but requires |a| >= |b| or a == 0
+template<class V> SIMDPP_INL
+V v_fast_two_sum(const V& a, const V& b, V& lo)
+{
+    V s = add(a, b);
+    lo = sub(b, sub(s, a));
+    return s;
+}
+
+// Evaluates a polynomial using Horner's scheme. The coefficients are given
+// starting from the highest power of x.
+template<class V, unsigned K> SIMDPP_INL
+V v_poly_eval(const V& x, const typename V::element_type (&c)[K])
+{
+    V r = splat<V>(c[0]);
+    for (unsigned i = 1; i < K; ++i)
+        r = v_mul_add(r, x, c[i]);
+    return r;
+}
+
+} // namespace insn
+} // namespace detail
+} // namespace SIMDPP_ARCH_NAMESPACE
+} // namespace simdpp
+
+#endif
+
@@ -0,0 +1,117 @@
+/*  Copyright (C) 2017  Povilas Kanapickas <povilas@radix.lt>
+
+    Distributed under the Boost Software License, Version 1.0.
+        (See accompanying file LICENSE_1_0.txt or copy at
+            http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#ifndef LIBSIMDPP_SIMDPP_DETAIL_INSN_F_POW_H
+#define LIBSIMDPP_SIMDPP_DETAIL_INSN_F_POW_H
+
+#ifndef LIBSIMDPP_SIMD_H
+    #error "This file must be included through simd.h"
+#endif
+
+#include <limits>
+#include <simdpp/types.h>
+#include <simdpp/core/bit_and.h>
+#include <simdpp/core/bit_andnot.h>
+#include <simdpp/core/bit_or.h>
+#include <simdpp/core/bit_xor.h>
+#include <simdpp/core/blend.h>
+#include <simdpp/core/cmp_eq.h>
+#include <simdpp/core/cmp_gt.h>
+#include <simdpp/core/cmp_lt.h>
+#include <simdpp/core/f_abs.h>
+#include <simdpp/core/f_add.h>
+#include <simdpp/core/f_floor.h>
+#include <simdpp/core/f_isnan.h>
+#include <simdpp/core/f_mul.h>
+#include <simdpp/core/f_neg.h>
+#include <simdpp/core/f_sub.h>
+#include <simdpp/core/f_trunc.h>
+#include <simdpp/core/make_uint.h>
+#include <simdpp/core/set_splat.h>
+#include <simdpp/core/to_float32.h>
+#include <simdpp/core/to_float64.h>
+#include <simdpp/detail/insn/f_exp.h>
+#include <simdpp/detail/insn/f_log.h>
+
+namespace simdpp {
+namespace SIMDPP_ARCH_NAMESPACE {
+namespace detail {
+namespace insn {
+
+/*  Computes 2^(y * log2(x)) for non-negative x. log2(x) is computed as a
+    double-double and the product with y is split into z + zl, thus the error
+    of log2(x) is not amplified by large |y * log2(x)|. The fractional part
+    z - n is exact and zl is added to it before the final exponentiation.
+    The correction is dropped if z is large or not finite, as then the
+    result overflows or underflows anyway.
+*/
+template<unsigned N> SIMDPP_INL
+float64<N> v_pow_abs(const float64<N>& x, const float64<N>& y)
+{
+    using V = float64<N>;
+    V ll;
+    V l = v_log_fixup(x, V(v_log2_dd(x, ll)));
+    V zl;
+    V z = v_two_prod(y, l, zl);
+    zl = v_mul_add(y, ll, zl);
+    zl = bit_and(zl, cmp_lt(abs(z), splat<V>(2048.0)));
+
+    V c = v_exp_clamp(z, -1080.0, 1025.0);
+    V n = floor(add(c, splat<V>(0.5)));
+    V f = mul(add(sub(c, n), zl), splat<V>(0.693147180559945309));
+    V r = v_ldexp_split(v_exp_reduced(f), n);
+    return blend(z, r, isnan(z));
+}
+
+/*  Computes pow(x, y) from 2^(y * log2(|x|)) and then handles the sign of
+    the result and the special cases as specified by C99.
+*/
+template<unsigned N> SIMDPP_INL
+float64<N> v_pow(const float64<N>& x, const float64<N>& y)
+{
+    using V = float64<N>;
+    using M = mask_float64<N>;
+    V ax = abs(x);
+    V one = splat<V>(1.0);
+    V r = v_pow_abs(ax, y);
+
+    // pow(1, y) and pow(x, 0) are 1 even if the other argument is NaN
+    r = blend(one, r, bit_or(cmp_eq(ax, one), cmp_eq(y, (V) make_zero())));
+
+    V hy = mul(y, splat<V>(0.5));
+    M y_int = cmp_eq(y, trunc(y));
+    M y_odd = bit_andnot(y_int, cmp_eq(hy, trunc(hy)));
+    r = bit_xor(r, bit_and(bit_and(x, splat<V>(-0.0)), y_odd));
+
+    V inf = splat<V>(std::numeric_limits<double>::infinity());
+    M neg_finite = bit_and(cmp_lt(x, (V) make_zero()), cmp_gt(x, neg(inf)));
+    return blend(splat<V>(std::numeric_limits<double>::quiet_NaN()), r,
+                 bit_andnot(neg_finite, y_int));
+}
+
+// The computation is done in double precision so that the result is nearly
+// correctly rounded
+template<unsigned N> SIMDPP_INL
+float32<N> i_pow(const float32<N>& x, const float32<N>& y)
+{
+    float64<N> r = v_pow(float64<N>(to_float64(x)), float64<N>(to_float64(y)));
+    return to_float32(r);
+}
+
+template<unsigned N> SIMDPP_INL
+float64<N> i_pow(const float64<N>& x, const float64<N>& y)
+{
+    return v_pow(x, y);
+}
+
+} // namespace insn
+} // namespace detail
+} // namespace SIMDPP_ARCH_NAMESPACE
+} // namespace simdpp
+
+#endif
+
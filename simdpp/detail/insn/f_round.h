@@ -0,0 +1,132 @@
+/*  Copyright (C) 2017  Povilas Kanapickas <povilas@radix.lt>
+
+    Distributed under the Boost Software License, Version 1.0.
+        (See accompanying file LICENSE_1_0.txt or copy at
+            http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#ifndef LIBSIMDPP_SIMDPP_DETAIL_INSN_F_ROUND_H
+#define LIBSIMDPP_SIMDPP_DETAIL_INSN_F_ROUND_H
+
+#ifndef LIBSIMDPP_SIMD_H
+    #error "This file must be included through simd.h"
+#endif
+
+#include <cmath>
+#include <simdpp/types.h>
+#include <simdpp/core/bit_or.h>
+#include <simdpp/core/bit_xor.h>
+#include <simdpp/core/blend.h>
+#include <simdpp/core/cmp_lt.h>
+#include <simdpp/core/f_abs.h>
+#include <simdpp/core/f_add.h>
+#include <simdpp/core/f_sub.h>
+#include <simdpp/detail/vector_array_macros.h>
+
+namespace simdpp {
+namespace SIMDPP_ARCH_NAMESPACE {
+namespace detail {
+namespace insn {
+
+/*  Emulates rounding to nearest even by adding and subtracting 2^(M), where M
+    is the number of the mantissa bits. The addition shifts all fraction bits
+    out of the mantissa, which are rounded according to the current rounding
+    mode, i.e. to nearest even by default. The sign is restored afterwards so
+    that e.g. -0.25 rounds to -0.0. Values that are too large to have any
+    fraction bits and NaNs are passed through.
+*/
+template<class V> SIMDPP_INL
+V v_emul_round(const V& a, const typename V::element_type& mantissa_pow2)
+{
+    V af = abs(a);
+    V r = sub(add(af, mantissa_pow2), mantissa_pow2);
+    r = bit_or(r, bit_xor(a, af)); // copy the sign bit
+    return blend(r, a, cmp_lt(af, mantissa_pow2));
+}
+
+static SIMDPP_INL
+float32x4 i_round(const float32x4& a)
+{
+#if SIMDPP_USE_NULL || SIMDPP_USE_NEON_NO_FLT_SP
+    float32x4 r;
+    for (unsigned i = 0; i < a.length; i++) {
+        r.el(i) = std::nearbyint(a.el(i));
+    }
+    return r;
+#elif SIMDPP_USE_SSE4_1
+    return _mm_round_ps(a.native(), 0); // 0 = round to nearest even
+#elif SIMDPP_USE_NEON64
+    return vrndnq_f32(a.native());
+#elif SIMDPP_USE_SSE2 || SIMDPP_USE_NEON_FLT_SP || SIMDPP_USE_MSA
+    return v_emul_round(a, 8388608.0f);
+#elif SIMDPP_USE_ALTIVEC
+    return vec_round(a.native());
+#endif
+}
+
+#if SIMDPP_USE_AVX
+static SIMDPP_INL
+float32x8 i_round(const float32x8& a)
+{
+    return _mm256_round_ps(a.native(), 0); // 0 = round to nearest even
+}
+#endif
+
+#if SIMDPP_USE_AVX512F
+static SIMDPP_INL
+float32<16> i_round(const float32<16>& a)
+{
+    return _mm512_roundscale_ps(a.native(), 0x00); // no fraction bits, nearest
+}
+#endif
+
+// -----------------------------------------------------------------------------
+
+static SIMDPP_INL
+float64x2 i_round(const float64x2& a)
+{
+#if SIMDPP_USE_SSE4_1
+    return _mm_round_pd(a.native(), 0); // 0 = round to nearest even
+#elif SIMDPP_USE_NEON64
+    return vrndnq_f64(a.native());
+#elif SIMDPP_USE_SSE2 || SIMDPP_USE_VSX_206 || SIMDPP_USE_MSA
+    return v_emul_round(a, 4503599627370496.0);
+#elif SIMDPP_USE_NULL || SIMDPP_USE_NEON32 || SIMDPP_USE_ALTIVEC
+    float64x2 r;
+    for (unsigned i = 0; i < r.length; ++i) {
+        r.el(i) = std::nearbyint(a.el(i));
+    }
+    return r;
+#endif
+}
+
+#if SIMDPP_USE_AVX
+static SIMDPP_INL
+float64x4 i_round(const float64x4& a)
+{
+    return _mm256_round_pd(a.native(), 0); // 0 = round to nearest even
+}
+#endif
+
+#if SIMDPP_USE_AVX512F
+static SIMDPP_INL
+float64<8> i_round(const float64<8>& a)
+{
+    return _mm512_roundscale_pd(a.native(), 0x00); // no fraction bits, nearest
+}
+#endif
+
+// -----------------------------------------------------------------------------
+
+template<class V> SIMDPP_INL
+V i_round(const V& a)
+{
+    SIMDPP_VEC_ARRAY_IMPL1(V, i_round, a);
+}
+
+} // namespace insn
+} // namespace detail
+} // namespace SIMDPP_ARCH_NAMESPACE
+} // namespace simdpp
+
+#endif
@@ -0,0 +1,90 @@
+/*  Copyright (C) 2017  Povilas Kanapickas <povilas@radix.lt>
+
+    Distributed under the Boost Software License, Version 1.0.
+        (See accompanying file LICENSE_1_0.txt or copy at
+            http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#ifndef LIBSIMDPP_SIMDPP_DETAIL_INSN_F_TANH_H
+#define LIBSIMDPP_SIMDPP_DETAIL_INSN_F_TANH_H
+
+#ifndef LIBSIMDPP_SIMD_H
+    #error "This file must be included through simd.h"
+#endif
+
+#include <simdpp/types.h>
+#include <simdpp/core/bit_xor.h>
+#include <simdpp/core/blend.h>
+#include <simdpp/core/cmp_lt.h>
+#include <simdpp/core/f_add.h>
+#include <simdpp/core/f_div.h>
+#include <simdpp/core/f_mul.h>
+#include <simdpp/core/f_neg.h>
+#include <simdpp/core/f_sub.h>
+#include <simdpp/core/set_splat.h>
+#include <simdpp/detail/insn/f_exp.h>
+#include <simdpp/detail/insn/f_poly.h>
+#include <simdpp/detail/insn/f_trig.h>
+
+namespace simdpp {
+namespace SIMDPP_ARCH_NAMESPACE {
+namespace detail {
+namespace insn {
+
+// Computes tanh(x) for |x| < 0.625. The approximations are from the Cephes
+// library.
+template<unsigned N> SIMDPP_INL
+float32<N> v_tanh_small(const float32<N>& x)
+{
+    static const float c[] = {
+        -5.70498872745e-3f, 2.06390887954e-2f, -5.37397044842e-2f,
+        1.33314422036e-1f, -3.33332819422e-1f
+    };
+    float32<N> z = mul(x, x);
+    return v_mul_add(float32<N>(mul(z, x)), v_poly_eval(z, c), x);
+}
+
+template<unsigned N> SIMDPP_INL
+float64<N> v_tanh_small(const float64<N>& x)
+{
+    static const double p[] = {
+        -9.64399179425052238628e-1, -9.92877231001918586564e1,
+        -1.61468768441708447952e3
+    };
+    static const double q[] = {
+        1.0, 1.12811678491632931402e2, 2.23548839060100448583e3,
+        4.84406305325125486048e3
+    };
+    float64<N> z = mul(x, x);
+    float64<N> y = div(v_poly_eval(z, p), v_poly_eval(z, q));
+    return v_mul_add(float64<N>(mul(z, x)), y, x);
+}
+
+// For larger arguments tanh(|x|) = 1 - 2 / (exp(2|x|) + 1). Both branches
+// are computed for |x| and the sign is applied last, thus tanh(-0) is -0.
+template<class V> SIMDPP_INL
+V i_tanh(const V& a)
+{
+    V sign;
+    V ax = v_split_sign(a, sign);
+    V one = splat<V>(1.0);
+    V e = i_exp(V(add(ax, ax)));
+    V r = sub(one, div(splat<V>(2.0), add(e, one)));
+    r = blend(v_tanh_small(ax), r, cmp_lt(ax, splat<V>(0.625)));
+    return bit_xor(r, sign);
+}
+
+template<class V> SIMDPP_INL
+V i_sigmoid(const V& a)
+{
+    V one = splat<V>(1.0);
+    return div(one, add(one, i_exp(V(neg(a)))));
+}
+
+} // namespace insn
+} // namespace detail
+} // namespace SIMDPP_ARCH_NAMESPACE
+} // namespace simdpp
+
+#endif
+
@@ -0,0 +1,217 @@
+/*  Copyright (C) 2017  Povilas Kanapickas <povilas@radix.lt>
+
+    Distributed under the Boost Software License, Version 1.0.
+        (See accompanying file LICENSE_1_0.txt or copy at
+            http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#ifndef LIBSIMDPP_SIMDPP_DETAIL_INSN_F_TRIG_H
+#define LIBSIMDPP_SIMDPP_DETAIL_INSN_F_TRIG_H
+
+#ifndef LIBSIMDPP_SIMD_H
+    #error "This file must be included through simd.h"
+#endif
+
+#include <limits>
+#include <simdpp/types.h>
+#include <simdpp/core/bit_and.h>
+#include <simdpp/core/bit_andnot.h>
+#include <simdpp/core/bit_xor.h>
+#include <simdpp/core/blend.h>
+#include <simdpp/core/cast.h>
+#include <simdpp/core/cmp_gt.h>
+#include <simdpp/core/f_add.h>
+#include <simdpp/core/f_div.h>
+#include <simdpp/core/f_floor.h>
+#include <simdpp/core/f_mul.h>
+#include <simdpp/core/i_add.h>
+#include <simdpp/core/i_shift_l.h>
+#include <simdpp/core/i_sub.h>
+#include <simdpp/core/make_uint.h>
+#include <simdpp/core/set_splat.h>
+#include <simdpp/detail/insn/f_poly.h>
+
+namespace simdpp {
+namespace SIMDPP_ARCH_NAMESPACE {
+namespace detail {
+namespace insn {
+
+// Returns the absolute value of a and stores its sign bit to sign
+template<class V> SIMDPP_INL
+V v_split_sign(const V& a, V& sign)
+{
+    V sign_mask = splat<V>(-0.0);
+    sign = bit_and(a, sign_mask);
+    return bit_andnot(a, sign_mask);
+}
+
+// Converts the lowest bit of each element into a full-width bit mask
+template<class U> SIMDPP_INL
+U v_low_bit_to_mask(const U& a)
+{
+    U zero = make_zero();
+    return sub(zero, bit_and(a, splat<U>(1)));
+}
+
+/*  Reduces a non-negative argument to r = x - k*pi/2 where k is an integer
+    and r is in range [-pi/4, pi/4]. pi/2 is split into several parts so that
+    k*pi/2 is computed with extra precision. The low bits of k are returned in
+    q, the quadrant is q & 3.
+
+    For 32-bit values all parts except the last have 11 significant bits, thus
+    the products are exact for k < 2^13. The 64-bit constants are from the
+    Cephes library. The reduction is precise up to 2^13 for 32-bit and 2^30
+    for 64-bit values. Without a fused multiply-add the error then grows
+    quickly, and from about 2^24 and 2^52 respectively r is no longer small
+    and the results are far outside [-1, 1]. NaN is returned for arguments
+    above these limits instead.
+*/
+template<unsigned N> SIMDPP_INL
+float32<N> v_trig_reduce(const float32<N>& ax, uint32<N>& q)
+{
+    using V = float32<N>;
+    V k = floor(v_mul_add(ax, splat<V>(0.636619772367581343f), 0.5f));
+    V r = v_mul_add(k, splat<V>(-1.5703125f), ax);
+    r = v_mul_add(k, splat<V>(-4.837512969970703125e-4f), r);
+    r = v_mul_add(k, splat<V>(-7.54953362047672271729e-8f), r);
+    r = v_mul_add(k, splat<V>(-2.56334406825708960298e-12f), r);
+    q = bit_cast<uint32<N>>(add(k, splat<V>(12582912.0f)));
+    return blend(splat<V>(std::numeric_limits<float>::quiet_NaN()), r,
+                 cmp_gt(ax, splat<V>(8192.0f)));
+}
+
+template<unsigned N> SIMDPP_INL
+float64<N> v_trig_reduce(const float64<N>& ax, uint64<N>& q)
+{
+    using V = float64<N>;
+    V k = floor(v_mul_add(ax, splat<V>(0.636619772367581343), 0.5));
+    V r = v_mul_add(k, splat<V>(-1.57079625129699707031), ax);
+    r = v_mul_add(k, splat<V>(-7.54978941586159635335e-8), r);
+    r = v_mul_add(k, splat<V>(-5.39030285815811905290e-15), r);
+    q = bit_cast<uint64<N>>(add(k, splat<V>(6755399441055744.0)));
+    return blend(splat<V>(std::numeric_limits<double>::quiet_NaN()), r,
+                 cmp_gt(ax, splat<V>(1073741824.0)));
+}
+
+// The polynomials approximate sin(r) and cos(r) for r in range
+// [-pi/4, pi/4]. They are from the Cephes library.
+template<unsigned N> SIMDPP_INL
+float32<N> v_sin_reduced(const float32<N>& r)
+{
+    static const float c[] = {
+        -1.9515295891e-4f, 8.3321608736e-3f, -1.6666654611e-1f
+    };
+    float32<N> z = mul(r, r);
+    return v_mul_add(float32<N>(mul(z, r)), v_poly_eval(z, c), r);
+}
+
+template<unsigned N> SIMDPP_INL
+float32<N> v_cos_reduced(const float32<N>& r)
+{
+    static const float c[] = {
+        2.443315711809948e-5f, -1.388731625493765e-3f, 4.166664568298827e-2f
+    };
+    float32<N> z = mul(r, r);
+    float32<N> y = v_mul_add(z, splat<float32<N>>(-0.5f), 1.0f);
+    return v_mul_add(float32<N>(mul(z, z)), v_poly_eval(z, c), y);
+}
+
+template<unsigned N> SIMDPP_INL
+float64<N> v_sin_reduced(const float64<N>& r)
+{
+    static const double c[] = {
+        1.58962301576546568060e-10, -2.50507477628578072866e-8,
+        2.75573136213857245213e-6, -1.98412698295895385996e-4,
+        8.33333333332211858878e-3, -1.66666666666666307295e-1
+    };
+    float64<N> z = mul(r, r);
+    return v_mul_add(float64<N>(mul(z, r)), v_poly_eval(z, c), r);
+}
+
+template<unsigned N> SIMDPP_INL
+float64<N> v_cos_reduced(const float64<N>& r)
+{
+    static const double c[] = {
+        -1.13585365213876817300e-11, 2.08757008419747316778e-9,
+        -2.75573141792967388112e-7, 2.48015872888517045348e-5,
+        -1.38888888888730564116e-3, 4.16666666666665929218e-2
+    };
+    float64<N> z = mul(r, r);
+    float64<N> y = v_mul_add(z, splat<float64<N>>(-0.5), 1.0);
+    return v_mul_add(float64<N>(mul(z, z)), v_poly_eval(z, c), y);
+}
+
+/*  sin(x) and cos(x) are computed from sin(r) and cos(r) depending on the
+    quadrant q:
+
+    q   sin(x)   cos(x)
+    0   sin(r)   cos(r)
+    1   cos(r)  -sin(r)
+    2  -sin(r)  -cos(r)
+    3  -cos(r)   sin(r)
+*/
+template<class V> SIMDPP_INL
+void i_sincos(const V& a, V& rs, V& rc)
+{
+    using U = typename V::uint_vector_type;
+    const unsigned sign_bit = sizeof(typename V::element_type) * 8 - 1;
+    V sign;
+    V ax = v_split_sign(a, sign);
+    U q;
+    V r = v_trig_reduce(ax, q);
+    V s = v_sin_reduced(r);
+    V c = v_cos_reduced(r);
+
+    V swap = bit_cast<V>(v_low_bit_to_mask(q));
+    rs = blend(c, s, swap);
+    rc = blend(s, c, swap);
+
+    V sign_s = bit_cast<V>(shift_l<sign_bit - 1>(bit_and(q, splat<U>(2))));
+    V sign_c = bit_cast<V>(shift_l<sign_bit - 1>(bit_and(add(q, splat<U>(1)),
+                                                         splat<U>(2))));
+    rs = bit_xor(rs, bit_xor(sign_s, sign));
+    rc = bit_xor(rc, sign_c);
+}
+
+template<class V> SIMDPP_INL
+V i_sin(const V& a)
+{
+    V s, c;
+    i_sincos(a, s, c);
+    return s;
+}
+
+template<class V> SIMDPP_INL
+V i_cos(const V& a)
+{
+    V s, c;
+    i_sincos(a, s, c);
+    return c;
+}
+
+// tan(x) is sin(r)/cos(r) for even quadrants and -cos(r)/sin(r) for odd ones
+template<class V> SIMDPP_INL
+V i_tan(const V& a)
+{
+    using U = typename V::uint_vector_type;
+    const unsigned sign_bit = sizeof(typename V::element_type) * 8 - 1;
+    V sign;
+    V ax = v_split_sign(a, sign);
+    U q;
+    V r = v_trig_reduce(ax, q);
+    V s = v_sin_reduced(r);
+    V c = v_cos_reduced(r);
+
+    V swap = bit_cast<V>(v_low_bit_to_mask(q));
+    V t = div(blend(c, s, swap), blend(s, c, swap));
+    V sign_t = bit_cast<V>(shift_l<sign_bit>(bit_and(q, splat<U>(1))));
+    return bit_xor(t, bit_xor(sign_t, sign));
+}
+
+} // namespace insn
+} // namespace detail
+} // namespace SIMDPP_ARCH_NAMESPACE
+} // namespace simdpp
+
+#endif
+
@@ -77,7 +77,7 @@ float32x8 i_trunc(const float32x8& a)
 static SIMDPP_INL
 float32<16> i_trunc(const float32<16>& a)
 {
-    return _mm512_roundscale_ps(a.native(), 0x13); // scale by 1, truncate
+    return _mm512_roundscale_ps(a.native(), 0x03); // no fraction bits, truncate
 }
 #endif
 
@@ -149,7 +149,7 @@ float64x4 i_trunc(const float64x4& a)
 static SIMDPP_INL
 float64<8> i_trunc(const float64<8>& a)
 {
-    return _mm512_roundscale_pd(a.native(), 0x13); // scale by 1, truncate
+    return _mm512_roundscale_pd(a.native(), 0x03); // no fraction bits, truncate
 }
 #endif
 
@@ -0,0 +1,156 @@
+/*  Copyright (C) 2017  Povilas Kanapickas <povilas@radix.lt>
+
+    Distributed under the Boost Software License, Version 1.0.
+        (See accompanying file LICENSE_1_0.txt or copy at
+            http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#ifndef LIBSIMDPP_SIMDPP_DETAIL_INSN_I_DETECT_CONFLICTS_H
+#define LIBSIMDPP_SIMDPP_DETAIL_INSN_I_DETECT_CONFLICTS_H
+
+#ifndef LIBSIMDPP_SIMD_H
+    #error "This file must be included through simd.h"
+#endif
+
+#include <simdpp/types.h>
+#include <simdpp/core/bit_and.h>
+#include <simdpp/core/bit_or.h>
+#include <simdpp/core/cmp_eq.h>
+#include <simdpp/core/make_uint.h>
+#include <simdpp/core/splat.h>
+#include <simdpp/detail/mem_block.h>
+
+namespace simdpp {
+namespace SIMDPP_ARCH_NAMESPACE {
+namespace detail {
+namespace insn {
+
+/*  Each element of the first vector is compared with all elements of the
+    vector. The equal elements set the corresponding bits in the result.
+    Finally, all bits that don't refer to preceding elements are cleared.
+*/
+template<class V> SIMDPP_INL
+V v_emul_detect_conflicts(const V& a)
+{
+    using E = typename V::element_type;
+
+    mem_block<V> ai(a);
+    mem_block<V> preceding;
+    V r = make_zero();
+    for (unsigned i = 0; i < V::length; ++i) {
+        V b = splat(ai[i]);
+        V bit = splat(E(1) << i);
+        r = bit_or(r, bit_and(bit, cmp_eq(a, b)));
+        preceding[i] = (E(1) << i) - 1;
+    }
+    return bit_and(r, (V) preceding);
+}
+
+// -----------------------------------------------------------------------------
+
+static SIMDPP_INL
+uint32<4> i_detect_conflicts(const uint32<4>& a)
+{
+#if SIMDPP_USE_NULL
+    uint32<4> r;
+    for (unsigned i = 0; i < 4; i++) {
+        r.el(i) = 0;
+        for (unsigned j = 0; j < i; j++) {
+            if (a.el(j) == a.el(i))
+                r.el(i) |= 1u << j;
+        }
+    }
+    return r;
+#elif SIMDPP_USE_AVX512CD && SIMDPP_USE_AVX512VL
+    return _mm_conflict_epi32(a.native());
+#else
+    return v_emul_detect_conflicts(a);
+#endif
+}
+
+#if SIMDPP_USE_AVX2
+static SIMDPP_INL
+uint32<8> i_detect_conflicts(const uint32<8>& a)
+{
+#if SIMDPP_USE_AVX512CD && SIMDPP_USE_AVX512VL
+    return _mm256_conflict_epi32(a.native());
+#else
+    return v_emul_detect_conflicts(a);
+#endif
+}
+#endif
+
+#if SIMDPP_USE_AVX512F
+static SIMDPP_INL
+uint32<16> i_detect_conflicts(const uint32<16>& a)
+{
+#if SIMDPP_USE_AVX512CD
+    return _mm512_conflict_epi32(a.native());
+#else
+    return v_emul_detect_conflicts(a);
+#endif
+}
+#endif
+
+// The conflicts are detected across the whole vector, thus vector arrays
+// can't be processed one native vector at a time
+template<unsigned N> SIMDPP_INL
+uint32<N> i_detect_conflicts(const uint32<N>& a)
+{
+    return v_emul_detect_conflicts(a);
+}
+
+// -----------------------------------------------------------------------------
+
+static SIMDPP_INL
+uint64<2> i_detect_conflicts(const uint64<2>& a)
+{
+#if SIMDPP_USE_NULL
+    uint64<2> r;
+    r.el(0) = 0;
+    r.el(1) = a.el(0) == a.el(1) ? 1 : 0;
+    return r;
+#elif SIMDPP_USE_AVX512CD && SIMDPP_USE_AVX512VL
+    return _mm_conflict_epi64(a.native());
+#else
+    return v_emul_detect_conflicts(a);
+#endif
+}
+
+#if SIMDPP_USE_AVX2
+static SIMDPP_INL
+uint64<4> i_detect_conflicts(const uint64<4>& a)
+{
+#if SIMDPP_USE_AVX512CD && SIMDPP_USE_AVX512VL
+    return _mm256_conflict_epi64(a.native());
+#else
+    return v_emul_detect_conflicts(a);
+#endif
+}
+#endif
+
+#if SIMDPP_USE_AVX512F
+static SIMDPP_INL
+uint64<8> i_detect_conflicts(const uint64<8>& a)
+{
+#if SIMDPP_USE_AVX512CD
+    return _mm512_conflict_epi64(a.native());
+#else
+    return v_emul_detect_conflicts(a);
+#endif
+}
+#endif
+
+template<unsigned N> SIMDPP_INL
+uint64<N> i_detect_conflicts(const uint64<N>& a)
+{
+    return v_emul_detect_conflicts(a);
+}
+
+} // namespace insn
+} // namespace detail
+} // namespace SIMDPP_ARCH_NAMESPACE
+} // namespace simdpp
+
+#endif
+
@@ -0,0 +1,100 @@
+/*  Copyright (C) 2017  Povilas Kanapickas <povilas@radix.lt>
+
+    Distributed under the Boost Software License, Version 1.0.
+        (See accompanying file LICENSE_1_0.txt or copy at
+            http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#ifndef LIBSIMDPP_SIMDPP_DETAIL_INSN_I_DIV_H
+#define LIBSIMDPP_SIMDPP_DETAIL_INSN_I_DIV_H
+
+#ifndef LIBSIMDPP_SIMD_H
+    #error "This file must be included through simd.h"
+#endif
+
+#include <simdpp/types.h>
+#include <simdpp/core/bit_and.h>
+#include <simdpp/core/divider.h>
+#include <simdpp/core/i_add.h>
+#include <simdpp/core/i_shift_r.h>
+#include <simdpp/core/i_sub.h>
+#include <simdpp/core/make_uint.h>
+#include <simdpp/core/set_splat.h>
+#include <simdpp/detail/insn/i_mul_hi.h>
+#include <simdpp/detail/insn/i_mul_lo.h>
+#include <simdpp/detail/traits.h>
+
+namespace simdpp {
+namespace SIMDPP_ARCH_NAMESPACE {
+namespace detail {
+namespace insn {
+
+/*  If the magic number does not fit into the element, the quotient is
+    computed as
+
+      q = mul_hi(a, magic)
+      r = (((a - q) >> 1) + q) >> shift
+
+    which avoids overflowing the element.
+*/
+template<class V> SIMDPP_INL
+V i_div_unsigned(const V& a, const divider<typename V::element_type>& d)
+{
+    if (d.magic() == 0) {
+        return shift_r(a, d.shift());
+    }
+    V q = i_mul_hi(a, splat<V>(d.magic()));
+    if (d.is_add()) {
+        q = add(shift_r<1>(sub(a, q)), q);
+    }
+    return shift_r(q, d.shift());
+}
+
+/*  The quotient is rounded towards zero. In the power of two case, 2^shift-1
+    is added to negative numerators before shifting. Otherwise the high
+    product is shifted and incremented if negative.
+*/
+template<class V> SIMDPP_INL
+V i_div_signed(const V& a, const divider<typename V::element_type>& d)
+{
+    using T = typename V::element_type;
+    using U = typename divider<T>::uint_element_type;
+    const unsigned sign_bit = sizeof(T) * 8 - 1;
+
+    V q;
+    if (d.magic() == 0) {
+        V mask = splat<V>(T((U(1) << d.shift()) - 1));
+        q = add(a, bit_and(shift_r<sign_bit>(a), mask));
+        q = shift_r(q, d.shift());
+        if (d.is_negative()) {
+            q = sub((V) make_zero(), q);
+        }
+        return q;
+    }
+
+    q = i_mul_hi(a, splat<V>(T(d.magic())));
+    if (d.is_add()) {
+        if (d.is_negative()) {
+            q = sub(q, a);
+        } else {
+            q = add(q, a);
+        }
+    }
+    q = shift_r(q, d.shift());
+    return sub(q, shift_r<sign_bit>(q));
+}
+
+template<class V> SIMDPP_INL
+V i_mod(const V& a, const V& q, typename V::element_type divisor)
+{
+    using U = typename detail::remove_sign<V>::type;
+    U p = i_mul_lo(U(q), splat<U>(divisor));
+    return V(sub(U(a), p));
+}
+
+} // namespace insn
+} // namespace detail
+} // namespace SIMDPP_ARCH_NAMESPACE
+} // namespace simdpp
+
+#endif
@@ -0,0 +1,244 @@
+/*  Copyright (C) 2017  Povilas Kanapickas <povilas@radix.lt>
+
+    Distributed under the Boost Software License, Version 1.0.
+        (See accompanying file LICENSE_1_0.txt or copy at
+            http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#ifndef LIBSIMDPP_SIMDPP_DETAIL_INSN_I_DOT_ACCUMULATE_H
+#define LIBSIMDPP_SIMDPP_DETAIL_INSN_I_DOT_ACCUMULATE_H
+
+#ifndef LIBSIMDPP_SIMD_H
+    #error "This file must be included through simd.h"
+#endif
+
+#include <simdpp/types.h>
+#include <simdpp/core/bit_and.h>
+#include <simdpp/core/bit_andnot.h>
+#include <simdpp/core/combine.h>
+#include <simdpp/core/i_add.h>
+#include <simdpp/core/i_shift_l.h>
+#include <simdpp/core/i_shift_r.h>
+#include <simdpp/core/make_int.h>
+#include <simdpp/core/make_uint.h>
+#include <simdpp/core/split.h>
+#include <simdpp/core/detail/subvec_extract.h>
+
+namespace simdpp {
+namespace SIMDPP_ARCH_NAMESPACE {
+namespace detail {
+namespace insn {
+
+/*  Note: the results of the dot products are exact, except for the int16
+    variant where the sum of two products may wrap around if all four inputs
+    are equal to -32768. This matches the behavior of the VNNI and PMADDWD
+    instructions.
+
+    PMADDUBSW saturates the sum of two products to 16 bits, thus it's not used
+    directly on the whole vectors. Instead, the even and odd bytes of the
+    unsigned argument are multiplied separately, so that one of the products
+    within each pair is always zero.
+*/
+
+static SIMDPP_INL
+int32<4> i_dot_accumulate(const int16<8>& a, const int16<8>& b, const int32<4>& c)
+{
+#if SIMDPP_USE_NULL
+    int32<4> r;
+    for (unsigned i = 0; i < 4; i++) {
+        uint32_t p0 = int32_t(a.el(i*2)) * b.el(i*2);
+        uint32_t p1 = int32_t(a.el(i*2+1)) * b.el(i*2+1);
+        r.el(i) = int32_t(uint32_t(c.el(i)) + p0 + p1);
+    }
+    return r;
+#elif SIMDPP_USE_AVX512VNNI && SIMDPP_USE_AVX512VL
+    return _mm_dpwssd_epi32(c.native(), a.native(), b.native());
+#elif SIMDPP_USE_SSE2
+    return add(c, (int32<4>) _mm_madd_epi16(a.native(), b.native()));
+#elif SIMDPP_USE_NEON
+    int32x4_t lo = vmull_s16(vget_low_s16(a.native()), vget_low_s16(b.native()));
+    int32x4_t hi = vmull_s16(vget_high_s16(a.native()), vget_high_s16(b.native()));
+    int32x2_t rlo = vpadd_s32(vget_low_s32(lo), vget_high_s32(lo));
+    int32x2_t rhi = vpadd_s32(vget_low_s32(hi), vget_high_s32(hi));
+    return vaddq_s32(c.native(), vcombine_s32(rlo, rhi));
+#elif SIMDPP_USE_ALTIVEC
+    return vec_msum(a.native(), b.native(), c.native());
+#elif SIMDPP_USE_MSA
+    return __msa_dpadd_s_w(c.native(), a.native(), b.native());
+#endif
+}
+
+#if SIMDPP_USE_AVX2
+static SIMDPP_INL
+int32<8> i_dot_accumulate(const int16<16>& a, const int16<16>& b, const int32<8>& c)
+{
+#if SIMDPP_USE_AVX512VNNI && SIMDPP_USE_AVX512VL
+    return _mm256_dpwssd_epi32(c.native(), a.native(), b.native());
+#else
+    return add(c, (int32<8>) _mm256_madd_epi16(a.native(), b.native()));
+#endif
+}
+#endif
+
+#if SIMDPP_USE_AVX512F
+static SIMDPP_INL
+int32<16> i_dot_accumulate(const int16<32>& a, const int16<32>& b, const int32<16>& c)
+{
+#if SIMDPP_USE_AVX512VNNI && SIMDPP_USE_AVX512BW
+    return _mm512_dpwssd_epi32(c.native(), a.native(), b.native());
+#elif SIMDPP_USE_AVX512BW
+    return add(c, (int32<16>) _mm512_madd_epi16(a.native(), b.native()));
+#else
+    int32<8> c0, c1;
+    split(c, c0, c1);
+    c0 = i_dot_accumulate(a.vec(0), b.vec(0), c0);
+    c1 = i_dot_accumulate(a.vec(1), b.vec(1), c1);
+    return combine(c0, c1);
+#endif
+}
+#endif
+
+template<unsigned N> SIMDPP_INL
+int32<N> i_dot_accumulate(const int16<N*2>& a, const int16<N*2>& b,
+                          const int32<N>& c)
+{
+    const unsigned M = int32<N>::base_length * 2;
+    int32<N> r;
+    for (unsigned i = 0; i < r.vec_length; ++i) {
+        r.vec(i) = i_dot_accumulate(detail::subvec_extract<M>(a, i),
+                                    detail::subvec_extract<M>(b, i),
+                                    c.vec(i));
+    }
+    return r;
+}
+
+// -----------------------------------------------------------------------------
+
+template<class U8, class I8, class R> SIMDPP_INL
+R v_emul_dot_accumulate_u8_s8(const U8& a, const I8& b, const R& c)
+{
+    using w_u16 = typename same_width<U8>::u16;
+    using w_i16 = typename same_width<U8>::i16;
+
+    w_u16 a16 = (w_u16) a;
+    w_i16 b16 = (w_i16) b;
+    w_u16 mask = make_uint(0x00ff);
+
+    w_u16 a_even = bit_and(a16, mask);
+    w_u16 a_odd = shift_r<8>(a16);
+    w_i16 b_even = shift_r<8>(shift_l<8>(b16));
+    w_i16 b_odd = shift_r<8>(b16);
+
+    R r = i_dot_accumulate((w_i16) a_even, b_even, c);
+    return i_dot_accumulate((w_i16) a_odd, b_odd, r);
+}
+
+static SIMDPP_INL
+int32<4> i_dot_accumulate(const uint8<16>& a, const int8<16>& b, const int32<4>& c)
+{
+#if SIMDPP_USE_NULL
+    int32<4> r;
+    for (unsigned i = 0; i < 4; i++) {
+        uint32_t sum = c.el(i);
+        for (unsigned j = 0; j < 4; j++) {
+            sum += int32_t(a.el(i*4+j)) * b.el(i*4+j);
+        }
+        r.el(i) = int32_t(sum);
+    }
+    return r;
+#elif SIMDPP_USE_AVX512VNNI && SIMDPP_USE_AVX512VL
+    return _mm_dpbusd_epi32(c.native(), a.native(), b.native());
+#elif SIMDPP_USE_SSSE3
+    uint8<16> mask = make_uint(0xff, 0);
+    uint8<16> a_even = bit_and(a, mask);
+    uint8<16> a_odd = bit_andnot(a, mask);
+    int16<8> p_even = _mm_maddubs_epi16(a_even.native(), b.native());
+    int16<8> p_odd = _mm_maddubs_epi16(a_odd.native(), b.native());
+    int16<8> ones = make_int(1);
+    int32<4> r = i_dot_accumulate(p_even, ones, c);
+    return i_dot_accumulate(p_odd, ones, r);
+#elif SIMDPP_USE_NEON && defined(__ARM_FEATURE_MATMUL_INT8)
+    return vusdotq_s32(c.native(), a.native(), b.native());
+#elif SIMDPP_USE_NEON
+    // the products of 8-bit values fit into 16 bits
+    int16x8_t alo = vreinterpretq_s16_u16(vmovl_u8(vget_low_u8(a.native())));
+    int16x8_t ahi = vreinterpretq_s16_u16(vmovl_u8(vget_high_u8(a.native())));
+    int16x8_t blo = vmovl_s8(vget_low_s8(b.native()));
+    int16x8_t bhi = vmovl_s8(vget_high_s8(b.native()));
+    int32x4_t plo = vpaddlq_s16(vmulq_s16(alo, blo));
+    int32x4_t phi = vpaddlq_s16(vmulq_s16(ahi, bhi));
+    int32x2_t rlo = vpadd_s32(vget_low_s32(plo), vget_high_s32(plo));
+    int32x2_t rhi = vpadd_s32(vget_low_s32(phi), vget_high_s32(phi));
+    return vaddq_s32(c.native(), vcombine_s32(rlo, rhi));
+#elif SIMDPP_USE_ALTIVEC
+    return vec_msum(b.native(), a.native(), c.native());
+#elif SIMDPP_USE_SSE2 || SIMDPP_USE_MSA
+    return v_emul_dot_accumulate_u8_s8(a, b, c);
+#endif
+}
+
+#if SIMDPP_USE_AVX2
+static SIMDPP_INL
+int32<8> i_dot_accumulate(const uint8<32>& a, const int8<32>& b, const int32<8>& c)
+{
+#if SIMDPP_USE_AVX512VNNI && SIMDPP_USE_AVX512VL
+    return _mm256_dpbusd_epi32(c.native(), a.native(), b.native());
+#else
+    uint8<32> mask = make_uint(0xff, 0);
+    uint8<32> a_even = bit_and(a, mask);
+    uint8<32> a_odd = bit_andnot(a, mask);
+    int16<16> p_even = _mm256_maddubs_epi16(a_even.native(), b.native());
+    int16<16> p_odd = _mm256_maddubs_epi16(a_odd.native(), b.native());
+    int16<16> ones = make_int(1);
+    int32<8> r = i_dot_accumulate(p_even, ones, c);
+    return i_dot_accumulate(p_odd, ones, r);
+#endif
+}
+#endif
+
+#if SIMDPP_USE_AVX512F
+static SIMDPP_INL
+int32<16> i_dot_accumulate(const uint8<64>& a, const int8<64>& b, const int32<16>& c)
+{
+#if SIMDPP_USE_AVX512VNNI && SIMDPP_USE_AVX512BW
+    return _mm512_dpbusd_epi32(c.native(), a.native(), b.native());
+#elif SIMDPP_USE_AVX512BW
+    uint8<64> mask = make_uint(0xff, 0);
+    uint8<64> a_even = bit_and(a, mask);
+    uint8<64> a_odd = bit_andnot(a, mask);
+    int16<32> p_even = _mm512_maddubs_epi16(a_even.native(), b.native());
+    int16<32> p_odd = _mm512_maddubs_epi16(a_odd.native(), b.native());
+    int16<32> ones = make_int(1);
+    int32<16> r = i_dot_accumulate(p_even, ones, c);
+    return i_dot_accumulate(p_odd, ones, r);
+#else
+    int32<8> c0, c1;
+    split(c, c0, c1);
+    c0 = i_dot_accumulate(a.vec(0), b.vec(0), c0);
+    c1 = i_dot_accumulate(a.vec(1), b.vec(1), c1);
+    return combine(c0, c1);
+#endif
+}
+#endif
+
+template<unsigned N> SIMDPP_INL
+int32<N> i_dot_accumulate(const uint8<N*4>& a, const int8<N*4>& b,
+                          const int32<N>& c)
+{
+    const unsigned M = int32<N>::base_length * 4;
+    int32<N> r;
+    for (unsigned i = 0; i < r.vec_length; ++i) {
+        r.vec(i) = i_dot_accumulate(detail::subvec_extract<M>(a, i),
+                                    detail::subvec_extract<M>(b, i),
+                                    c.vec(i));
+    }
+    return r;
+}
+
+} // namespace insn
+} // namespace detail
+} // namespace SIMDPP_ARCH_NAMESPACE
+} // namespace simdpp
+
+#endif
+
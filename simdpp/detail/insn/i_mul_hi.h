@@ -14,8 +14,11 @@
 
 #include <simdpp/types.h>
 #include <simdpp/core/i_mull.h>
+#include <simdpp/core/unzip_lo.h>
 #include <simdpp/core/unzip_hi.h>
+#include <simdpp/detail/insn/i_mul_lo.h>
 #include <simdpp/detail/null/math.h>
+#include <simdpp/detail/traits.h>
 #include <simdpp/detail/vector_array_macros.h>
 
 namespace simdpp {
@@ -23,6 +26,11 @@ namespace SIMDPP_ARCH_NAMESPACE {
 namespace detail {
 namespace insn {
 
+// High multiplication is implemented for all signed and unsigned element
+// types, as div() with a divider uses it for every element type.
+template<class V> SIMDPP_INL
+V i_mul_hi(const V& a, const V& b);
+
 static SIMDPP_INL
 int16<8> i_mul_hi(const int16<8>& a, const int16<8>& b)
 {
@@ -113,6 +121,211 @@ uint16<32> i_mul_hi(const uint16<32>& a, const uint16<32>& b)
 
 // -----------------------------------------------------------------------------
 
+// The even and odd bytes are multiplied separately using 16-bit multiplies
+template<unsigned N> SIMDPP_INL
+uint8<N> i_mul_hi(const uint8<N>& a, const uint8<N>& b)
+{
+    using U = uint16<N/2>;
+    U a16 = U(a), b16 = U(b);
+    U mask = splat<U>(0x00ff);
+    U ev = i_mul_lo(U(bit_and(a16, mask)), U(bit_and(b16, mask)));
+    U od = i_mul_lo(U(shift_r<8>(a16)), U(shift_r<8>(b16)));
+    ev = shift_r<8>(ev);
+    od = bit_andnot(od, mask);
+    return uint8<N>(bit_or(ev, od));
+}
+
+template<unsigned N> SIMDPP_INL
+int8<N> i_mul_hi(const int8<N>& a, const int8<N>& b)
+{
+    using S = int16<N/2>;
+    using U = uint16<N/2>;
+    S a16 = S(a), b16 = S(b);
+    // sign-extend the even and odd bytes to 16 bits
+    U ae = U(shift_r<8>(shift_l<8>(a16)));
+    U be = U(shift_r<8>(shift_l<8>(b16)));
+    U ao = U(shift_r<8>(a16));
+    U bo = U(shift_r<8>(b16));
+    U ev = shift_r<8>(i_mul_lo(ae, be));
+    U od = bit_andnot(i_mul_lo(ao, bo), splat<U>(0x00ff));
+    return int8<N>(bit_or(ev, od));
+}
+
+// -----------------------------------------------------------------------------
+
+/*  Emulates 32-bit high multiplication using 32x32->64 multiplication of the
+    even and odd elements.
+*/
+template<unsigned N> SIMDPP_INL
+uint32<N> v_emul_mul_hi_u32(const uint32<N>& a, const uint32<N>& b)
+{
+    using U64 = uint64<N/2>;
+    U64 a64 = U64(a), b64 = U64(b);
+    U64 ev = shift_r<32>(v_mul_u32_to_u64(a64, b64));
+    U64 od = v_mul_u32_to_u64(U64(shift_r<32>(a64)), U64(shift_r<32>(b64)));
+    od = bit_and(od, splat<U64>(0xffffffff00000000));
+    return uint32<N>(bit_or(ev, od));
+}
+
+static SIMDPP_INL
+uint32<4> i_mul_hi(const uint32<4>& a, const uint32<4>& b)
+{
+#if SIMDPP_USE_NULL
+    uint32<4> r;
+    for (unsigned i = 0; i < a.length; i++) {
+        r.el(i) = (uint64_t(a.el(i)) * b.el(i)) >> 32;
+    }
+    return r;
+#elif SIMDPP_USE_SSE4_1
+    __m128i ev = _mm_srli_epi64(_mm_mul_epu32(a.native(), b.native()), 32);
+    __m128i od = _mm_mul_epu32(_mm_srli_epi64(a.native(), 32),
+                               _mm_srli_epi64(b.native(), 32));
+    return _mm_blend_epi16(ev, od, 0xcc);
+#elif SIMDPP_USE_SSE2
+    return v_emul_mul_hi_u32(a, b);
+#elif SIMDPP_USE_NEON
+    uint64x2 lo = vmull_u32(vget_low_u32(a.native()), vget_low_u32(b.native()));
+    uint64x2 hi = vmull_u32(vget_high_u32(a.native()), vget_high_u32(b.native()));
+    return unzip4_hi(uint32x4(lo), uint32x4(hi));
+#elif SIMDPP_USE_ALTIVEC && SIMDPP_BIG_ENDIAN
+    uint64<4> ab;
+    ab = mull(a, b);
+    return unzip4_lo(uint32<4>(ab.vec(0)), uint32<4>(ab.vec(1)));
+#elif (SIMDPP_USE_ALTIVEC && SIMDPP_LITTLE_ENDIAN) || SIMDPP_USE_MSA
+    uint64<4> ab;
+    ab = mull(a, b);
+    return unzip4_hi(uint32<4>(ab.vec(0)), uint32<4>(ab.vec(1)));
+#endif
+}
+
+#if SIMDPP_USE_AVX2
+static SIMDPP_INL
+uint32<8> i_mul_hi(const uint32<8>& a, const uint32<8>& b)
+{
+    __m256i ev = _mm256_srli_epi64(_mm256_mul_epu32(a.native(), b.native()), 32);
+    __m256i od = _mm256_mul_epu32(_mm256_srli_epi64(a.native(), 32),
+                                  _mm256_srli_epi64(b.native(), 32));
+    return _mm256_blend_epi32(ev, od, 0xaa);
+}
+#endif
+
+#if SIMDPP_USE_AVX512F
+static SIMDPP_INL
+uint32<16> i_mul_hi(const uint32<16>& a, const uint32<16>& b)
+{
+    __m512i ev = _mm512_srli_epi64(_mm512_mul_epu32(a.native(), b.native()), 32);
+    __m512i od = _mm512_mul_epu32(_mm512_srli_epi64(a.native(), 32),
+                                  _mm512_srli_epi64(b.native(), 32));
+    return _mm512_mask_mov_epi32(ev, 0xaaaa, od);
+}
+#endif
+
+// -----------------------------------------------------------------------------
+
+/*  The full 128-bit product of 64-bit elements is computed from 32x32->64
+    partial products:
+
+      t  = al*bl
+      u  = ah*bl + (t >> 32)
+      v  = al*bh + (u & 0xffffffff)
+      hi = ah*bh + (u >> 32) + (v >> 32)
+      lo = (v << 32) | (t & 0xffffffff)
+*/
+template<unsigned N> SIMDPP_INL
+void v_mul_wide_u64(const uint64<N>& a, const uint64<N>& b,
+                    uint64<N>& lo, uint64<N>& hi)
+{
+    using U = uint64<N>;
+    U mask = splat<U>(0xffffffff);
+    U ah = shift_r<32>(a);
+    U bh = shift_r<32>(b);
+    U t = v_mul_u32_to_u64(a, b);
+    U u = add(v_mul_u32_to_u64(ah, b), U(shift_r<32>(t)));
+    U v = add(v_mul_u32_to_u64(a, bh), U(bit_and(u, mask)));
+    U r = add(v_mul_u32_to_u64(ah, bh), U(shift_r<32>(u)));
+    hi = add(r, U(shift_r<32>(v)));
+    lo = bit_or(U(shift_l<32>(v)), U(bit_and(t, mask)));
+}
+
+template<unsigned N> SIMDPP_INL
+uint64<N> i_mul_hi(const uint64<N>& a, const uint64<N>& b)
+{
+    uint64<N> lo, hi;
+    v_mul_wide_u64(a, b, lo, hi);
+    return hi;
+}
+
+// -----------------------------------------------------------------------------
+
+/*  Signed high product is computed from the unsigned one:
+
+      hi_s(a, b) = hi_u(a, b) - (a < 0 ? b : 0) - (b < 0 ? a : 0)
+*/
+template<class V> SIMDPP_INL
+V v_emul_mul_hi_signed(const V& a, const V& b)
+{
+    using U = typename detail::remove_sign<V>::type;
+    const unsigned sign_bit = sizeof(typename V::element_type) * 8 - 1;
+    U ua = a, ub = b;
+    U r = i_mul_hi(ua, ub);
+    U ca = bit_and(U(shift_r<sign_bit>(a)), ub);
+    U cb = bit_and(U(shift_r<sign_bit>(b)), ua);
+    return V(sub(sub(r, ca), cb));
+}
+
+static SIMDPP_INL
+int32<4> i_mul_hi(const int32<4>& a, const int32<4>& b)
+{
+#if SIMDPP_USE_NULL
+    int32<4> r;
+    for (unsigned i = 0; i < a.length; i++) {
+        r.el(i) = (int64_t(a.el(i)) * b.el(i)) >> 32;
+    }
+    return r;
+#elif SIMDPP_USE_SSE4_1
+    __m128i ev = _mm_srli_epi64(_mm_mul_epi32(a.native(), b.native()), 32);
+    __m128i od = _mm_mul_epi32(_mm_srli_epi64(a.native(), 32),
+                               _mm_srli_epi64(b.native(), 32));
+    return _mm_blend_epi16(ev, od, 0xcc);
+#elif SIMDPP_USE_NEON
+    int64x2 lo = vmull_s32(vget_low_s32(a.native()), vget_low_s32(b.native()));
+    int64x2 hi = vmull_s32(vget_high_s32(a.native()), vget_high_s32(b.native()));
+    return unzip4_hi(int32x4(lo), int32x4(hi));
+#else
+    return v_emul_mul_hi_signed(a, b);
+#endif
+}
+
+#if SIMDPP_USE_AVX2
+static SIMDPP_INL
+int32<8> i_mul_hi(const int32<8>& a, const int32<8>& b)
+{
+    __m256i ev = _mm256_srli_epi64(_mm256_mul_epi32(a.native(), b.native()), 32);
+    __m256i od = _mm256_mul_epi32(_mm256_srli_epi64(a.native(), 32),
+                                  _mm256_srli_epi64(b.native(), 32));
+    return _mm256_blend_epi32(ev, od, 0xaa);
+}
+#endif
+
+#if SIMDPP_USE_AVX512F
+static SIMDPP_INL
+int32<16> i_mul_hi(const int32<16>& a, const int32<16>& b)
+{
+    __m512i ev = _mm512_srli_epi64(_mm512_mul_epi32(a.native(), b.native()), 32);
+    __m512i od = _mm512_mul_epi32(_mm512_srli_epi64(a.native(), 32),
+                                  _mm512_srli_epi64(b.native(), 32));
+    return _mm512_mask_mov_epi32(ev, 0xaaaa, od);
+}
+#endif
+
+template<unsigned N> SIMDPP_INL
+int64<N> i_mul_hi(const int64<N>& a, const int64<N>& b)
+{
+    return v_emul_mul_hi_signed(a, b);
+}
+
+// -----------------------------------------------------------------------------
+
 template<class V> SIMDPP_INL
 V i_mul_hi(const V& a, const V& b)
 {
@@ -17,6 +17,7 @@
 #include <simdpp/core/move_l.h>
 #include <simdpp/core/permute4.h>
 #include <simdpp/core/shuffle2.h>
+#include <simdpp/detail/mem_block.h>
 #include <simdpp/detail/null/math.h>
 #include <simdpp/detail/vector_array_macros.h>
 
@@ -25,6 +26,9 @@ namespace SIMDPP_ARCH_NAMESPACE {
 namespace detail {
 namespace insn {
 
+template<class V> SIMDPP_INL
+V i_mul_lo(const V& a, const V& b);
+
 static SIMDPP_INL
 uint16<8> i_mul_lo(const uint16<8>& a, const uint16<8>& b)
 {
@@ -140,6 +144,125 @@ uint32<16> i_mul_lo(const uint32<16>& a, const uint32<16>& b)
 
 // -----------------------------------------------------------------------------
 
+// The even and odd bytes are multiplied separately using 16-bit multiplies
+template<unsigned N> SIMDPP_INL
+uint8<N> i_mul_lo(const uint8<N>& a, const uint8<N>& b)
+{
+    using U = uint16<N/2>;
+    U a16 = U(a), b16 = U(b);
+    U mask = splat<U>(0x00ff);
+    U ev = bit_and(i_mul_lo(a16, b16), mask);
+    U od = shift_l<8>(i_mul_lo(U(shift_r<8>(a16)), U(shift_r<8>(b16))));
+    return uint8<N>(bit_or(ev, od));
+}
+
+// -----------------------------------------------------------------------------
+
+// Multiplies the low 32 bits of each 64-bit element and returns the full
+// 64-bit products
+static SIMDPP_INL
+uint64<2> v_mul_u32_to_u64(const uint64<2>& a, const uint64<2>& b)
+{
+#if SIMDPP_USE_NULL || (SIMDPP_USE_ALTIVEC && !SIMDPP_USE_VSX_207)
+    uint64<2> r;
+    for (unsigned i = 0; i < r.length; i++) {
+        r.el(i) = (a.el(i) & 0xffffffff) * (b.el(i) & 0xffffffff);
+    }
+    return r;
+#elif SIMDPP_USE_SSE2
+    return _mm_mul_epu32(a.native(), b.native());
+#elif SIMDPP_USE_NEON
+    return vmull_u32(vmovn_u64(a.native()), vmovn_u64(b.native()));
+#elif SIMDPP_USE_VSX_207
+    mem_block<uint64<2>> ba = a;
+    mem_block<uint64<2>> bb = b;
+    ba[0] = (ba[0] & 0xffffffff) * (bb[0] & 0xffffffff);
+    ba[1] = (ba[1] & 0xffffffff) * (bb[1] & 0xffffffff);
+    return ba;
+#elif SIMDPP_USE_MSA
+    uint64<2> mask = splat<uint64<2>>(0xffffffff);
+    uint64<2> al = bit_and(a, mask);
+    uint64<2> bl = bit_and(b, mask);
+    return (v2u64) __msa_mulv_d((v2i64) al.native(), (v2i64) bl.native());
+#endif
+}
+
+#if SIMDPP_USE_AVX2
+static SIMDPP_INL
+uint64<4> v_mul_u32_to_u64(const uint64<4>& a, const uint64<4>& b)
+{
+    return _mm256_mul_epu32(a.native(), b.native());
+}
+#endif
+
+#if SIMDPP_USE_AVX512F
+static SIMDPP_INL
+uint64<8> v_mul_u32_to_u64(const uint64<8>& a, const uint64<8>& b)
+{
+    return _mm512_mul_epu32(a.native(), b.native());
+}
+#endif
+
+template<unsigned N> SIMDPP_INL
+uint64<N> v_mul_u32_to_u64(const uint64<N>& a, const uint64<N>& b)
+{
+    SIMDPP_VEC_ARRAY_IMPL2(uint64<N>, v_mul_u32_to_u64, a, b)
+}
+
+/*  Computes the low half of 64-bit products from 32-bit pieces:
+
+      a * b = al*bl + ((ah*bl + al*bh) << 32)   (mod 2^64)
+*/
+template<unsigned N> SIMDPP_INL
+uint64<N> v_emul_mul_lo_u64(const uint64<N>& a, const uint64<N>& b)
+{
+    uint64<N> ah = shift_r<32>(a);
+    uint64<N> bh = shift_r<32>(b);
+    uint64<N> lo = v_mul_u32_to_u64(a, b);
+    uint64<N> mid = add(v_mul_u32_to_u64(ah, b), v_mul_u32_to_u64(a, bh));
+    return add(lo, shift_l<32>(mid));
+}
+
+static SIMDPP_INL
+uint64<2> i_mul_lo(const uint64<2>& a, const uint64<2>& b)
+{
+#if SIMDPP_USE_NULL || (SIMDPP_USE_ALTIVEC && !SIMDPP_USE_VSX_207)
+    return detail::null::mul(a, b);
+#elif SIMDPP_USE_AVX512DQ && SIMDPP_USE_AVX512VL
+    return _mm_mullo_epi64(a.native(), b.native());
+#elif SIMDPP_USE_MSA
+    return (v2u64) __msa_mulv_d((v2i64) a.native(), (v2i64) b.native());
+#else
+    return v_emul_mul_lo_u64(a, b);
+#endif
+}
+
+#if SIMDPP_USE_AVX2
+static SIMDPP_INL
+uint64<4> i_mul_lo(const uint64<4>& a, const uint64<4>& b)
+{
+#if SIMDPP_USE_AVX512DQ && SIMDPP_USE_AVX512VL
+    return _mm256_mullo_epi64(a.native(), b.native());
+#else
+    return v_emul_mul_lo_u64(a, b);
+#endif
+}
+#endif
+
+#if SIMDPP_USE_AVX512F
+static SIMDPP_INL
+uint64<8> i_mul_lo(const uint64<8>& a, const uint64<8>& b)
+{
+#if SIMDPP_USE_AVX512DQ
+    return _mm512_mullo_epi64(a.native(), b.native());
+#else
+    return v_emul_mul_lo_u64(a, b);
+#endif
+}
+#endif
+
+// -----------------------------------------------------------------------------
+
 template<class V> SIMDPP_INL
 V i_mul_lo(const V& a, const V& b)
 {
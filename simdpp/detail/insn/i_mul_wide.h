@@ -0,0 +1,54 @@
+/*  Copyright (C) 2017  Povilas Kanapickas <povilas@radix.lt>
+
+    Distributed under the Boost Software License, Version 1.0.
+        (See accompanying file LICENSE_1_0.txt or copy at
+            http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#ifndef LIBSIMDPP_SIMDPP_DETAIL_INSN_I_MUL_WIDE_H
+#define LIBSIMDPP_SIMDPP_DETAIL_INSN_I_MUL_WIDE_H
+
+#ifndef LIBSIMDPP_SIMD_H
+    #error "This file must be included through simd.h"
+#endif
+
+#include <simdpp/types.h>
+#include <simdpp/core/bit_and.h>
+#include <simdpp/core/i_shift_r.h>
+#include <simdpp/core/i_sub.h>
+#include <simdpp/detail/insn/i_mul_hi.h>
+
+namespace simdpp {
+namespace SIMDPP_ARCH_NAMESPACE {
+namespace detail {
+namespace insn {
+
+template<unsigned N> SIMDPP_INL
+void i_mul_wide(const uint64<N>& a, const uint64<N>& b,
+                uint64<N>& lo, uint64<N>& hi)
+{
+    v_mul_wide_u64(a, b, lo, hi);
+}
+
+// The low half is the same as for unsigned multiplication. The high half is
+// corrected in the same way as in v_emul_mul_hi_signed
+template<unsigned N> SIMDPP_INL
+void i_mul_wide(const int64<N>& a, const int64<N>& b,
+                int64<N>& lo, int64<N>& hi)
+{
+    using U = uint64<N>;
+    U ua = a, ub = b;
+    U rlo, rhi;
+    v_mul_wide_u64(ua, ub, rlo, rhi);
+    U ca = bit_and(U(shift_r<63>(a)), ub);
+    U cb = bit_and(U(shift_r<63>(b)), ua);
+    lo = rlo;
+    hi = sub(sub(rhi, ca), cb);
+}
+
+} // namespace insn
+} // namespace detail
+} // namespace SIMDPP_ARCH_NAMESPACE
+} // namespace simdpp
+
+#endif
@@ -14,6 +14,7 @@
 
 #include <simdpp/types.h>
 #include <simdpp/detail/null/bitwise.h>
+#include <simdpp/core/i_add.h>
 #include <simdpp/core/i_popcnt.h>
 #include <simdpp/core/i_reduce_add.h>
 
@@ -31,6 +32,9 @@ uint32_t i_reduce_popcnt(const uint32<4>& a)
         r += detail::null::el_popcnt32(a.el(i));
     }
     return r;
+#elif SIMDPP_USE_AVX512VPOPCNTDQ && SIMDPP_USE_AVX512VL
+    uint64<2> r = _mm_popcnt_epi64(a.native());
+    return (uint32_t) reduce_add(r);
 #elif SIMDPP_USE_X86_POPCNT_INSN
     uint32_t r = 0;
 #if SIMDPP_64_BITS
@@ -64,7 +68,10 @@ uint32_t i_reduce_popcnt(const uint32<4>& a)
 static SIMDPP_INL
 uint32_t i_reduce_popcnt(const uint32<8>& a)
 {
-#if SIMDPP_USE_X86_POPCNT_INSN && SIMDPP_64_BITS
+#if SIMDPP_USE_AVX512VPOPCNTDQ && SIMDPP_USE_AVX512VL
+    uint64<4> r = _mm256_popcnt_epi64(a.native());
+    return (uint32_t) reduce_add(r);
+#elif SIMDPP_USE_X86_POPCNT_INSN && SIMDPP_64_BITS
     uint32<4> a0, a1;
     split(a, a0, a1);
     return i_reduce_popcnt(a0) + i_reduce_popcnt(a1);
@@ -79,12 +86,14 @@ uint32_t i_reduce_popcnt(const uint32<8>& a)
 static SIMDPP_INL
 uint32_t i_reduce_popcnt(const uint32<16>& a)
 {
-#if SIMDPP_USE_X86_POPCNT_INSN && SIMDPP_64_BITS
+#if SIMDPP_USE_AVX512VPOPCNTDQ
+    uint64<8> r = _mm512_popcnt_epi64(a.native());
+    return (uint32_t) reduce_add(r);
+#elif SIMDPP_USE_X86_POPCNT_INSN && SIMDPP_64_BITS
     uint32<8> a0, a1;
     split(a, a0, a1);
     return i_reduce_popcnt(a0) + i_reduce_popcnt(a1);
 #else
-    // TODO: support AVX512VPOPCNTDQ
     uint64<8> r = popcnt((uint64<8>)a);
     return reduce_add(r);
 #endif
@@ -94,11 +103,41 @@ uint32_t i_reduce_popcnt(const uint32<16>& a)
 template<unsigned N> SIMDPP_INL
 uint32_t i_reduce_popcnt(const uint32<N>& a)
 {
+#if SIMDPP_USE_AVX512VPOPCNTDQ
+    // Accumulate the per-lane counts and perform only a single horizontal
+    // reduction
+    uint64<8> r = _mm512_popcnt_epi64(a.vec(0).native());
+    for (unsigned j = 1; j < a.vec_length; ++j) {
+        r = add(r, (uint64<8>) _mm512_popcnt_epi64(a.vec(j).native()));
+    }
+    return (uint32_t) reduce_add(r);
+#else
     uint32_t r = 0;
     for (unsigned j = 0; j < a.vec_length; ++j) {
         r += i_reduce_popcnt(a.vec(j));
     }
     return r;
+#endif
+}
+
+/*  The bit counts of 64-bit elements are accumulated in 64-bit lanes, thus
+    only a single horizontal reduction is needed. This is only beneficial when
+    the 64-bit population count is native. Otherwise the elements are counted
+    as 32-bit ones.
+*/
+template<unsigned N> SIMDPP_INL
+uint32_t i_reduce_popcnt(const uint64<N>& a)
+{
+#if SIMDPP_USE_AVX512VPOPCNTDQ || SIMDPP_USE_VSX_207 || SIMDPP_USE_MSA
+    using V = uint64<N / uint64<N>::vec_length>;
+    V r = popcnt(a.vec(0));
+    for (unsigned j = 1; j < a.vec_length; ++j) {
+        r = add(r, (V) popcnt(a.vec(j)));
+    }
+    return (uint32_t) reduce_add(r);
+#else
+    return i_reduce_popcnt(uint32<N*2>(a));
+#endif
 }
 
 // -----------------------------------------------------------------------------
@@ -0,0 +1,364 @@
+/*  Copyright (C) 2017  Povilas Kanapickas <povilas@radix.lt>
+
+    Distributed under the Boost Software License, Version 1.0.
+        (See accompanying file LICENSE_1_0.txt or copy at
+            http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#ifndef LIBSIMDPP_SIMDPP_DETAIL_INSN_LOAD_FIRST_H
+#define LIBSIMDPP_SIMDPP_DETAIL_INSN_LOAD_FIRST_H
+
+#ifndef LIBSIMDPP_SIMD_H
+    #error "This file must be included through simd.h"
+#endif
+
+#include <simdpp/types.h>
+#include <simdpp/core/bit_and.h>
+#include <simdpp/core/cast.h>
+#include <simdpp/core/load_u.h>
+#include <simdpp/detail/mem_block.h>
+#include <simdpp/detail/null/memory.h>
+#include <cstring>
+#include <stdint.h>
+
+namespace simdpp {
+namespace SIMDPP_ARCH_NAMESPACE {
+namespace detail {
+namespace insn {
+
+/*  Loading a whole vector can't fault if all pages it touches contain at
+    least one of the requested elements. The smallest page size on all
+    supported architectures is 4096 bytes. The first element is always on
+    the first page touched by the vector, thus only the last page needs to be
+    checked.
+*/
+static SIMDPP_INL
+bool v_load_first_is_safe(const char* p, unsigned n_bytes, unsigned length_bytes)
+{
+    uintptr_t last_requested = reinterpret_cast<uintptr_t>(p) + n_bytes - 1;
+    uintptr_t last = reinterpret_cast<uintptr_t>(p) + length_bytes - 1;
+    return (last_requested >> 12) == (last >> 12);
+}
+
+static SIMDPP_INL
+uint64_t v_load_first_bits(unsigned n)
+{
+    return n >= 64 ? ~uint64_t(0) : (uint64_t(1) << n) - 1;
+}
+
+// The requested bytes are copied to a zeroed buffer if the vector crosses to
+// a page that contains none of them. This is rare for short arrays.
+template<class V> SIMDPP_INL
+void v_emul_load_first_bytes(V& r, const char* p, unsigned n,
+                             const uint8_t* mask_d)
+{
+    if (n == 0) {
+        r = make_zero();
+    } else if (v_load_first_is_safe(p, n, V::length_bytes)) {
+        V mask = load_u(mask_d + V::length_bytes - n);
+        r = load_u(p);
+        r = bit_and(r, mask);
+    } else {
+        mem_block<V> b = (V) make_zero();
+        std::memcpy(&b[0], p, n);
+        r = b;
+    }
+}
+
+static SIMDPP_INL
+void i_load_first(uint8<16>& r, const char* p, unsigned n)
+{
+#if SIMDPP_USE_NULL
+    null::load_first(r, p, n);
+#elif SIMDPP_USE_AVX512VL
+    r = _mm_maskz_loadu_epi8(v_load_first_bits(n), p);
+#else
+    static const uint8_t mask_d[32] = {0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+                                       0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+                                       0,0,0,0,0,0,0,0,
+                                       0,0,0,0,0,0,0,0};
+    v_emul_load_first_bytes(r, p, n, mask_d);
+#endif
+}
+
+#if SIMDPP_USE_AVX2
+static SIMDPP_INL
+void i_load_first(uint8<32>& r, const char* p, unsigned n)
+{
+#if SIMDPP_USE_AVX512VL
+    r = _mm256_maskz_loadu_epi8(v_load_first_bits(n), p);
+#else
+    static const uint8_t mask_d[64] = {0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+                                       0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+                                       0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+                                       0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+                                       0,0,0,0,0,0,0,0,  0,0,0,0,0,0,0,0,
+                                       0,0,0,0,0,0,0,0,  0,0,0,0,0,0,0,0};
+    v_emul_load_first_bytes(r, p, n, mask_d);
+#endif
+}
+#endif
+
+#if SIMDPP_USE_AVX512BW
+static SIMDPP_INL
+void i_load_first(uint8<64>& r, const char* p, unsigned n)
+{
+    r = _mm512_maskz_loadu_epi8(v_load_first_bits(n), p);
+}
+#endif
+
+// -----------------------------------------------------------------------------
+
+static SIMDPP_INL
+void i_load_first(uint16<8>& r, const char* p, unsigned n)
+{
+#if SIMDPP_USE_NULL
+    null::load_first(r, p, n);
+#elif SIMDPP_USE_AVX512VL
+    r = _mm_maskz_loadu_epi16(v_load_first_bits(n), p);
+#else
+    uint8<16> r8;
+    i_load_first(r8, p, n*2);
+    r = r8;
+#endif
+}
+
+#if SIMDPP_USE_AVX2
+static SIMDPP_INL
+void i_load_first(uint16<16>& r, const char* p, unsigned n)
+{
+#if SIMDPP_USE_AVX512VL
+    r = _mm256_maskz_loadu_epi16(v_load_first_bits(n), p);
+#else
+    uint8<32> r8;
+    i_load_first(r8, p, n*2);
+    r = r8;
+#endif
+}
+#endif
+
+#if SIMDPP_USE_AVX512BW
+static SIMDPP_INL
+void i_load_first(uint16<32>& r, const char* p, unsigned n)
+{
+    r = _mm512_maskz_loadu_epi16(v_load_first_bits(n), p);
+}
+#endif
+
+// -----------------------------------------------------------------------------
+
+static SIMDPP_INL
+void i_load_first(uint32<4>& r, const char* p, unsigned n)
+{
+#if SIMDPP_USE_NULL
+    null::load_first(r, p, n);
+#elif SIMDPP_USE_AVX512VL
+    r = _mm_maskz_loadu_epi32(v_load_first_bits(n), p);
+#elif SIMDPP_USE_AVX
+    static const int32_t mask_d[8] = { -1, -1, -1, -1, 0, 0, 0, 0 };
+    uint32<4> mask = load_u(mask_d + 4-n);
+#if SIMDPP_USE_AVX2
+    r = _mm_maskload_epi32(reinterpret_cast<const int*>(p), mask.native());
+#else
+    r = _mm_castps_si128(_mm_maskload_ps(reinterpret_cast<const float*>(p),
+                                         mask.native()));
+#endif
+#else
+    uint8<16> r8;
+    i_load_first(r8, p, n*4);
+    r = r8;
+#endif
+}
+
+#if SIMDPP_USE_AVX2
+static SIMDPP_INL
+void i_load_first(uint32<8>& r, const char* p, unsigned n)
+{
+#if SIMDPP_USE_AVX512VL
+    r = _mm256_maskz_loadu_epi32(v_load_first_bits(n), p);
+#else
+    static const int32_t mask_d[16] = { -1, -1, -1, -1, -1, -1, -1, -1,
+                                        0, 0, 0, 0, 0, 0, 0, 0 };
+    uint32<8> mask = load_u(mask_d + 8-n);
+    r = _mm256_maskload_epi32(reinterpret_cast<const int*>(p), mask.native());
+#endif
+}
+#endif
+
+#if SIMDPP_USE_AVX512F
+static SIMDPP_INL
+void i_load_first(uint32<16>& r, const char* p, unsigned n)
+{
+    r = _mm512_maskz_loadu_epi32(v_load_first_bits(n), p);
+}
+#endif
+
+// -----------------------------------------------------------------------------
+
+static SIMDPP_INL
+void i_load_first(uint64<2>& r, const char* p, unsigned n)
+{
+#if SIMDPP_USE_NULL || (SIMDPP_USE_ALTIVEC && !SIMDPP_USE_VSX_207)
+    null::load_first(r, p, n);
+#elif SIMDPP_USE_AVX512VL
+    r = _mm_maskz_loadu_epi64(v_load_first_bits(n), p);
+#elif SIMDPP_USE_AVX
+    static const int64_t mask_d[4] = { -1, -1, 0, 0 };
+    uint64<2> mask = load_u(mask_d + 2-n);
+#if SIMDPP_USE_AVX2
+#if __INTEL_COMPILER
+    r = _mm_maskload_epi64(reinterpret_cast<const __int64*>(p), mask.native());
+#else
+    r = _mm_maskload_epi64(reinterpret_cast<const long long*>(p), mask.native());
+#endif
+#else
+    r = _mm_castpd_si128(_mm_maskload_pd(reinterpret_cast<const double*>(p),
+                                         mask.native()));
+#endif
+#else
+    uint8<16> r8;
+    i_load_first(r8, p, n*8);
+    r = r8;
+#endif
+}
+
+#if SIMDPP_USE_AVX2
+static SIMDPP_INL
+void i_load_first(uint64<4>& r, const char* p, unsigned n)
+{
+#if SIMDPP_USE_AVX512VL
+    r = _mm256_maskz_loadu_epi64(v_load_first_bits(n), p);
+#else
+    static const int64_t mask_d[8] = { -1, -1, -1, -1, 0, 0, 0, 0 };
+    uint64<4> mask = load_u(mask_d + 4-n);
+#if __INTEL_COMPILER
+    r = _mm256_maskload_epi64(reinterpret_cast<const __int64*>(p), mask.native());
+#else
+    r = _mm256_maskload_epi64(reinterpret_cast<const long long*>(p), mask.native());
+#endif
+#endif
+}
+#endif
+
+#if SIMDPP_USE_AVX512F
+static SIMDPP_INL
+void i_load_first(uint64<8>& r, const char* p, unsigned n)
+{
+    r = _mm512_maskz_loadu_epi64(v_load_first_bits(n), p);
+}
+#endif
+
+// -----------------------------------------------------------------------------
+
+static SIMDPP_INL
+void i_load_first(float32<4>& r, const char* p, unsigned n)
+{
+#if SIMDPP_USE_NULL || (SIMDPP_USE_NEON && !SIMDPP_USE_NEON_FLT_SP)
+    null::load_first(r, p, n);
+#elif SIMDPP_USE_AVX512VL
+    r = _mm_maskz_loadu_ps(v_load_first_bits(n), p);
+#elif SIMDPP_USE_AVX
+    static const int32_t mask_d[8] = { -1, -1, -1, -1, 0, 0, 0, 0 };
+    uint32<4> mask = load_u(mask_d + 4-n);
+    r = _mm_maskload_ps(reinterpret_cast<const float*>(p), mask.native());
+#else
+    uint8<16> r8;
+    i_load_first(r8, p, n*4);
+    r = bit_cast<float32<4>>(r8);
+#endif
+}
+
+#if SIMDPP_USE_AVX
+static SIMDPP_INL
+void i_load_first(float32<8>& r, const char* p, unsigned n)
+{
+#if SIMDPP_USE_AVX512VL
+    r = _mm256_maskz_loadu_ps(v_load_first_bits(n), p);
+#else
+    static const int32_t mask_d[16] = { -1, -1, -1, -1, -1, -1, -1, -1,
+                                        0, 0, 0, 0, 0, 0, 0, 0 };
+    __m256i mask = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(mask_d + 8-n));
+    r = _mm256_maskload_ps(reinterpret_cast<const float*>(p), mask);
+#endif
+}
+#endif
+
+#if SIMDPP_USE_AVX512F
+static SIMDPP_INL
+void i_load_first(float32<16>& r, const char* p, unsigned n)
+{
+    r = _mm512_maskz_loadu_ps(v_load_first_bits(n), p);
+}
+#endif
+
+// -----------------------------------------------------------------------------
+
+static SIMDPP_INL
+void i_load_first(float64<2>& r, const char* p, unsigned n)
+{
+#if SIMDPP_USE_NULL || SIMDPP_USE_NEON32 || (SIMDPP_USE_ALTIVEC && !SIMDPP_USE_VSX_206)
+    null::load_first(r, p, n);
+#elif SIMDPP_USE_AVX512VL
+    r = _mm_maskz_loadu_pd(v_load_first_bits(n), p);
+#elif SIMDPP_USE_AVX
+    static const int64_t mask_d[4] = { -1, -1, 0, 0 };
+    uint64<2> mask = load_u(mask_d + 2-n);
+    r = _mm_maskload_pd(reinterpret_cast<const double*>(p), mask.native());
+#else
+    uint8<16> r8;
+    i_load_first(r8, p, n*8);
+    r = bit_cast<float64<2>>(r8);
+#endif
+}
+
+#if SIMDPP_USE_AVX
+static SIMDPP_INL
+void i_load_first(float64<4>& r, const char* p, unsigned n)
+{
+#if SIMDPP_USE_AVX512VL
+    r = _mm256_maskz_loadu_pd(v_load_first_bits(n), p);
+#else
+    static const int64_t mask_d[8] = { -1, -1, -1, -1, 0, 0, 0, 0 };
+    __m256i mask = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(mask_d + 4-n));
+    r = _mm256_maskload_pd(reinterpret_cast<const double*>(p), mask);
+#endif
+}
+#endif
+
+#if SIMDPP_USE_AVX512F
+static SIMDPP_INL
+void i_load_first(float64<8>& r, const char* p, unsigned n)
+{
+    r = _mm512_maskz_loadu_pd(v_load_first_bits(n), p);
+}
+#endif
+
+// -----------------------------------------------------------------------------
+
+template<class V> SIMDPP_INL
+void i_load_first(V& r, const char* p, unsigned n)
+{
+    using B = typename V::base_vector_type;
+    for (unsigned i = 0; i < V::vec_length; ++i) {
+        unsigned n_vec = n < B::length ? n : B::length;
+        i_load_first(r.vec(i), p, n_vec);
+        p += B::length_bytes;
+        n -= n_vec;
+    }
+}
+
+template<class V> SIMDPP_INL
+V i_load_first_any(const char* p, unsigned n)
+{
+    typename detail::remove_sign<V>::type r;
+    i_load_first(r, p, n);
+    return V(r);
+}
+
+} // namespace insn
+} // namespace detail
+} // namespace SIMDPP_ARCH_NAMESPACE
+} // namespace simdpp
+
+#endif
+
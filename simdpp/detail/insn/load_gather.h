@@ -0,0 +1,509 @@
+/*  Copyright (C) 2017  Povilas Kanapickas <povilas@radix.lt>
+
+    Distributed under the Boost Software License, Version 1.0.
+        (See accompanying file LICENSE_1_0.txt or copy at
+            http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#ifndef LIBSIMDPP_SIMDPP_DETAIL_INSN_LOAD_GATHER_H
+#define LIBSIMDPP_SIMDPP_DETAIL_INSN_LOAD_GATHER_H
+
+#ifndef LIBSIMDPP_SIMD_H
+    #error "This file must be included through simd.h"
+#endif
+
+#include <simdpp/types.h>
+#include <simdpp/core/cast.h>
+#include <simdpp/core/combine.h>
+#include <simdpp/core/detail/subvec_extract.h>
+#include <simdpp/detail/mem_block.h>
+
+namespace simdpp {
+namespace SIMDPP_ARCH_NAMESPACE {
+namespace detail {
+namespace insn {
+
+/*  The indices are interpreted as signed values and are expressed in units of
+    the element size. This matches the semantics of the x86 gather
+    instructions.
+
+    On architectures without native gather instructions the indices are read
+    through a memory block and each element is loaded separately. The masked
+    variant does not touch memory for lanes that are not selected.
+*/
+
+template<class V, class T, class I> SIMDPP_INL
+V v_emul_load_gather(const T* p, const I& idx)
+{
+    mem_block<I> ids(idx);
+    mem_block<V> r;
+    for (unsigned i = 0; i < V::length; ++i) {
+        r[i] = p[ids[i]];
+    }
+    return r;
+}
+
+template<class V, class T, class I, class U> SIMDPP_INL
+V v_emul_load_gather_masked(const T* p, const I& idx, const U& mask)
+{
+    mem_block<I> ids(idx);
+    mem_block<U> m(mask);
+    mem_block<V> r;
+    for (unsigned i = 0; i < V::length; ++i) {
+        r[i] = m[i] ? p[ids[i]] : T(0);
+    }
+    return r;
+}
+
+// -----------------------------------------------------------------------------
+
+static SIMDPP_INL
+uint32<4> i_load_gather(const uint32_t* p, const int32<4>& idx)
+{
+#if SIMDPP_USE_NULL
+    uint32<4> r;
+    for (unsigned i = 0; i < 4; i++) {
+        r.el(i) = p[idx.el(i)];
+    }
+    return r;
+#elif SIMDPP_USE_AVX2
+    return _mm_i32gather_epi32(reinterpret_cast<const int*>(p), idx.native(), 4);
+#else
+    return v_emul_load_gather<uint32<4>>(p, idx);
+#endif
+}
+
+#if SIMDPP_USE_AVX2
+static SIMDPP_INL
+uint32<8> i_load_gather(const uint32_t* p, const int32<8>& idx)
+{
+    return _mm256_i32gather_epi32(reinterpret_cast<const int*>(p), idx.native(), 4);
+}
+#endif
+
+#if SIMDPP_USE_AVX512F
+static SIMDPP_INL
+uint32<16> i_load_gather(const uint32_t* p, const int32<16>& idx)
+{
+    return _mm512_i32gather_epi32(idx.native(), p, 4);
+}
+#endif
+
+template<unsigned N> SIMDPP_INL
+uint32<N> i_load_gather(const uint32_t* p, const int32<N>& idx)
+{
+    uint32<N> r;
+    for (unsigned i = 0; i < r.vec_length; ++i) {
+        r.vec(i) = i_load_gather(p, idx.vec(i));
+    }
+    return r;
+}
+
+// -----------------------------------------------------------------------------
+
+static SIMDPP_INL
+uint64<2> i_load_gather(const uint64_t* p, const int64<2>& idx)
+{
+#if SIMDPP_USE_NULL
+    uint64<2> r;
+    for (unsigned i = 0; i < 2; i++) {
+        r.el(i) = p[idx.el(i)];
+    }
+    return r;
+#elif SIMDPP_USE_AVX2
+    return _mm_i64gather_epi64(reinterpret_cast<const long long*>(p),
+                               idx.native(), 8);
+#else
+    return v_emul_load_gather<uint64<2>>(p, idx);
+#endif
+}
+
+#if SIMDPP_USE_AVX2
+static SIMDPP_INL
+uint64<4> i_load_gather(const uint64_t* p, const int64<4>& idx)
+{
+    return _mm256_i64gather_epi64(reinterpret_cast<const long long*>(p),
+                                  idx.native(), 8);
+}
+#endif
+
+#if SIMDPP_USE_AVX512F
+static SIMDPP_INL
+uint64<8> i_load_gather(const uint64_t* p, const int64<8>& idx)
+{
+    return _mm512_i64gather_epi64(idx.native(), p, 8);
+}
+#endif
+
+template<unsigned N> SIMDPP_INL
+uint64<N> i_load_gather(const uint64_t* p, const int64<N>& idx)
+{
+    uint64<N> r;
+    for (unsigned i = 0; i < r.vec_length; ++i) {
+        r.vec(i) = i_load_gather(p, idx.vec(i));
+    }
+    return r;
+}
+
+// -----------------------------------------------------------------------------
+
+static SIMDPP_INL
+float32<4> i_load_gather(const float* p, const int32<4>& idx)
+{
+#if SIMDPP_USE_NULL
+    float32<4> r;
+    for (unsigned i = 0; i < 4; i++) {
+        r.el(i) = p[idx.el(i)];
+    }
+    return r;
+#elif SIMDPP_USE_AVX2
+    return _mm_i32gather_ps(p, idx.native(), 4);
+#else
+    return v_emul_load_gather<float32<4>>(p, idx);
+#endif
+}
+
+#if SIMDPP_USE_AVX
+static SIMDPP_INL
+float32<8> i_load_gather(const float* p, const int32<8>& idx)
+{
+#if SIMDPP_USE_AVX2
+    return _mm256_i32gather_ps(p, idx.native(), 4);
+#else
+    float32<4> r0 = i_load_gather(p, idx.vec(0));
+    float32<4> r1 = i_load_gather(p, idx.vec(1));
+    return combine(r0, r1);
+#endif
+}
+#endif
+
+#if SIMDPP_USE_AVX512F
+static SIMDPP_INL
+float32<16> i_load_gather(const float* p, const int32<16>& idx)
+{
+    return _mm512_i32gather_ps(idx.native(), p, 4);
+}
+#endif
+
+template<unsigned N> SIMDPP_INL
+float32<N> i_load_gather(const float* p, const int32<N>& idx)
+{
+    const unsigned M = float32<N>::base_length;
+    float32<N> r;
+    for (unsigned i = 0; i < r.vec_length; ++i) {
+        r.vec(i) = i_load_gather(p, detail::subvec_extract<M>(idx, i));
+    }
+    return r;
+}
+
+// -----------------------------------------------------------------------------
+
+static SIMDPP_INL
+float64<2> i_load_gather(const double* p, const int64<2>& idx)
+{
+#if SIMDPP_USE_NULL
+    float64<2> r;
+    for (unsigned i = 0; i < 2; i++) {
+        r.el(i) = p[idx.el(i)];
+    }
+    return r;
+#elif SIMDPP_USE_AVX2
+    return _mm_i64gather_pd(p, idx.native(), 8);
+#else
+    return v_emul_load_gather<float64<2>>(p, idx);
+#endif
+}
+
+#if SIMDPP_USE_AVX
+static SIMDPP_INL
+float64<4> i_load_gather(const double* p, const int64<4>& idx)
+{
+#if SIMDPP_USE_AVX2
+    return _mm256_i64gather_pd(p, idx.native(), 8);
+#else
+    float64<2> r0 = i_load_gather(p, idx.vec(0));
+    float64<2> r1 = i_load_gather(p, idx.vec(1));
+    return combine(r0, r1);
+#endif
+}
+#endif
+
+#if SIMDPP_USE_AVX512F
+static SIMDPP_INL
+float64<8> i_load_gather(const double* p, const int64<8>& idx)
+{
+    return _mm512_i64gather_pd(idx.native(), p, 8);
+}
+#endif
+
+template<unsigned N> SIMDPP_INL
+float64<N> i_load_gather(const double* p, const int64<N>& idx)
+{
+    const unsigned M = float64<N>::base_length;
+    float64<N> r;
+    for (unsigned i = 0; i < r.vec_length; ++i) {
+        r.vec(i) = i_load_gather(p, detail::subvec_extract<M>(idx, i));
+    }
+    return r;
+}
+
+// -----------------------------------------------------------------------------
+// masked variants
+
+static SIMDPP_INL
+uint32<4> i_load_gather_masked(const uint32_t* p, const int32<4>& idx,
+                               const mask_int32<4>& mask)
+{
+#if SIMDPP_USE_NULL
+    uint32<4> r;
+    for (unsigned i = 0; i < 4; i++) {
+        r.el(i) = mask.el(i) ? p[idx.el(i)] : 0;
+    }
+    return r;
+#elif SIMDPP_USE_AVX512VL
+    return _mm_mmask_i32gather_epi32(_mm_setzero_si128(), mask.native(),
+                                     idx.native(), p, 4);
+#elif SIMDPP_USE_AVX2
+    return _mm_mask_i32gather_epi32(_mm_setzero_si128(),
+                                    reinterpret_cast<const int*>(p),
+                                    idx.native(), mask.native(), 4);
+#else
+    return v_emul_load_gather_masked<uint32<4>>(p, idx, mask.unmask());
+#endif
+}
+
+#if SIMDPP_USE_AVX2
+static SIMDPP_INL
+uint32<8> i_load_gather_masked(const uint32_t* p, const int32<8>& idx,
+                               const mask_int32<8>& mask)
+{
+#if SIMDPP_USE_AVX512VL
+    return _mm256_mmask_i32gather_epi32(_mm256_setzero_si256(), mask.native(),
+                                        idx.native(), p, 4);
+#else
+    return _mm256_mask_i32gather_epi32(_mm256_setzero_si256(),
+                                       reinterpret_cast<const int*>(p),
+                                       idx.native(), mask.native(), 4);
+#endif
+}
+#endif
+
+#if SIMDPP_USE_AVX512F
+static SIMDPP_INL
+uint32<16> i_load_gather_masked(const uint32_t* p, const int32<16>& idx,
+                                const mask_int32<16>& mask)
+{
+    return _mm512_mask_i32gather_epi32(_mm512_setzero_si512(), mask.native(),
+                                       idx.native(), p, 4);
+}
+#endif
+
+template<unsigned N> SIMDPP_INL
+uint32<N> i_load_gather_masked(const uint32_t* p, const int32<N>& idx,
+                               const mask_int32<N>& mask)
+{
+    uint32<N> r;
+    for (unsigned i = 0; i < r.vec_length; ++i) {
+        r.vec(i) = i_load_gather_masked(p, idx.vec(i), mask.vec(i));
+    }
+    return r;
+}
+
+// -----------------------------------------------------------------------------
+
+static SIMDPP_INL
+uint64<2> i_load_gather_masked(const uint64_t* p, const int64<2>& idx,
+                               const mask_int64<2>& mask)
+{
+#if SIMDPP_USE_NULL
+    uint64<2> r;
+    for (unsigned i = 0; i < 2; i++) {
+        r.el(i) = mask.el(i) ? p[idx.el(i)] : 0;
+    }
+    return r;
+#elif SIMDPP_USE_AVX512VL
+    return _mm_mmask_i64gather_epi64(_mm_setzero_si128(), mask.native(),
+                                     idx.native(), p, 8);
+#elif SIMDPP_USE_AVX2
+    return _mm_mask_i64gather_epi64(_mm_setzero_si128(),
+                                    reinterpret_cast<const long long*>(p),
+                                    idx.native(), mask.native(), 8);
+#else
+    return v_emul_load_gather_masked<uint64<2>>(p, idx, mask.unmask());
+#endif
+}
+
+#if SIMDPP_USE_AVX2
+static SIMDPP_INL
+uint64<4> i_load_gather_masked(const uint64_t* p, const int64<4>& idx,
+                               const mask_int64<4>& mask)
+{
+#if SIMDPP_USE_AVX512VL
+    return _mm256_mmask_i64gather_epi64(_mm256_setzero_si256(), mask.native(),
+                                        idx.native(), p, 8);
+#else
+    return _mm256_mask_i64gather_epi64(_mm256_setzero_si256(),
+                                       reinterpret_cast<const long long*>(p),
+                                       idx.native(), mask.native(), 8);
+#endif
+}
+#endif
+
+#if SIMDPP_USE_AVX512F
+static SIMDPP_INL
+uint64<8> i_load_gather_masked(const uint64_t* p, const int64<8>& idx,
+                               const mask_int64<8>& mask)
+{
+    return _mm512_mask_i64gather_epi64(_mm512_setzero_si512(), mask.native(),
+                                       idx.native(), p, 8);
+}
+#endif
+
+template<unsigned N> SIMDPP_INL
+uint64<N> i_load_gather_masked(const uint64_t* p, const int64<N>& idx,
+                               const mask_int64<N>& mask)
+{
+    uint64<N> r;
+    for (unsigned i = 0; i < r.vec_length; ++i) {
+        r.vec(i) = i_load_gather_masked(p, idx.vec(i), mask.vec(i));
+    }
+    return r;
+}
+
+// -----------------------------------------------------------------------------
+
+static SIMDPP_INL
+float32<4> i_load_gather_masked(const float* p, const int32<4>& idx,
+                                const mask_float32<4>& mask)
+{
+#if SIMDPP_USE_NULL
+    float32<4> r;
+    for (unsigned i = 0; i < 4; i++) {
+        r.el(i) = mask.el(i) ? p[idx.el(i)] : 0.0f;
+    }
+    return r;
+#elif SIMDPP_USE_AVX512VL
+    return _mm_mmask_i32gather_ps(_mm_setzero_ps(), mask.native(),
+                                  idx.native(), p, 4);
+#elif SIMDPP_USE_AVX2
+    return _mm_mask_i32gather_ps(_mm_setzero_ps(), p, idx.native(),
+                                 mask.native(), 4);
+#else
+    uint32<4> m = bit_cast<uint32<4>>(mask.unmask());
+    return v_emul_load_gather_masked<float32<4>>(p, idx, m);
+#endif
+}
+
+#if SIMDPP_USE_AVX
+static SIMDPP_INL
+float32<8> i_load_gather_masked(const float* p, const int32<8>& idx,
+                                const mask_float32<8>& mask)
+{
+#if SIMDPP_USE_AVX512VL
+    return _mm256_mmask_i32gather_ps(_mm256_setzero_ps(), mask.native(),
+                                     idx.native(), p, 4);
+#elif SIMDPP_USE_AVX2
+    return _mm256_mask_i32gather_ps(_mm256_setzero_ps(), p, idx.native(),
+                                    mask.native(), 4);
+#else
+    uint32<8> m = bit_cast<uint32<8>>(mask.unmask());
+    return v_emul_load_gather_masked<float32<8>>(p, idx, m);
+#endif
+}
+#endif
+
+#if SIMDPP_USE_AVX512F
+static SIMDPP_INL
+float32<16> i_load_gather_masked(const float* p, const int32<16>& idx,
+                                 const mask_float32<16>& mask)
+{
+    return _mm512_mask_i32gather_ps(_mm512_setzero_ps(), mask.native(),
+                                    idx.native(), p, 4);
+}
+#endif
+
+template<unsigned N> SIMDPP_INL
+float32<N> i_load_gather_masked(const float* p, const int32<N>& idx,
+                                const mask_float32<N>& mask)
+{
+    const unsigned M = float32<N>::base_length;
+    float32<N> r;
+    for (unsigned i = 0; i < r.vec_length; ++i) {
+        r.vec(i) = i_load_gather_masked(p, detail::subvec_extract<M>(idx, i),
+                                        mask.vec(i));
+    }
+    return r;
+}
+
+// -----------------------------------------------------------------------------
+
+static SIMDPP_INL
+float64<2> i_load_gather_masked(const double* p, const int64<2>& idx,
+                                const mask_float64<2>& mask)
+{
+#if SIMDPP_USE_NULL
+    float64<2> r;
+    for (unsigned i = 0; i < 2; i++) {
+        r.el(i) = mask.el(i) ? p[idx.el(i)] : 0.0;
+    }
+    return r;
+#elif SIMDPP_USE_AVX512VL
+    return _mm_mmask_i64gather_pd(_mm_setzero_pd(), mask.native(),
+                                  idx.native(), p, 8);
+#elif SIMDPP_USE_AVX2
+    return _mm_mask_i64gather_pd(_mm_setzero_pd(), p, idx.native(),
+                                 mask.native(), 8);
+#else
+    uint64<2> m = bit_cast<uint64<2>>(mask.unmask());
+    return v_emul_load_gather_masked<float64<2>>(p, idx, m);
+#endif
+}
+
+#if SIMDPP_USE_AVX
+static SIMDPP_INL
+float64<4> i_load_gather_masked(const double* p, const int64<4>& idx,
+                                const mask_float64<4>& mask)
+{
+#if SIMDPP_USE_AVX512VL
+    return _mm256_mmask_i64gather_pd(_mm256_setzero_pd(), mask.native(),
+                                     idx.native(), p, 8);
+#elif SIMDPP_USE_AVX2
+    return _mm256_mask_i64gather_pd(_mm256_setzero_pd(), p, idx.native(),
+                                    mask.native(), 8);
+#else
+    uint64<4> m = bit_cast<uint64<4>>(mask.unmask());
+    return v_emul_load_gather_masked<float64<4>>(p, idx, m);
+#endif
+}
+#endif
+
+#if SIMDPP_USE_AVX512F
+static SIMDPP_INL
+float64<8> i_load_gather_masked(const double* p, const int64<8>& idx,
+                                const mask_float64<8>& mask)
+{
+    return _mm512_mask_i64gather_pd(_mm512_setzero_pd(), mask.native(),
+                                    idx.native(), p, 8);
+}
+#endif
+
+template<unsigned N> SIMDPP_INL
+float64<N> i_load_gather_masked(const double* p, const int64<N>& idx,
+                                const mask_float64<N>& mask)
+{
+    const unsigned M = float64<N>::base_length;
+    float64<N> r;
+    for (unsigned i = 0; i < r.vec_length; ++i) {
+        r.vec(i) = i_load_gather_masked(p, detail::subvec_extract<M>(idx, i),
+                                        mask.vec(i));
+    }
+    return r;
+}
+
+} // namespace insn
+} // namespace detail
+} // namespace SIMDPP_ARCH_NAMESPACE
+} // namespace simdpp
+
+#endif
+
@@ -0,0 +1,285 @@
+/*  Copyright (C) 2017  Povilas Kanapickas <povilas@radix.lt>
+
+    Distributed under the Boost Software License, Version 1.0.
+        (See accompanying file LICENSE_1_0.txt or copy at
+            http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#ifndef LIBSIMDPP_SIMDPP_DETAIL_INSN_LOAD_MASKED_H
+#define LIBSIMDPP_SIMDPP_DETAIL_INSN_LOAD_MASKED_H
+
+#ifndef LIBSIMDPP_SIMD_H
+    #error "This file must be included through simd.h"
+#endif
+
+#include <simdpp/types.h>
+#include <simdpp/core/bit_and.h>
+#include <simdpp/core/load.h>
+#include <simdpp/detail/insn/extract_bits.h>
+#include <simdpp/detail/null/memory.h>
+
+namespace simdpp {
+namespace SIMDPP_ARCH_NAMESPACE {
+namespace detail {
+namespace insn {
+
+/*  An aligned vector never crosses a page boundary, thus the whole vector can
+    be loaded if at least one element is selected.
+*/
+template<class V, class M> SIMDPP_INL
+void v_emul_load_masked(V& r, const char* p, const M& mask)
+{
+    if (i_extract_mask_bits(mask) == 0) {
+        r = make_zero();
+    } else {
+        r = load(p);
+        r = bit_and(r, mask);
+    }
+}
+
+static SIMDPP_INL
+void i_load_masked(uint8<16>& r, const char* p, const mask_int8<16>& mask)
+{
+#if SIMDPP_USE_NULL
+    null::load_masked(r, p, mask);
+#elif SIMDPP_USE_AVX512VL
+    r = _mm_maskz_loadu_epi8(mask.native(), p);
+#else
+    v_emul_load_masked(r, p, mask);
+#endif
+}
+
+#if SIMDPP_USE_AVX2
+static SIMDPP_INL
+void i_load_masked(uint8<32>& r, const char* p, const mask_int8<32>& mask)
+{
+#if SIMDPP_USE_AVX512VL
+    r = _mm256_maskz_loadu_epi8(mask.native(), p);
+#else
+    v_emul_load_masked(r, p, mask);
+#endif
+}
+#endif
+
+#if SIMDPP_USE_AVX512BW
+static SIMDPP_INL
+void i_load_masked(uint8<64>& r, const char* p, const mask_int8<64>& mask)
+{
+    r = _mm512_maskz_loadu_epi8(mask.native(), p);
+}
+#endif
+
+// -----------------------------------------------------------------------------
+
+static SIMDPP_INL
+void i_load_masked(uint16<8>& r, const char* p, const mask_int16<8>& mask)
+{
+#if SIMDPP_USE_NULL
+    null::load_masked(r, p, mask);
+#elif SIMDPP_USE_AVX512VL
+    r = _mm_maskz_loadu_epi16(mask.native(), p);
+#else
+    v_emul_load_masked(r, p, mask);
+#endif
+}
+
+#if SIMDPP_USE_AVX2
+static SIMDPP_INL
+void i_load_masked(uint16<16>& r, const char* p, const mask_int16<16>& mask)
+{
+#if SIMDPP_USE_AVX512VL
+    r = _mm256_maskz_loadu_epi16(mask.native(), p);
+#else
+    v_emul_load_masked(r, p, mask);
+#endif
+}
+#endif
+
+#if SIMDPP_USE_AVX512BW
+static SIMDPP_INL
+void i_load_masked(uint16<32>& r, const char* p, const mask_int16<32>& mask)
+{
+    r = _mm512_maskz_loadu_epi16(mask.native(), p);
+}
+#endif
+
+// -----------------------------------------------------------------------------
+
+static SIMDPP_INL
+void i_load_masked(uint32<4>& r, const char* p, const mask_int32<4>& mask)
+{
+#if SIMDPP_USE_NULL
+    null::load_masked(r, p, mask);
+#elif SIMDPP_USE_AVX512VL
+    r = _mm_maskz_load_epi32(mask.native(), p);
+#elif SIMDPP_USE_AVX2
+    r = _mm_maskload_epi32(reinterpret_cast<const int*>(p), mask.native());
+#elif SIMDPP_USE_AVX
+    r = _mm_castps_si128(_mm_maskload_ps(reinterpret_cast<const float*>(p),
+                                         mask.native()));
+#else
+    v_emul_load_masked(r, p, mask);
+#endif
+}
+
+#if SIMDPP_USE_AVX2
+static SIMDPP_INL
+void i_load_masked(uint32<8>& r, const char* p, const mask_int32<8>& mask)
+{
+#if SIMDPP_USE_AVX512VL
+    r = _mm256_maskz_load_epi32(mask.native(), p);
+#else
+    r = _mm256_maskload_epi32(reinterpret_cast<const int*>(p), mask.native());
+#endif
+}
+#endif
+
+#if SIMDPP_USE_AVX512F
+static SIMDPP_INL
+void i_load_masked(uint32<16>& r, const char* p, const mask_int32<16>& mask)
+{
+    r = _mm512_maskz_load_epi32(mask.native(), p);
+}
+#endif
+
+// -----------------------------------------------------------------------------
+
+static SIMDPP_INL
+void i_load_masked(uint64<2>& r, const char* p, const mask_int64<2>& mask)
+{
+#if SIMDPP_USE_NULL || (SIMDPP_USE_ALTIVEC && !SIMDPP_USE_VSX_207)
+    null::load_masked(r, p, mask);
+#elif SIMDPP_USE_AVX512VL
+    r = _mm_maskz_load_epi64(mask.native(), p);
+#elif SIMDPP_USE_AVX2
+#if __INTEL_COMPILER
+    r = _mm_maskload_epi64(reinterpret_cast<const __int64*>(p), mask.native());
+#else
+    r = _mm_maskload_epi64(reinterpret_cast<const long long*>(p), mask.native());
+#endif
+#elif SIMDPP_USE_AVX
+    r = _mm_castpd_si128(_mm_maskload_pd(reinterpret_cast<const double*>(p),
+                                         mask.native()));
+#else
+    v_emul_load_masked(r, p, mask);
+#endif
+}
+
+#if SIMDPP_USE_AVX2
+static SIMDPP_INL
+void i_load_masked(uint64<4>& r, const char* p, const mask_int64<4>& mask)
+{
+#if SIMDPP_USE_AVX512VL
+    r = _mm256_maskz_load_epi64(mask.native(), p);
+#elif __INTEL_COMPILER
+    r = _mm256_maskload_epi64(reinterpret_cast<const __int64*>(p), mask.native());
+#else
+    r = _mm256_maskload_epi64(reinterpret_cast<const long long*>(p), mask.native());
+#endif
+}
+#endif
+
+#if SIMDPP_USE_AVX512F
+static SIMDPP_INL
+void i_load_masked(uint64<8>& r, const char* p, const mask_int64<8>& mask)
+{
+    r = _mm512_maskz_load_epi64(mask.native(), p);
+}
+#endif
+
+// -----------------------------------------------------------------------------
+
+static SIMDPP_INL
+void i_load_masked(float32<4>& r, const char* p, const mask_float32<4>& mask)
+{
+#if SIMDPP_USE_NULL
+    null::load_masked(r, p, mask);
+#elif SIMDPP_USE_AVX512VL
+    r = _mm_maskz_load_ps(mask.native(), p);
+#elif SIMDPP_USE_AVX
+    r = _mm_maskload_ps(reinterpret_cast<const float*>(p),
+                        _mm_castps_si128(mask.native()));
+#else
+    v_emul_load_masked(r, p, mask);
+#endif
+}
+
+#if SIMDPP_USE_AVX
+static SIMDPP_INL
+void i_load_masked(float32<8>& r, const char* p, const mask_float32<8>& mask)
+{
+#if SIMDPP_USE_AVX512VL
+    r = _mm256_maskz_load_ps(mask.native(), p);
+#else
+    r = _mm256_maskload_ps(reinterpret_cast<const float*>(p),
+                           _mm256_castps_si256(mask.native()));
+#endif
+}
+#endif
+
+#if SIMDPP_USE_AVX512F
+static SIMDPP_INL
+void i_load_masked(float32<16>& r, const char* p, const mask_float32<16>& mask)
+{
+    r = _mm512_maskz_load_ps(mask.native(), p);
+}
+#endif
+
+// -----------------------------------------------------------------------------
+
+static SIMDPP_INL
+void i_load_masked(float64<2>& r, const char* p, const mask_float64<2>& mask)
+{
+#if SIMDPP_USE_NULL || SIMDPP_USE_NEON32 || (SIMDPP_USE_ALTIVEC && !SIMDPP_USE_VSX_206)
+    null::load_masked(r, p, mask);
+#elif SIMDPP_USE_AVX512VL
+    r = _mm_maskz_load_pd(mask.native(), p);
+#elif SIMDPP_USE_AVX
+    r = _mm_maskload_pd(reinterpret_cast<const double*>(p),
+                        _mm_castpd_si128(mask.native()));
+#else
+    v_emul_load_masked(r, p, mask);
+#endif
+}
+
+#if SIMDPP_USE_AVX
+static SIMDPP_INL
+void i_load_masked(float64<4>& r, const char* p, const mask_float64<4>& mask)
+{
+#if SIMDPP_USE_AVX512VL
+    r = _mm256_maskz_load_pd(mask.native(), p);
+#else
+    r = _mm256_maskload_pd(reinterpret_cast<const double*>(p),
+                           _mm256_castpd_si256(mask.native()));
+#endif
+}
+#endif
+
+#if SIMDPP_USE_AVX512F
+static SIMDPP_INL
+void i_load_masked(float64<8>& r, const char* p, const mask_float64<8>& mask)
+{
+    r = _mm512_maskz_load_pd(mask.native(), p);
+}
+#endif
+
+// -----------------------------------------------------------------------------
+
+template<class V, class M> SIMDPP_INL
+void i_load_masked(V& r, const char* p, const M& mask)
+{
+    using B = typename V::base_vector_type;
+
+    for (unsigned i = 0; i < V::vec_length; ++i) {
+        i_load_masked(r.vec(i), p, mask.vec(i));
+        p += B::length_bytes;
+    }
+}
+
+} // namespace insn
+} // namespace detail
+} // namespace SIMDPP_ARCH_NAMESPACE
+} // namespace simdpp
+
+#endif
+
@@ -0,0 +1,158 @@
+/*  Copyright (C) 2017  Povilas Kanapickas <povilas@radix.lt>
+
+    Distributed under the Boost Software License, Version 1.0.
+        (See accompanying file LICENSE_1_0.txt or copy at
+            http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#ifndef LIBSIMDPP_SIMDPP_DETAIL_INSN_LOOKUP_TABLE_H
+#define LIBSIMDPP_SIMDPP_DETAIL_INSN_LOOKUP_TABLE_H
+
+#ifndef LIBSIMDPP_SIMD_H
+    #error "This file must be included through simd.h"
+#endif
+
+#include <type_traits>
+#include <simdpp/types.h>
+#include <simdpp/core/bit_and.h>
+#include <simdpp/core/blend.h>
+#include <simdpp/core/cmp_eq.h>
+#include <simdpp/core/make_uint.h>
+#include <simdpp/detail/insn/combine.h>
+#include <simdpp/detail/insn/permute_bytes.h>
+#include <simdpp/detail/insn/split.h>
+#include <simdpp/detail/mem_block.h>
+
+namespace simdpp {
+namespace SIMDPP_ARCH_NAMESPACE {
+namespace detail {
+namespace insn {
+
+template<unsigned T, unsigned N> SIMDPP_INL
+uint8<N> i_lookup_table(const uint8<T>& table, const uint8<N>& idx);
+
+#if SIMDPP_USE_NEON64
+template<unsigned T> SIMDPP_INL
+void v_neon_table4(const uint8<T>& table, unsigned first, uint8x16x4_t& r)
+{
+    r.val[0] = table.vec(first).native();
+    r.val[1] = table.vec(first + 1).native();
+    r.val[2] = table.vec(first + 2).native();
+    r.val[3] = table.vec(first + 3).native();
+}
+#endif
+
+/*  Looks up the elements of a native vector idx in a table consisting of
+    native vectors of the same width. Only the low log2(T) bits of each index
+    are used.
+*/
+template<unsigned T, class V> SIMDPP_INL
+V v_lookup_native(const uint8<T>& table, const V& idx)
+{
+#if SIMDPP_USE_SSE2 && !SIMDPP_USE_SSSE3
+    mem_block<uint8<T>> mt(table);
+    mem_block<V> mi(idx), mr;
+    for (unsigned i = 0; i < V::length; i++) {
+        mr[i] = mt[mi[i] & (T - 1)];
+    }
+    return mr;
+#elif SIMDPP_USE_NEON64
+    // TBL returns zero and TBX leaves the element unchanged for indices that
+    // are out of range, thus each TBX covers the next 64 table entries
+    uint8x16_t i = vandq_u8(idx.native(), vdupq_n_u8(T - 1));
+    if (T == 16) {
+        return vqtbl1q_u8(table.vec(0).native(), i);
+    }
+    if (T == 32) {
+        uint8x16x2_t t = {{ table.vec(0).native(), table.vec(1).native() }};
+        return vqtbl2q_u8(t, i);
+    }
+    uint8x16x4_t t;
+    v_neon_table4(table, 0, t);
+    uint8x16_t r = vqtbl4q_u8(t, i);
+    for (unsigned k = 1; k < T / 64; ++k) {
+        v_neon_table4(table, k * 4, t);
+        r = vqtbx4q_u8(r, t, vsubq_u8(i, vdupq_n_u8(k * 64)));
+    }
+    return r;
+#else
+    const unsigned base_length = V::length;
+    V sel_mask = make_uint((T - 1) & ~(base_length - 1));
+    V sel = bit_and(idx, sel_mask);
+    V r = i_permute_bytes(table.vec(0), idx);
+    for (unsigned i = 1; i < table.vec_length; ++i) {
+        V ri = i_permute_bytes(table.vec(i), idx);
+        V sel_i = make_uint(i * base_length);
+        r = blend(ri, r, cmp_eq(sel, sel_i));
+    }
+    return r;
+#endif
+}
+
+#if SIMDPP_USE_AVX512VBMI
+static SIMDPP_INL
+uint8<64> v_lookup_native(const uint8<128>& table, const uint8<64>& idx)
+{
+    return _mm512_permutex2var_epi8(table.vec(0).native(), idx.native(),
+                                    table.vec(1).native());
+}
+
+static SIMDPP_INL
+uint8<64> v_lookup_native(const uint8<256>& table, const uint8<64>& idx)
+{
+    __m512i r0 = _mm512_permutex2var_epi8(table.vec(0).native(), idx.native(),
+                                          table.vec(1).native());
+    __m512i r1 = _mm512_permutex2var_epi8(table.vec(2).native(), idx.native(),
+                                          table.vec(3).native());
+    return _mm512_mask_blend_epi8(_mm512_movepi8_mask(idx.native()), r0, r1);
+}
+#endif
+
+// The table and the indices consist of native vectors of the same width
+template<unsigned T, unsigned N> SIMDPP_INL
+uint8<N> v_lookup_table(const uint8<T>& table, const uint8<N>& idx,
+                        std::integral_constant<int, 0>)
+{
+    uint8<N> r;
+    for (unsigned j = 0; j < idx.vec_length; ++j) {
+        r.vec(j) = v_lookup_native(table, idx.vec(j));
+    }
+    return r;
+}
+
+// The table is narrower than a native index vector. The indices are taken
+// modulo T, thus repeating the table does not change the result
+template<unsigned T, unsigned N> SIMDPP_INL
+uint8<N> v_lookup_table(const uint8<T>& table, const uint8<N>& idx,
+                        std::integral_constant<int, -1>)
+{
+    return i_lookup_table(i_combine<uint8<T*2>>(table, table), idx);
+}
+
+// The indices are narrower than a native table vector. Widen the indices,
+// do the lookup and drop the upper half of the result
+template<unsigned T, unsigned N> SIMDPP_INL
+uint8<N> v_lookup_table(const uint8<T>& table, const uint8<N>& idx,
+                        std::integral_constant<int, 1>)
+{
+    uint8<N*2> r2 = i_lookup_table(table, i_combine<uint8<N*2>>(idx, idx));
+    uint8<N> r, rh;
+    i_split(r2, r, rh);
+    return r;
+}
+
+template<unsigned T, unsigned N> SIMDPP_INL
+uint8<N> i_lookup_table(const uint8<T>& table, const uint8<N>& idx)
+{
+    const unsigned table_base = uint8<T>::length / uint8<T>::vec_length;
+    const unsigned idx_base = uint8<N>::length / uint8<N>::vec_length;
+    const int cmp = table_base < idx_base ? -1 : (table_base > idx_base ? 1 : 0);
+    return v_lookup_table(table, idx, std::integral_constant<int, cmp>());
+}
+
+} // namespace insn
+} // namespace detail
+} // namespace SIMDPP_ARCH_NAMESPACE
+} // namespace simdpp
+
+#endif
@@ -0,0 +1,123 @@
+/*  Copyright (C) 2017  Povilas Kanapickas <povilas@radix.lt>
+
+    Distributed under the Boost Software License, Version 1.0.
+        (See accompanying file LICENSE_1_0.txt or copy at
+            http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#ifndef LIBSIMDPP_SIMDPP_DETAIL_INSN_MASK_TEST_H
+#define LIBSIMDPP_SIMDPP_DETAIL_INSN_MASK_TEST_H
+
+#ifndef LIBSIMDPP_SIMD_H
+    #error "This file must be included through simd.h"
+#endif
+
+#include <type_traits>
+#include <utility>
+#include <simdpp/types.h>
+#include <simdpp/core/bit_not.h>
+#include <simdpp/detail/insn/extract_bits.h>
+#include <simdpp/detail/insn/test_bits.h>
+
+namespace simdpp {
+namespace SIMDPP_ARCH_NAMESPACE {
+namespace detail {
+namespace insn {
+
+/*  AVX-512 masks live in mask registers which are tested directly (KORTEST
+    or KMOV+TEST). Other masks are tested as vectors, which uses PTEST on
+    SSE4.1 and VMAXV on NEON64. Neither needs the mask to be stored to memory.
+*/
+template<class M>
+struct is_kmask : std::is_integral<typename std::decay<
+        decltype(std::declval<M>().vec(0))>::type::native_type> {};
+
+template<class M> SIMDPP_INL
+bool v_any_true(const M& a, std::true_type /*kmask*/)
+{
+    for (unsigned i = 0; i < a.vec_length; ++i) {
+        if (i_extract_mask_bits(a.vec(i)) != 0)
+            return true;
+    }
+    return false;
+}
+
+template<class M> SIMDPP_INL
+bool v_any_true(const M& a, std::false_type /*kmask*/)
+{
+    return i_test_bits_any(a.unmask());
+}
+
+template<class M> SIMDPP_INL
+bool i_any_true(const M& a)
+{
+    return v_any_true(a, is_kmask<M>());
+}
+
+template<class M> SIMDPP_INL
+bool v_all_true(const M& a, std::true_type /*kmask*/)
+{
+    const unsigned base_length = M::length / M::vec_length;
+    const uint64_t all = base_length == 64 ? ~uint64_t(0) :
+                                             (uint64_t(1) << base_length) - 1;
+    for (unsigned i = 0; i < a.vec_length; ++i) {
+        if (i_extract_mask_bits(a.vec(i)) != all)
+            return false;
+    }
+    return true;
+}
+
+template<class M> SIMDPP_INL
+bool v_all_true(const M& a, std::false_type /*kmask*/)
+{
+    auto r = a.unmask();
+    r = bit_not(r);
+    return !i_test_bits_any(r);
+}
+
+template<class M> SIMDPP_INL
+bool i_all_true(const M& a)
+{
+    return v_all_true(a, is_kmask<M>());
+}
+
+template<class M> SIMDPP_INL
+unsigned i_count_true(const M& a)
+{
+    unsigned r = 0;
+    for (unsigned i = 0; i < a.vec_length; ++i) {
+        r += v_mask_bits_count(i_extract_mask_bits(a.vec(i)));
+    }
+    return r;
+}
+
+template<class M> SIMDPP_INL
+unsigned i_find_first_set(const M& a)
+{
+    const unsigned base_length = M::length / M::vec_length;
+    for (unsigned i = 0; i < a.vec_length; ++i) {
+        uint64_t bits = i_extract_mask_bits(a.vec(i));
+        if (bits != 0)
+            return i * base_length + v_mask_bits_find_first(bits);
+    }
+    return a.length;
+}
+
+template<class M> SIMDPP_INL
+unsigned i_find_last_set(const M& a)
+{
+    const unsigned base_length = M::length / M::vec_length;
+    for (unsigned i = a.vec_length; i > 0; --i) {
+        uint64_t bits = i_extract_mask_bits(a.vec(i - 1));
+        if (bits != 0)
+            return (i - 1) * base_length + v_mask_bits_find_last(bits);
+    }
+    return a.length;
+}
+
+} // namespace insn
+} // namespace detail
+} // namespace SIMDPP_ARCH_NAMESPACE
+} // namespace simdpp
+
+#endif
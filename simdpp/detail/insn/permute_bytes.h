@@ -0,0 +1,189 @@
+/*  Copyright (C) 2017  Povilas Kanapickas <povilas@radix.lt>
+
+    Distributed under the Boost Software License, Version 1.0.
+        (See accompanying file LICENSE_1_0.txt or copy at
+            http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#ifndef LIBSIMDPP_SIMDPP_DETAIL_INSN_PERMUTE_BYTES_H
+#define LIBSIMDPP_SIMDPP_DETAIL_INSN_PERMUTE_BYTES_H
+
+#ifndef LIBSIMDPP_SIMD_H
+    #error "This file must be included through simd.h"
+#endif
+
+#include <simdpp/types.h>
+#include <simdpp/core/bit_and.h>
+#include <simdpp/core/bit_or.h>
+#include <simdpp/core/blend.h>
+#include <simdpp/core/cmp_eq.h>
+#include <simdpp/core/i_add.h>
+#include <simdpp/core/i_shift_l.h>
+#include <simdpp/core/make_uint.h>
+#include <simdpp/detail/insn/permute_bytes16.h>
+#include <simdpp/detail/mem_block.h>
+
+namespace simdpp {
+namespace SIMDPP_ARCH_NAMESPACE {
+namespace detail {
+namespace insn {
+
+/*  Only the low log2(N) bits of each index are used. Vectors that are wider
+    than 16 bytes are handled by shuffling within each 128-bit lane of the
+    table and selecting the lane according to the upper index bits.
+*/
+static SIMDPP_INL
+uint8<16> i_permute_bytes(const uint8<16>& a, const uint8<16>& idx)
+{
+#if SIMDPP_USE_NULL
+    uint8<16> r;
+    for (unsigned i = 0; i < 16; i++) {
+        r.el(i) = a.el(idx.el(i) & 0x0f);
+    }
+    return r;
+#elif SIMDPP_USE_SSE2 && !SIMDPP_USE_SSSE3
+    mem_block<uint8<16>> ma(a), mi(idx), mr;
+    for (unsigned i = 0; i < 16; i++) {
+        mr[i] = ma[mi[i] & 0x0f];
+    }
+    return mr;
+#else
+    uint8<16> lo = make_uint(0x0f);
+    return i_permute_bytes16(a, bit_and(idx, lo));
+#endif
+}
+
+#if SIMDPP_USE_AVX2
+static SIMDPP_INL
+uint8<32> i_permute_bytes(const uint8<32>& a, const uint8<32>& idx)
+{
+#if SIMDPP_USE_AVX512VBMI && SIMDPP_USE_AVX512VL
+    return _mm256_permutexvar_epi8(idx.native(), a.native());
+#else
+    // clear bit 7 so that PSHUFB does not zero the element
+    __m256i i = _mm256_and_si256(idx.native(), _mm256_set1_epi8(0x1f));
+    __m256i lo = _mm256_permute2x128_si256(a.native(), a.native(), 0x00);
+    __m256i hi = _mm256_permute2x128_si256(a.native(), a.native(), 0x11);
+    lo = _mm256_shuffle_epi8(lo, i);
+    hi = _mm256_shuffle_epi8(hi, i);
+    // move bit 4 of the index to bit 7 which is used by PBLENDVB
+    return _mm256_blendv_epi8(lo, hi, _mm256_slli_epi16(i, 3));
+#endif
+}
+#endif
+
+#if SIMDPP_USE_AVX512BW
+static SIMDPP_INL
+uint8<64> i_permute_bytes(const uint8<64>& a, const uint8<64>& idx)
+{
+#if SIMDPP_USE_AVX512VBMI
+    return _mm512_permutexvar_epi8(idx.native(), a.native());
+#else
+    __m512i i = idx.native();
+    __m512i l0 = _mm512_shuffle_i32x4(a.native(), a.native(), 0x00);
+    __m512i l1 = _mm512_shuffle_i32x4(a.native(), a.native(), 0x55);
+    __m512i l2 = _mm512_shuffle_i32x4(a.native(), a.native(), 0xaa);
+    __m512i l3 = _mm512_shuffle_i32x4(a.native(), a.native(), 0xff);
+    // PSHUFB zeroes the element if bit 7 of the index is set
+    __m512i i4 = _mm512_and_si512(i, _mm512_set1_epi8(0x0f));
+    l0 = _mm512_shuffle_epi8(l0, i4);
+    l1 = _mm512_shuffle_epi8(l1, i4);
+    l2 = _mm512_shuffle_epi8(l2, i4);
+    l3 = _mm512_shuffle_epi8(l3, i4);
+    __mmask64 odd = _mm512_test_epi8_mask(i, _mm512_set1_epi8(0x10));
+    __mmask64 high = _mm512_test_epi8_mask(i, _mm512_set1_epi8(0x20));
+    __m512i r01 = _mm512_mask_blend_epi8(odd, l0, l1);
+    __m512i r23 = _mm512_mask_blend_epi8(odd, l2, l3);
+    return _mm512_mask_blend_epi8(high, r01, r23);
+#endif
+}
+#endif
+
+#if SIMDPP_USE_NEON64
+static SIMDPP_INL
+uint8<32> i_permute_bytes(const uint8<32>& a, const uint8<32>& idx)
+{
+    uint8x16x2_t table = {{ a.vec(0).native(), a.vec(1).native() }};
+    uint8x16_t lo = vdupq_n_u8(0x1f);
+    uint8<32> r;
+    r.vec(0) = vqtbl2q_u8(table, vandq_u8(idx.vec(0).native(), lo));
+    r.vec(1) = vqtbl2q_u8(table, vandq_u8(idx.vec(1).native(), lo));
+    return r;
+}
+
+static SIMDPP_INL
+uint8<64> i_permute_bytes(const uint8<64>& a, const uint8<64>& idx)
+{
+    uint8x16x4_t table = {{ a.vec(0).native(), a.vec(1).native(),
+                            a.vec(2).native(), a.vec(3).native() }};
+    uint8x16_t lo = vdupq_n_u8(0x3f);
+    uint8<64> r;
+    for (unsigned i = 0; i < 4; ++i) {
+        r.vec(i) = vqtbl4q_u8(table, vandq_u8(idx.vec(i).native(), lo));
+    }
+    return r;
+}
+#endif
+
+template<unsigned N> SIMDPP_INL
+uint8<N> i_permute_bytes(const uint8<N>& a, const uint8<N>& idx)
+{
+    using V = typename uint8<N>::base_vector_type;
+    const unsigned base_length = V::length;
+    V sel_mask = make_uint((a.vec_length - 1) * base_length);
+
+    uint8<N> r;
+    for (unsigned j = 0; j < idx.vec_length; ++j) {
+        V sel = bit_and(idx.vec(j), sel_mask);
+        V rj = i_permute_bytes(a.vec(0), idx.vec(j));
+        for (unsigned i = 1; i < a.vec_length; ++i) {
+            V ri = i_permute_bytes(a.vec(i), idx.vec(j));
+            V sel_i = make_uint(i * base_length);
+            rj = blend(ri, rj, cmp_eq(sel, sel_i));
+        }
+        r.vec(j) = rj;
+    }
+    return r;
+}
+
+// -----------------------------------------------------------------------------
+
+#if SIMDPP_USE_AVX512BW && SIMDPP_USE_AVX512VL
+static SIMDPP_INL
+uint16<8> i_permute_words(const uint16<8>& a, const uint16<8>& idx)
+{
+    return _mm_permutexvar_epi16(idx.native(), a.native());
+}
+
+static SIMDPP_INL
+uint16<16> i_permute_words(const uint16<16>& a, const uint16<16>& idx)
+{
+    return _mm256_permutexvar_epi16(idx.native(), a.native());
+}
+#endif
+
+#if SIMDPP_USE_AVX512BW
+static SIMDPP_INL
+uint16<32> i_permute_words(const uint16<32>& a, const uint16<32>& idx)
+{
+    return _mm512_permutexvar_epi16(idx.native(), a.native());
+}
+#endif
+
+// Converts each 16-bit index i to a pair of byte indices 2*i and 2*i+1
+template<unsigned N> SIMDPP_INL
+uint16<N> i_permute_words(const uint16<N>& a, const uint16<N>& idx)
+{
+    uint16<N> i = bit_and(idx, N - 1);
+    i = shift_l<1>(i);
+    i = bit_or(i, shift_l<8>(i));
+    i = add(i, 0x0100);
+    return uint16<N>(i_permute_bytes(uint8<N*2>(a), uint8<N*2>(i)));
+}
+
+} // namespace insn
+} // namespace detail
+} // namespace SIMDPP_ARCH_NAMESPACE
+} // namespace simdpp
+
+#endif
@@ -0,0 +1,443 @@
+/*  Copyright (C) 2017  Povilas Kanapickas <povilas@radix.lt>
+
+    Distributed under the Boost Software License, Version 1.0.
+        (See accompanying file LICENSE_1_0.txt or copy at
+            http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#ifndef LIBSIMDPP_SIMDPP_DETAIL_INSN_STORE_SCATTER_H
+#define LIBSIMDPP_SIMDPP_DETAIL_INSN_STORE_SCATTER_H
+
+#ifndef LIBSIMDPP_SIMD_H
+    #error "This file must be included through simd.h"
+#endif
+
+#include <simdpp/types.h>
+#include <simdpp/core/cast.h>
+#include <simdpp/core/detail/subvec_extract.h>
+#include <simdpp/detail/mem_block.h>
+
+namespace simdpp {
+namespace SIMDPP_ARCH_NAMESPACE {
+namespace detail {
+namespace insn {
+
+/*  The indices are interpreted as signed values and are expressed in units of
+    the element size. The elements are written in order from the lowest to the
+    highest, thus if several indices are equal, the value of the highest
+    element is left in memory. This matches the semantics of the x86 scatter
+    instructions.
+*/
+
+template<class T, class I, class V> SIMDPP_INL
+void v_emul_store_scatter(T* p, const I& idx, const V& a)
+{
+    mem_block<I> ids(idx);
+    mem_block<V> values(a);
+    for (unsigned i = 0; i < V::length; ++i) {
+        p[ids[i]] = values[i];
+    }
+}
+
+template<class T, class I, class V, class U> SIMDPP_INL
+void v_emul_store_scatter_masked(T* p, const I& idx, const V& a, const U& mask)
+{
+    mem_block<I> ids(idx);
+    mem_block<V> values(a);
+    mem_block<U> m(mask);
+    for (unsigned i = 0; i < V::length; ++i) {
+        if (m[i])
+            p[ids[i]] = values[i];
+    }
+}
+
+// -----------------------------------------------------------------------------
+
+static SIMDPP_INL
+void i_store_scatter(uint32_t* p, const int32<4>& idx, const uint32<4>& a)
+{
+#if SIMDPP_USE_NULL
+    for (unsigned i = 0; i < 4; i++) {
+        p[idx.el(i)] = a.el(i);
+    }
+#elif SIMDPP_USE_AVX512VL
+    _mm_i32scatter_epi32(p, idx.native(), a.native(), 4);
+#else
+    v_emul_store_scatter(p, idx, a);
+#endif
+}
+
+#if SIMDPP_USE_AVX2
+static SIMDPP_INL
+void i_store_scatter(uint32_t* p, const int32<8>& idx, const uint32<8>& a)
+{
+#if SIMDPP_USE_AVX512VL
+    _mm256_i32scatter_epi32(p, idx.native(), a.native(), 4);
+#else
+    v_emul_store_scatter(p, idx, a);
+#endif
+}
+#endif
+
+#if SIMDPP_USE_AVX512F
+static SIMDPP_INL
+void i_store_scatter(uint32_t* p, const int32<16>& idx, const uint32<16>& a)
+{
+    _mm512_i32scatter_epi32(p, idx.native(), a.native(), 4);
+}
+#endif
+
+template<unsigned N> SIMDPP_INL
+void i_store_scatter(uint32_t* p, const int32<N>& idx, const uint32<N>& a)
+{
+    for (unsigned i = 0; i < a.vec_length; ++i) {
+        i_store_scatter(p, idx.vec(i), a.vec(i));
+    }
+}
+
+// -----------------------------------------------------------------------------
+
+static SIMDPP_INL
+void i_store_scatter(uint64_t* p, const int64<2>& idx, const uint64<2>& a)
+{
+#if SIMDPP_USE_NULL
+    for (unsigned i = 0; i < 2; i++) {
+        p[idx.el(i)] = a.el(i);
+    }
+#elif SIMDPP_USE_AVX512VL
+    _mm_i64scatter_epi64(p, idx.native(), a.native(), 8);
+#else
+    v_emul_store_scatter(p, idx, a);
+#endif
+}
+
+#if SIMDPP_USE_AVX2
+static SIMDPP_INL
+void i_store_scatter(uint64_t* p, const int64<4>& idx, const uint64<4>& a)
+{
+#if SIMDPP_USE_AVX512VL
+    _mm256_i64scatter_epi64(p, idx.native(), a.native(), 8);
+#else
+    v_emul_store_scatter(p, idx, a);
+#endif
+}
+#endif
+
+#if SIMDPP_USE_AVX512F
+static SIMDPP_INL
+void i_store_scatter(uint64_t* p, const int64<8>& idx, const uint64<8>& a)
+{
+    _mm512_i64scatter_epi64(p, idx.native(), a.native(), 8);
+}
+#endif
+
+template<unsigned N> SIMDPP_INL
+void i_store_scatter(uint64_t* p, const int64<N>& idx, const uint64<N>& a)
+{
+    for (unsigned i = 0; i < a.vec_length; ++i) {
+        i_store_scatter(p, idx.vec(i), a.vec(i));
+    }
+}
+
+// -----------------------------------------------------------------------------
+
+static SIMDPP_INL
+void i_store_scatter(float* p, const int32<4>& idx, const float32<4>& a)
+{
+#if SIMDPP_USE_NULL
+    for (unsigned i = 0; i < 4; i++) {
+        p[idx.el(i)] = a.el(i);
+    }
+#elif SIMDPP_USE_AVX512VL
+    _mm_i32scatter_ps(p, idx.native(), a.native(), 4);
+#else
+    v_emul_store_scatter(p, idx, a);
+#endif
+}
+
+#if SIMDPP_USE_AVX
+static SIMDPP_INL
+void i_store_scatter(float* p, const int32<8>& idx, const float32<8>& a)
+{
+#if SIMDPP_USE_AVX512VL
+    _mm256_i32scatter_ps(p, idx.native(), a.native(), 4);
+#else
+    v_emul_store_scatter(p, idx, a);
+#endif
+}
+#endif
+
+#if SIMDPP_USE_AVX512F
+static SIMDPP_INL
+void i_store_scatter(float* p, const int32<16>& idx, const float32<16>& a)
+{
+    _mm512_i32scatter_ps(p, idx.native(), a.native(), 4);
+}
+#endif
+
+template<unsigned N> SIMDPP_INL
+void i_store_scatter(float* p, const int32<N>& idx, const float32<N>& a)
+{
+    const unsigned M = float32<N>::base_length;
+    for (unsigned i = 0; i < a.vec_length; ++i) {
+        i_store_scatter(p, detail::subvec_extract<M>(idx, i), a.vec(i));
+    }
+}
+
+// -----------------------------------------------------------------------------
+
+static SIMDPP_INL
+void i_store_scatter(double* p, const int64<2>& idx, const float64<2>& a)
+{
+#if SIMDPP_USE_NULL
+    for (unsigned i = 0; i < 2; i++) {
+        p[idx.el(i)] = a.el(i);
+    }
+#elif SIMDPP_USE_AVX512VL
+    _mm_i64scatter_pd(p, idx.native(), a.native(), 8);
+#else
+    v_emul_store_scatter(p, idx, a);
+#endif
+}
+
+#if SIMDPP_USE_AVX
+static SIMDPP_INL
+void i_store_scatter(double* p, const int64<4>& idx, const float64<4>& a)
+{
+#if SIMDPP_USE_AVX512VL
+    _mm256_i64scatter_pd(p, idx.native(), a.native(), 8);
+#else
+    v_emul_store_scatter(p, idx, a);
+#endif
+}
+#endif
+
+#if SIMDPP_USE_AVX512F
+static SIMDPP_INL
+void i_store_scatter(double* p, const int64<8>& idx, const float64<8>& a)
+{
+    _mm512_i64scatter_pd(p, idx.native(), a.native(), 8);
+}
+#endif
+
+template<unsigned N> SIMDPP_INL
+void i_store_scatter(double* p, const int64<N>& idx, const float64<N>& a)
+{
+    const unsigned M = float64<N>::base_length;
+    for (unsigned i = 0; i < a.vec_length; ++i) {
+        i_store_scatter(p, detail::subvec_extract<M>(idx, i), a.vec(i));
+    }
+}
+
+// -----------------------------------------------------------------------------
+// masked variants
+
+static SIMDPP_INL
+void i_store_scatter_masked(uint32_t* p, const int32<4>& idx,
+                            const uint32<4>& a, const mask_int32<4>& mask)
+{
+#if SIMDPP_USE_NULL
+    for (unsigned i = 0; i < 4; i++) {
+        if (mask.el(i))
+            p[idx.el(i)] = a.el(i);
+    }
+#elif SIMDPP_USE_AVX512VL
+    _mm_mask_i32scatter_epi32(p, mask.native(), idx.native(), a.native(), 4);
+#else
+    v_emul_store_scatter_masked(p, idx, a, mask.unmask());
+#endif
+}
+
+#if SIMDPP_USE_AVX2
+static SIMDPP_INL
+void i_store_scatter_masked(uint32_t* p, const int32<8>& idx,
+                            const uint32<8>& a, const mask_int32<8>& mask)
+{
+#if SIMDPP_USE_AVX512VL
+    _mm256_mask_i32scatter_epi32(p, mask.native(), idx.native(), a.native(), 4);
+#else
+    v_emul_store_scatter_masked(p, idx, a, mask.unmask());
+#endif
+}
+#endif
+
+#if SIMDPP_USE_AVX512F
+static SIMDPP_INL
+void i_store_scatter_masked(uint32_t* p, const int32<16>& idx,
+                            const uint32<16>& a, const mask_int32<16>& mask)
+{
+    _mm512_mask_i32scatter_epi32(p, mask.native(), idx.native(), a.native(), 4);
+}
+#endif
+
+template<unsigned N> SIMDPP_INL
+void i_store_scatter_masked(uint32_t* p, const int32<N>& idx,
+                            const uint32<N>& a, const mask_int32<N>& mask)
+{
+    for (unsigned i = 0; i < a.vec_length; ++i) {
+        i_store_scatter_masked(p, idx.vec(i), a.vec(i), mask.vec(i));
+    }
+}
+
+// -----------------------------------------------------------------------------
+
+static SIMDPP_INL
+void i_store_scatter_masked(uint64_t* p, const int64<2>& idx,
+                            const uint64<2>& a, const mask_int64<2>& mask)
+{
+#if SIMDPP_USE_NULL
+    for (unsigned i = 0; i < 2; i++) {
+        if (mask.el(i))
+            p[idx.el(i)] = a.el(i);
+    }
+#elif SIMDPP_USE_AVX512VL
+    _mm_mask_i64scatter_epi64(p, mask.native(), idx.native(), a.native(), 8);
+#else
+    v_emul_store_scatter_masked(p, idx, a, mask.unmask());
+#endif
+}
+
+#if SIMDPP_USE_AVX2
+static SIMDPP_INL
+void i_store_scatter_masked(uint64_t* p, const int64<4>& idx,
+                            const uint64<4>& a, const mask_int64<4>& mask)
+{
+#if SIMDPP_USE_AVX512VL
+    _mm256_mask_i64scatter_epi64(p, mask.native(), idx.native(), a.native(), 8);
+#else
+    v_emul_store_scatter_masked(p, idx, a, mask.unmask());
+#endif
+}
+#endif
+
+#if SIMDPP_USE_AVX512F
+static SIMDPP_INL
+void i_store_scatter_masked(uint64_t* p, const int64<8>& idx,
+                            const uint64<8>& a, const mask_int64<8>& mask)
+{
+    _mm512_mask_i64scatter_epi64(p, mask.native(), idx.native(), a.native(), 8);
+}
+#endif
+
+template<unsigned N> SIMDPP_INL
+void i_store_scatter_masked(uint64_t* p, const int64<N>& idx,
+                            const uint64<N>& a, const mask_int64<N>& mask)
+{
+    for (unsigned i = 0; i < a.vec_length; ++i) {
+        i_store_scatter_masked(p, idx.vec(i), a.vec(i), mask.vec(i));
+    }
+}
+
+// -----------------------------------------------------------------------------
+
+static SIMDPP_INL
+void i_store_scatter_masked(float* p, const int32<4>& idx,
+                            const float32<4>& a, const mask_float32<4>& mask)
+{
+#if SIMDPP_USE_NULL
+    for (unsigned i = 0; i < 4; i++) {
+        if (mask.el(i))
+            p[idx.el(i)] = a.el(i);
+    }
+#elif SIMDPP_USE_AVX512VL
+    _mm_mask_i32scatter_ps(p, mask.native(), idx.native(), a.native(), 4);
+#else
+    uint32<4> m = bit_cast<uint32<4>>(mask.unmask());
+    v_emul_store_scatter_masked(p, idx, a, m);
+#endif
+}
+
+#if SIMDPP_USE_AVX
+static SIMDPP_INL
+void i_store_scatter_masked(float* p, const int32<8>& idx,
+                            const float32<8>& a, const mask_float32<8>& mask)
+{
+#if SIMDPP_USE_AVX512VL
+    _mm256_mask_i32scatter_ps(p, mask.native(), idx.native(), a.native(), 4);
+#else
+    uint32<8> m = bit_cast<uint32<8>>(mask.unmask());
+    v_emul_store_scatter_masked(p, idx, a, m);
+#endif
+}
+#endif
+
+#if SIMDPP_USE_AVX512F
+static SIMDPP_INL
+void i_store_scatter_masked(float* p, const int32<16>& idx,
+                            const float32<16>& a, const mask_float32<16>& mask)
+{
+    _mm512_mask_i32scatter_ps(p, mask.native(), idx.native(), a.native(), 4);
+}
+#endif
+
+template<unsigned N> SIMDPP_INL
+void i_store_scatter_masked(float* p, const int32<N>& idx,
+                            const float32<N>& a, const mask_float32<N>& mask)
+{
+    const unsigned M = float32<N>::base_length;
+    for (unsigned i = 0; i < a.vec_length; ++i) {
+        i_store_scatter_masked(p, detail::subvec_extract<M>(idx, i),
+                               a.vec(i), mask.vec(i));
+    }
+}
+
+// -----------------------------------------------------------------------------
+
+static SIMDPP_INL
+void i_store_scatter_masked(double* p, const int64<2>& idx,
+                            const float64<2>& a, const mask_float64<2>& mask)
+{
+#if SIMDPP_USE_NULL
+    for (unsigned i = 0; i < 2; i++) {
+        if (mask.el(i))
+            p[idx.el(i)] = a.el(i);
+    }
+#elif SIMDPP_USE_AVX512VL
+    _mm_mask_i64scatter_pd(p, mask.native(), idx.native(), a.native(), 8);
+#else
+    uint64<2> m = bit_cast<uint64<2>>(mask.unmask());
+    v_emul_store_scatter_masked(p, idx, a, m);
+#endif
+}
+
+#if SIMDPP_USE_AVX
+static SIMDPP_INL
+void i_store_scatter_masked(double* p, const int64<4>& idx,
+                            const float64<4>& a, const mask_float64<4>& mask)
+{
+#if SIMDPP_USE_AVX512VL
+    _mm256_mask_i64scatter_pd(p, mask.native(), idx.native(), a.native(), 8);
+#else
+    uint64<4> m = bit_cast<uint64<4>>(mask.unmask());
+    v_emul_store_scatter_masked(p, idx, a, m);
+#endif
+}
+#endif
+
+#if SIMDPP_USE_AVX512F
+static SIMDPP_INL
+void i_store_scatter_masked(double* p, const int64<8>& idx,
+                            const float64<8>& a, const mask_float64<8>& mask)
+{
+    _mm512_mask_i64scatter_pd(p, mask.native(), idx.native(), a.native(), 8);
+}
+#endif
+
+template<unsigned N> SIMDPP_INL
+void i_store_scatter_masked(double* p, const int64<N>& idx,
+                            const float64<N>& a, const mask_float64<N>& mask)
+{
+    const unsigned M = float64<N>::base_length;
+    for (unsigned i = 0; i < a.vec_length; ++i) {
+        i_store_scatter_masked(p, detail::subvec_extract<M>(idx, i),
+                               a.vec(i), mask.vec(i));
+    }
+}
+
+} // namespace insn
+} // namespace detail
+} // namespace SIMDPP_ARCH_NAMESPACE
+} // namespace simdpp
+
+#endif
+
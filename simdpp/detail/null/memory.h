@@ -66,6 +66,26 @@ void load_packed4(V& a, V& b, V& c, V& d, const char* p)
     }
 }
 
+template<class V, class M> SIMDPP_INL
+void load_masked(V& a, const char* p, const M& mask)
+{
+    using T = typename V::element_type;
+    const T* pt = reinterpret_cast<const T*>(p);
+    for (unsigned i = 0; i < V::length; i++) {
+        a.el(i) = mask.el(i) ? pt[i] : 0;
+    }
+}
+
+template<class V> SIMDPP_INL
+void load_first(V& a, const char* p, unsigned n)
+{
+    using T = typename V::element_type;
+    const T* pt = reinterpret_cast<const T*>(p);
+    for (unsigned i = 0; i < V::length; i++) {
+        a.el(i) = i < n ? pt[i] : 0;
+    }
+}
+
 template<class V> SIMDPP_INL
 void store(char* p, const V& a)
 {
@@ -91,6 +91,45 @@
 #ifdef SIMDPP_ARCH_PP_USE_AVX512VL
 #undef SIMDPP_ARCH_PP_USE_AVX512VL
 #endif
+#ifdef SIMDPP_ARCH_PP_USE_BMI1
+#undef SIMDPP_ARCH_PP_USE_BMI1
+#endif
+#ifdef SIMDPP_ARCH_PP_USE_BMI2
+#undef SIMDPP_ARCH_PP_USE_BMI2
+#endif
+#ifdef SIMDPP_ARCH_PP_USE_F16C
+#undef SIMDPP_ARCH_PP_USE_F16C
+#endif
+#ifdef SIMDPP_ARCH_PP_USE_GFNI
+#undef SIMDPP_ARCH_PP_USE_GFNI
+#endif
+#ifdef SIMDPP_ARCH_PP_USE_VAES
+#undef SIMDPP_ARCH_PP_USE_VAES
+#endif
+#ifdef SIMDPP_ARCH_PP_USE_VPCLMULQDQ
+#undef SIMDPP_ARCH_PP_USE_VPCLMULQDQ
+#endif
+#ifdef SIMDPP_ARCH_PP_USE_AVX512VBMI
+#undef SIMDPP_ARCH_PP_USE_AVX512VBMI
+#endif
+#ifdef SIMDPP_ARCH_PP_USE_AVX512VBMI2
+#undef SIMDPP_ARCH_PP_USE_AVX512VBMI2
+#endif
+#ifdef SIMDPP_ARCH_PP_USE_AVX512VNNI
+#undef SIMDPP_ARCH_PP_USE_AVX512VNNI
+#endif
+#ifdef SIMDPP_ARCH_PP_USE_AVX512BITALG
+#undef SIMDPP_ARCH_PP_USE_AVX512BITALG
+#endif
+#ifdef SIMDPP_ARCH_PP_USE_AVX512VPOPCNTDQ
+#undef SIMDPP_ARCH_PP_USE_AVX512VPOPCNTDQ
+#endif
+#ifdef SIMDPP_ARCH_PP_USE_AVX512IFMA
+#undef SIMDPP_ARCH_PP_USE_AVX512IFMA
+#endif
+#ifdef SIMDPP_ARCH_PP_USE_AVX512CD
+#undef SIMDPP_ARCH_PP_USE_AVX512CD
+#endif
 #ifdef SIMDPP_ARCH_PP_USE_FMA3
 #undef SIMDPP_ARCH_PP_USE_FMA3
 #endif
@@ -155,6 +194,45 @@
 #ifdef SIMDPP_ARCH_PP_NS_USE_AVX512VL
 #undef SIMDPP_ARCH_PP_NS_USE_AVX512VL
 #endif
+#ifdef SIMDPP_ARCH_PP_NS_USE_BMI1
+#undef SIMDPP_ARCH_PP_NS_USE_BMI1
+#endif
+#ifdef SIMDPP_ARCH_PP_NS_USE_BMI2
+#undef SIMDPP_ARCH_PP_NS_USE_BMI2
+#endif
+#ifdef SIMDPP_ARCH_PP_NS_USE_F16C
+#undef SIMDPP_ARCH_PP_NS_USE_F16C
+#endif
+#ifdef SIMDPP_ARCH_PP_NS_USE_GFNI
+#undef SIMDPP_ARCH_PP_NS_USE_GFNI
+#endif
+#ifdef SIMDPP_ARCH_PP_NS_USE_VAES
+#undef SIMDPP_ARCH_PP_NS_USE_VAES
+#endif
+#ifdef SIMDPP_ARCH_PP_NS_USE_VPCLMULQDQ
+#undef SIMDPP_ARCH_PP_NS_USE_VPCLMULQDQ
+#endif
+#ifdef SIMDPP_ARCH_PP_NS_USE_AVX512VBMI
+#undef SIMDPP_ARCH_PP_NS_USE_AVX512VBMI
+#endif
+#ifdef SIMDPP_ARCH_PP_NS_USE_AVX512VBMI2
+#undef SIMDPP_ARCH_PP_NS_USE_AVX512VBMI2
+#endif
+#ifdef SIMDPP_ARCH_PP_NS_USE_AVX512VNNI
+#undef SIMDPP_ARCH_PP_NS_USE_AVX512VNNI
+#endif
+#ifdef SIMDPP_ARCH_PP_NS_USE_AVX512BITALG
+#undef SIMDPP_ARCH_PP_NS_USE_AVX512BITALG
+#endif
+#ifdef SIMDPP_ARCH_PP_NS_USE_AVX512VPOPCNTDQ
+#undef SIMDPP_ARCH_PP_NS_USE_AVX512VPOPCNTDQ
+#endif
+#ifdef SIMDPP_ARCH_PP_NS_USE_AVX512IFMA
+#undef SIMDPP_ARCH_PP_NS_USE_AVX512IFMA
+#endif
+#ifdef SIMDPP_ARCH_PP_NS_USE_AVX512CD
+#undef SIMDPP_ARCH_PP_NS_USE_AVX512CD
+#endif
 #ifdef SIMDPP_ARCH_PP_NS_USE_FMA3
 #undef SIMDPP_ARCH_PP_NS_USE_FMA3
 #endif
@@ -185,7 +263,7 @@
 
 #ifdef SIMDPP_ARCH_PP_LIST
 
-    #define SIMDPP_ARCH_CREATE_MASK2(x0,x1,x2,x3,x4,x5,x6,x7,x8,x9,x10,x11,x12,x13,...)    \
+    #define SIMDPP_ARCH_CREATE_MASK2(x0,x1,x2,x3,x4,x5,x6,x7,x8,x9,x10,x11,x12,x13,x14,x15,x16,x17,x18,x19,x20,x21,x22,x23,x24,x25,x26,x27,x28,x29,x30,x31,...)    \
         SIMDPP_PP_CAT(SIMDPP_PREFIX_, x0) | \
         SIMDPP_PP_CAT(SIMDPP_PREFIX_, x1) | \
         SIMDPP_PP_CAT(SIMDPP_PREFIX_, x2) | \
@@ -199,9 +277,27 @@
         SIMDPP_PP_CAT(SIMDPP_PREFIX_, x10) | \
         SIMDPP_PP_CAT(SIMDPP_PREFIX_, x11) | \
         SIMDPP_PP_CAT(SIMDPP_PREFIX_, x12) | \
-        SIMDPP_PP_CAT(SIMDPP_PREFIX_, x13)
-
-    #define SIMDPP_ARCH_PP_CREATE_MASK(...) SIMDPP_PP_EXPAND( SIMDPP_ARCH_CREATE_MASK2(__VA_ARGS__,0,0,0,0,0,0,0,0,0,0,0,0,0,0) )
+        SIMDPP_PP_CAT(SIMDPP_PREFIX_, x13) | \
+        SIMDPP_PP_CAT(SIMDPP_PREFIX_, x14) | \
+        SIMDPP_PP_CAT(SIMDPP_PREFIX_, x15) | \
+        SIMDPP_PP_CAT(SIMDPP_PREFIX_, x16) | \
+        SIMDPP_PP_CAT(SIMDPP_PREFIX_, x17) | \
+        SIMDPP_PP_CAT(SIMDPP_PREFIX_, x18) | \
+        SIMDPP_PP_CAT(SIMDPP_PREFIX_, x19) | \
+        SIMDPP_PP_CAT(SIMDPP_PREFIX_, x20) | \
+        SIMDPP_PP_CAT(SIMDPP_PREFIX_, x21) | \
+        SIMDPP_PP_CAT(SIMDPP_PREFIX_, x22) | \
+        SIMDPP_PP_CAT(SIMDPP_PREFIX_, x23) | \
+        SIMDPP_PP_CAT(SIMDPP_PREFIX_, x24) | \
+        SIMDPP_PP_CAT(SIMDPP_PREFIX_, x25) | \
+        SIMDPP_PP_CAT(SIMDPP_PREFIX_, x26) | \
+        SIMDPP_PP_CAT(SIMDPP_PREFIX_, x27) | \
+        SIMDPP_PP_CAT(SIMDPP_PREFIX_, x28) | \
+        SIMDPP_PP_CAT(SIMDPP_PREFIX_, x29) | \
+        SIMDPP_PP_CAT(SIMDPP_PREFIX_, x30) | \
+        SIMDPP_PP_CAT(SIMDPP_PREFIX_, x31)
+
+    #define SIMDPP_ARCH_PP_CREATE_MASK(...) SIMDPP_PP_EXPAND( SIMDPP_ARCH_CREATE_MASK2(__VA_ARGS__,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0) )
     #define SIMDPP_ARCH_PP_MASK SIMDPP_ARCH_PP_CREATE_MASK(SIMDPP_ARCH_PP_LIST)
 
     #if ((SIMDPP_ARCH_PP_MASK) & SIMDPP_INSN_MASK_SSE2) == SIMDPP_INSN_MASK_SSE2
@@ -246,6 +342,45 @@
     #if ((SIMDPP_ARCH_PP_MASK) & SIMDPP_INSN_MASK_AVX512VL) == SIMDPP_INSN_MASK_AVX512VL
         #define SIMDPP_ARCH_PP_USE_AVX512VL 1
     #endif
+    #if ((SIMDPP_ARCH_PP_MASK) & SIMDPP_INSN_MASK_BMI1) == SIMDPP_INSN_MASK_BMI1
+        #define SIMDPP_ARCH_PP_USE_BMI1 1
+    #endif
+    #if ((SIMDPP_ARCH_PP_MASK) & SIMDPP_INSN_MASK_BMI2) == SIMDPP_INSN_MASK_BMI2
+        #define SIMDPP_ARCH_PP_USE_BMI2 1
+    #endif
+    #if ((SIMDPP_ARCH_PP_MASK) & SIMDPP_INSN_MASK_F16C) == SIMDPP_INSN_MASK_F16C
+        #define SIMDPP_ARCH_PP_USE_F16C 1
+    #endif
+    #if ((SIMDPP_ARCH_PP_MASK) & SIMDPP_INSN_MASK_GFNI) == SIMDPP_INSN_MASK_GFNI
+        #define SIMDPP_ARCH_PP_USE_GFNI 1
+    #endif
+    #if ((SIMDPP_ARCH_PP_MASK) & SIMDPP_INSN_MASK_VAES) == SIMDPP_INSN_MASK_VAES
+        #define SIMDPP_ARCH_PP_USE_VAES 1
+    #endif
+    #if ((SIMDPP_ARCH_PP_MASK) & SIMDPP_INSN_MASK_VPCLMULQDQ) == SIMDPP_INSN_MASK_VPCLMULQDQ
+        #define SIMDPP_ARCH_PP_USE_VPCLMULQDQ 1
+    #endif
+    #if ((SIMDPP_ARCH_PP_MASK) & SIMDPP_INSN_MASK_AVX512VBMI) == SIMDPP_INSN_MASK_AVX512VBMI
+        #define SIMDPP_ARCH_PP_USE_AVX512VBMI 1
+    #endif
+    #if ((SIMDPP_ARCH_PP_MASK) & SIMDPP_INSN_MASK_AVX512VBMI2) == SIMDPP_INSN_MASK_AVX512VBMI2
+        #define SIMDPP_ARCH_PP_USE_AVX512VBMI2 1
+    #endif
+    #if ((SIMDPP_ARCH_PP_MASK) & SIMDPP_INSN_MASK_AVX512VNNI) == SIMDPP_INSN_MASK_AVX512VNNI
+        #define SIMDPP_ARCH_PP_USE_AVX512VNNI 1
+    #endif
+    #if ((SIMDPP_ARCH_PP_MASK) & SIMDPP_INSN_MASK_AVX512BITALG) == SIMDPP_INSN_MASK_AVX512BITALG
+        #define SIMDPP_ARCH_PP_USE_AVX512BITALG 1
+    #endif
+    #if ((SIMDPP_ARCH_PP_MASK) & SIMDPP_INSN_MASK_AVX512VPOPCNTDQ) == SIMDPP_INSN_MASK_AVX512VPOPCNTDQ
+        #define SIMDPP_ARCH_PP_USE_AVX512VPOPCNTDQ 1
+    #endif
+    #if ((SIMDPP_ARCH_PP_MASK) & SIMDPP_INSN_MASK_AVX512IFMA) == SIMDPP_INSN_MASK_AVX512IFMA
+        #define SIMDPP_ARCH_PP_USE_AVX512IFMA 1
+    #endif
+    #if ((SIMDPP_ARCH_PP_MASK) & SIMDPP_INSN_MASK_AVX512CD) == SIMDPP_INSN_MASK_AVX512CD
+        #define SIMDPP_ARCH_PP_USE_AVX512CD 1
+    #endif
     #if ((SIMDPP_ARCH_PP_MASK) & SIMDPP_INSN_MASK_NEON) == SIMDPP_INSN_MASK_NEON
         #define SIMDPP_ARCH_PP_USE_NEON 1
     #endif
@@ -325,6 +460,58 @@
         #define SIMDPP_ARCH_PP_USE_AVX512VL 1
         #undef SIMDPP_ARCH_X86_AVX512VL
     #endif
+    #ifdef SIMDPP_ARCH_X86_BMI1
+        #define SIMDPP_ARCH_PP_USE_BMI1 1
+        #undef SIMDPP_ARCH_X86_BMI1
+    #endif
+    #ifdef SIMDPP_ARCH_X86_BMI2
+        #define SIMDPP_ARCH_PP_USE_BMI2 1
+        #undef SIMDPP_ARCH_X86_BMI2
+    #endif
+    #ifdef SIMDPP_ARCH_X86_F16C
+        #define SIMDPP_ARCH_PP_USE_F16C 1
+        #undef SIMDPP_ARCH_X86_F16C
+    #endif
+    #ifdef SIMDPP_ARCH_X86_GFNI
+        #define SIMDPP_ARCH_PP_USE_GFNI 1
+        #undef SIMDPP_ARCH_X86_GFNI
+    #endif
+    #ifdef SIMDPP_ARCH_X86_VAES
+        #define SIMDPP_ARCH_PP_USE_VAES 1
+        #undef SIMDPP_ARCH_X86_VAES
+    #endif
+    #ifdef SIMDPP_ARCH_X86_VPCLMULQDQ
+        #define SIMDPP_ARCH_PP_USE_VPCLMULQDQ 1
+        #undef SIMDPP_ARCH_X86_VPCLMULQDQ
+    #endif
+    #ifdef SIMDPP_ARCH_X86_AVX512VBMI
+        #define SIMDPP_ARCH_PP_USE_AVX512VBMI 1
+        #undef SIMDPP_ARCH_X86_AVX512VBMI
+    #endif
+    #ifdef SIMDPP_ARCH_X86_AVX512VBMI2
+        #define SIMDPP_ARCH_PP_USE_AVX512VBMI2 1
+        #undef SIMDPP_ARCH_X86_AVX512VBMI2
+    #endif
+    #ifdef SIMDPP_ARCH_X86_AVX512VNNI
+        #define SIMDPP_ARCH_PP_USE_AVX512VNNI 1
+        #undef SIMDPP_ARCH_X86_AVX512VNNI
+    #endif
+    #ifdef SIMDPP_ARCH_X86_AVX512BITALG
+        #define SIMDPP_ARCH_PP_USE_AVX512BITALG 1
+        #undef SIMDPP_ARCH_X86_AVX512BITALG
+    #endif
+    #ifdef SIMDPP_ARCH_X86_AVX512VPOPCNTDQ
+        #define SIMDPP_ARCH_PP_USE_AVX512VPOPCNTDQ 1
+        #undef SIMDPP_ARCH_X86_AVX512VPOPCNTDQ
+    #endif
+    #ifdef SIMDPP_ARCH_X86_AVX512IFMA
+        #define SIMDPP_ARCH_PP_USE_AVX512IFMA 1
+        #undef SIMDPP_ARCH_X86_AVX512IFMA
+    #endif
+    #ifdef SIMDPP_ARCH_X86_AVX512CD
+        #define SIMDPP_ARCH_PP_USE_AVX512CD 1
+        #undef SIMDPP_ARCH_X86_AVX512CD
+    #endif
     #ifdef SIMDPP_ARCH_ARM_NEON
         #define SIMDPP_ARCH_PP_USE_NEON 1
         #undef SIMDPP_ARCH_ARM_NEON
@@ -353,6 +540,48 @@
 
 // Define support of instruction sets that are implicitly available when another
 // instruction set is available
+#if SIMDPP_ARCH_PP_USE_AVX512VBMI2
+    #ifndef SIMDPP_ARCH_PP_USE_AVX512BW
+        #define SIMDPP_ARCH_PP_USE_AVX512BW 1
+    #endif
+#endif
+
+#if SIMDPP_ARCH_PP_USE_AVX512VBMI
+    #ifndef SIMDPP_ARCH_PP_USE_AVX512BW
+        #define SIMDPP_ARCH_PP_USE_AVX512BW 1
+    #endif
+#endif
+
+#if SIMDPP_ARCH_PP_USE_AVX512BITALG
+    #ifndef SIMDPP_ARCH_PP_USE_AVX512BW
+        #define SIMDPP_ARCH_PP_USE_AVX512BW 1
+    #endif
+#endif
+
+#if SIMDPP_ARCH_PP_USE_AVX512VNNI
+    #ifndef SIMDPP_ARCH_PP_USE_AVX512F
+        #define SIMDPP_ARCH_PP_USE_AVX512F 1
+    #endif
+#endif
+
+#if SIMDPP_ARCH_PP_USE_AVX512VPOPCNTDQ
+    #ifndef SIMDPP_ARCH_PP_USE_AVX512F
+        #define SIMDPP_ARCH_PP_USE_AVX512F 1
+    #endif
+#endif
+
+#if SIMDPP_ARCH_PP_USE_AVX512IFMA
+    #ifndef SIMDPP_ARCH_PP_USE_AVX512F
+        #define SIMDPP_ARCH_PP_USE_AVX512F 1
+    #endif
+#endif
+
+#if SIMDPP_ARCH_PP_USE_AVX512CD
+    #ifndef SIMDPP_ARCH_PP_USE_AVX512F
+        #define SIMDPP_ARCH_PP_USE_AVX512F 1
+    #endif
+#endif
+
 #if SIMDPP_ARCH_PP_USE_AVX512VL
     #ifndef SIMDPP_ARCH_PP_USE_AVX512F
         #define SIMDPP_ARCH_PP_USE_AVX512F 1
@@ -383,6 +612,24 @@
     #endif
 #endif
 
+#if SIMDPP_ARCH_PP_USE_F16C
+    #ifndef SIMDPP_ARCH_PP_USE_AVX
+        #define SIMDPP_ARCH_PP_USE_AVX 1
+    #endif
+#endif
+
+#if SIMDPP_ARCH_PP_USE_VAES
+    #ifndef SIMDPP_ARCH_PP_USE_AVX
+        #define SIMDPP_ARCH_PP_USE_AVX 1
+    #endif
+#endif
+
+#if SIMDPP_ARCH_PP_USE_VPCLMULQDQ
+    #ifndef SIMDPP_ARCH_PP_USE_AVX
+        #define SIMDPP_ARCH_PP_USE_AVX 1
+    #endif
+#endif
+
 #if SIMDPP_ARCH_PP_USE_AVX
     #ifndef SIMDPP_ARCH_PP_USE_SSE4_1
         #define SIMDPP_ARCH_PP_USE_SSE4_1 1
@@ -431,6 +678,24 @@
     #endif
 #endif
 
+#if SIMDPP_ARCH_PP_USE_BMI1
+    #ifndef SIMDPP_ARCH_PP_USE_SSE2
+        #define SIMDPP_ARCH_PP_USE_SSE2 1
+    #endif
+#endif
+
+#if SIMDPP_ARCH_PP_USE_BMI2
+    #ifndef SIMDPP_ARCH_PP_USE_SSE2
+        #define SIMDPP_ARCH_PP_USE_SSE2 1
+    #endif
+#endif
+
+#if SIMDPP_ARCH_PP_USE_GFNI
+    #ifndef SIMDPP_ARCH_PP_USE_SSE2
+        #define SIMDPP_ARCH_PP_USE_SSE2 1
+    #endif
+#endif
+
 #if SIMDPP_ARCH_PP_USE_NEON_FLT_SP
     #ifndef SIMDPP_ARCH_PP_USE_NEON
         #define SIMDPP_ARCH_PP_USE_NEON 1
@@ -486,10 +751,13 @@
 #if SIMDPP_ARCH_PP_USE_AVX2 && !SIMDPP_ARCH_PP_USE_AVX512F
 #define SIMDPP_ARCH_PP_NS_USE_AVX2 1
 #endif
-#if SIMDPP_ARCH_PP_USE_AVX512F && !SIMDPP_ARCH_PP_USE_AVX512BW && !SIMDPP_ARCH_PP_USE_AVX512DQ && !SIMDPP_ARCH_PP_USE_AVX512VL
+#if SIMDPP_ARCH_PP_USE_AVX512F && !SIMDPP_ARCH_PP_USE_AVX512BW && !SIMDPP_ARCH_PP_USE_AVX512DQ && !SIMDPP_ARCH_PP_USE_AVX512VL && \
+    !SIMDPP_ARCH_PP_USE_AVX512VNNI && !SIMDPP_ARCH_PP_USE_AVX512VPOPCNTDQ && !SIMDPP_ARCH_PP_USE_AVX512IFMA && \
+    !SIMDPP_ARCH_PP_USE_AVX512CD
 #define SIMDPP_ARCH_PP_NS_USE_AVX512F 1
 #endif
-#if SIMDPP_ARCH_PP_USE_AVX512BW
+#if SIMDPP_ARCH_PP_USE_AVX512BW && !SIMDPP_ARCH_PP_USE_AVX512VBMI && !SIMDPP_ARCH_PP_USE_AVX512VBMI2 && \
+    !SIMDPP_ARCH_PP_USE_AVX512BITALG
 #define SIMDPP_ARCH_PP_NS_USE_AVX512BW 1
 #endif
 #if SIMDPP_ARCH_PP_USE_AVX512DQ
@@ -498,6 +766,45 @@
 #if SIMDPP_ARCH_PP_USE_AVX512VL
 #define SIMDPP_ARCH_PP_NS_USE_AVX512VL 1
 #endif
+#if SIMDPP_ARCH_PP_USE_BMI1
+#define SIMDPP_ARCH_PP_NS_USE_BMI1 1
+#endif
+#if SIMDPP_ARCH_PP_USE_BMI2
+#define SIMDPP_ARCH_PP_NS_USE_BMI2 1
+#endif
+#if SIMDPP_ARCH_PP_USE_F16C
+#define SIMDPP_ARCH_PP_NS_USE_F16C 1
+#endif
+#if SIMDPP_ARCH_PP_USE_GFNI
+#define SIMDPP_ARCH_PP_NS_USE_GFNI 1
+#endif
+#if SIMDPP_ARCH_PP_USE_VAES
+#define SIMDPP_ARCH_PP_NS_USE_VAES 1
+#endif
+#if SIMDPP_ARCH_PP_USE_VPCLMULQDQ
+#define SIMDPP_ARCH_PP_NS_USE_VPCLMULQDQ 1
+#endif
+#if SIMDPP_ARCH_PP_USE_AVX512VBMI
+#define SIMDPP_ARCH_PP_NS_USE_AVX512VBMI 1
+#endif
+#if SIMDPP_ARCH_PP_USE_AVX512VBMI2
+#define SIMDPP_ARCH_PP_NS_USE_AVX512VBMI2 1
+#endif
+#if SIMDPP_ARCH_PP_USE_AVX512VNNI
+#define SIMDPP_ARCH_PP_NS_USE_AVX512VNNI 1
+#endif
+#if SIMDPP_ARCH_PP_USE_AVX512BITALG
+#define SIMDPP_ARCH_PP_NS_USE_AVX512BITALG 1
+#endif
+#if SIMDPP_ARCH_PP_USE_AVX512VPOPCNTDQ
+#define SIMDPP_ARCH_PP_NS_USE_AVX512VPOPCNTDQ 1
+#endif
+#if SIMDPP_ARCH_PP_USE_AVX512IFMA
+#define SIMDPP_ARCH_PP_NS_USE_AVX512IFMA 1
+#endif
+#if SIMDPP_ARCH_PP_USE_AVX512CD
+#define SIMDPP_ARCH_PP_NS_USE_AVX512CD 1
+#endif
 #if SIMDPP_ARCH_PP_USE_FMA3
 #define SIMDPP_ARCH_PP_NS_USE_FMA3 1
 #endif
@@ -88,6 +88,22 @@
 */
 #endif
 
+#if SIMDPP_USE_AVX512F
+#if defined(__GNUC__) && (__GNUC__ >= 12) && !defined(__INTEL_COMPILER) && !defined(__clang__)
+#define SIMDPP_WORKAROUND_AVX512_MASK_ZERO_EXTEND 1
+/*  GCC 12 miscompiles the zero extension of a mask that lives in an AVX-512
+    mask register to uint64_t when the mask is spilled. The spill is a 16-bit
+    kmovw store, but the extended value is then reloaded from the stack slot
+    with a 64-bit mov, thus the upper bits contain whatever the slot held
+    before. This was seen with GCC 12.2 at -O1 in compress() for uint8<16>,
+    which then indexed its permutation table out of bounds. The failure
+    persists with -fno-strict-aliasing. Passing the value through a general
+    purpose register avoids the spill of the mask register. Later versions
+    have not been verified to be fixed, thus the workaround is kept for them.
+*/
+#endif
+#endif
+
 #if SIMDPP_USE_ALTIVEC
 #if defined(__GNUC__) && (__GNUC__ < 6) && __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__ && \
     !defined(__INTEL_COMPILER) && !defined(__clang__)
@@ -18,7 +18,10 @@ namespace simdpp {
 */
 /*  The values are assigned in such a way that the result of comparison of two
     ORed flag sets is likely identify which instruction set the binary is more
-    likely to run faster on.
+    likely to run faster on. The x86 extensions added later are appended after
+    the original values, thus the bits of minor extensions that don't affect
+    the vector width or the bulk of the instruction set are larger than those
+    of the major instruction sets. detail::arch_order_key() accounts for that.
 
     detail::select_version depends on this.
 */
@@ -54,6 +57,32 @@ enum class Arch : std::uint32_t {
     X86_AVX512DQ = 1 << 13,
     /// Indicates x86 AVX-512VL suppotr
     X86_AVX512VL = 1 << 14,
+    /// Indicates x86 BMI1 support
+    X86_BMI1 = 1 << 15,
+    /// Indicates x86 BMI2 support
+    X86_BMI2 = 1 << 16,
+    /// Indicates x86 F16C (half-precision conversion) support
+    X86_F16C = 1 << 17,
+    /// Indicates x86 GFNI (Galois field instructions) support
+    X86_GFNI = 1 << 18,
+    /// Indicates x86 VAES (vector AES) support
+    X86_VAES = 1 << 19,
+    /// Indicates x86 VPCLMULQDQ (vector carry-less multiplication) support
+    X86_VPCLMULQDQ = 1 << 20,
+    /// Indicates x86 AVX-512VBMI support
+    X86_AVX512VBMI = 1 << 21,
+    /// Indicates x86 AVX-512VBMI2 support
+    X86_AVX512VBMI2 = 1 << 22,
+    /// Indicates x86 AVX-512VNNI support
+    X86_AVX512VNNI = 1 << 23,
+    /// Indicates x86 AVX-512BITALG support
+    X86_AVX512BITALG = 1 << 24,
+    /// Indicates x86 AVX-512VPOPCNTDQ support
+    X86_AVX512VPOPCNTDQ = 1 << 25,
+    /// Indicates x86 AVX-512IFMA support
+    X86_AVX512IFMA = 1 << 26,
+    /// Indicates x86 AVX-512CD (conflict detection) support
+    X86_AVX512CD = 1 << 27,
 
     /// Indicates ARM NEON support (SP and DP floating-point math is executed
     /// on VFP)
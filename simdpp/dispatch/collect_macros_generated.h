@@ -107,6 +107,71 @@
     #else
     #define SIMDPP_DISPATCH_1_NS_ID_AVX512VL
     #endif
+    #if SIMDPP_ARCH_PP_NS_USE_BMI1
+    #define SIMDPP_DISPATCH_1_NS_ID_BMI1 SIMDPP_INSN_ID_BMI1
+    #else
+    #define SIMDPP_DISPATCH_1_NS_ID_BMI1
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_BMI2
+    #define SIMDPP_DISPATCH_1_NS_ID_BMI2 SIMDPP_INSN_ID_BMI2
+    #else
+    #define SIMDPP_DISPATCH_1_NS_ID_BMI2
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_F16C
+    #define SIMDPP_DISPATCH_1_NS_ID_F16C SIMDPP_INSN_ID_F16C
+    #else
+    #define SIMDPP_DISPATCH_1_NS_ID_F16C
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_GFNI
+    #define SIMDPP_DISPATCH_1_NS_ID_GFNI SIMDPP_INSN_ID_GFNI
+    #else
+    #define SIMDPP_DISPATCH_1_NS_ID_GFNI
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_VAES
+    #define SIMDPP_DISPATCH_1_NS_ID_VAES SIMDPP_INSN_ID_VAES
+    #else
+    #define SIMDPP_DISPATCH_1_NS_ID_VAES
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_VPCLMULQDQ
+    #define SIMDPP_DISPATCH_1_NS_ID_VPCLMULQDQ SIMDPP_INSN_ID_VPCLMULQDQ
+    #else
+    #define SIMDPP_DISPATCH_1_NS_ID_VPCLMULQDQ
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_AVX512VBMI
+    #define SIMDPP_DISPATCH_1_NS_ID_AVX512VBMI SIMDPP_INSN_ID_AVX512VBMI
+    #else
+    #define SIMDPP_DISPATCH_1_NS_ID_AVX512VBMI
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_AVX512VBMI2
+    #define SIMDPP_DISPATCH_1_NS_ID_AVX512VBMI2 SIMDPP_INSN_ID_AVX512VBMI2
+    #else
+    #define SIMDPP_DISPATCH_1_NS_ID_AVX512VBMI2
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_AVX512VNNI
+    #define SIMDPP_DISPATCH_1_NS_ID_AVX512VNNI SIMDPP_INSN_ID_AVX512VNNI
+    #else
+    #define SIMDPP_DISPATCH_1_NS_ID_AVX512VNNI
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_AVX512BITALG
+    #define SIMDPP_DISPATCH_1_NS_ID_AVX512BITALG SIMDPP_INSN_ID_AVX512BITALG
+    #else
+    #define SIMDPP_DISPATCH_1_NS_ID_AVX512BITALG
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_AVX512VPOPCNTDQ
+    #define SIMDPP_DISPATCH_1_NS_ID_AVX512VPOPCNTDQ SIMDPP_INSN_ID_AVX512VPOPCNTDQ
+    #else
+    #define SIMDPP_DISPATCH_1_NS_ID_AVX512VPOPCNTDQ
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_AVX512IFMA
+    #define SIMDPP_DISPATCH_1_NS_ID_AVX512IFMA SIMDPP_INSN_ID_AVX512IFMA
+    #else
+    #define SIMDPP_DISPATCH_1_NS_ID_AVX512IFMA
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_AVX512CD
+    #define SIMDPP_DISPATCH_1_NS_ID_AVX512CD SIMDPP_INSN_ID_AVX512CD
+    #else
+    #define SIMDPP_DISPATCH_1_NS_ID_AVX512CD
+    #endif
     #if SIMDPP_ARCH_PP_NS_USE_NEON
     #define SIMDPP_DISPATCH_1_NS_ID_NEON SIMDPP_INSN_ID_NEON
     #else
@@ -138,7 +203,7 @@
     #define SIMDPP_DISPATCH_1_NS_ID_VSX_207
     #endif
 
-    #define SIMDPP_DISPATCH_1_NAMESPACE SIMDPP_PP_PASTE22(arch,               \
+    #define SIMDPP_DISPATCH_1_NAMESPACE SIMDPP_PP_PASTE35(arch,               \
         SIMDPP_DISPATCH_1_NS_ID_NULL,                                         \
         SIMDPP_DISPATCH_1_NS_ID_SSE2,                                         \
         SIMDPP_DISPATCH_1_NS_ID_SSE3,                                         \
@@ -151,6 +216,19 @@
         SIMDPP_DISPATCH_1_NS_ID_AVX512BW,                                     \
         SIMDPP_DISPATCH_1_NS_ID_AVX512DQ,                                     \
         SIMDPP_DISPATCH_1_NS_ID_AVX512VL,                                     \
+        SIMDPP_DISPATCH_1_NS_ID_BMI1,                                         \
+        SIMDPP_DISPATCH_1_NS_ID_BMI2,                                         \
+        SIMDPP_DISPATCH_1_NS_ID_F16C,                                         \
+        SIMDPP_DISPATCH_1_NS_ID_GFNI,                                         \
+        SIMDPP_DISPATCH_1_NS_ID_VAES,                                         \
+        SIMDPP_DISPATCH_1_NS_ID_VPCLMULQDQ,                                   \
+        SIMDPP_DISPATCH_1_NS_ID_AVX512VBMI,                                   \
+        SIMDPP_DISPATCH_1_NS_ID_AVX512VBMI2,                                  \
+        SIMDPP_DISPATCH_1_NS_ID_AVX512VNNI,                                   \
+        SIMDPP_DISPATCH_1_NS_ID_AVX512BITALG,                                 \
+        SIMDPP_DISPATCH_1_NS_ID_AVX512VPOPCNTDQ,                              \
+        SIMDPP_DISPATCH_1_NS_ID_AVX512IFMA,                                   \
+        SIMDPP_DISPATCH_1_NS_ID_AVX512CD,                                     \
         SIMDPP_DISPATCH_1_NS_ID_FMA3,                                         \
         SIMDPP_DISPATCH_1_NS_ID_FMA4,                                         \
         SIMDPP_DISPATCH_1_NS_ID_XOP,                                          \
@@ -265,6 +343,71 @@
     #else
     #define SIMDPP_DISPATCH_2_NS_ID_AVX512VL
     #endif
+    #if SIMDPP_ARCH_PP_NS_USE_BMI1
+    #define SIMDPP_DISPATCH_2_NS_ID_BMI1 SIMDPP_INSN_ID_BMI1
+    #else
+    #define SIMDPP_DISPATCH_2_NS_ID_BMI1
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_BMI2
+    #define SIMDPP_DISPATCH_2_NS_ID_BMI2 SIMDPP_INSN_ID_BMI2
+    #else
+    #define SIMDPP_DISPATCH_2_NS_ID_BMI2
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_F16C
+    #define SIMDPP_DISPATCH_2_NS_ID_F16C SIMDPP_INSN_ID_F16C
+    #else
+    #define SIMDPP_DISPATCH_2_NS_ID_F16C
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_GFNI
+    #define SIMDPP_DISPATCH_2_NS_ID_GFNI SIMDPP_INSN_ID_GFNI
+    #else
+    #define SIMDPP_DISPATCH_2_NS_ID_GFNI
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_VAES
+    #define SIMDPP_DISPATCH_2_NS_ID_VAES SIMDPP_INSN_ID_VAES
+    #else
+    #define SIMDPP_DISPATCH_2_NS_ID_VAES
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_VPCLMULQDQ
+    #define SIMDPP_DISPATCH_2_NS_ID_VPCLMULQDQ SIMDPP_INSN_ID_VPCLMULQDQ
+    #else
+    #define SIMDPP_DISPATCH_2_NS_ID_VPCLMULQDQ
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_AVX512VBMI
+    #define SIMDPP_DISPATCH_2_NS_ID_AVX512VBMI SIMDPP_INSN_ID_AVX512VBMI
+    #else
+    #define SIMDPP_DISPATCH_2_NS_ID_AVX512VBMI
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_AVX512VBMI2
+    #define SIMDPP_DISPATCH_2_NS_ID_AVX512VBMI2 SIMDPP_INSN_ID_AVX512VBMI2
+    #else
+    #define SIMDPP_DISPATCH_2_NS_ID_AVX512VBMI2
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_AVX512VNNI
+    #define SIMDPP_DISPATCH_2_NS_ID_AVX512VNNI SIMDPP_INSN_ID_AVX512VNNI
+    #else
+    #define SIMDPP_DISPATCH_2_NS_ID_AVX512VNNI
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_AVX512BITALG
+    #define SIMDPP_DISPATCH_2_NS_ID_AVX512BITALG SIMDPP_INSN_ID_AVX512BITALG
+    #else
+    #define SIMDPP_DISPATCH_2_NS_ID_AVX512BITALG
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_AVX512VPOPCNTDQ
+    #define SIMDPP_DISPATCH_2_NS_ID_AVX512VPOPCNTDQ SIMDPP_INSN_ID_AVX512VPOPCNTDQ
+    #else
+    #define SIMDPP_DISPATCH_2_NS_ID_AVX512VPOPCNTDQ
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_AVX512IFMA
+    #define SIMDPP_DISPATCH_2_NS_ID_AVX512IFMA SIMDPP_INSN_ID_AVX512IFMA
+    #else
+    #define SIMDPP_DISPATCH_2_NS_ID_AVX512IFMA
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_AVX512CD
+    #define SIMDPP_DISPATCH_2_NS_ID_AVX512CD SIMDPP_INSN_ID_AVX512CD
+    #else
+    #define SIMDPP_DISPATCH_2_NS_ID_AVX512CD
+    #endif
     #if SIMDPP_ARCH_PP_NS_USE_NEON
     #define SIMDPP_DISPATCH_2_NS_ID_NEON SIMDPP_INSN_ID_NEON
     #else
@@ -296,7 +439,7 @@
     #define SIMDPP_DISPATCH_2_NS_ID_VSX_207
     #endif
 
-    #define SIMDPP_DISPATCH_2_NAMESPACE SIMDPP_PP_PASTE22(arch,               \
+    #define SIMDPP_DISPATCH_2_NAMESPACE SIMDPP_PP_PASTE35(arch,               \
         SIMDPP_DISPATCH_2_NS_ID_NULL,                                         \
         SIMDPP_DISPATCH_2_NS_ID_SSE2,                                         \
         SIMDPP_DISPATCH_2_NS_ID_SSE3,                                         \
@@ -309,6 +452,19 @@
         SIMDPP_DISPATCH_2_NS_ID_AVX512BW,                                     \
         SIMDPP_DISPATCH_2_NS_ID_AVX512DQ,                                     \
         SIMDPP_DISPATCH_2_NS_ID_AVX512VL,                                     \
+        SIMDPP_DISPATCH_2_NS_ID_BMI1,                                         \
+        SIMDPP_DISPATCH_2_NS_ID_BMI2,                                         \
+        SIMDPP_DISPATCH_2_NS_ID_F16C,                                         \
+        SIMDPP_DISPATCH_2_NS_ID_GFNI,                                         \
+        SIMDPP_DISPATCH_2_NS_ID_VAES,                                         \
+        SIMDPP_DISPATCH_2_NS_ID_VPCLMULQDQ,                                   \
+        SIMDPP_DISPATCH_2_NS_ID_AVX512VBMI,                                   \
+        SIMDPP_DISPATCH_2_NS_ID_AVX512VBMI2,                                  \
+        SIMDPP_DISPATCH_2_NS_ID_AVX512VNNI,                                   \
+        SIMDPP_DISPATCH_2_NS_ID_AVX512BITALG,                                 \
+        SIMDPP_DISPATCH_2_NS_ID_AVX512VPOPCNTDQ,                              \
+        SIMDPP_DISPATCH_2_NS_ID_AVX512IFMA,                                   \
+        SIMDPP_DISPATCH_2_NS_ID_AVX512CD,                                     \
         SIMDPP_DISPATCH_2_NS_ID_FMA3,                                         \
         SIMDPP_DISPATCH_2_NS_ID_FMA4,                                         \
         SIMDPP_DISPATCH_2_NS_ID_XOP,                                          \
@@ -423,6 +579,71 @@
     #else
     #define SIMDPP_DISPATCH_3_NS_ID_AVX512VL
     #endif
+    #if SIMDPP_ARCH_PP_NS_USE_BMI1
+    #define SIMDPP_DISPATCH_3_NS_ID_BMI1 SIMDPP_INSN_ID_BMI1
+    #else
+    #define SIMDPP_DISPATCH_3_NS_ID_BMI1
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_BMI2
+    #define SIMDPP_DISPATCH_3_NS_ID_BMI2 SIMDPP_INSN_ID_BMI2
+    #else
+    #define SIMDPP_DISPATCH_3_NS_ID_BMI2
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_F16C
+    #define SIMDPP_DISPATCH_3_NS_ID_F16C SIMDPP_INSN_ID_F16C
+    #else
+    #define SIMDPP_DISPATCH_3_NS_ID_F16C
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_GFNI
+    #define SIMDPP_DISPATCH_3_NS_ID_GFNI SIMDPP_INSN_ID_GFNI
+    #else
+    #define SIMDPP_DISPATCH_3_NS_ID_GFNI
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_VAES
+    #define SIMDPP_DISPATCH_3_NS_ID_VAES SIMDPP_INSN_ID_VAES
+    #else
+    #define SIMDPP_DISPATCH_3_NS_ID_VAES
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_VPCLMULQDQ
+    #define SIMDPP_DISPATCH_3_NS_ID_VPCLMULQDQ SIMDPP_INSN_ID_VPCLMULQDQ
+    #else
+    #define SIMDPP_DISPATCH_3_NS_ID_VPCLMULQDQ
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_AVX512VBMI
+    #define SIMDPP_DISPATCH_3_NS_ID_AVX512VBMI SIMDPP_INSN_ID_AVX512VBMI
+    #else
+    #define SIMDPP_DISPATCH_3_NS_ID_AVX512VBMI
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_AVX512VBMI2
+    #define SIMDPP_DISPATCH_3_NS_ID_AVX512VBMI2 SIMDPP_INSN_ID_AVX512VBMI2
+    #else
+    #define SIMDPP_DISPATCH_3_NS_ID_AVX512VBMI2
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_AVX512VNNI
+    #define SIMDPP_DISPATCH_3_NS_ID_AVX512VNNI SIMDPP_INSN_ID_AVX512VNNI
+    #else
+    #define SIMDPP_DISPATCH_3_NS_ID_AVX512VNNI
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_AVX512BITALG
+    #define SIMDPP_DISPATCH_3_NS_ID_AVX512BITALG SIMDPP_INSN_ID_AVX512BITALG
+    #else
+    #define SIMDPP_DISPATCH_3_NS_ID_AVX512BITALG
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_AVX512VPOPCNTDQ
+    #define SIMDPP_DISPATCH_3_NS_ID_AVX512VPOPCNTDQ SIMDPP_INSN_ID_AVX512VPOPCNTDQ
+    #else
+    #define SIMDPP_DISPATCH_3_NS_ID_AVX512VPOPCNTDQ
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_AVX512IFMA
+    #define SIMDPP_DISPATCH_3_NS_ID_AVX512IFMA SIMDPP_INSN_ID_AVX512IFMA
+    #else
+    #define SIMDPP_DISPATCH_3_NS_ID_AVX512IFMA
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_AVX512CD
+    #define SIMDPP_DISPATCH_3_NS_ID_AVX512CD SIMDPP_INSN_ID_AVX512CD
+    #else
+    #define SIMDPP_DISPATCH_3_NS_ID_AVX512CD
+    #endif
     #if SIMDPP_ARCH_PP_NS_USE_NEON
     #define SIMDPP_DISPATCH_3_NS_ID_NEON SIMDPP_INSN_ID_NEON
     #else
@@ -454,7 +675,7 @@
     #define SIMDPP_DISPATCH_3_NS_ID_VSX_207
     #endif
 
-    #define SIMDPP_DISPATCH_3_NAMESPACE SIMDPP_PP_PASTE22(arch,               \
+    #define SIMDPP_DISPATCH_3_NAMESPACE SIMDPP_PP_PASTE35(arch,               \
         SIMDPP_DISPATCH_3_NS_ID_NULL,                                         \
         SIMDPP_DISPATCH_3_NS_ID_SSE2,                                         \
         SIMDPP_DISPATCH_3_NS_ID_SSE3,                                         \
@@ -467,6 +688,19 @@
         SIMDPP_DISPATCH_3_NS_ID_AVX512BW,                                     \
         SIMDPP_DISPATCH_3_NS_ID_AVX512DQ,                                     \
         SIMDPP_DISPATCH_3_NS_ID_AVX512VL,                                     \
+        SIMDPP_DISPATCH_3_NS_ID_BMI1,                                         \
+        SIMDPP_DISPATCH_3_NS_ID_BMI2,                                         \
+        SIMDPP_DISPATCH_3_NS_ID_F16C,                                         \
+        SIMDPP_DISPATCH_3_NS_ID_GFNI,                                         \
+        SIMDPP_DISPATCH_3_NS_ID_VAES,                                         \
+        SIMDPP_DISPATCH_3_NS_ID_VPCLMULQDQ,                                   \
+        SIMDPP_DISPATCH_3_NS_ID_AVX512VBMI,                                   \
+        SIMDPP_DISPATCH_3_NS_ID_AVX512VBMI2,                                  \
+        SIMDPP_DISPATCH_3_NS_ID_AVX512VNNI,                                   \
+        SIMDPP_DISPATCH_3_NS_ID_AVX512BITALG,                                 \
+        SIMDPP_DISPATCH_3_NS_ID_AVX512VPOPCNTDQ,                              \
+        SIMDPP_DISPATCH_3_NS_ID_AVX512IFMA,                                   \
+        SIMDPP_DISPATCH_3_NS_ID_AVX512CD,                                     \
         SIMDPP_DISPATCH_3_NS_ID_FMA3,                                         \
         SIMDPP_DISPATCH_3_NS_ID_FMA4,                                         \
         SIMDPP_DISPATCH_3_NS_ID_XOP,                                          \
@@ -581,6 +815,71 @@
     #else
     #define SIMDPP_DISPATCH_4_NS_ID_AVX512VL
     #endif
+    #if SIMDPP_ARCH_PP_NS_USE_BMI1
+    #define SIMDPP_DISPATCH_4_NS_ID_BMI1 SIMDPP_INSN_ID_BMI1
+    #else
+    #define SIMDPP_DISPATCH_4_NS_ID_BMI1
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_BMI2
+    #define SIMDPP_DISPATCH_4_NS_ID_BMI2 SIMDPP_INSN_ID_BMI2
+    #else
+    #define SIMDPP_DISPATCH_4_NS_ID_BMI2
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_F16C
+    #define SIMDPP_DISPATCH_4_NS_ID_F16C SIMDPP_INSN_ID_F16C
+    #else
+    #define SIMDPP_DISPATCH_4_NS_ID_F16C
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_GFNI
+    #define SIMDPP_DISPATCH_4_NS_ID_GFNI SIMDPP_INSN_ID_GFNI
+    #else
+    #define SIMDPP_DISPATCH_4_NS_ID_GFNI
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_VAES
+    #define SIMDPP_DISPATCH_4_NS_ID_VAES SIMDPP_INSN_ID_VAES
+    #else
+    #define SIMDPP_DISPATCH_4_NS_ID_VAES
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_VPCLMULQDQ
+    #define SIMDPP_DISPATCH_4_NS_ID_VPCLMULQDQ SIMDPP_INSN_ID_VPCLMULQDQ
+    #else
+    #define SIMDPP_DISPATCH_4_NS_ID_VPCLMULQDQ
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_AVX512VBMI
+    #define SIMDPP_DISPATCH_4_NS_ID_AVX512VBMI SIMDPP_INSN_ID_AVX512VBMI
+    #else
+    #define SIMDPP_DISPATCH_4_NS_ID_AVX512VBMI
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_AVX512VBMI2
+    #define SIMDPP_DISPATCH_4_NS_ID_AVX512VBMI2 SIMDPP_INSN_ID_AVX512VBMI2
+    #else
+    #define SIMDPP_DISPATCH_4_NS_ID_AVX512VBMI2
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_AVX512VNNI
+    #define SIMDPP_DISPATCH_4_NS_ID_AVX512VNNI SIMDPP_INSN_ID_AVX512VNNI
+    #else
+    #define SIMDPP_DISPATCH_4_NS_ID_AVX512VNNI
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_AVX512BITALG
+    #define SIMDPP_DISPATCH_4_NS_ID_AVX512BITALG SIMDPP_INSN_ID_AVX512BITALG
+    #else
+    #define SIMDPP_DISPATCH_4_NS_ID_AVX512BITALG
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_AVX512VPOPCNTDQ
+    #define SIMDPP_DISPATCH_4_NS_ID_AVX512VPOPCNTDQ SIMDPP_INSN_ID_AVX512VPOPCNTDQ
+    #else
+    #define SIMDPP_DISPATCH_4_NS_ID_AVX512VPOPCNTDQ
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_AVX512IFMA
+    #define SIMDPP_DISPATCH_4_NS_ID_AVX512IFMA SIMDPP_INSN_ID_AVX512IFMA
+    #else
+    #define SIMDPP_DISPATCH_4_NS_ID_AVX512IFMA
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_AVX512CD
+    #define SIMDPP_DISPATCH_4_NS_ID_AVX512CD SIMDPP_INSN_ID_AVX512CD
+    #else
+    #define SIMDPP_DISPATCH_4_NS_ID_AVX512CD
+    #endif
     #if SIMDPP_ARCH_PP_NS_USE_NEON
     #define SIMDPP_DISPATCH_4_NS_ID_NEON SIMDPP_INSN_ID_NEON
     #else
@@ -612,7 +911,7 @@
     #define SIMDPP_DISPATCH_4_NS_ID_VSX_207
     #endif
 
-    #define SIMDPP_DISPATCH_4_NAMESPACE SIMDPP_PP_PASTE22(arch,               \
+    #define SIMDPP_DISPATCH_4_NAMESPACE SIMDPP_PP_PASTE35(arch,               \
         SIMDPP_DISPATCH_4_NS_ID_NULL,                                         \
         SIMDPP_DISPATCH_4_NS_ID_SSE2,                                         \
         SIMDPP_DISPATCH_4_NS_ID_SSE3,                                         \
@@ -625,6 +924,19 @@
         SIMDPP_DISPATCH_4_NS_ID_AVX512BW,                                     \
         SIMDPP_DISPATCH_4_NS_ID_AVX512DQ,                                     \
         SIMDPP_DISPATCH_4_NS_ID_AVX512VL,                                     \
+        SIMDPP_DISPATCH_4_NS_ID_BMI1,                                         \
+        SIMDPP_DISPATCH_4_NS_ID_BMI2,                                         \
+        SIMDPP_DISPATCH_4_NS_ID_F16C,                                         \
+        SIMDPP_DISPATCH_4_NS_ID_GFNI,                                         \
+        SIMDPP_DISPATCH_4_NS_ID_VAES,                                         \
+        SIMDPP_DISPATCH_4_NS_ID_VPCLMULQDQ,                                   \
+        SIMDPP_DISPATCH_4_NS_ID_AVX512VBMI,                                   \
+        SIMDPP_DISPATCH_4_NS_ID_AVX512VBMI2,                                  \
+        SIMDPP_DISPATCH_4_NS_ID_AVX512VNNI,                                   \
+        SIMDPP_DISPATCH_4_NS_ID_AVX512BITALG,                                 \
+        SIMDPP_DISPATCH_4_NS_ID_AVX512VPOPCNTDQ,                              \
+        SIMDPP_DISPATCH_4_NS_ID_AVX512IFMA,                                   \
+        SIMDPP_DISPATCH_4_NS_ID_AVX512CD,                                     \
         SIMDPP_DISPATCH_4_NS_ID_FMA3,                                         \
         SIMDPP_DISPATCH_4_NS_ID_FMA4,                                         \
         SIMDPP_DISPATCH_4_NS_ID_XOP,                                          \
@@ -739,6 +1051,71 @@
     #else
     #define SIMDPP_DISPATCH_5_NS_ID_AVX512VL
     #endif
+    #if SIMDPP_ARCH_PP_NS_USE_BMI1
+    #define SIMDPP_DISPATCH_5_NS_ID_BMI1 SIMDPP_INSN_ID_BMI1
+    #else
+    #define SIMDPP_DISPATCH_5_NS_ID_BMI1
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_BMI2
+    #define SIMDPP_DISPATCH_5_NS_ID_BMI2 SIMDPP_INSN_ID_BMI2
+    #else
+    #define SIMDPP_DISPATCH_5_NS_ID_BMI2
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_F16C
+    #define SIMDPP_DISPATCH_5_NS_ID_F16C SIMDPP_INSN_ID_F16C
+    #else
+    #define SIMDPP_DISPATCH_5_NS_ID_F16C
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_GFNI
+    #define SIMDPP_DISPATCH_5_NS_ID_GFNI SIMDPP_INSN_ID_GFNI
+    #else
+    #define SIMDPP_DISPATCH_5_NS_ID_GFNI
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_VAES
+    #define SIMDPP_DISPATCH_5_NS_ID_VAES SIMDPP_INSN_ID_VAES
+    #else
+    #define SIMDPP_DISPATCH_5_NS_ID_VAES
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_VPCLMULQDQ
+    #define SIMDPP_DISPATCH_5_NS_ID_VPCLMULQDQ SIMDPP_INSN_ID_VPCLMULQDQ
+    #else
+    #define SIMDPP_DISPATCH_5_NS_ID_VPCLMULQDQ
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_AVX512VBMI
+    #define SIMDPP_DISPATCH_5_NS_ID_AVX512VBMI SIMDPP_INSN_ID_AVX512VBMI
+    #else
+    #define SIMDPP_DISPATCH_5_NS_ID_AVX512VBMI
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_AVX512VBMI2
+    #define SIMDPP_DISPATCH_5_NS_ID_AVX512VBMI2 SIMDPP_INSN_ID_AVX512VBMI2
+    #else
+    #define SIMDPP_DISPATCH_5_NS_ID_AVX512VBMI2
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_AVX512VNNI
+    #define SIMDPP_DISPATCH_5_NS_ID_AVX512VNNI SIMDPP_INSN_ID_AVX512VNNI
+    #else
+    #define SIMDPP_DISPATCH_5_NS_ID_AVX512VNNI
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_AVX512BITALG
+    #define SIMDPP_DISPATCH_5_NS_ID_AVX512BITALG SIMDPP_INSN_ID_AVX512BITALG
+    #else
+    #define SIMDPP_DISPATCH_5_NS_ID_AVX512BITALG
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_AVX512VPOPCNTDQ
+    #define SIMDPP_DISPATCH_5_NS_ID_AVX512VPOPCNTDQ SIMDPP_INSN_ID_AVX512VPOPCNTDQ
+    #else
+    #define SIMDPP_DISPATCH_5_NS_ID_AVX512VPOPCNTDQ
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_AVX512IFMA
+    #define SIMDPP_DISPATCH_5_NS_ID_AVX512IFMA SIMDPP_INSN_ID_AVX512IFMA
+    #else
+    #define SIMDPP_DISPATCH_5_NS_ID_AVX512IFMA
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_AVX512CD
+    #define SIMDPP_DISPATCH_5_NS_ID_AVX512CD SIMDPP_INSN_ID_AVX512CD
+    #else
+    #define SIMDPP_DISPATCH_5_NS_ID_AVX512CD
+    #endif
     #if SIMDPP_ARCH_PP_NS_USE_NEON
     #define SIMDPP_DISPATCH_5_NS_ID_NEON SIMDPP_INSN_ID_NEON
     #else
@@ -770,7 +1147,7 @@
     #define SIMDPP_DISPATCH_5_NS_ID_VSX_207
     #endif
 
-    #define SIMDPP_DISPATCH_5_NAMESPACE SIMDPP_PP_PASTE22(arch,               \
+    #define SIMDPP_DISPATCH_5_NAMESPACE SIMDPP_PP_PASTE35(arch,               \
         SIMDPP_DISPATCH_5_NS_ID_NULL,                                         \
         SIMDPP_DISPATCH_5_NS_ID_SSE2,                                         \
         SIMDPP_DISPATCH_5_NS_ID_SSE3,                                         \
@@ -783,6 +1160,19 @@
         SIMDPP_DISPATCH_5_NS_ID_AVX512BW,                                     \
         SIMDPP_DISPATCH_5_NS_ID_AVX512DQ,                                     \
         SIMDPP_DISPATCH_5_NS_ID_AVX512VL,                                     \
+        SIMDPP_DISPATCH_5_NS_ID_BMI1,                                         \
+        SIMDPP_DISPATCH_5_NS_ID_BMI2,                                         \
+        SIMDPP_DISPATCH_5_NS_ID_F16C,                                         \
+        SIMDPP_DISPATCH_5_NS_ID_GFNI,                                         \
+        SIMDPP_DISPATCH_5_NS_ID_VAES,                                         \
+        SIMDPP_DISPATCH_5_NS_ID_VPCLMULQDQ,                                   \
+        SIMDPP_DISPATCH_5_NS_ID_AVX512VBMI,                                   \
+        SIMDPP_DISPATCH_5_NS_ID_AVX512VBMI2,                                  \
+        SIMDPP_DISPATCH_5_NS_ID_AVX512VNNI,                                   \
+        SIMDPP_DISPATCH_5_NS_ID_AVX512BITALG,                                 \
+        SIMDPP_DISPATCH_5_NS_ID_AVX512VPOPCNTDQ,                              \
+        SIMDPP_DISPATCH_5_NS_ID_AVX512IFMA,                                   \
+        SIMDPP_DISPATCH_5_NS_ID_AVX512CD,                                     \
         SIMDPP_DISPATCH_5_NS_ID_FMA3,                                         \
         SIMDPP_DISPATCH_5_NS_ID_FMA4,                                         \
         SIMDPP_DISPATCH_5_NS_ID_XOP,                                          \
@@ -897,6 +1287,71 @@
     #else
     #define SIMDPP_DISPATCH_6_NS_ID_AVX512VL
     #endif
+    #if SIMDPP_ARCH_PP_NS_USE_BMI1
+    #define SIMDPP_DISPATCH_6_NS_ID_BMI1 SIMDPP_INSN_ID_BMI1
+    #else
+    #define SIMDPP_DISPATCH_6_NS_ID_BMI1
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_BMI2
+    #define SIMDPP_DISPATCH_6_NS_ID_BMI2 SIMDPP_INSN_ID_BMI2
+    #else
+    #define SIMDPP_DISPATCH_6_NS_ID_BMI2
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_F16C
+    #define SIMDPP_DISPATCH_6_NS_ID_F16C SIMDPP_INSN_ID_F16C
+    #else
+    #define SIMDPP_DISPATCH_6_NS_ID_F16C
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_GFNI
+    #define SIMDPP_DISPATCH_6_NS_ID_GFNI SIMDPP_INSN_ID_GFNI
+    #else
+    #define SIMDPP_DISPATCH_6_NS_ID_GFNI
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_VAES
+    #define SIMDPP_DISPATCH_6_NS_ID_VAES SIMDPP_INSN_ID_VAES
+    #else
+    #define SIMDPP_DISPATCH_6_NS_ID_VAES
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_VPCLMULQDQ
+    #define SIMDPP_DISPATCH_6_NS_ID_VPCLMULQDQ SIMDPP_INSN_ID_VPCLMULQDQ
+    #else
+    #define SIMDPP_DISPATCH_6_NS_ID_VPCLMULQDQ
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_AVX512VBMI
+    #define SIMDPP_DISPATCH_6_NS_ID_AVX512VBMI SIMDPP_INSN_ID_AVX512VBMI
+    #else
+    #define SIMDPP_DISPATCH_6_NS_ID_AVX512VBMI
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_AVX512VBMI2
+    #define SIMDPP_DISPATCH_6_NS_ID_AVX512VBMI2 SIMDPP_INSN_ID_AVX512VBMI2
+    #else
+    #define SIMDPP_DISPATCH_6_NS_ID_AVX512VBMI2
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_AVX512VNNI
+    #define SIMDPP_DISPATCH_6_NS_ID_AVX512VNNI SIMDPP_INSN_ID_AVX512VNNI
+    #else
+    #define SIMDPP_DISPATCH_6_NS_ID_AVX512VNNI
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_AVX512BITALG
+    #define SIMDPP_DISPATCH_6_NS_ID_AVX512BITALG SIMDPP_INSN_ID_AVX512BITALG
+    #else
+    #define SIMDPP_DISPATCH_6_NS_ID_AVX512BITALG
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_AVX512VPOPCNTDQ
+    #define SIMDPP_DISPATCH_6_NS_ID_AVX512VPOPCNTDQ SIMDPP_INSN_ID_AVX512VPOPCNTDQ
+    #else
+    #define SIMDPP_DISPATCH_6_NS_ID_AVX512VPOPCNTDQ
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_AVX512IFMA
+    #define SIMDPP_DISPATCH_6_NS_ID_AVX512IFMA SIMDPP_INSN_ID_AVX512IFMA
+    #else
+    #define SIMDPP_DISPATCH_6_NS_ID_AVX512IFMA
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_AVX512CD
+    #define SIMDPP_DISPATCH_6_NS_ID_AVX512CD SIMDPP_INSN_ID_AVX512CD
+    #else
+    #define SIMDPP_DISPATCH_6_NS_ID_AVX512CD
+    #endif
     #if SIMDPP_ARCH_PP_NS_USE_NEON
     #define SIMDPP_DISPATCH_6_NS_ID_NEON SIMDPP_INSN_ID_NEON
     #else
@@ -928,7 +1383,7 @@
     #define SIMDPP_DISPATCH_6_NS_ID_VSX_207
     #endif
 
-    #define SIMDPP_DISPATCH_6_NAMESPACE SIMDPP_PP_PASTE22(arch,               \
+    #define SIMDPP_DISPATCH_6_NAMESPACE SIMDPP_PP_PASTE35(arch,               \
         SIMDPP_DISPATCH_6_NS_ID_NULL,                                         \
         SIMDPP_DISPATCH_6_NS_ID_SSE2,                                         \
         SIMDPP_DISPATCH_6_NS_ID_SSE3,                                         \
@@ -941,6 +1396,19 @@
         SIMDPP_DISPATCH_6_NS_ID_AVX512BW,                                     \
         SIMDPP_DISPATCH_6_NS_ID_AVX512DQ,                                     \
         SIMDPP_DISPATCH_6_NS_ID_AVX512VL,                                     \
+        SIMDPP_DISPATCH_6_NS_ID_BMI1,                                         \
+        SIMDPP_DISPATCH_6_NS_ID_BMI2,                                         \
+        SIMDPP_DISPATCH_6_NS_ID_F16C,                                         \
+        SIMDPP_DISPATCH_6_NS_ID_GFNI,                                         \
+        SIMDPP_DISPATCH_6_NS_ID_VAES,                                         \
+        SIMDPP_DISPATCH_6_NS_ID_VPCLMULQDQ,                                   \
+        SIMDPP_DISPATCH_6_NS_ID_AVX512VBMI,                                   \
+        SIMDPP_DISPATCH_6_NS_ID_AVX512VBMI2,                                  \
+        SIMDPP_DISPATCH_6_NS_ID_AVX512VNNI,                                   \
+        SIMDPP_DISPATCH_6_NS_ID_AVX512BITALG,                                 \
+        SIMDPP_DISPATCH_6_NS_ID_AVX512VPOPCNTDQ,                              \
+        SIMDPP_DISPATCH_6_NS_ID_AVX512IFMA,                                   \
+        SIMDPP_DISPATCH_6_NS_ID_AVX512CD,                                     \
         SIMDPP_DISPATCH_6_NS_ID_FMA3,                                         \
         SIMDPP_DISPATCH_6_NS_ID_FMA4,                                         \
         SIMDPP_DISPATCH_6_NS_ID_XOP,                                          \
@@ -1055,6 +1523,71 @@
     #else
     #define SIMDPP_DISPATCH_7_NS_ID_AVX512VL
     #endif
+    #if SIMDPP_ARCH_PP_NS_USE_BMI1
+    #define SIMDPP_DISPATCH_7_NS_ID_BMI1 SIMDPP_INSN_ID_BMI1
+    #else
+    #define SIMDPP_DISPATCH_7_NS_ID_BMI1
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_BMI2
+    #define SIMDPP_DISPATCH_7_NS_ID_BMI2 SIMDPP_INSN_ID_BMI2
+    #else
+    #define SIMDPP_DISPATCH_7_NS_ID_BMI2
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_F16C
+    #define SIMDPP_DISPATCH_7_NS_ID_F16C SIMDPP_INSN_ID_F16C
+    #else
+    #define SIMDPP_DISPATCH_7_NS_ID_F16C
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_GFNI
+    #define SIMDPP_DISPATCH_7_NS_ID_GFNI SIMDPP_INSN_ID_GFNI
+    #else
+    #define SIMDPP_DISPATCH_7_NS_ID_GFNI
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_VAES
+    #define SIMDPP_DISPATCH_7_NS_ID_VAES SIMDPP_INSN_ID_VAES
+    #else
+    #define SIMDPP_DISPATCH_7_NS_ID_VAES
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_VPCLMULQDQ
+    #define SIMDPP_DISPATCH_7_NS_ID_VPCLMULQDQ SIMDPP_INSN_ID_VPCLMULQDQ
+    #else
+    #define SIMDPP_DISPATCH_7_NS_ID_VPCLMULQDQ
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_AVX512VBMI
+    #define SIMDPP_DISPATCH_7_NS_ID_AVX512VBMI SIMDPP_INSN_ID_AVX512VBMI
+    #else
+    #define SIMDPP_DISPATCH_7_NS_ID_AVX512VBMI
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_AVX512VBMI2
+    #define SIMDPP_DISPATCH_7_NS_ID_AVX512VBMI2 SIMDPP_INSN_ID_AVX512VBMI2
+    #else
+    #define SIMDPP_DISPATCH_7_NS_ID_AVX512VBMI2
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_AVX512VNNI
+    #define SIMDPP_DISPATCH_7_NS_ID_AVX512VNNI SIMDPP_INSN_ID_AVX512VNNI
+    #else
+    #define SIMDPP_DISPATCH_7_NS_ID_AVX512VNNI
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_AVX512BITALG
+    #define SIMDPP_DISPATCH_7_NS_ID_AVX512BITALG SIMDPP_INSN_ID_AVX512BITALG
+    #else
+    #define SIMDPP_DISPATCH_7_NS_ID_AVX512BITALG
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_AVX512VPOPCNTDQ
+    #define SIMDPP_DISPATCH_7_NS_ID_AVX512VPOPCNTDQ SIMDPP_INSN_ID_AVX512VPOPCNTDQ
+    #else
+    #define SIMDPP_DISPATCH_7_NS_ID_AVX512VPOPCNTDQ
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_AVX512IFMA
+    #define SIMDPP_DISPATCH_7_NS_ID_AVX512IFMA SIMDPP_INSN_ID_AVX512IFMA
+    #else
+    #define SIMDPP_DISPATCH_7_NS_ID_AVX512IFMA
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_AVX512CD
+    #define SIMDPP_DISPATCH_7_NS_ID_AVX512CD SIMDPP_INSN_ID_AVX512CD
+    #else
+    #define SIMDPP_DISPATCH_7_NS_ID_AVX512CD
+    #endif
     #if SIMDPP_ARCH_PP_NS_USE_NEON
     #define SIMDPP_DISPATCH_7_NS_ID_NEON SIMDPP_INSN_ID_NEON
     #else
@@ -1086,7 +1619,7 @@
     #define SIMDPP_DISPATCH_7_NS_ID_VSX_207
     #endif
 
-    #define SIMDPP_DISPATCH_7_NAMESPACE SIMDPP_PP_PASTE22(arch,               \
+    #define SIMDPP_DISPATCH_7_NAMESPACE SIMDPP_PP_PASTE35(arch,               \
         SIMDPP_DISPATCH_7_NS_ID_NULL,                                         \
         SIMDPP_DISPATCH_7_NS_ID_SSE2,                                         \
         SIMDPP_DISPATCH_7_NS_ID_SSE3,                                         \
@@ -1099,6 +1632,19 @@
         SIMDPP_DISPATCH_7_NS_ID_AVX512BW,                                     \
         SIMDPP_DISPATCH_7_NS_ID_AVX512DQ,                                     \
         SIMDPP_DISPATCH_7_NS_ID_AVX512VL,                                     \
+        SIMDPP_DISPATCH_7_NS_ID_BMI1,                                         \
+        SIMDPP_DISPATCH_7_NS_ID_BMI2,                                         \
+        SIMDPP_DISPATCH_7_NS_ID_F16C,                                         \
+        SIMDPP_DISPATCH_7_NS_ID_GFNI,                                         \
+        SIMDPP_DISPATCH_7_NS_ID_VAES,                                         \
+        SIMDPP_DISPATCH_7_NS_ID_VPCLMULQDQ,                                   \
+        SIMDPP_DISPATCH_7_NS_ID_AVX512VBMI,                                   \
+        SIMDPP_DISPATCH_7_NS_ID_AVX512VBMI2,                                  \
+        SIMDPP_DISPATCH_7_NS_ID_AVX512VNNI,                                   \
+        SIMDPP_DISPATCH_7_NS_ID_AVX512BITALG,                                 \
+        SIMDPP_DISPATCH_7_NS_ID_AVX512VPOPCNTDQ,                              \
+        SIMDPP_DISPATCH_7_NS_ID_AVX512IFMA,                                   \
+        SIMDPP_DISPATCH_7_NS_ID_AVX512CD,                                     \
         SIMDPP_DISPATCH_7_NS_ID_FMA3,                                         \
         SIMDPP_DISPATCH_7_NS_ID_FMA4,                                         \
         SIMDPP_DISPATCH_7_NS_ID_XOP,                                          \
@@ -1213,6 +1759,71 @@
     #else
     #define SIMDPP_DISPATCH_8_NS_ID_AVX512VL
     #endif
+    #if SIMDPP_ARCH_PP_NS_USE_BMI1
+    #define SIMDPP_DISPATCH_8_NS_ID_BMI1 SIMDPP_INSN_ID_BMI1
+    #else
+    #define SIMDPP_DISPATCH_8_NS_ID_BMI1
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_BMI2
+    #define SIMDPP_DISPATCH_8_NS_ID_BMI2 SIMDPP_INSN_ID_BMI2
+    #else
+    #define SIMDPP_DISPATCH_8_NS_ID_BMI2
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_F16C
+    #define SIMDPP_DISPATCH_8_NS_ID_F16C SIMDPP_INSN_ID_F16C
+    #else
+    #define SIMDPP_DISPATCH_8_NS_ID_F16C
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_GFNI
+    #define SIMDPP_DISPATCH_8_NS_ID_GFNI SIMDPP_INSN_ID_GFNI
+    #else
+    #define SIMDPP_DISPATCH_8_NS_ID_GFNI
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_VAES
+    #define SIMDPP_DISPATCH_8_NS_ID_VAES SIMDPP_INSN_ID_VAES
+    #else
+    #define SIMDPP_DISPATCH_8_NS_ID_VAES
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_VPCLMULQDQ
+    #define SIMDPP_DISPATCH_8_NS_ID_VPCLMULQDQ SIMDPP_INSN_ID_VPCLMULQDQ
+    #else
+    #define SIMDPP_DISPATCH_8_NS_ID_VPCLMULQDQ
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_AVX512VBMI
+    #define SIMDPP_DISPATCH_8_NS_ID_AVX512VBMI SIMDPP_INSN_ID_AVX512VBMI
+    #else
+    #define SIMDPP_DISPATCH_8_NS_ID_AVX512VBMI
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_AVX512VBMI2
+    #define SIMDPP_DISPATCH_8_NS_ID_AVX512VBMI2 SIMDPP_INSN_ID_AVX512VBMI2
+    #else
+    #define SIMDPP_DISPATCH_8_NS_ID_AVX512VBMI2
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_AVX512VNNI
+    #define SIMDPP_DISPATCH_8_NS_ID_AVX512VNNI SIMDPP_INSN_ID_AVX512VNNI
+    #else
+    #define SIMDPP_DISPATCH_8_NS_ID_AVX512VNNI
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_AVX512BITALG
+    #define SIMDPP_DISPATCH_8_NS_ID_AVX512BITALG SIMDPP_INSN_ID_AVX512BITALG
+    #else
+    #define SIMDPP_DISPATCH_8_NS_ID_AVX512BITALG
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_AVX512VPOPCNTDQ
+    #define SIMDPP_DISPATCH_8_NS_ID_AVX512VPOPCNTDQ SIMDPP_INSN_ID_AVX512VPOPCNTDQ
+    #else
+    #define SIMDPP_DISPATCH_8_NS_ID_AVX512VPOPCNTDQ
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_AVX512IFMA
+    #define SIMDPP_DISPATCH_8_NS_ID_AVX512IFMA SIMDPP_INSN_ID_AVX512IFMA
+    #else
+    #define SIMDPP_DISPATCH_8_NS_ID_AVX512IFMA
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_AVX512CD
+    #define SIMDPP_DISPATCH_8_NS_ID_AVX512CD SIMDPP_INSN_ID_AVX512CD
+    #else
+    #define SIMDPP_DISPATCH_8_NS_ID_AVX512CD
+    #endif
     #if SIMDPP_ARCH_PP_NS_USE_NEON
     #define SIMDPP_DISPATCH_8_NS_ID_NEON SIMDPP_INSN_ID_NEON
     #else
@@ -1244,7 +1855,7 @@
     #define SIMDPP_DISPATCH_8_NS_ID_VSX_207
     #endif
 
-    #define SIMDPP_DISPATCH_8_NAMESPACE SIMDPP_PP_PASTE22(arch,               \
+    #define SIMDPP_DISPATCH_8_NAMESPACE SIMDPP_PP_PASTE35(arch,               \
         SIMDPP_DISPATCH_8_NS_ID_NULL,                                         \
         SIMDPP_DISPATCH_8_NS_ID_SSE2,                                         \
         SIMDPP_DISPATCH_8_NS_ID_SSE3,                                         \
@@ -1257,6 +1868,19 @@
         SIMDPP_DISPATCH_8_NS_ID_AVX512BW,                                     \
         SIMDPP_DISPATCH_8_NS_ID_AVX512DQ,                                     \
         SIMDPP_DISPATCH_8_NS_ID_AVX512VL,                                     \
+        SIMDPP_DISPATCH_8_NS_ID_BMI1,                                         \
+        SIMDPP_DISPATCH_8_NS_ID_BMI2,                                         \
+        SIMDPP_DISPATCH_8_NS_ID_F16C,                                         \
+        SIMDPP_DISPATCH_8_NS_ID_GFNI,                                         \
+        SIMDPP_DISPATCH_8_NS_ID_VAES,                                         \
+        SIMDPP_DISPATCH_8_NS_ID_VPCLMULQDQ,                                   \
+        SIMDPP_DISPATCH_8_NS_ID_AVX512VBMI,                                   \
+        SIMDPP_DISPATCH_8_NS_ID_AVX512VBMI2,                                  \
+        SIMDPP_DISPATCH_8_NS_ID_AVX512VNNI,                                   \
+        SIMDPP_DISPATCH_8_NS_ID_AVX512BITALG,                                 \
+        SIMDPP_DISPATCH_8_NS_ID_AVX512VPOPCNTDQ,                              \
+        SIMDPP_DISPATCH_8_NS_ID_AVX512IFMA,                                   \
+        SIMDPP_DISPATCH_8_NS_ID_AVX512CD,                                     \
         SIMDPP_DISPATCH_8_NS_ID_FMA3,                                         \
         SIMDPP_DISPATCH_8_NS_ID_FMA4,                                         \
         SIMDPP_DISPATCH_8_NS_ID_XOP,                                          \
@@ -1371,6 +1995,71 @@
     #else
     #define SIMDPP_DISPATCH_9_NS_ID_AVX512VL
     #endif
+    #if SIMDPP_ARCH_PP_NS_USE_BMI1
+    #define SIMDPP_DISPATCH_9_NS_ID_BMI1 SIMDPP_INSN_ID_BMI1
+    #else
+    #define SIMDPP_DISPATCH_9_NS_ID_BMI1
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_BMI2
+    #define SIMDPP_DISPATCH_9_NS_ID_BMI2 SIMDPP_INSN_ID_BMI2
+    #else
+    #define SIMDPP_DISPATCH_9_NS_ID_BMI2
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_F16C
+    #define SIMDPP_DISPATCH_9_NS_ID_F16C SIMDPP_INSN_ID_F16C
+    #else
+    #define SIMDPP_DISPATCH_9_NS_ID_F16C
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_GFNI
+    #define SIMDPP_DISPATCH_9_NS_ID_GFNI SIMDPP_INSN_ID_GFNI
+    #else
+    #define SIMDPP_DISPATCH_9_NS_ID_GFNI
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_VAES
+    #define SIMDPP_DISPATCH_9_NS_ID_VAES SIMDPP_INSN_ID_VAES
+    #else
+    #define SIMDPP_DISPATCH_9_NS_ID_VAES
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_VPCLMULQDQ
+    #define SIMDPP_DISPATCH_9_NS_ID_VPCLMULQDQ SIMDPP_INSN_ID_VPCLMULQDQ
+    #else
+    #define SIMDPP_DISPATCH_9_NS_ID_VPCLMULQDQ
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_AVX512VBMI
+    #define SIMDPP_DISPATCH_9_NS_ID_AVX512VBMI SIMDPP_INSN_ID_AVX512VBMI
+    #else
+    #define SIMDPP_DISPATCH_9_NS_ID_AVX512VBMI
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_AVX512VBMI2
+    #define SIMDPP_DISPATCH_9_NS_ID_AVX512VBMI2 SIMDPP_INSN_ID_AVX512VBMI2
+    #else
+    #define SIMDPP_DISPATCH_9_NS_ID_AVX512VBMI2
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_AVX512VNNI
+    #define SIMDPP_DISPATCH_9_NS_ID_AVX512VNNI SIMDPP_INSN_ID_AVX512VNNI
+    #else
+    #define SIMDPP_DISPATCH_9_NS_ID_AVX512VNNI
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_AVX512BITALG
+    #define SIMDPP_DISPATCH_9_NS_ID_AVX512BITALG SIMDPP_INSN_ID_AVX512BITALG
+    #else
+    #define SIMDPP_DISPATCH_9_NS_ID_AVX512BITALG
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_AVX512VPOPCNTDQ
+    #define SIMDPP_DISPATCH_9_NS_ID_AVX512VPOPCNTDQ SIMDPP_INSN_ID_AVX512VPOPCNTDQ
+    #else
+    #define SIMDPP_DISPATCH_9_NS_ID_AVX512VPOPCNTDQ
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_AVX512IFMA
+    #define SIMDPP_DISPATCH_9_NS_ID_AVX512IFMA SIMDPP_INSN_ID_AVX512IFMA
+    #else
+    #define SIMDPP_DISPATCH_9_NS_ID_AVX512IFMA
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_AVX512CD
+    #define SIMDPP_DISPATCH_9_NS_ID_AVX512CD SIMDPP_INSN_ID_AVX512CD
+    #else
+    #define SIMDPP_DISPATCH_9_NS_ID_AVX512CD
+    #endif
     #if SIMDPP_ARCH_PP_NS_USE_NEON
     #define SIMDPP_DISPATCH_9_NS_ID_NEON SIMDPP_INSN_ID_NEON
     #else
@@ -1402,7 +2091,7 @@
     #define SIMDPP_DISPATCH_9_NS_ID_VSX_207
     #endif
 
-    #define SIMDPP_DISPATCH_9_NAMESPACE SIMDPP_PP_PASTE22(arch,               \
+    #define SIMDPP_DISPATCH_9_NAMESPACE SIMDPP_PP_PASTE35(arch,               \
         SIMDPP_DISPATCH_9_NS_ID_NULL,                                         \
         SIMDPP_DISPATCH_9_NS_ID_SSE2,                                         \
         SIMDPP_DISPATCH_9_NS_ID_SSE3,                                         \
@@ -1415,6 +2104,19 @@
         SIMDPP_DISPATCH_9_NS_ID_AVX512BW,                                     \
         SIMDPP_DISPATCH_9_NS_ID_AVX512DQ,                                     \
         SIMDPP_DISPATCH_9_NS_ID_AVX512VL,                                     \
+        SIMDPP_DISPATCH_9_NS_ID_BMI1,                                         \
+        SIMDPP_DISPATCH_9_NS_ID_BMI2,                                         \
+        SIMDPP_DISPATCH_9_NS_ID_F16C,                                         \
+        SIMDPP_DISPATCH_9_NS_ID_GFNI,                                         \
+        SIMDPP_DISPATCH_9_NS_ID_VAES,                                         \
+        SIMDPP_DISPATCH_9_NS_ID_VPCLMULQDQ,                                   \
+        SIMDPP_DISPATCH_9_NS_ID_AVX512VBMI,                                   \
+        SIMDPP_DISPATCH_9_NS_ID_AVX512VBMI2,                                  \
+        SIMDPP_DISPATCH_9_NS_ID_AVX512VNNI,                                   \
+        SIMDPP_DISPATCH_9_NS_ID_AVX512BITALG,                                 \
+        SIMDPP_DISPATCH_9_NS_ID_AVX512VPOPCNTDQ,                              \
+        SIMDPP_DISPATCH_9_NS_ID_AVX512IFMA,                                   \
+        SIMDPP_DISPATCH_9_NS_ID_AVX512CD,                                     \
         SIMDPP_DISPATCH_9_NS_ID_FMA3,                                         \
         SIMDPP_DISPATCH_9_NS_ID_FMA4,                                         \
         SIMDPP_DISPATCH_9_NS_ID_XOP,                                          \
@@ -1529,6 +2231,71 @@
     #else
     #define SIMDPP_DISPATCH_10_NS_ID_AVX512VL
     #endif
+    #if SIMDPP_ARCH_PP_NS_USE_BMI1
+    #define SIMDPP_DISPATCH_10_NS_ID_BMI1 SIMDPP_INSN_ID_BMI1
+    #else
+    #define SIMDPP_DISPATCH_10_NS_ID_BMI1
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_BMI2
+    #define SIMDPP_DISPATCH_10_NS_ID_BMI2 SIMDPP_INSN_ID_BMI2
+    #else
+    #define SIMDPP_DISPATCH_10_NS_ID_BMI2
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_F16C
+    #define SIMDPP_DISPATCH_10_NS_ID_F16C SIMDPP_INSN_ID_F16C
+    #else
+    #define SIMDPP_DISPATCH_10_NS_ID_F16C
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_GFNI
+    #define SIMDPP_DISPATCH_10_NS_ID_GFNI SIMDPP_INSN_ID_GFNI
+    #else
+    #define SIMDPP_DISPATCH_10_NS_ID_GFNI
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_VAES
+    #define SIMDPP_DISPATCH_10_NS_ID_VAES SIMDPP_INSN_ID_VAES
+    #else
+    #define SIMDPP_DISPATCH_10_NS_ID_VAES
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_VPCLMULQDQ
+    #define SIMDPP_DISPATCH_10_NS_ID_VPCLMULQDQ SIMDPP_INSN_ID_VPCLMULQDQ
+    #else
+    #define SIMDPP_DISPATCH_10_NS_ID_VPCLMULQDQ
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_AVX512VBMI
+    #define SIMDPP_DISPATCH_10_NS_ID_AVX512VBMI SIMDPP_INSN_ID_AVX512VBMI
+    #else
+    #define SIMDPP_DISPATCH_10_NS_ID_AVX512VBMI
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_AVX512VBMI2
+    #define SIMDPP_DISPATCH_10_NS_ID_AVX512VBMI2 SIMDPP_INSN_ID_AVX512VBMI2
+    #else
+    #define SIMDPP_DISPATCH_10_NS_ID_AVX512VBMI2
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_AVX512VNNI
+    #define SIMDPP_DISPATCH_10_NS_ID_AVX512VNNI SIMDPP_INSN_ID_AVX512VNNI
+    #else
+    #define SIMDPP_DISPATCH_10_NS_ID_AVX512VNNI
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_AVX512BITALG
+    #define SIMDPP_DISPATCH_10_NS_ID_AVX512BITALG SIMDPP_INSN_ID_AVX512BITALG
+    #else
+    #define SIMDPP_DISPATCH_10_NS_ID_AVX512BITALG
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_AVX512VPOPCNTDQ
+    #define SIMDPP_DISPATCH_10_NS_ID_AVX512VPOPCNTDQ SIMDPP_INSN_ID_AVX512VPOPCNTDQ
+    #else
+    #define SIMDPP_DISPATCH_10_NS_ID_AVX512VPOPCNTDQ
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_AVX512IFMA
+    #define SIMDPP_DISPATCH_10_NS_ID_AVX512IFMA SIMDPP_INSN_ID_AVX512IFMA
+    #else
+    #define SIMDPP_DISPATCH_10_NS_ID_AVX512IFMA
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_AVX512CD
+    #define SIMDPP_DISPATCH_10_NS_ID_AVX512CD SIMDPP_INSN_ID_AVX512CD
+    #else
+    #define SIMDPP_DISPATCH_10_NS_ID_AVX512CD
+    #endif
     #if SIMDPP_ARCH_PP_NS_USE_NEON
     #define SIMDPP_DISPATCH_10_NS_ID_NEON SIMDPP_INSN_ID_NEON
     #else
@@ -1560,7 +2327,7 @@
     #define SIMDPP_DISPATCH_10_NS_ID_VSX_207
     #endif
 
-    #define SIMDPP_DISPATCH_10_NAMESPACE SIMDPP_PP_PASTE22(arch,              \
+    #define SIMDPP_DISPATCH_10_NAMESPACE SIMDPP_PP_PASTE35(arch,              \
         SIMDPP_DISPATCH_10_NS_ID_NULL,                                        \
         SIMDPP_DISPATCH_10_NS_ID_SSE2,                                        \
         SIMDPP_DISPATCH_10_NS_ID_SSE3,                                        \
@@ -1573,6 +2340,19 @@
         SIMDPP_DISPATCH_10_NS_ID_AVX512BW,                                    \
         SIMDPP_DISPATCH_10_NS_ID_AVX512DQ,                                    \
         SIMDPP_DISPATCH_10_NS_ID_AVX512VL,                                    \
+        SIMDPP_DISPATCH_10_NS_ID_BMI1,                                        \
+        SIMDPP_DISPATCH_10_NS_ID_BMI2,                                        \
+        SIMDPP_DISPATCH_10_NS_ID_F16C,                                        \
+        SIMDPP_DISPATCH_10_NS_ID_GFNI,                                        \
+        SIMDPP_DISPATCH_10_NS_ID_VAES,                                        \
+        SIMDPP_DISPATCH_10_NS_ID_VPCLMULQDQ,                                  \
+        SIMDPP_DISPATCH_10_NS_ID_AVX512VBMI,                                  \
+        SIMDPP_DISPATCH_10_NS_ID_AVX512VBMI2,                                 \
+        SIMDPP_DISPATCH_10_NS_ID_AVX512VNNI,                                  \
+        SIMDPP_DISPATCH_10_NS_ID_AVX512BITALG,                                \
+        SIMDPP_DISPATCH_10_NS_ID_AVX512VPOPCNTDQ,                             \
+        SIMDPP_DISPATCH_10_NS_ID_AVX512IFMA,                                  \
+        SIMDPP_DISPATCH_10_NS_ID_AVX512CD,                                    \
         SIMDPP_DISPATCH_10_NS_ID_FMA3,                                        \
         SIMDPP_DISPATCH_10_NS_ID_FMA4,                                        \
         SIMDPP_DISPATCH_10_NS_ID_XOP,                                         \
@@ -1687,6 +2467,71 @@
     #else
     #define SIMDPP_DISPATCH_11_NS_ID_AVX512VL
     #endif
+    #if SIMDPP_ARCH_PP_NS_USE_BMI1
+    #define SIMDPP_DISPATCH_11_NS_ID_BMI1 SIMDPP_INSN_ID_BMI1
+    #else
+    #define SIMDPP_DISPATCH_11_NS_ID_BMI1
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_BMI2
+    #define SIMDPP_DISPATCH_11_NS_ID_BMI2 SIMDPP_INSN_ID_BMI2
+    #else
+    #define SIMDPP_DISPATCH_11_NS_ID_BMI2
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_F16C
+    #define SIMDPP_DISPATCH_11_NS_ID_F16C SIMDPP_INSN_ID_F16C
+    #else
+    #define SIMDPP_DISPATCH_11_NS_ID_F16C
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_GFNI
+    #define SIMDPP_DISPATCH_11_NS_ID_GFNI SIMDPP_INSN_ID_GFNI
+    #else
+    #define SIMDPP_DISPATCH_11_NS_ID_GFNI
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_VAES
+    #define SIMDPP_DISPATCH_11_NS_ID_VAES SIMDPP_INSN_ID_VAES
+    #else
+    #define SIMDPP_DISPATCH_11_NS_ID_VAES
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_VPCLMULQDQ
+    #define SIMDPP_DISPATCH_11_NS_ID_VPCLMULQDQ SIMDPP_INSN_ID_VPCLMULQDQ
+    #else
+    #define SIMDPP_DISPATCH_11_NS_ID_VPCLMULQDQ
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_AVX512VBMI
+    #define SIMDPP_DISPATCH_11_NS_ID_AVX512VBMI SIMDPP_INSN_ID_AVX512VBMI
+    #else
+    #define SIMDPP_DISPATCH_11_NS_ID_AVX512VBMI
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_AVX512VBMI2
+    #define SIMDPP_DISPATCH_11_NS_ID_AVX512VBMI2 SIMDPP_INSN_ID_AVX512VBMI2
+    #else
+    #define SIMDPP_DISPATCH_11_NS_ID_AVX512VBMI2
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_AVX512VNNI
+    #define SIMDPP_DISPATCH_11_NS_ID_AVX512VNNI SIMDPP_INSN_ID_AVX512VNNI
+    #else
+    #define SIMDPP_DISPATCH_11_NS_ID_AVX512VNNI
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_AVX512BITALG
+    #define SIMDPP_DISPATCH_11_NS_ID_AVX512BITALG SIMDPP_INSN_ID_AVX512BITALG
+    #else
+    #define SIMDPP_DISPATCH_11_NS_ID_AVX512BITALG
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_AVX512VPOPCNTDQ
+    #define SIMDPP_DISPATCH_11_NS_ID_AVX512VPOPCNTDQ SIMDPP_INSN_ID_AVX512VPOPCNTDQ
+    #else
+    #define SIMDPP_DISPATCH_11_NS_ID_AVX512VPOPCNTDQ
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_AVX512IFMA
+    #define SIMDPP_DISPATCH_11_NS_ID_AVX512IFMA SIMDPP_INSN_ID_AVX512IFMA
+    #else
+    #define SIMDPP_DISPATCH_11_NS_ID_AVX512IFMA
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_AVX512CD
+    #define SIMDPP_DISPATCH_11_NS_ID_AVX512CD SIMDPP_INSN_ID_AVX512CD
+    #else
+    #define SIMDPP_DISPATCH_11_NS_ID_AVX512CD
+    #endif
     #if SIMDPP_ARCH_PP_NS_USE_NEON
     #define SIMDPP_DISPATCH_11_NS_ID_NEON SIMDPP_INSN_ID_NEON
     #else
@@ -1718,7 +2563,7 @@
     #define SIMDPP_DISPATCH_11_NS_ID_VSX_207
     #endif
 
-    #define SIMDPP_DISPATCH_11_NAMESPACE SIMDPP_PP_PASTE22(arch,              \
+    #define SIMDPP_DISPATCH_11_NAMESPACE SIMDPP_PP_PASTE35(arch,              \
         SIMDPP_DISPATCH_11_NS_ID_NULL,                                        \
         SIMDPP_DISPATCH_11_NS_ID_SSE2,                                        \
         SIMDPP_DISPATCH_11_NS_ID_SSE3,                                        \
@@ -1731,6 +2576,19 @@
         SIMDPP_DISPATCH_11_NS_ID_AVX512BW,                                    \
         SIMDPP_DISPATCH_11_NS_ID_AVX512DQ,                                    \
         SIMDPP_DISPATCH_11_NS_ID_AVX512VL,                                    \
+        SIMDPP_DISPATCH_11_NS_ID_BMI1,                                        \
+        SIMDPP_DISPATCH_11_NS_ID_BMI2,                                        \
+        SIMDPP_DISPATCH_11_NS_ID_F16C,                                        \
+        SIMDPP_DISPATCH_11_NS_ID_GFNI,                                        \
+        SIMDPP_DISPATCH_11_NS_ID_VAES,                                        \
+        SIMDPP_DISPATCH_11_NS_ID_VPCLMULQDQ,                                  \
+        SIMDPP_DISPATCH_11_NS_ID_AVX512VBMI,                                  \
+        SIMDPP_DISPATCH_11_NS_ID_AVX512VBMI2,                                 \
+        SIMDPP_DISPATCH_11_NS_ID_AVX512VNNI,                                  \
+        SIMDPP_DISPATCH_11_NS_ID_AVX512BITALG,                                \
+        SIMDPP_DISPATCH_11_NS_ID_AVX512VPOPCNTDQ,                             \
+        SIMDPP_DISPATCH_11_NS_ID_AVX512IFMA,                                  \
+        SIMDPP_DISPATCH_11_NS_ID_AVX512CD,                                    \
         SIMDPP_DISPATCH_11_NS_ID_FMA3,                                        \
         SIMDPP_DISPATCH_11_NS_ID_FMA4,                                        \
         SIMDPP_DISPATCH_11_NS_ID_XOP,                                         \
@@ -1845,6 +2703,71 @@
     #else
     #define SIMDPP_DISPATCH_12_NS_ID_AVX512VL
     #endif
+    #if SIMDPP_ARCH_PP_NS_USE_BMI1
+    #define SIMDPP_DISPATCH_12_NS_ID_BMI1 SIMDPP_INSN_ID_BMI1
+    #else
+    #define SIMDPP_DISPATCH_12_NS_ID_BMI1
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_BMI2
+    #define SIMDPP_DISPATCH_12_NS_ID_BMI2 SIMDPP_INSN_ID_BMI2
+    #else
+    #define SIMDPP_DISPATCH_12_NS_ID_BMI2
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_F16C
+    #define SIMDPP_DISPATCH_12_NS_ID_F16C SIMDPP_INSN_ID_F16C
+    #else
+    #define SIMDPP_DISPATCH_12_NS_ID_F16C
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_GFNI
+    #define SIMDPP_DISPATCH_12_NS_ID_GFNI SIMDPP_INSN_ID_GFNI
+    #else
+    #define SIMDPP_DISPATCH_12_NS_ID_GFNI
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_VAES
+    #define SIMDPP_DISPATCH_12_NS_ID_VAES SIMDPP_INSN_ID_VAES
+    #else
+    #define SIMDPP_DISPATCH_12_NS_ID_VAES
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_VPCLMULQDQ
+    #define SIMDPP_DISPATCH_12_NS_ID_VPCLMULQDQ SIMDPP_INSN_ID_VPCLMULQDQ
+    #else
+    #define SIMDPP_DISPATCH_12_NS_ID_VPCLMULQDQ
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_AVX512VBMI
+    #define SIMDPP_DISPATCH_12_NS_ID_AVX512VBMI SIMDPP_INSN_ID_AVX512VBMI
+    #else
+    #define SIMDPP_DISPATCH_12_NS_ID_AVX512VBMI
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_AVX512VBMI2
+    #define SIMDPP_DISPATCH_12_NS_ID_AVX512VBMI2 SIMDPP_INSN_ID_AVX512VBMI2
+    #else
+    #define SIMDPP_DISPATCH_12_NS_ID_AVX512VBMI2
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_AVX512VNNI
+    #define SIMDPP_DISPATCH_12_NS_ID_AVX512VNNI SIMDPP_INSN_ID_AVX512VNNI
+    #else
+    #define SIMDPP_DISPATCH_12_NS_ID_AVX512VNNI
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_AVX512BITALG
+    #define SIMDPP_DISPATCH_12_NS_ID_AVX512BITALG SIMDPP_INSN_ID_AVX512BITALG
+    #else
+    #define SIMDPP_DISPATCH_12_NS_ID_AVX512BITALG
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_AVX512VPOPCNTDQ
+    #define SIMDPP_DISPATCH_12_NS_ID_AVX512VPOPCNTDQ SIMDPP_INSN_ID_AVX512VPOPCNTDQ
+    #else
+    #define SIMDPP_DISPATCH_12_NS_ID_AVX512VPOPCNTDQ
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_AVX512IFMA
+    #define SIMDPP_DISPATCH_12_NS_ID_AVX512IFMA SIMDPP_INSN_ID_AVX512IFMA
+    #else
+    #define SIMDPP_DISPATCH_12_NS_ID_AVX512IFMA
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_AVX512CD
+    #define SIMDPP_DISPATCH_12_NS_ID_AVX512CD SIMDPP_INSN_ID_AVX512CD
+    #else
+    #define SIMDPP_DISPATCH_12_NS_ID_AVX512CD
+    #endif
     #if SIMDPP_ARCH_PP_NS_USE_NEON
     #define SIMDPP_DISPATCH_12_NS_ID_NEON SIMDPP_INSN_ID_NEON
     #else
@@ -1876,7 +2799,7 @@
     #define SIMDPP_DISPATCH_12_NS_ID_VSX_207
     #endif
 
-    #define SIMDPP_DISPATCH_12_NAMESPACE SIMDPP_PP_PASTE22(arch,              \
+    #define SIMDPP_DISPATCH_12_NAMESPACE SIMDPP_PP_PASTE35(arch,              \
         SIMDPP_DISPATCH_12_NS_ID_NULL,                                        \
         SIMDPP_DISPATCH_12_NS_ID_SSE2,                                        \
         SIMDPP_DISPATCH_12_NS_ID_SSE3,                                        \
@@ -1889,6 +2812,19 @@
         SIMDPP_DISPATCH_12_NS_ID_AVX512BW,                                    \
         SIMDPP_DISPATCH_12_NS_ID_AVX512DQ,                                    \
         SIMDPP_DISPATCH_12_NS_ID_AVX512VL,                                    \
+        SIMDPP_DISPATCH_12_NS_ID_BMI1,                                        \
+        SIMDPP_DISPATCH_12_NS_ID_BMI2,                                        \
+        SIMDPP_DISPATCH_12_NS_ID_F16C,                                        \
+        SIMDPP_DISPATCH_12_NS_ID_GFNI,                                        \
+        SIMDPP_DISPATCH_12_NS_ID_VAES,                                        \
+        SIMDPP_DISPATCH_12_NS_ID_VPCLMULQDQ,                                  \
+        SIMDPP_DISPATCH_12_NS_ID_AVX512VBMI,                                  \
+        SIMDPP_DISPATCH_12_NS_ID_AVX512VBMI2,                                 \
+        SIMDPP_DISPATCH_12_NS_ID_AVX512VNNI,                                  \
+        SIMDPP_DISPATCH_12_NS_ID_AVX512BITALG,                                \
+        SIMDPP_DISPATCH_12_NS_ID_AVX512VPOPCNTDQ,                             \
+        SIMDPP_DISPATCH_12_NS_ID_AVX512IFMA,                                  \
+        SIMDPP_DISPATCH_12_NS_ID_AVX512CD,                                    \
         SIMDPP_DISPATCH_12_NS_ID_FMA3,                                        \
         SIMDPP_DISPATCH_12_NS_ID_FMA4,                                        \
         SIMDPP_DISPATCH_12_NS_ID_XOP,                                         \
@@ -2003,6 +2939,71 @@
     #else
     #define SIMDPP_DISPATCH_13_NS_ID_AVX512VL
     #endif
+    #if SIMDPP_ARCH_PP_NS_USE_BMI1
+    #define SIMDPP_DISPATCH_13_NS_ID_BMI1 SIMDPP_INSN_ID_BMI1
+    #else
+    #define SIMDPP_DISPATCH_13_NS_ID_BMI1
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_BMI2
+    #define SIMDPP_DISPATCH_13_NS_ID_BMI2 SIMDPP_INSN_ID_BMI2
+    #else
+    #define SIMDPP_DISPATCH_13_NS_ID_BMI2
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_F16C
+    #define SIMDPP_DISPATCH_13_NS_ID_F16C SIMDPP_INSN_ID_F16C
+    #else
+    #define SIMDPP_DISPATCH_13_NS_ID_F16C
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_GFNI
+    #define SIMDPP_DISPATCH_13_NS_ID_GFNI SIMDPP_INSN_ID_GFNI
+    #else
+    #define SIMDPP_DISPATCH_13_NS_ID_GFNI
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_VAES
+    #define SIMDPP_DISPATCH_13_NS_ID_VAES SIMDPP_INSN_ID_VAES
+    #else
+    #define SIMDPP_DISPATCH_13_NS_ID_VAES
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_VPCLMULQDQ
+    #define SIMDPP_DISPATCH_13_NS_ID_VPCLMULQDQ SIMDPP_INSN_ID_VPCLMULQDQ
+    #else
+    #define SIMDPP_DISPATCH_13_NS_ID_VPCLMULQDQ
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_AVX512VBMI
+    #define SIMDPP_DISPATCH_13_NS_ID_AVX512VBMI SIMDPP_INSN_ID_AVX512VBMI
+    #else
+    #define SIMDPP_DISPATCH_13_NS_ID_AVX512VBMI
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_AVX512VBMI2
+    #define SIMDPP_DISPATCH_13_NS_ID_AVX512VBMI2 SIMDPP_INSN_ID_AVX512VBMI2
+    #else
+    #define SIMDPP_DISPATCH_13_NS_ID_AVX512VBMI2
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_AVX512VNNI
+    #define SIMDPP_DISPATCH_13_NS_ID_AVX512VNNI SIMDPP_INSN_ID_AVX512VNNI
+    #else
+    #define SIMDPP_DISPATCH_13_NS_ID_AVX512VNNI
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_AVX512BITALG
+    #define SIMDPP_DISPATCH_13_NS_ID_AVX512BITALG SIMDPP_INSN_ID_AVX512BITALG
+    #else
+    #define SIMDPP_DISPATCH_13_NS_ID_AVX512BITALG
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_AVX512VPOPCNTDQ
+    #define SIMDPP_DISPATCH_13_NS_ID_AVX512VPOPCNTDQ SIMDPP_INSN_ID_AVX512VPOPCNTDQ
+    #else
+    #define SIMDPP_DISPATCH_13_NS_ID_AVX512VPOPCNTDQ
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_AVX512IFMA
+    #define SIMDPP_DISPATCH_13_NS_ID_AVX512IFMA SIMDPP_INSN_ID_AVX512IFMA
+    #else
+    #define SIMDPP_DISPATCH_13_NS_ID_AVX512IFMA
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_AVX512CD
+    #define SIMDPP_DISPATCH_13_NS_ID_AVX512CD SIMDPP_INSN_ID_AVX512CD
+    #else
+    #define SIMDPP_DISPATCH_13_NS_ID_AVX512CD
+    #endif
     #if SIMDPP_ARCH_PP_NS_USE_NEON
     #define SIMDPP_DISPATCH_13_NS_ID_NEON SIMDPP_INSN_ID_NEON
     #else
@@ -2034,7 +3035,7 @@
     #define SIMDPP_DISPATCH_13_NS_ID_VSX_207
     #endif
 
-    #define SIMDPP_DISPATCH_13_NAMESPACE SIMDPP_PP_PASTE22(arch,              \
+    #define SIMDPP_DISPATCH_13_NAMESPACE SIMDPP_PP_PASTE35(arch,              \
         SIMDPP_DISPATCH_13_NS_ID_NULL,                                        \
         SIMDPP_DISPATCH_13_NS_ID_SSE2,                                        \
         SIMDPP_DISPATCH_13_NS_ID_SSE3,                                        \
@@ -2047,6 +3048,19 @@
         SIMDPP_DISPATCH_13_NS_ID_AVX512BW,                                    \
         SIMDPP_DISPATCH_13_NS_ID_AVX512DQ,                                    \
         SIMDPP_DISPATCH_13_NS_ID_AVX512VL,                                    \
+        SIMDPP_DISPATCH_13_NS_ID_BMI1,                                        \
+        SIMDPP_DISPATCH_13_NS_ID_BMI2,                                        \
+        SIMDPP_DISPATCH_13_NS_ID_F16C,                                        \
+        SIMDPP_DISPATCH_13_NS_ID_GFNI,                                        \
+        SIMDPP_DISPATCH_13_NS_ID_VAES,                                        \
+        SIMDPP_DISPATCH_13_NS_ID_VPCLMULQDQ,                                  \
+        SIMDPP_DISPATCH_13_NS_ID_AVX512VBMI,                                  \
+        SIMDPP_DISPATCH_13_NS_ID_AVX512VBMI2,                                 \
+        SIMDPP_DISPATCH_13_NS_ID_AVX512VNNI,                                  \
+        SIMDPP_DISPATCH_13_NS_ID_AVX512BITALG,                                \
+        SIMDPP_DISPATCH_13_NS_ID_AVX512VPOPCNTDQ,                             \
+        SIMDPP_DISPATCH_13_NS_ID_AVX512IFMA,                                  \
+        SIMDPP_DISPATCH_13_NS_ID_AVX512CD,                                    \
         SIMDPP_DISPATCH_13_NS_ID_FMA3,                                        \
         SIMDPP_DISPATCH_13_NS_ID_FMA4,                                        \
         SIMDPP_DISPATCH_13_NS_ID_XOP,                                         \
@@ -2161,6 +3175,71 @@
     #else
     #define SIMDPP_DISPATCH_14_NS_ID_AVX512VL
     #endif
+    #if SIMDPP_ARCH_PP_NS_USE_BMI1
+    #define SIMDPP_DISPATCH_14_NS_ID_BMI1 SIMDPP_INSN_ID_BMI1
+    #else
+    #define SIMDPP_DISPATCH_14_NS_ID_BMI1
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_BMI2
+    #define SIMDPP_DISPATCH_14_NS_ID_BMI2 SIMDPP_INSN_ID_BMI2
+    #else
+    #define SIMDPP_DISPATCH_14_NS_ID_BMI2
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_F16C
+    #define SIMDPP_DISPATCH_14_NS_ID_F16C SIMDPP_INSN_ID_F16C
+    #else
+    #define SIMDPP_DISPATCH_14_NS_ID_F16C
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_GFNI
+    #define SIMDPP_DISPATCH_14_NS_ID_GFNI SIMDPP_INSN_ID_GFNI
+    #else
+    #define SIMDPP_DISPATCH_14_NS_ID_GFNI
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_VAES
+    #define SIMDPP_DISPATCH_14_NS_ID_VAES SIMDPP_INSN_ID_VAES
+    #else
+    #define SIMDPP_DISPATCH_14_NS_ID_VAES
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_VPCLMULQDQ
+    #define SIMDPP_DISPATCH_14_NS_ID_VPCLMULQDQ SIMDPP_INSN_ID_VPCLMULQDQ
+    #else
+    #define SIMDPP_DISPATCH_14_NS_ID_VPCLMULQDQ
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_AVX512VBMI
+    #define SIMDPP_DISPATCH_14_NS_ID_AVX512VBMI SIMDPP_INSN_ID_AVX512VBMI
+    #else
+    #define SIMDPP_DISPATCH_14_NS_ID_AVX512VBMI
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_AVX512VBMI2
+    #define SIMDPP_DISPATCH_14_NS_ID_AVX512VBMI2 SIMDPP_INSN_ID_AVX512VBMI2
+    #else
+    #define SIMDPP_DISPATCH_14_NS_ID_AVX512VBMI2
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_AVX512VNNI
+    #define SIMDPP_DISPATCH_14_NS_ID_AVX512VNNI SIMDPP_INSN_ID_AVX512VNNI
+    #else
+    #define SIMDPP_DISPATCH_14_NS_ID_AVX512VNNI
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_AVX512BITALG
+    #define SIMDPP_DISPATCH_14_NS_ID_AVX512BITALG SIMDPP_INSN_ID_AVX512BITALG
+    #else
+    #define SIMDPP_DISPATCH_14_NS_ID_AVX512BITALG
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_AVX512VPOPCNTDQ
+    #define SIMDPP_DISPATCH_14_NS_ID_AVX512VPOPCNTDQ SIMDPP_INSN_ID_AVX512VPOPCNTDQ
+    #else
+    #define SIMDPP_DISPATCH_14_NS_ID_AVX512VPOPCNTDQ
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_AVX512IFMA
+    #define SIMDPP_DISPATCH_14_NS_ID_AVX512IFMA SIMDPP_INSN_ID_AVX512IFMA
+    #else
+    #define SIMDPP_DISPATCH_14_NS_ID_AVX512IFMA
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_AVX512CD
+    #define SIMDPP_DISPATCH_14_NS_ID_AVX512CD SIMDPP_INSN_ID_AVX512CD
+    #else
+    #define SIMDPP_DISPATCH_14_NS_ID_AVX512CD
+    #endif
     #if SIMDPP_ARCH_PP_NS_USE_NEON
     #define SIMDPP_DISPATCH_14_NS_ID_NEON SIMDPP_INSN_ID_NEON
     #else
@@ -2192,7 +3271,7 @@
     #define SIMDPP_DISPATCH_14_NS_ID_VSX_207
     #endif
 
-    #define SIMDPP_DISPATCH_14_NAMESPACE SIMDPP_PP_PASTE22(arch,              \
+    #define SIMDPP_DISPATCH_14_NAMESPACE SIMDPP_PP_PASTE35(arch,              \
         SIMDPP_DISPATCH_14_NS_ID_NULL,                                        \
         SIMDPP_DISPATCH_14_NS_ID_SSE2,                                        \
         SIMDPP_DISPATCH_14_NS_ID_SSE3,                                        \
@@ -2205,6 +3284,19 @@
         SIMDPP_DISPATCH_14_NS_ID_AVX512BW,                                    \
         SIMDPP_DISPATCH_14_NS_ID_AVX512DQ,                                    \
         SIMDPP_DISPATCH_14_NS_ID_AVX512VL,                                    \
+        SIMDPP_DISPATCH_14_NS_ID_BMI1,                                        \
+        SIMDPP_DISPATCH_14_NS_ID_BMI2,                                        \
+        SIMDPP_DISPATCH_14_NS_ID_F16C,                                        \
+        SIMDPP_DISPATCH_14_NS_ID_GFNI,                                        \
+        SIMDPP_DISPATCH_14_NS_ID_VAES,                                        \
+        SIMDPP_DISPATCH_14_NS_ID_VPCLMULQDQ,                                  \
+        SIMDPP_DISPATCH_14_NS_ID_AVX512VBMI,                                  \
+        SIMDPP_DISPATCH_14_NS_ID_AVX512VBMI2,                                 \
+        SIMDPP_DISPATCH_14_NS_ID_AVX512VNNI,                                  \
+        SIMDPP_DISPATCH_14_NS_ID_AVX512BITALG,                                \
+        SIMDPP_DISPATCH_14_NS_ID_AVX512VPOPCNTDQ,                             \
+        SIMDPP_DISPATCH_14_NS_ID_AVX512IFMA,                                  \
+        SIMDPP_DISPATCH_14_NS_ID_AVX512CD,                                    \
         SIMDPP_DISPATCH_14_NS_ID_FMA3,                                        \
         SIMDPP_DISPATCH_14_NS_ID_FMA4,                                        \
         SIMDPP_DISPATCH_14_NS_ID_XOP,                                         \
@@ -2319,6 +3411,71 @@
     #else
     #define SIMDPP_DISPATCH_15_NS_ID_AVX512VL
     #endif
+    #if SIMDPP_ARCH_PP_NS_USE_BMI1
+    #define SIMDPP_DISPATCH_15_NS_ID_BMI1 SIMDPP_INSN_ID_BMI1
+    #else
+    #define SIMDPP_DISPATCH_15_NS_ID_BMI1
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_BMI2
+    #define SIMDPP_DISPATCH_15_NS_ID_BMI2 SIMDPP_INSN_ID_BMI2
+    #else
+    #define SIMDPP_DISPATCH_15_NS_ID_BMI2
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_F16C
+    #define SIMDPP_DISPATCH_15_NS_ID_F16C SIMDPP_INSN_ID_F16C
+    #else
+    #define SIMDPP_DISPATCH_15_NS_ID_F16C
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_GFNI
+    #define SIMDPP_DISPATCH_15_NS_ID_GFNI SIMDPP_INSN_ID_GFNI
+    #else
+    #define SIMDPP_DISPATCH_15_NS_ID_GFNI
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_VAES
+    #define SIMDPP_DISPATCH_15_NS_ID_VAES SIMDPP_INSN_ID_VAES
+    #else
+    #define SIMDPP_DISPATCH_15_NS_ID_VAES
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_VPCLMULQDQ
+    #define SIMDPP_DISPATCH_15_NS_ID_VPCLMULQDQ SIMDPP_INSN_ID_VPCLMULQDQ
+    #else
+    #define SIMDPP_DISPATCH_15_NS_ID_VPCLMULQDQ
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_AVX512VBMI
+    #define SIMDPP_DISPATCH_15_NS_ID_AVX512VBMI SIMDPP_INSN_ID_AVX512VBMI
+    #else
+    #define SIMDPP_DISPATCH_15_NS_ID_AVX512VBMI
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_AVX512VBMI2
+    #define SIMDPP_DISPATCH_15_NS_ID_AVX512VBMI2 SIMDPP_INSN_ID_AVX512VBMI2
+    #else
+    #define SIMDPP_DISPATCH_15_NS_ID_AVX512VBMI2
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_AVX512VNNI
+    #define SIMDPP_DISPATCH_15_NS_ID_AVX512VNNI SIMDPP_INSN_ID_AVX512VNNI
+    #else
+    #define SIMDPP_DISPATCH_15_NS_ID_AVX512VNNI
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_AVX512BITALG
+    #define SIMDPP_DISPATCH_15_NS_ID_AVX512BITALG SIMDPP_INSN_ID_AVX512BITALG
+    #else
+    #define SIMDPP_DISPATCH_15_NS_ID_AVX512BITALG
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_AVX512VPOPCNTDQ
+    #define SIMDPP_DISPATCH_15_NS_ID_AVX512VPOPCNTDQ SIMDPP_INSN_ID_AVX512VPOPCNTDQ
+    #else
+    #define SIMDPP_DISPATCH_15_NS_ID_AVX512VPOPCNTDQ
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_AVX512IFMA
+    #define SIMDPP_DISPATCH_15_NS_ID_AVX512IFMA SIMDPP_INSN_ID_AVX512IFMA
+    #else
+    #define SIMDPP_DISPATCH_15_NS_ID_AVX512IFMA
+    #endif
+    #if SIMDPP_ARCH_PP_NS_USE_AVX512CD
+    #define SIMDPP_DISPATCH_15_NS_ID_AVX512CD SIMDPP_INSN_ID_AVX512CD
+    #else
+    #define SIMDPP_DISPATCH_15_NS_ID_AVX512CD
+    #endif
     #if SIMDPP_ARCH_PP_NS_USE_NEON
     #define SIMDPP_DISPATCH_15_NS_ID_NEON SIMDPP_INSN_ID_NEON
     #else
@@ -2350,7 +3507,7 @@
     #define SIMDPP_DISPATCH_15_NS_ID_VSX_207
     #endif
 
-    #define SIMDPP_DISPATCH_15_NAMESPACE SIMDPP_PP_PASTE22(arch,              \
+    #define SIMDPP_DISPATCH_15_NAMESPACE SIMDPP_PP_PASTE35(arch,              \
         SIMDPP_DISPATCH_15_NS_ID_NULL,                                        \
         SIMDPP_DISPATCH_15_NS_ID_SSE2,                                        \
         SIMDPP_DISPATCH_15_NS_ID_SSE3,                                        \
@@ -2363,6 +3520,19 @@
         SIMDPP_DISPATCH_15_NS_ID_AVX512BW,                                    \
         SIMDPP_DISPATCH_15_NS_ID_AVX512DQ,                                    \
         SIMDPP_DISPATCH_15_NS_ID_AVX512VL,                                    \
+        SIMDPP_DISPATCH_15_NS_ID_BMI1,                                        \
+        SIMDPP_DISPATCH_15_NS_ID_BMI2,                                        \
+        SIMDPP_DISPATCH_15_NS_ID_F16C,                                        \
+        SIMDPP_DISPATCH_15_NS_ID_GFNI,                                        \
+        SIMDPP_DISPATCH_15_NS_ID_VAES,                                        \
+        SIMDPP_DISPATCH_15_NS_ID_VPCLMULQDQ,                                  \
+        SIMDPP_DISPATCH_15_NS_ID_AVX512VBMI,                                  \
+        SIMDPP_DISPATCH_15_NS_ID_AVX512VBMI2,                                 \
+        SIMDPP_DISPATCH_15_NS_ID_AVX512VNNI,                                  \
+        SIMDPP_DISPATCH_15_NS_ID_AVX512BITALG,                                \
+        SIMDPP_DISPATCH_15_NS_ID_AVX512VPOPCNTDQ,                             \
+        SIMDPP_DISPATCH_15_NS_ID_AVX512IFMA,                                  \
+        SIMDPP_DISPATCH_15_NS_ID_AVX512CD,                                    \
         SIMDPP_DISPATCH_15_NS_ID_FMA3,                                        \
         SIMDPP_DISPATCH_15_NS_ID_FMA4,                                        \
         SIMDPP_DISPATCH_15_NS_ID_XOP,                                         \
@@ -8,11 +8,8 @@
 #ifndef LIBSIMDPP_DISPATCHER_H
 #define LIBSIMDPP_DISPATCHER_H
 
-#ifndef LIBSIMDPP_SIMD_H
-    #error "This file must be included through simd.h"
-#endif
-
 #include <algorithm>
+#include <cstdint>
 #include <cstdlib>
 #include <simdpp/dispatch/arch.h>
 
@@ -26,13 +23,16 @@ namespace simdpp {
     The macro is used by @c SIMDPP_MAKE_DISPATCHER_* to specify function which
     is invoked to determine which version of the dispatched function to
     dispatch. The macro is just a more convenient method to pass a parameter
-    which has high chance to be the same in the majority of use cases. The user
-    may redefine the macro and use different definitions for each site of
-    @c SIMDPP_MAKE_DISPATCHER_* expansion.
+    which has high chance to be the same in the majority of use cases.
 
-    The function identified by the @c SIMDPP_USER_ARCH_INFO is called at the
-    first time the specific dispatcher is invoked. The user must ensure that
-    proper synchronization is used if the dispatcher is called concurrently.
+    The function identified by the @c SIMDPP_USER_ARCH_INFO is called when the
+    first dispatcher within the program is invoked or when
+    @c resolve_dispatchers is called. The result is cached and shared by all
+    dispatchers, thus redefinitions of the macro at subsequent sites have no
+    effect on the selected architecture. If the first dispatchers are invoked
+    concurrently from several threads, the function may be called more than
+    once, possibly concurrently, thus it must be thread-safe and must return
+    the same result each time.
 
     The user must ensure that the returned information is sensible: e.g. SSE2
     must be supported if SSE3 support is indicated.
@@ -67,13 +67,29 @@ struct FnVersion {
     const char* arch_name;
 };
 
+/*  Returns a value that orders function versions by the expected performance.
+    The minor x86 extensions have been appended after the major instruction
+    sets in Arch, thus they are moved below all of them, where they only act
+    as tie breakers. The moved bits don't overlap with the values used on
+    other architectures.
+*/
+inline std::uint64_t arch_order_key(Arch arch)
+{
+    const Arch minor = Arch::X86_BMI1 | Arch::X86_BMI2 | Arch::X86_F16C |
+                       Arch::X86_GFNI | Arch::X86_VAES | Arch::X86_VPCLMULQDQ;
+    std::uint64_t major_bits = static_cast<std::uint32_t>(arch & ~minor);
+    std::uint64_t minor_bits = static_cast<std::uint32_t>(arch & minor);
+    return (major_bits << 32) | minor_bits;
+}
+
 inline FnVersion select_version_any(FnVersion* versions, unsigned size,
                                     Arch arch)
 {
     // No need to try to be very efficient here.
     std::sort(versions, versions + size,
               [](const FnVersion& lhs, const FnVersion& rhs) {
-                  return lhs.needed_arch > rhs.needed_arch;
+                  return arch_order_key(lhs.needed_arch) >
+                         arch_order_key(rhs.needed_arch);
               });
 
     unsigned i;
@@ -8,7 +8,7 @@
 #ifndef LIBSIMDPP_DISPATCH_GET_ARCH_GCC_BUILTIN_CPU_SUPPORTS_H
 #define LIBSIMDPP_DISPATCH_GET_ARCH_GCC_BUILTIN_CPU_SUPPORTS_H
 
-#if ((__GNUC__ >= 4) && (__GNUC_MINOR__ >= 8)) && (__i386__ || __amd64__)
+#if ((__GNUC__ > 4) || ((__GNUC__ == 4) && (__GNUC_MINOR__ >= 8))) && (__i386__ || __amd64__)
 #define SIMDPP_HAS_GET_ARCH_GCC_BUILTIN_CPU_SUPPORTS 1
 
 #include <simdpp/dispatch/arch.h>
@@ -20,7 +20,10 @@ namespace simdpp {
 */
 inline Arch get_arch_gcc_builtin_cpu_supports()
 {
-    Arch arch_info;
+    // Needed when called before static constructors, e.g. by ifunc resolvers
+    __builtin_cpu_init();
+
+    Arch arch_info = Arch::NONE_NULL;
 #if (__GNUC__ > 4)
     if (__builtin_cpu_supports("avx512f")) { // since 5.0
         arch_info |= Arch::X86_SSE2;
@@ -63,6 +66,52 @@ inline Arch get_arch_gcc_builtin_cpu_supports()
     }
     if (__builtin_cpu_supports("popcnt"))
         arch_info |= Arch::X86_POPCNT_INSN;
+#if (__GNUC__ > 5)
+    if (__builtin_cpu_supports("bmi"))
+        arch_info |= Arch::X86_BMI1;
+    if (__builtin_cpu_supports("bmi2"))
+        arch_info |= Arch::X86_BMI2;
+    if (__builtin_cpu_supports("avx512f")) {
+        if (__builtin_cpu_supports("avx512bw"))
+            arch_info |= Arch::X86_AVX512BW;
+        if (__builtin_cpu_supports("avx512dq"))
+            arch_info |= Arch::X86_AVX512DQ;
+        if (__builtin_cpu_supports("avx512vl"))
+            arch_info |= Arch::X86_AVX512VL;
+        if (__builtin_cpu_supports("avx512cd"))
+            arch_info |= Arch::X86_AVX512CD;
+        if (__builtin_cpu_supports("avx512ifma"))
+            arch_info |= Arch::X86_AVX512IFMA;
+        if (__builtin_cpu_supports("avx512vbmi"))
+            arch_info |= Arch::X86_AVX512VBMI;
+    }
+#endif
+#if (__GNUC__ > 6)
+    if (__builtin_cpu_supports("avx512f")) {
+        if (__builtin_cpu_supports("avx512vpopcntdq"))
+            arch_info |= Arch::X86_AVX512VPOPCNTDQ;
+    }
+#endif
+#if (__GNUC__ > 7)
+    if (__builtin_cpu_supports("avx512f")) {
+        if (__builtin_cpu_supports("avx512vbmi2"))
+            arch_info |= Arch::X86_AVX512VBMI2;
+        if (__builtin_cpu_supports("avx512vnni"))
+            arch_info |= Arch::X86_AVX512VNNI;
+        if (__builtin_cpu_supports("avx512bitalg"))
+            arch_info |= Arch::X86_AVX512BITALG;
+    }
+    if (__builtin_cpu_supports("gfni"))
+        arch_info |= Arch::X86_GFNI;
+    if (__builtin_cpu_supports("vaes"))
+        arch_info |= Arch::X86_VAES;
+    if (__builtin_cpu_supports("vpclmulqdq"))
+        arch_info |= Arch::X86_VPCLMULQDQ;
+#endif
+#if (__GNUC__ > 11)
+    if (__builtin_cpu_supports("f16c"))
+        arch_info |= Arch::X86_F16C;
+#endif
 
     return arch_info;
 }
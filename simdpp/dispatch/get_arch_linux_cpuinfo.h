@@ -56,6 +56,19 @@ inline Arch get_arch_linux_cpuinfo()
     Arch a_avx512bw = a_avx512f | Arch::X86_AVX512BW;
     Arch a_avx512dq = a_avx512f | Arch::X86_AVX512DQ;
     Arch a_avx512vl = a_avx512f | Arch::X86_AVX512VL;
+    Arch a_avx512vbmi = a_avx512bw | Arch::X86_AVX512VBMI;
+    Arch a_avx512vbmi2 = a_avx512bw | Arch::X86_AVX512VBMI2;
+    Arch a_avx512vnni = a_avx512f | Arch::X86_AVX512VNNI;
+    Arch a_avx512bitalg = a_avx512bw | Arch::X86_AVX512BITALG;
+    Arch a_avx512vpopcntdq = a_avx512f | Arch::X86_AVX512VPOPCNTDQ;
+    Arch a_avx512ifma = a_avx512f | Arch::X86_AVX512IFMA;
+    Arch a_avx512cd = a_avx512f | Arch::X86_AVX512CD;
+    Arch a_bmi1 = a_sse2 | Arch::X86_BMI1;
+    Arch a_bmi2 = a_sse2 | Arch::X86_BMI2;
+    Arch a_f16c = a_avx | Arch::X86_F16C;
+    Arch a_gfni = a_sse2 | Arch::X86_GFNI;
+    Arch a_vaes = a_avx | Arch::X86_VAES;
+    Arch a_vpclmulqdq = a_avx | Arch::X86_VPCLMULQDQ;
 
     ident = "flags\t";
     features["sse2"] = a_sse2;
@@ -72,6 +85,19 @@ inline Arch get_arch_linux_cpuinfo()
     features["avx512bw"] = a_avx512bw;
     features["avx512dq"] = a_avx512dq;
     features["avx512vl"] = a_avx512vl;
+    features["avx512vbmi"] = a_avx512vbmi;
+    features["avx512_vbmi2"] = a_avx512vbmi2;
+    features["avx512_vnni"] = a_avx512vnni;
+    features["avx512_bitalg"] = a_avx512bitalg;
+    features["avx512_vpopcntdq"] = a_avx512vpopcntdq;
+    features["avx512ifma"] = a_avx512ifma;
+    features["avx512cd"] = a_avx512cd;
+    features["bmi1"] = a_bmi1;
+    features["bmi2"] = a_bmi2;
+    features["f16c"] = a_f16c;
+    features["gfni"] = a_gfni;
+    features["vaes"] = a_vaes;
+    features["vpclmulqdq"] = a_vpclmulqdq;
 #else
     return res;
 #endif
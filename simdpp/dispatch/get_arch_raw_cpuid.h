@@ -100,6 +100,7 @@ inline Arch get_arch_raw_cpuid()
 
     uint32_t eax, ebx, ecx, edx;
     bool xsave_xrstore_avail = false;
+    bool avx512_state_avail = false;
 
     simdpp::detail::get_cpuid(0, 0, &eax, &ebx, &ecx, &edx);
     unsigned max_cpuid_level = eax;
@@ -131,10 +132,15 @@ inline Arch get_arch_raw_cpuid()
             uint64_t xcr = simdpp::detail::get_xcr(0);
             if ((xcr & 6) == 6)
                 xsave_xrstore_avail = true;
+            // opmask, upper halves of ZMM0-15 and ZMM16-31 state
+            if ((xcr & 0xe6) == 0xe6)
+                avx512_state_avail = true;
         }
 
         if (ecx & (1u << 28) && xsave_xrstore_avail)
             arch_info |= Arch::X86_AVX;
+        if (ecx & (1u << 29) && xsave_xrstore_avail)
+            arch_info |= Arch::X86_F16C;
     }
     if (max_ex_cpuid_level >= 0x80000001) {
         simdpp::detail::get_cpuid(0x80000001, 0, &eax, &ebx, &ecx, &edx);
@@ -148,14 +154,41 @@ inline Arch get_arch_raw_cpuid()
         simdpp::detail::get_cpuid(0x00000007, 0, &eax, &ebx, &ecx, &edx);
         if (ebx & (1u << 5) && xsave_xrstore_avail)
             arch_info |= Arch::X86_AVX2;
-        if (ebx & (1u << 16) && xsave_xrstore_avail)
-            arch_info |= Arch::X86_AVX512F;
-        if (ebx & (1u << 30) && xsave_xrstore_avail)
-            arch_info |= Arch::X86_AVX512BW;
-        if (ebx & (1u << 17) && xsave_xrstore_avail)
-            arch_info |= Arch::X86_AVX512DQ;
-        if (ebx & (1u << 31) && xsave_xrstore_avail)
-            arch_info |= Arch::X86_AVX512VL;
+        if (ebx & (1u << 3))
+            arch_info |= Arch::X86_BMI1;
+        if (ebx & (1u << 8))
+            arch_info |= Arch::X86_BMI2;
+        if (ecx & (1u << 8))
+            arch_info |= Arch::X86_GFNI;
+        if (ecx & (1u << 9) && xsave_xrstore_avail)
+            arch_info |= Arch::X86_VAES;
+        if (ecx & (1u << 10) && xsave_xrstore_avail)
+            arch_info |= Arch::X86_VPCLMULQDQ;
+
+        if (avx512_state_avail) {
+            if (ebx & (1u << 16))
+                arch_info |= Arch::X86_AVX512F;
+            if (ebx & (1u << 30))
+                arch_info |= Arch::X86_AVX512BW;
+            if (ebx & (1u << 17))
+                arch_info |= Arch::X86_AVX512DQ;
+            if (ebx & (1u << 31))
+                arch_info |= Arch::X86_AVX512VL;
+            if (ebx & (1u << 21))
+                arch_info |= Arch::X86_AVX512IFMA;
+            if (ebx & (1u << 28))
+                arch_info |= Arch::X86_AVX512CD;
+            if (ecx & (1u << 1))
+                arch_info |= Arch::X86_AVX512VBMI;
+            if (ecx & (1u << 6))
+                arch_info |= Arch::X86_AVX512VBMI2;
+            if (ecx & (1u << 11))
+                arch_info |= Arch::X86_AVX512VNNI;
+            if (ecx & (1u << 12))
+                arch_info |= Arch::X86_AVX512BITALG;
+            if (ecx & (1u << 14))
+                arch_info |= Arch::X86_AVX512VPOPCNTDQ;
+        }
     }
 
     return arch_info;
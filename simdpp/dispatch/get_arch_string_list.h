@@ -9,7 +9,9 @@
 #define LIBSIMDPP_DISPATCH_GET_ARCH_STRING_LIST_H
 
 #include <vector>
+#include <cctype>
 #include <cstring>
+#include <string>
 #include <simdpp/dispatch/arch.h>
 #include <simdpp/setup_arch.h>
 
@@ -55,6 +57,19 @@ inline Arch get_arch_string_list(const char* const strings[], int count, const c
     Arch a_avx512bw = a_avx512f | Arch::X86_AVX512BW;
     Arch a_avx512dq = a_avx512f | Arch::X86_AVX512DQ;
     Arch a_avx512vl = a_avx512f | Arch::X86_AVX512VL;
+    Arch a_avx512vbmi = a_avx512bw | Arch::X86_AVX512VBMI;
+    Arch a_avx512vbmi2 = a_avx512bw | Arch::X86_AVX512VBMI2;
+    Arch a_avx512vnni = a_avx512f | Arch::X86_AVX512VNNI;
+    Arch a_avx512bitalg = a_avx512bw | Arch::X86_AVX512BITALG;
+    Arch a_avx512vpopcntdq = a_avx512f | Arch::X86_AVX512VPOPCNTDQ;
+    Arch a_avx512ifma = a_avx512f | Arch::X86_AVX512IFMA;
+    Arch a_avx512cd = a_avx512f | Arch::X86_AVX512CD;
+    Arch a_bmi1 = a_sse2 | Arch::X86_BMI1;
+    Arch a_bmi2 = a_sse2 | Arch::X86_BMI2;
+    Arch a_f16c = a_avx | Arch::X86_F16C;
+    Arch a_gfni = a_sse2 | Arch::X86_GFNI;
+    Arch a_vaes = a_avx | Arch::X86_VAES;
+    Arch a_vpclmulqdq = a_avx | Arch::X86_VPCLMULQDQ;
 
     features.emplace_back("sse2", a_sse2);
     features.emplace_back("sse3", a_sse3);
@@ -70,6 +85,19 @@ inline Arch get_arch_string_list(const char* const strings[], int count, const c
     features.emplace_back("avx512bw", a_avx512bw);
     features.emplace_back("avx512dq", a_avx512dq);
     features.emplace_back("avx512vl", a_avx512vl);
+    features.emplace_back("avx512vbmi", a_avx512vbmi);
+    features.emplace_back("avx512vbmi2", a_avx512vbmi2);
+    features.emplace_back("avx512vnni", a_avx512vnni);
+    features.emplace_back("avx512bitalg", a_avx512bitalg);
+    features.emplace_back("avx512vpopcntdq", a_avx512vpopcntdq);
+    features.emplace_back("avx512ifma", a_avx512ifma);
+    features.emplace_back("avx512cd", a_avx512cd);
+    features.emplace_back("bmi1", a_bmi1);
+    features.emplace_back("bmi2", a_bmi2);
+    features.emplace_back("f16c", a_f16c);
+    features.emplace_back("gfni", a_gfni);
+    features.emplace_back("vaes", a_vaes);
+    features.emplace_back("vpclmulqdq", a_vpclmulqdq);
 #elif SIMDPP_PPC
     Arch a_altivec = Arch::POWER_ALTIVEC;
     Arch a_vsx_206 = a_altivec | Arch::POWER_VSX_206;
@@ -108,6 +136,32 @@ inline Arch get_arch_string_list(const char* const strings[], int count, const c
     return res;
 }
 
+/** Retrieves supported architecture from a single string containing a list
+    of architecture names separated by commas or whitespace, e.g.
+    "sse4p1,popcnt". The names are the same as in the overload above.
+*/
+inline Arch get_arch_string_list(const char* string, const char* prefix)
+{
+    std::vector<std::string> names;
+    std::string name;
+    for (const char* s = string; ; ++s) {
+        if (*s == '\0' || *s == ',' || std::isspace((unsigned char)*s)) {
+            if (!name.empty())
+                names.push_back(name);
+            name.clear();
+            if (*s == '\0')
+                break;
+        } else {
+            name += *s;
+        }
+    }
+
+    std::vector<const char*> strings;
+    for (auto& n : names)
+        strings.push_back(n.c_str());
+    return get_arch_string_list(strings.data(), strings.size(), prefix);
+}
+
 } // namespace simdpp
 
 #endif
@@ -13,12 +13,17 @@
 #include <simdpp/detail/preprocessor/seq/for_each.hpp>
 #include <simdpp/detail/preprocessor/variadic/to_seq.hpp>
 
-#if SIMDPP_EMIT_DISPATCHER
+#include <simdpp/detail/preprocessor/punctuation/comma.hpp>
 #include <simdpp/detail/preprocessor/punctuation/comma_if.hpp>
 #include <simdpp/detail/preprocessor/seq/elem.hpp>
 #include <simdpp/detail/preprocessor/seq/for_each_i.hpp>
+#include <simdpp/detail/preprocessor/stringize.hpp>
 #include <simdpp/detail/preprocessor/tuple/rem.hpp>
+
+#if SIMDPP_EMIT_DISPATCHER
 #include <simdpp/dispatch/collect_macros_generated.h>
+#include <simdpp/dispatch/registry.h>
+#endif
 
 // When debugging this code, it's a good idea to familiarize yourself with
 // advanced preprocessor techniques first. Several resources follow:
@@ -131,6 +136,13 @@
 #define SIMDPP_DETAIL_FORWARD(args)                                             \
     SIMDPP_PP_SEQ_FOR_EACH_I(SIMDPP_DETAIL_FORWARD_EACH, data, SIMDPP_PP_VARIADIC_TO_SEQ args)
 
+// Will expand to ',' if the argument list is not empty
+#define SIMDPP_DETAIL_COMMA_IF_ARGS(args)                                       \
+    SIMDPP_PP_IIF(SIMDPP_PP_IS_BEGIN_PARENS(SIMDPP_PP_REM args),                \
+                  SIMDPP_PP_COMMA,                                              \
+                  SIMDPP_PP_EMPTY                                               \
+                 )()
+
 // Will expand to 1 if argument contains SIMDPP_PP_PROBE macro anywhere, 0 otherwise
 #if ~SIMDPP_PP_CONFIG_FLAGS() & SIMDPP_PP_CONFIG_MSVC()
     #define SIMDPP_PP_PROBE_TO_BOOL(...)                                        \
@@ -258,6 +270,33 @@
 
 #define SIMDPP_DETAIL_RETURN_TOKEN() return
 
+// Defines SimdppDispatchTraits class to be used with
+// ::simdpp::detail::DispatchSlotHolder. FUN_NAME is the parenthesized name of
+// the dispatched function relative to each architecture namespace.
+// DISPATCHER is an expression that evaluates to the pointer to the dispatcher
+// itself.
+#define SIMDPP_DETAIL_DISPATCH_TRAITS(NAME_STR, FUN_NAME, FUN_TYPE, DISPATCHER) \
+    struct SimdppDispatchTraits {                                               \
+        static constexpr const char* name()                                     \
+        {                                                                       \
+            return NAME_STR;                                                    \
+        }                                                                       \
+        static void collect(::simdpp::detail::FnVersion* versions)              \
+        {                                                                       \
+            SIMDPP_DISPATCH_COLLECT_FUNCTIONS(versions, FUN_NAME, FUN_TYPE)     \
+        }                                                                       \
+        static constexpr unsigned num_versions()                                \
+        {                                                                       \
+            return SIMDPP_DISPATCH_MAX_ARCHS;                                   \
+        }                                                                       \
+        static ::simdpp::Arch arch_info() { return SIMDPP_USER_ARCH_INFO; }     \
+        static bool is_dispatcher(const void* type_id, const void* ptr)         \
+        {                                                                       \
+            return ::simdpp::detail::is_same_dispatcher(type_id, ptr,           \
+                                                        DISPATCHER);            \
+        }                                                                       \
+    };
+
 #define SIMDPP_DETAIL_MAKE_DISPATCHER_IMPL(TEMPLATE_PREFIX, TEMPLATE_ARGS, R, NAME, ARGS) \
                                                                                 \
 SIMDPP_DISPATCH_DECLARE_FUNCTIONS(                                              \
@@ -268,19 +307,59 @@ SIMDPP_PP_REMOVE_PARENS(TEMPLATE_PREFIX)
 SIMDPP_PP_REMOVE_PARENS(R) NAME(SIMDPP_DETAIL_ARGS(ARGS))                       \
 {                                                                               \
     using FunPtr = SIMDPP_PP_REMOVE_PARENS(R)(*)(SIMDPP_DETAIL_TYPES(ARGS));    \
-    static FunPtr selected = nullptr;                                           \
-    if (selected == nullptr) {                                                  \
-        ::simdpp::detail::FnVersion versions[SIMDPP_DISPATCH_MAX_ARCHS] = {};   \
-        SIMDPP_DISPATCH_COLLECT_FUNCTIONS(versions,                             \
-            (NAME SIMDPP_PP_REMOVE_PARENS(TEMPLATE_ARGS)), FunPtr)              \
-        ::simdpp::detail::FnVersion version =                                   \
-            ::simdpp::detail::select_version_any(versions,                      \
-                SIMDPP_DISPATCH_MAX_ARCHS, SIMDPP_USER_ARCH_INFO);              \
-        selected = reinterpret_cast<FunPtr>(version.fun_ptr);                   \
-    }                                                                           \
+    SIMDPP_DETAIL_DISPATCH_TRAITS(SIMDPP_PP_STRINGIZE(NAME),                    \
+        (NAME SIMDPP_PP_REMOVE_PARENS(TEMPLATE_ARGS)), FunPtr,                  \
+        static_cast<FunPtr>(&NAME SIMDPP_PP_REMOVE_PARENS(TEMPLATE_ARGS)))      \
+    FunPtr selected = reinterpret_cast<FunPtr>(                                 \
+        ::simdpp::detail::DispatchSlotHolder<SimdppDispatchTraits>::get());     \
     SIMDPP_DETAIL_RETURN_IF_NOT_VOID(R) selected(SIMDPP_DETAIL_FORWARD(ARGS));  \
 }
 
+/*  GNU indirect functions are used for non-template dispatchers if the user
+    requests this via SIMDPP_DISPATCH_USE_IFUNC and the target supports them.
+*/
+#if SIMDPP_DISPATCH_USE_IFUNC && defined(__ELF__) && \
+    (defined(__linux__) || defined(__FreeBSD__)) && \
+    (defined(__clang__) || (__GNUC__ >= 5))
+#define SIMDPP_DETAIL_DISPATCH_IFUNC 1
+#else
+#define SIMDPP_DETAIL_DISPATCH_IFUNC 0
+#endif
+
+// The identifier and the assembler name of the ifunc resolver. The line
+// number distinguishes the resolvers of overloaded functions.
+#define SIMDPP_DETAIL_IFUNC_RESOLVER(NAME)                                      \
+    SIMDPP_PP_CAT(SIMDPP_PP_CAT(simdpp_detail_ifunc_resolver_, NAME),           \
+                  SIMDPP_PP_CAT(_, __LINE__))
+
+#define SIMDPP_DETAIL_MAKE_DISPATCHER_IFUNC_IMPL(R, NAME, ARGS)                 \
+                                                                                \
+SIMDPP_DISPATCH_DECLARE_FUNCTIONS(                                              \
+    (SIMDPP_PP_REMOVE_PARENS(R) NAME (SIMDPP_DETAIL_TYPES(ARGS))))              \
+                                                                                \
+__attribute__((used))                                                           \
+static SIMDPP_PP_REMOVE_PARENS(R)                                               \
+    (*SIMDPP_DETAIL_IFUNC_RESOLVER(NAME)())(SIMDPP_DETAIL_TYPES(ARGS))          \
+    __asm__(SIMDPP_PP_STRINGIZE(SIMDPP_DETAIL_IFUNC_RESOLVER(NAME)));           \
+                                                                                \
+static SIMDPP_PP_REMOVE_PARENS(R)                                               \
+    (*SIMDPP_DETAIL_IFUNC_RESOLVER(NAME)())(SIMDPP_DETAIL_TYPES(ARGS))          \
+{                                                                               \
+    using FunPtr = SIMDPP_PP_REMOVE_PARENS(R)(*)(SIMDPP_DETAIL_TYPES(ARGS));    \
+    ::simdpp::detail::FnVersion versions[SIMDPP_DISPATCH_MAX_ARCHS] = {};       \
+    SIMDPP_DISPATCH_COLLECT_FUNCTIONS(versions, (NAME), FunPtr)                 \
+    ::simdpp::Arch arch =                                                       \
+        ::simdpp::detail::DispatchRegistry::get().get_detected_arch(            \
+            +[]() -> ::simdpp::Arch { return SIMDPP_USER_ARCH_INFO; });         \
+    ::simdpp::detail::FnVersion version =                                       \
+        ::simdpp::detail::select_version_any(versions,                          \
+            SIMDPP_DISPATCH_MAX_ARCHS, arch);                                   \
+    return reinterpret_cast<FunPtr>(version.fun_ptr);                           \
+}                                                                               \
+                                                                                \
+SIMDPP_PP_REMOVE_PARENS(R) NAME(SIMDPP_DETAIL_TYPES(ARGS))                      \
+    __attribute__((ifunc(SIMDPP_PP_STRINGIZE(SIMDPP_DETAIL_IFUNC_RESOLVER(NAME)))));
+
 #define SIMDPP_DETAIL_IGNORE_PARENS2(x)                                         \
     SIMDPP_DETAIL_IGNORE_PARENS(SIMDPP_DETAIL_IGNORE_PARENS(x))
 
@@ -298,6 +377,13 @@ SIMDPP_PP_REMOVE_PARENS(R) NAME(SIMDPP_DETAIL_ARGS(ARGS))
 // so we use a workaround
 #define SIMDPP_DETAIL_MAKE_DISPATCHER1(DESC) SIMDPP_ERROR_INCORRECT_NUMBER_OF_ARGUMENTS
 #define SIMDPP_DETAIL_MAKE_DISPATCHER2(DESC) SIMDPP_ERROR_INCORRECT_NUMBER_OF_ARGUMENTS
+#if SIMDPP_DETAIL_DISPATCH_IFUNC
+#define SIMDPP_DETAIL_MAKE_DISPATCHER3(DESC)                                    \
+    SIMDPP_DETAIL_MAKE_DISPATCHER_IFUNC_IMPL(                                   \
+        (SIMDPP_DETAIL_EXTRACT_PARENS_IGNORE_REST(DESC)),                       \
+        SIMDPP_DETAIL_EXTRACT_PARENS_IGNORE_REST(SIMDPP_DETAIL_IGNORE_PARENS(DESC)), \
+        (SIMDPP_DETAIL_EXTRACT_PARENS_IGNORE_REST(SIMDPP_DETAIL_IGNORE_PARENS2(DESC))))
+#else
 #define SIMDPP_DETAIL_MAKE_DISPATCHER3(DESC)                                    \
     SIMDPP_DETAIL_MAKE_DISPATCHER_IMPL(                                         \
         (),                                                                     \
@@ -305,6 +391,7 @@ SIMDPP_PP_REMOVE_PARENS(R) NAME(SIMDPP_DETAIL_ARGS(ARGS))
         (SIMDPP_DETAIL_EXTRACT_PARENS_IGNORE_REST(DESC)),                       \
         SIMDPP_DETAIL_EXTRACT_PARENS_IGNORE_REST(SIMDPP_DETAIL_IGNORE_PARENS(DESC)), \
         (SIMDPP_DETAIL_EXTRACT_PARENS_IGNORE_REST(SIMDPP_DETAIL_IGNORE_PARENS2(DESC))))
+#endif
 
 #define SIMDPP_DETAIL_MAKE_DISPATCHER4(DESC) SIMDPP_ERROR_INCORRECT_NUMBER_OF_ARGUMENTS
 #define SIMDPP_DETAIL_MAKE_DISPATCHER5(DESC)                                    \
@@ -363,18 +450,178 @@ SIMDPP_PP_REMOVE_PARENS(R) NAME(SIMDPP_DETAIL_ARGS(ARGS))
 
     The dispatch functions check the enabled instruction set and select the
     best function on first call. The initialization does not introduce race
-    conditions when done concurrently.
+    conditions when done concurrently: the selected function pointer is
+    published through an atomic variable. If several threads call the
+    dispatcher for the first time simultaneously, each of them may perform the
+    selection, but all of them arrive at the same result. Subsequent calls
+    cost a single load of the cached pointer and an indirect call.
+
+    Each dispatcher is registered in a process-wide registry during static
+    initialization. The instruction set information is retrieved only once
+    per process and is shared by all dispatchers. @c resolve_dispatchers may
+    be used to select the functions of all registered dispatchers in advance.
+
+    If SIMDPP_DISPATCH_USE_IFUNC is defined to 1 and the target supports GNU
+    indirect functions (ELF targets on Linux or FreeBSD, GCC 5 or Clang),
+    dispatchers of non-template functions are emitted as indirect functions
+    instead. The dynamic loader then runs the selection once when the program
+    or library is loaded, and calls go to the selected version directly
+    without any per-call overhead. Note the following:
+
+     - the selection happens before any static constructors and before
+       @c main are run. The function referred to by SIMDPP_USER_ARCH_INFO must
+       not depend on anything initialized at runtime. The
+       @c get_arch_raw_cpuid and @c get_arch_gcc_builtin_cpu_supports
+       functions are suitable.
+
+     - the selected function can not be changed later, e.g. by
+       @c set_dispatch_arch_mask. The SIMDPP_FORCE_ARCH environment variable
+       is not taken into account either.
+
+    Dispatchers of function templates and dispatchers on targets without
+    indirect function support always use the regular mechanism.
 
     The generated dispatching code links to all versions of the dispatched
     function statically, so techniques to prevent linkers from stripping
     unreferenced object files are not needed.
 */
+#if SIMDPP_EMIT_DISPATCHER
 #define SIMDPP_MAKE_DISPATCHER(DESC)                                            \
     SIMDPP_PP_CAT(SIMDPP_DETAIL_MAKE_DISPATCHER, SIMDPP_PP_SEQ_SIZE(DESC))(DESC)
-#else // #if SIMDPP_EMIT_DISPATCHER
+#else
 #define SIMDPP_MAKE_DISPATCHER(DESC)
 #endif
 
+// The name of the free function that calls the member function template with
+// the architecture tag. The line number distinguishes thunks of different
+// member functions with the same class and signature.
+#define SIMDPP_DETAIL_MEMBER_THUNK                                              \
+    SIMDPP_PP_CAT(simdpp_detail_member_thunk_, __LINE__)
+
+// Defines the thunk in the current architecture namespace
+#define SIMDPP_DETAIL_MAKE_MEMBER_THUNK(R, CLASS, NAME, ARGS, QUAL)             \
+namespace SIMDPP_ARCH_NAMESPACE {                                               \
+SIMDPP_PP_REMOVE_PARENS(R) SIMDPP_DETAIL_MEMBER_THUNK(                          \
+    SIMDPP_PP_REMOVE_PARENS(CLASS) SIMDPP_PP_REMOVE_PARENS(QUAL)* self          \
+    SIMDPP_DETAIL_COMMA_IF_ARGS(ARGS) SIMDPP_DETAIL_ARGS(ARGS))                 \
+{                                                                               \
+    SIMDPP_DETAIL_RETURN_IF_NOT_VOID(R) self->SIMDPP_PP_REMOVE_PARENS(NAME)(    \
+        ::simdpp::SIMDPP_ARCH_NAMESPACE::arch_tag()                             \
+        SIMDPP_DETAIL_COMMA_IF_ARGS(ARGS) SIMDPP_DETAIL_FORWARD(ARGS));         \
+}                                                                               \
+}
+
+#if SIMDPP_EMIT_DISPATCHER
+#define SIMDPP_DETAIL_MAKE_MEMBER_DISPATCHER_IMPL(R, CLASS, NAME, ARGS, QUAL)    \
+                                                                                \
+SIMDPP_DETAIL_MAKE_MEMBER_THUNK(R, CLASS, NAME, ARGS, QUAL)                     \
+                                                                                \
+SIMDPP_DISPATCH_DECLARE_FUNCTIONS(                                              \
+    (SIMDPP_PP_REMOVE_PARENS(R) SIMDPP_DETAIL_MEMBER_THUNK(                     \
+        SIMDPP_PP_REMOVE_PARENS(CLASS) SIMDPP_PP_REMOVE_PARENS(QUAL)*           \
+        SIMDPP_DETAIL_COMMA_IF_ARGS(ARGS) SIMDPP_DETAIL_TYPES(ARGS))))          \
+                                                                                \
+SIMDPP_PP_REMOVE_PARENS(R)                                                      \
+SIMDPP_PP_REMOVE_PARENS(CLASS)::SIMDPP_PP_REMOVE_PARENS(NAME)(                  \
+    SIMDPP_DETAIL_ARGS(ARGS)) SIMDPP_PP_REMOVE_PARENS(QUAL)                     \
+{                                                                               \
+    using FunPtr = SIMDPP_PP_REMOVE_PARENS(R)(*)(                               \
+        SIMDPP_PP_REMOVE_PARENS(CLASS) SIMDPP_PP_REMOVE_PARENS(QUAL)*           \
+        SIMDPP_DETAIL_COMMA_IF_ARGS(ARGS) SIMDPP_DETAIL_TYPES(ARGS));           \
+    using MemFunPtr = SIMDPP_PP_REMOVE_PARENS(R)                                \
+        (SIMDPP_PP_REMOVE_PARENS(CLASS)::*)(SIMDPP_DETAIL_TYPES(ARGS))          \
+        SIMDPP_PP_REMOVE_PARENS(QUAL);                                          \
+    SIMDPP_DETAIL_DISPATCH_TRAITS(                                              \
+        SIMDPP_PP_STRINGIZE(SIMDPP_PP_REMOVE_PARENS(CLASS)::SIMDPP_PP_REMOVE_PARENS(NAME)), \
+        (SIMDPP_DETAIL_MEMBER_THUNK), FunPtr,                                   \
+        static_cast<MemFunPtr>(                                                 \
+            &SIMDPP_PP_REMOVE_PARENS(CLASS)::SIMDPP_PP_REMOVE_PARENS(NAME)))    \
+    FunPtr selected = reinterpret_cast<FunPtr>(                                 \
+        ::simdpp::detail::DispatchSlotHolder<SimdppDispatchTraits>::get());     \
+    SIMDPP_DETAIL_RETURN_IF_NOT_VOID(R) selected(this                           \
+        SIMDPP_DETAIL_COMMA_IF_ARGS(ARGS) SIMDPP_DETAIL_FORWARD(ARGS));         \
+}
+#else
+#define SIMDPP_DETAIL_MAKE_MEMBER_DISPATCHER_IMPL(R, CLASS, NAME, ARGS, QUAL)    \
+    SIMDPP_DETAIL_MAKE_MEMBER_THUNK(R, CLASS, NAME, ARGS, QUAL)
+#endif
+
+#define SIMDPP_DETAIL_MAKE_MEMBER_DISPATCHER1(DESC) SIMDPP_ERROR_INCORRECT_NUMBER_OF_ARGUMENTS
+#define SIMDPP_DETAIL_MAKE_MEMBER_DISPATCHER2(DESC) SIMDPP_ERROR_INCORRECT_NUMBER_OF_ARGUMENTS
+#define SIMDPP_DETAIL_MAKE_MEMBER_DISPATCHER3(DESC) SIMDPP_ERROR_INCORRECT_NUMBER_OF_ARGUMENTS
+#define SIMDPP_DETAIL_MAKE_MEMBER_DISPATCHER4(DESC)                             \
+    SIMDPP_DETAIL_MAKE_MEMBER_DISPATCHER_IMPL(                                  \
+        (SIMDPP_DETAIL_EXTRACT_PARENS_IGNORE_REST(DESC)),                       \
+        (SIMDPP_DETAIL_EXTRACT_PARENS_IGNORE_REST(SIMDPP_DETAIL_IGNORE_PARENS(DESC))), \
+        (SIMDPP_DETAIL_EXTRACT_PARENS_IGNORE_REST(SIMDPP_DETAIL_IGNORE_PARENS2(DESC))), \
+        (SIMDPP_DETAIL_EXTRACT_PARENS_IGNORE_REST(SIMDPP_DETAIL_IGNORE_PARENS3(DESC))), \
+        ())
+#define SIMDPP_DETAIL_MAKE_MEMBER_DISPATCHER5(DESC)                             \
+    SIMDPP_DETAIL_MAKE_MEMBER_DISPATCHER_IMPL(                                  \
+        (SIMDPP_DETAIL_EXTRACT_PARENS_IGNORE_REST(DESC)),                       \
+        (SIMDPP_DETAIL_EXTRACT_PARENS_IGNORE_REST(SIMDPP_DETAIL_IGNORE_PARENS(DESC))), \
+        (SIMDPP_DETAIL_EXTRACT_PARENS_IGNORE_REST(SIMDPP_DETAIL_IGNORE_PARENS2(DESC))), \
+        (SIMDPP_DETAIL_EXTRACT_PARENS_IGNORE_REST(SIMDPP_DETAIL_IGNORE_PARENS3(DESC))), \
+        (SIMDPP_DETAIL_EXTRACT_PARENS_IGNORE_REST(SIMDPP_DETAIL_IGNORE_PARENS4(DESC))))
+#define SIMDPP_DETAIL_MAKE_MEMBER_DISPATCHER6(DESC) SIMDPP_ERROR_INCORRECT_NUMBER_OF_ARGUMENTS
+#define SIMDPP_DETAIL_MAKE_MEMBER_DISPATCHER7(DESC) SIMDPP_ERROR_INCORRECT_NUMBER_OF_ARGUMENTS
+
+/** Builds a dispatcher for a member function of a class, including the
+    function call operator of a function object. This allows stateful kernels
+    to be dispatched and to keep the loops over the data inside the
+    dispatched code, so that the dispatch overhead is paid once per batch
+    instead of once per element.
+
+    The macro accepts a sequence of 4 or 5 parenthesized token groups:
+     - the return type, e.g. (void), or (float)
+     - the class name, e.g. (my_kernel)
+     - the member function name, e.g. (process) or (operator())
+     - comma separated list of function arguments in the same format as for
+       SIMDPP_MAKE_DISPATCHER
+     - (optional) the cv-qualifiers of the member function, e.g. (const)
+
+    The class must declare two overloads of the member function: a regular
+    member function with the given signature, which the macro defines, and a
+    member function template that accepts an additional first parameter of
+    arbitrary type and implements the function:
+
+    @code
+    struct my_kernel { // in a header shared by all architectures
+        float factor;
+        void operator()(float* data, unsigned size) const;
+
+        template<class ArchTag>
+        void operator()(ArchTag, float* data, unsigned size) const;
+    };
+    @endcode
+
+    The implementation is defined in the source file that is compiled for
+    each architecture, followed by the dispatcher:
+
+    @code
+    template<class ArchTag>
+    void my_kernel::operator()(ArchTag, float* data, unsigned size) const
+    {
+        // use simdpp types here
+    }
+
+    SIMDPP_MAKE_MEMBER_DISPATCHER((void)(my_kernel)(operator())
+                                  ((float*) data, (unsigned) size)(const))
+    @endcode
+
+    The member function template is instantiated with
+    @c simdpp::SIMDPP_ARCH_NAMESPACE::arch_tag, which is a distinct type for
+    each architecture, thus each instantiation is compiled for its own
+    instruction set and no virtual functions are involved. The macro must be
+    used in the global namespace or in a namespace that encloses the class.
+    Each use of the macro within a source file must be on a different line.
+
+    Lambdas can not be dispatched, because their body is compiled only once.
+    The code needs to be moved to a function object as shown above.
+*/
+#define SIMDPP_MAKE_MEMBER_DISPATCHER(DESC)                                     \
+    SIMDPP_PP_CAT(SIMDPP_DETAIL_MAKE_MEMBER_DISPATCHER, SIMDPP_PP_SEQ_SIZE(DESC))(DESC)
+
 #define SIMDPP_DETAIL_SIGNATURE_EACH(r, data, x) SIMDPP_PP_REMOVE_PARENS(x) ;
 #define SIMDPP_DETAIL_SIGNATURES(signatures)                                    \
     SIMDPP_PP_SEQ_FOR_EACH(SIMDPP_DETAIL_SIGNATURE_EACH, data,                  \
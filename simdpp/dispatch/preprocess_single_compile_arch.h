@@ -29,6 +29,9 @@
     simdpp::SIMDPP_ARCH_PP_THIS_COMPILE_ARCH_NAMESPACE::this_compile_arch() and
     simdpp::SIMDPP_ARCH_PP_THIS_COMPILE_ARCH_NAMESPACE::create_fn_version().
 
+    If the macro is defined to 0, the arch_tag type is defined in the same
+    namespace as this_compile_arch().
+
     This separation is required because the current architecture and the
     set of dispatched architectures (if enabled) are defined separately, and
     it's hard to figure out whether there's any overlap. If it is, then we need
@@ -89,6 +92,45 @@ static inline Arch this_compile_arch()
 #if SIMDPP_ARCH_PP_USE_AVX512VL
     res |= Arch::X86_AVX512VL;
 #endif
+#if SIMDPP_ARCH_PP_USE_BMI1
+    res |= Arch::X86_BMI1;
+#endif
+#if SIMDPP_ARCH_PP_USE_BMI2
+    res |= Arch::X86_BMI2;
+#endif
+#if SIMDPP_ARCH_PP_USE_F16C
+    res |= Arch::X86_F16C;
+#endif
+#if SIMDPP_ARCH_PP_USE_GFNI
+    res |= Arch::X86_GFNI;
+#endif
+#if SIMDPP_ARCH_PP_USE_VAES
+    res |= Arch::X86_VAES;
+#endif
+#if SIMDPP_ARCH_PP_USE_VPCLMULQDQ
+    res |= Arch::X86_VPCLMULQDQ;
+#endif
+#if SIMDPP_ARCH_PP_USE_AVX512VBMI
+    res |= Arch::X86_AVX512VBMI;
+#endif
+#if SIMDPP_ARCH_PP_USE_AVX512VBMI2
+    res |= Arch::X86_AVX512VBMI2;
+#endif
+#if SIMDPP_ARCH_PP_USE_AVX512VNNI
+    res |= Arch::X86_AVX512VNNI;
+#endif
+#if SIMDPP_ARCH_PP_USE_AVX512BITALG
+    res |= Arch::X86_AVX512BITALG;
+#endif
+#if SIMDPP_ARCH_PP_USE_AVX512VPOPCNTDQ
+    res |= Arch::X86_AVX512VPOPCNTDQ;
+#endif
+#if SIMDPP_ARCH_PP_USE_AVX512IFMA
+    res |= Arch::X86_AVX512IFMA;
+#endif
+#if SIMDPP_ARCH_PP_USE_AVX512CD
+    res |= Arch::X86_AVX512CD;
+#endif
 #if SIMDPP_ARCH_PP_USE_NEON
     res |= Arch::ARM_NEON;
 #endif
@@ -110,7 +152,17 @@ static inline Arch this_compile_arch()
     return res;
 }
 
-#if SIMDPP_ARCH_PP_THIS_COMPILE_ARCH_FOR_DISPATCH
+#if !SIMDPP_ARCH_PP_THIS_COMPILE_ARCH_FOR_DISPATCH
+
+/** An empty type that is distinct for each architecture namespace. Templates
+    that are parameterized on this type get a separate instantiation for each
+    architecture. See SIMDPP_MAKE_MEMBER_DISPATCHER.
+*/
+struct arch_tag {
+    static Arch arch() { return this_compile_arch(); }
+};
+
+#else
 
 template<class FunPtr>
 static inline simdpp::detail::FnVersion create_fn_version(FunPtr fun_ptr)
@@ -0,0 +1,541 @@
+/*  Copyright (C) 2017  Povilas Kanapickas <povilas@radix.lt>
+
+    Distributed under the Boost Software License, Version 1.0.
+        (See accompanying file LICENSE_1_0.txt or copy at
+            http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#ifndef LIBSIMDPP_DISPATCH_REGISTRY_H
+#define LIBSIMDPP_DISPATCH_REGISTRY_H
+
+#include <atomic>
+#include <cstdint>
+#include <cctype>
+#include <cstdlib>
+#include <string>
+#include <thread>
+#include <vector>
+#include <simdpp/dispatch/arch.h>
+#include <simdpp/dispatch/dispatcher.h>
+#include <simdpp/dispatch/get_arch_string_list.h>
+
+namespace simdpp {
+namespace detail {
+
+/*  Holds the dispatch state of a single function dispatched via
+    SIMDPP_MAKE_DISPATCHER. The objects of this type have static storage
+    duration and are constant-initialized, thus the fast path of the
+    dispatcher does not need to check whether the object itself has been
+    initialized.
+*/
+struct DispatchSlot {
+    constexpr DispatchSlot(const char* name_str,
+                           void (*collect_fn)(FnVersion*),
+                           unsigned num_versions_count,
+                           Arch (*arch_info_fn)(),
+                           bool (*is_dispatcher_fn)(const void*, const void*)) :
+        selected(nullptr),
+        num_calls(0),
+        name(name_str),
+        collect(collect_fn),
+        num_versions(num_versions_count),
+        arch_info(arch_info_fn),
+        is_dispatcher(is_dispatcher_fn),
+        selected_version{Arch::NONE_NULL, nullptr, nullptr},
+        next(nullptr)
+    {}
+
+    // The selected function version or nullptr if not selected yet
+    std::atomic<VoidFunPtr> selected;
+
+    // The number of calls. Counted only if SIMDPP_DISPATCH_COUNT_CALLS is 1
+    std::atomic<std::uint64_t> num_calls;
+
+    // The name of the dispatched function
+    const char* name;
+
+    // Fills the given array of num_versions elements with all versions of the
+    // function. Unavailable versions have null fun_ptr.
+    void (*collect)(FnVersion* versions);
+    unsigned num_versions;
+
+    // Returns the architecture as determined by SIMDPP_USER_ARCH_INFO at the
+    // site where the dispatcher was defined
+    Arch (*arch_info)();
+
+    // Checks whether the given pointer to dispatcher refers to the dispatcher
+    // of this slot. See is_same_dispatcher()
+    bool (*is_dispatcher)(const void* type_id, const void* ptr);
+
+    // Full information about the selected function version. Protected by the
+    // registry lock
+    FnVersion selected_version;
+
+    // The next slot in the list of registered slots
+    DispatchSlot* next;
+};
+
+// Provides an unique address for each type. Used instead of RTTI.
+template<class T>
+struct TypeId {
+    static const char id;
+};
+
+template<class T>
+const char TypeId<T>::id = 0;
+
+/*  Returns true if @a ptr points to a pointer of type @a P that is equal to
+    @a dispatcher. @a type_id identifies the type of the pointer.
+*/
+template<class P>
+bool is_same_dispatcher(const void* type_id, const void* ptr, P dispatcher)
+{
+    return type_id == &TypeId<P>::id &&
+           *static_cast<const P*>(ptr) == dispatcher;
+}
+
+/*  Tracks all dispatchers within the program. The architecture information is
+    retrieved only once and shared by all dispatchers. The architecture used
+    by the dispatchers is the detected one restricted by the architecture
+    mask, which is taken either from the SIMDPP_FORCE_ARCH environment variable
+    or from set_dispatch_arch_mask().
+
+    The object is constant-initialized and has trivial destructor, thus it's
+    safe to use it both during static initialization and destruction. All
+    operations are serialized by a simple spin lock. The lock is not contended
+    in practice, because it's only taken when selecting functions.
+*/
+class DispatchRegistry {
+public:
+    // The maximum number of versions of a single dispatched function. The
+    // versions are collected into a buffer on the stack, so that no memory
+    // is allocated while the lock is held.
+    static constexpr unsigned max_versions = 16;
+
+    constexpr DispatchRegistry() :
+        lock_(false),
+        head_(nullptr),
+        detected_(Arch::NONE_NULL),
+        mask_(Arch::NONE_NULL),
+        detected_known_(false),
+        mask_known_(false)
+    {}
+
+    static DispatchRegistry& get()
+    {
+        static DispatchRegistry registry;
+        return registry;
+    }
+
+    /*  Adds the slot to the list of known dispatchers. Each slot must be added
+        at most once.
+    */
+    void add(DispatchSlot* slot)
+    {
+        Lock lock(*this);
+        slot->next = head_;
+        head_ = slot;
+    }
+
+    /*  Returns the detected architecture. The supplied function is used to
+        retrieve the architecture information if this is the first request.
+        The architecture mask is not applied.
+    */
+    Arch get_detected_arch(Arch (*arch_info)())
+    {
+        Lock lock(*this);
+        return detected_arch(arch_info);
+    }
+
+    // Selects the function version of the given slot and publishes it
+    VoidFunPtr resolve(DispatchSlot& slot)
+    {
+        Lock lock(*this);
+        return resolve_slot(slot);
+    }
+
+    // Resolves all registered slots
+    void resolve_all()
+    {
+        Lock lock(*this);
+        for (DispatchSlot* slot = head_; slot != nullptr; slot = slot->next) {
+            resolve_slot(*slot);
+        }
+    }
+
+    /*  Sets the architecture mask and resolves again the slots that have
+        already been resolved. The remaining slots will use the new mask when
+        they are resolved.
+    */
+    void set_arch_mask(Arch mask)
+    {
+        Lock lock(*this);
+        mask_ = mask;
+        mask_known_ = true;
+        for (DispatchSlot* slot = head_; slot != nullptr; slot = slot->next) {
+            if (slot->selected.load(std::memory_order_relaxed) != nullptr)
+                resolve_slot(*slot);
+        }
+    }
+
+    Arch get_arch_mask()
+    {
+        Lock lock(*this);
+        return arch_mask();
+    }
+
+    /*  Parses the value of the SIMDPP_FORCE_ARCH environment variable. See
+        set_dispatch_arch_mask() for the format. Names that are not
+        recognized, e.g. misspelled names or names of instruction sets of
+        other architectures, are ignored. If none of the names is recognized,
+        the mask includes all architectures, so that a wrong value never
+        silently disables all instruction sets.
+    */
+    static Arch parse_arch_mask(const char* str)
+    {
+        Arch mask = Arch::NONE_NULL;
+        bool recognized = false;
+        std::string name;
+        for (const char* s = str; ; ++s) {
+            if (*s == '\0' || *s == ',' || std::isspace((unsigned char)*s)) {
+                if (name == "null") {
+                    recognized = true;
+                } else if (!name.empty()) {
+                    Arch arch = get_arch_string_list(name.c_str(), nullptr);
+                    if (arch != Arch::NONE_NULL) {
+                        mask |= arch;
+                        recognized = true;
+                    }
+                }
+                name.clear();
+                if (*s == '\0')
+                    break;
+            } else {
+                name += *s;
+            }
+        }
+        return recognized ? mask : ~Arch::NONE_NULL;
+    }
+
+    /*  Returns the selected function of the dispatcher identified by @a ptr
+        or nullptr if no such dispatcher has been registered. See
+        is_same_dispatcher() for the meaning of arguments.
+    */
+    VoidFunPtr resolve_dispatcher(const void* type_id, const void* ptr)
+    {
+        Lock lock(*this);
+        for (DispatchSlot* slot = head_; slot != nullptr; slot = slot->next) {
+            if (!slot->is_dispatcher(type_id, ptr))
+                continue;
+            VoidFunPtr selected = slot->selected.load(std::memory_order_relaxed);
+            if (selected == nullptr)
+                selected = resolve_slot(*slot);
+            return selected;
+        }
+        return nullptr;
+    }
+
+    // Calls fn(const DispatchSlot&) for each registered slot
+    template<class F>
+    void for_each_slot(F fn)
+    {
+        Lock lock(*this);
+        for (DispatchSlot* slot = head_; slot != nullptr; slot = slot->next) {
+            fn(static_cast<const DispatchSlot&>(*slot));
+        }
+    }
+
+private:
+    class Lock {
+    public:
+        Lock(DispatchRegistry& r) : r_(r)
+        {
+            while (r_.lock_.exchange(true, std::memory_order_acquire)) {
+                // Wait until the lock is released without writing to it
+                while (r_.lock_.load(std::memory_order_relaxed))
+                    std::this_thread::yield();
+            }
+        }
+        ~Lock()
+        {
+            r_.lock_.store(false, std::memory_order_release);
+        }
+    private:
+        DispatchRegistry& r_;
+    };
+
+    Arch detected_arch(Arch (*arch_info)())
+    {
+        if (!detected_known_) {
+            detected_ = arch_info();
+            detected_known_ = true;
+        }
+        return detected_;
+    }
+
+    Arch arch_mask()
+    {
+        if (!mask_known_) {
+            const char* env = std::getenv("SIMDPP_FORCE_ARCH");
+            if (env != nullptr)
+                mask_ = parse_arch_mask(env);
+            else
+                mask_ = ~Arch::NONE_NULL;
+            mask_known_ = true;
+        }
+        return mask_;
+    }
+
+    VoidFunPtr resolve_slot(DispatchSlot& slot)
+    {
+        Arch arch = detected_arch(slot.arch_info) & arch_mask();
+        FnVersion versions[max_versions];
+        slot.collect(versions);
+        FnVersion version = select_version_any(versions, slot.num_versions,
+                                               arch);
+        slot.selected_version = version;
+        slot.selected.store(version.fun_ptr, std::memory_order_release);
+        return version.fun_ptr;
+    }
+
+    std::atomic<bool> lock_;
+    DispatchSlot* head_;
+    Arch detected_;
+    Arch mask_;
+    bool detected_known_;
+    bool mask_known_;
+};
+
+// Registers the slot on construction
+struct DispatchRegistrar {
+    DispatchRegistrar(DispatchSlot* slot)
+    {
+        DispatchRegistry::get().add(slot);
+    }
+};
+
+/*  Provides storage for the dispatch state of a single dispatcher. @a Traits
+    is a class local to the dispatcher function that is generated by
+    SIMDPP_MAKE_DISPATCHER, thus each dispatcher (and each instantiation of a
+    dispatcher template) gets its own slot. It must define the following
+    static members:
+
+     - const char* name(): returns the name of the dispatched function
+     - void collect(FnVersion* versions): collects all function versions
+     - unsigned num_versions(): the size of the array passed to collect(). At
+       most DispatchRegistry::max_versions
+     - Arch arch_info(): returns SIMDPP_USER_ARCH_INFO
+     - bool is_dispatcher(const void* type_id, const void* ptr): see
+       is_same_dispatcher()
+*/
+template<class Traits>
+struct DispatchSlotHolder {
+    static_assert(Traits::num_versions() <= DispatchRegistry::max_versions,
+                  "Too many function versions");
+
+    static DispatchSlot slot;
+    static DispatchRegistrar registrar;
+
+    static VoidFunPtr get()
+    {
+        // The reference to registrar forces its instantiation, so that the
+        // slot is registered during the static initialization of the program.
+        (void) &registrar;
+
+#if SIMDPP_DISPATCH_COUNT_CALLS
+        slot.num_calls.fetch_add(1, std::memory_order_relaxed);
+#endif
+        VoidFunPtr selected = slot.selected.load(std::memory_order_acquire);
+        if (selected == nullptr)
+            selected = DispatchRegistry::get().resolve(slot);
+        return selected;
+    }
+};
+
+template<class Traits>
+DispatchSlot DispatchSlotHolder<Traits>::slot(Traits::name(), &Traits::collect,
+                                              Traits::num_versions(),
+                                              &Traits::arch_info,
+                                              &Traits::is_dispatcher);
+
+template<class Traits>
+DispatchRegistrar DispatchSlotHolder<Traits>::registrar(&DispatchSlotHolder<Traits>::slot);
+
+/*  Maps the type of pointer to a dispatcher to the type of the pointer to the
+    selected function. Pointers to member functions are mapped to pointers to
+    free functions that accept the object pointer as the first argument.
+*/
+template<class P> struct ResolvedFunPtr;
+
+template<class R, class... Args>
+struct ResolvedFunPtr<R(*)(Args...)> {
+    using type = R(*)(Args...);
+    static type fallback(R(*dispatcher)(Args...)) { return dispatcher; }
+};
+
+template<class R, class C, class... Args>
+struct ResolvedFunPtr<R(C::*)(Args...)> {
+    using type = R(*)(C*, Args...);
+    static type fallback(R(C::*)(Args...)) { return nullptr; }
+};
+
+template<class R, class C, class... Args>
+struct ResolvedFunPtr<R(C::*)(Args...) const> {
+    using type = R(*)(const C*, Args...);
+    static type fallback(R(C::*)(Args...) const) { return nullptr; }
+};
+
+} // namespace detail
+
+/** Selects the function versions of all dispatchers defined via
+    SIMDPP_MAKE_DISPATCHER in a single pass.
+
+    Usually, each dispatcher selects the function version on its first call.
+    This function may be called at the start of the program to perform this
+    work in advance, so that the first call to each dispatched function costs
+    the same as any subsequent call.
+
+    Dispatchers are registered during the static initialization of the
+    program. Dispatchers in libraries that are loaded later are resolved on
+    their first call or by calling this function again. Dispatcher templates
+    are registered only if they are instantiated (e.g. via
+    SIMDPP_INSTANTIATE_DISPATCHER).
+*/
+inline void resolve_dispatchers()
+{
+    ::simdpp::detail::DispatchRegistry::get().resolve_all();
+}
+
+/** Restricts the instruction sets that dispatchers may use to those in
+    @a mask. The dispatchers select the best function version for the
+    intersection of @a mask and the architecture that has been detected via
+    SIMDPP_USER_ARCH_INFO, thus a mask can lower the selected architecture,
+    but never raise it above what is supported. For example, passing
+    @c Arch::NONE_NULL forces the use of the non-SIMD versions of all
+    functions.
+
+    The dispatchers that have already selected their function version are
+    resolved again immediately. Calls that are in progress concurrently may
+    still complete using the previous selection.
+
+    Unless this function is called first, the initial mask is read from the
+    SIMDPP_FORCE_ARCH environment variable, which contains a list of
+    architecture names separated by commas or whitespace, e.g.
+    "sse4p1,popcnt". The names are those accepted by get_arch_string_list.
+    The name "null" stands for @c Arch::NONE_NULL. Names that are not
+    recognized are ignored. If the variable is not set or none of the names
+    is recognized, the mask includes all architectures.
+
+    Dispatchers emitted as GNU indirect functions (see
+    SIMDPP_DISPATCH_USE_IFUNC) are not affected by the mask.
+*/
+inline void set_dispatch_arch_mask(Arch mask)
+{
+    ::simdpp::detail::DispatchRegistry::get().set_arch_mask(mask);
+}
+
+/// Returns the mask set by set_dispatch_arch_mask or SIMDPP_FORCE_ARCH
+inline Arch get_dispatch_arch_mask()
+{
+    return ::simdpp::detail::DispatchRegistry::get().get_arch_mask();
+}
+
+/** Returns a pointer to the function version that has been selected by the
+    given dispatcher. The dispatcher selects the version if it has not done so
+    yet. Calling the returned pointer avoids the overhead of the dispatcher,
+    thus the pointer may be stored and used for the duration of a batch of
+    work, or for the lifetime of the process.
+
+    The returned pointer remains valid as long as the code of the program is
+    loaded. However, it's not updated by subsequent calls to
+    set_dispatch_arch_mask; resolve should be called again to retrieve the new
+    selection.
+
+    @a dispatcher may be a pointer to a function defined via
+    SIMDPP_MAKE_DISPATCHER. In this case the returned pointer has the same
+    type. If the function is not a registered dispatcher (e.g. it's an
+    indirect function dispatcher or a regular function), @a dispatcher itself
+    is returned.
+
+    @a dispatcher may also be a pointer to a member function defined via
+    SIMDPP_MAKE_MEMBER_DISPATCHER. In this case the returned pointer points
+    to a free function that accepts the object pointer as its first argument,
+    e.g. @c void(*)(const C*, float*) for @c void(C::*)(float*) const. If the
+    member function is not a registered dispatcher, nullptr is returned.
+
+    If the dispatched function is overloaded, the type of @a dispatcher needs
+    to be specified explicitly, e.g. @c resolve<void(C::*)(float*)>(&C::fn).
+*/
+template<class P>
+typename ::simdpp::detail::ResolvedFunPtr<P>::type resolve(P dispatcher)
+{
+    using Resolved = ::simdpp::detail::ResolvedFunPtr<P>;
+    using ResultPtr = typename Resolved::type;
+
+    ::simdpp::detail::VoidFunPtr selected =
+        ::simdpp::detail::DispatchRegistry::get().resolve_dispatcher(
+            &::simdpp::detail::TypeId<P>::id, &dispatcher);
+    if (selected == nullptr)
+        return Resolved::fallback(dispatcher);
+    return reinterpret_cast<ResultPtr>(selected);
+}
+
+/// Describes a single dispatcher defined via SIMDPP_MAKE_DISPATCHER
+struct DispatcherInfo {
+    /// The name of the dispatched function
+    const char* name;
+
+    /** The name of the architecture of the selected function version, e.g.
+        "arch_avx2", or nullptr if the dispatcher has not selected a version
+        yet.
+    */
+    const char* selected_arch_name;
+
+    /// The architecture required by the selected function version
+    Arch selected_arch;
+
+    /// The names of the architectures of all available function versions
+    std::vector<const char*> arch_names;
+
+    /** The number of calls to the dispatcher. The calls are counted only if
+        SIMDPP_DISPATCH_COUNT_CALLS is defined to 1 before libsimdpp is
+        included in the source file that defines the dispatcher, otherwise
+        the value is zero. Counting adds an atomic increment to each call.
+    */
+    std::uint64_t num_calls;
+};
+
+/** Returns information about all dispatchers that have been registered (see
+    resolve_dispatchers()). Instantiations of a dispatcher template are listed
+    separately under the same name. Dispatchers emitted as GNU indirect
+    functions are not listed.
+*/
+inline std::vector<DispatcherInfo> get_dispatchers_info()
+{
+    using ::simdpp::detail::DispatchSlot;
+    using ::simdpp::detail::FnVersion;
+
+    std::vector<DispatcherInfo> res;
+    ::simdpp::detail::DispatchRegistry::get().for_each_slot(
+        [&](const DispatchSlot& slot)
+    {
+        DispatcherInfo info;
+        info.name = slot.name;
+        info.selected_arch_name = slot.selected_version.arch_name;
+        info.selected_arch = slot.selected_version.needed_arch;
+        info.num_calls = slot.num_calls.load(std::memory_order_relaxed);
+
+        FnVersion versions[::simdpp::detail::DispatchRegistry::max_versions];
+        slot.collect(versions);
+        for (unsigned i = 0; i < slot.num_versions; ++i) {
+            if (versions[i].fun_ptr != nullptr)
+                info.arch_names.push_back(versions[i].arch_name);
+        }
+        res.push_back(info);
+    });
+    return res;
+}
+
+} // namespace simdpp
+
+#endif
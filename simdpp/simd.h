@@ -18,6 +18,7 @@
 
 #include <simdpp/core/align.h>
 #include <simdpp/core/aligned_allocator.h>
+#include <simdpp/core/bfloat16_to_float32.h>
 #include <simdpp/core/bit_and.h>
 #include <simdpp/core/bit_andnot.h>
 #include <simdpp/core/bit_not.h>
@@ -32,43 +33,72 @@
 #include <simdpp/core/cmp_le.h>
 #include <simdpp/core/cmp_lt.h>
 #include <simdpp/core/cmp_neq.h>
+#include <simdpp/core/compress.h>
+#include <simdpp/core/compress_store.h>
+#include <simdpp/core/divider.h>
+#include <simdpp/core/expand_load.h>
 #include <simdpp/core/extract.h>
 #include <simdpp/core/extract_bits.h>
 #include <simdpp/core/f_abs.h>
 #include <simdpp/core/f_add.h>
+#include <simdpp/core/f_atan.h>
+#include <simdpp/core/f_atan2.h>
 #include <simdpp/core/f_ceil.h>
+#include <simdpp/core/f_cos.h>
 #include <simdpp/core/f_div.h>
+#include <simdpp/core/f_exp.h>
+#include <simdpp/core/f_exp2.h>
+#include <simdpp/core/f_exp2_e.h>
+#include <simdpp/core/f_exp_e.h>
 #include <simdpp/core/f_floor.h>
 #include <simdpp/core/f_fmadd.h>
 #include <simdpp/core/f_fmsub.h>
 #include <simdpp/core/f_isnan.h>
 #include <simdpp/core/f_isnan2.h>
+#include <simdpp/core/f_log.h>
+#include <simdpp/core/f_log2.h>
+#include <simdpp/core/f_log2_e.h>
+#include <simdpp/core/f_log_e.h>
 #include <simdpp/core/f_max.h>
 #include <simdpp/core/f_min.h>
 #include <simdpp/core/f_mul.h>
 #include <simdpp/core/f_neg.h>
+#include <simdpp/core/f_pow.h>
 #include <simdpp/core/f_reduce_add.h>
 #include <simdpp/core/f_reduce_max.h>
 #include <simdpp/core/f_reduce_min.h>
 #include <simdpp/core/f_reduce_mul.h>
 #include <simdpp/core/f_rcp_e.h>
 #include <simdpp/core/f_rcp_rh.h>
+#include <simdpp/core/f_round.h>
 #include <simdpp/core/f_rsqrt_e.h>
 #include <simdpp/core/f_rsqrt_rh.h>
+#include <simdpp/core/f_sigmoid.h>
 #include <simdpp/core/f_sign.h>
+#include <simdpp/core/f_sin.h>
+#include <simdpp/core/f_sincos.h>
 #include <simdpp/core/f_sqrt.h>
 #include <simdpp/core/f_sub.h>
+#include <simdpp/core/f_tan.h>
+#include <simdpp/core/f_tanh.h>
 #include <simdpp/core/f_trunc.h>
+#include <simdpp/core/float16_to_float32.h>
+#include <simdpp/core/float32_to_bfloat16.h>
+#include <simdpp/core/float32_to_float16.h>
 #include <simdpp/core/for_each.h>
 #include <simdpp/core/i_abs.h>
 #include <simdpp/core/i_add.h>
 #include <simdpp/core/i_add_sat.h>
 #include <simdpp/core/i_avg.h>
 #include <simdpp/core/i_avg_trunc.h>
+#include <simdpp/core/i_detect_conflicts.h>
+#include <simdpp/core/i_div.h>
 #include <simdpp/core/i_div_p.h>
+#include <simdpp/core/i_dot_accumulate.h>
 #include <simdpp/core/i_max.h>
 #include <simdpp/core/i_min.h>
 #include <simdpp/core/i_mul.h>
+#include <simdpp/core/i_mul_wide.h>
 #include <simdpp/core/i_mull.h>
 #include <simdpp/core/i_neg.h>
 #include <simdpp/core/i_popcnt.h>
@@ -85,19 +115,25 @@
 #include <simdpp/core/i_sub_sat.h>
 #include <simdpp/core/insert.h>
 #include <simdpp/core/load.h>
+#include <simdpp/core/load_first.h>
+#include <simdpp/core/load_gather.h>
+#include <simdpp/core/load_masked.h>
 #include <simdpp/core/load_packed2.h>
 #include <simdpp/core/load_packed3.h>
 #include <simdpp/core/load_packed4.h>
 #include <simdpp/core/load_splat.h>
 #include <simdpp/core/load_u.h>
+#include <simdpp/core/lookup_table.h>
 #include <simdpp/core/make_float.h>
 #include <simdpp/core/make_int.h>
 #include <simdpp/core/make_uint.h>
 #include <simdpp/core/make_shuffle_bytes_mask.h>
+#include <simdpp/core/mask_test.h>
 #include <simdpp/core/move_l.h>
 #include <simdpp/core/move_r.h>
 #include <simdpp/core/permute2.h>
 #include <simdpp/core/permute4.h>
+#include <simdpp/core/permute_bytes.h>
 #include <simdpp/core/permute_bytes16.h>
 #include <simdpp/core/permute_zbytes16.h>
 #include <simdpp/core/set_splat.h>
@@ -115,15 +151,22 @@
 #include <simdpp/core/store_packed2.h>
 #include <simdpp/core/store_packed3.h>
 #include <simdpp/core/store_packed4.h>
+#include <simdpp/core/store_scatter.h>
 #include <simdpp/core/store_u.h>
 #include <simdpp/core/stream.h>
 #include <simdpp/core/test_bits.h>
 #include <simdpp/core/to_float32.h>
 #include <simdpp/core/to_float64.h>
 #include <simdpp/core/to_int16.h>
+#include <simdpp/core/to_int16_sat.h>
 #include <simdpp/core/to_int32.h>
+#include <simdpp/core/to_int32_round.h>
+#include <simdpp/core/to_int32_sat.h>
 #include <simdpp/core/to_int64.h>
+#include <simdpp/core/to_int64_round.h>
+#include <simdpp/core/to_int64_sat.h>
 #include <simdpp/core/to_int8.h>
+#include <simdpp/core/to_int8_sat.h>
 #include <simdpp/core/to_mask.h>
 #include <simdpp/core/transpose.h>
 #include <simdpp/core/unzip_hi.h>
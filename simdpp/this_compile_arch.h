@@ -66,6 +66,45 @@ inline Arch this_compile_arch()
 #if SIMDPP_USE_AVX512VL
     res |= Arch::X86_AVX512VL;
 #endif
+#if SIMDPP_USE_BMI1
+    res |= Arch::X86_BMI1;
+#endif
+#if SIMDPP_USE_BMI2
+    res |= Arch::X86_BMI2;
+#endif
+#if SIMDPP_USE_F16C
+    res |= Arch::X86_F16C;
+#endif
+#if SIMDPP_USE_GFNI
+    res |= Arch::X86_GFNI;
+#endif
+#if SIMDPP_USE_VAES
+    res |= Arch::X86_VAES;
+#endif
+#if SIMDPP_USE_VPCLMULQDQ
+    res |= Arch::X86_VPCLMULQDQ;
+#endif
+#if SIMDPP_USE_AVX512VBMI
+    res |= Arch::X86_AVX512VBMI;
+#endif
+#if SIMDPP_USE_AVX512VBMI2
+    res |= Arch::X86_AVX512VBMI2;
+#endif
+#if SIMDPP_USE_AVX512VNNI
+    res |= Arch::X86_AVX512VNNI;
+#endif
+#if SIMDPP_USE_AVX512BITALG
+    res |= Arch::X86_AVX512BITALG;
+#endif
+#if SIMDPP_USE_AVX512VPOPCNTDQ
+    res |= Arch::X86_AVX512VPOPCNTDQ;
+#endif
+#if SIMDPP_USE_AVX512IFMA
+    res |= Arch::X86_AVX512IFMA;
+#endif
+#if SIMDPP_USE_AVX512CD
+    res |= Arch::X86_AVX512CD;
+#endif
 #if SIMDPP_USE_NEON
     res |= Arch::ARM_NEON;
 #endif
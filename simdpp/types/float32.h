@@ -26,7 +26,7 @@ namespace SIMDPP_ARCH_NAMESPACE {
     always contains at least one native vector.
 */
 template<unsigned N>
-class float32<N, void> : public any_float32<N, float32<N,void>> {
+class SIMDPP_MAY_ALIAS float32<N, void> : public any_float32<N, float32<N,void>> {
 public:
     static const unsigned type_tag = SIMDPP_TAG_FLOAT;
     using expr_type = void;
@@ -84,7 +84,7 @@ private:
 /// Class representing a mask for 32-bit floating-point vector of arbitrary
 /// length.
 template<unsigned N>
-class mask_float32<N, void> : public any_float32<N, mask_float32<N,void>> {
+class SIMDPP_MAY_ALIAS mask_float32<N, void> : public any_float32<N, mask_float32<N,void>> {
 public:
     static const unsigned type_tag = SIMDPP_TAG_MASK_FLOAT;
     using base_vector_type = mask_float32v;
@@ -26,7 +26,7 @@ namespace SIMDPP_ARCH_NAMESPACE {
     always contains at least one native vector.
 */
 template<unsigned N>
-class float64<N, void> : public any_float64<N, float64<N,void>> {
+class SIMDPP_MAY_ALIAS float64<N, void> : public any_float64<N, float64<N,void>> {
 public:
     static const unsigned type_tag = SIMDPP_TAG_FLOAT;
     using element_type = double;
@@ -83,7 +83,7 @@ private:
 /// Class representing possibly optimized mask data for 2x 64-bit floating point
 /// vector
 template<unsigned N>
-class mask_float64<N, void> : public any_float64<N, mask_float64<N,void>> {
+class SIMDPP_MAY_ALIAS mask_float64<N, void> : public any_float64<N, mask_float64<N,void>> {
 public:
     static const unsigned type_tag = SIMDPP_TAG_MASK_FLOAT;
     using base_vector_type = mask_float64v;
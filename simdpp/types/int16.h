@@ -26,7 +26,7 @@ namespace SIMDPP_ARCH_NAMESPACE {
     always contains at least one native vector.
 */
 template<unsigned N>
-class int16<N, void> : public any_int16<N, int16<N,void>> {
+class SIMDPP_MAY_ALIAS int16<N, void> : public any_int16<N, int16<N,void>> {
 public:
     static const unsigned type_tag = SIMDPP_TAG_INT;
     using element_type = int16_t;
@@ -81,7 +81,7 @@ private:
     always contains at least one native vector.
 */
 template<unsigned N>
-class uint16<N, void> : public any_int16<N, uint16<N,void>> {
+class SIMDPP_MAY_ALIAS uint16<N, void> : public any_int16<N, uint16<N,void>> {
 public:
     static const unsigned type_tag = SIMDPP_TAG_UINT;
     using element_type = uint16_t;
@@ -135,7 +135,7 @@ private:
 /// Class representing a mask for 16-bit integer vector of arbitrary
 /// length.
 template<unsigned N>
-class mask_int16<N, void> : public any_int16<N, mask_int16<N,void>> {
+class SIMDPP_MAY_ALIAS mask_int16<N, void> : public any_int16<N, mask_int16<N,void>> {
 public:
     static const unsigned type_tag = SIMDPP_TAG_MASK_INT;
     using base_vector_type = mask_int16v;
@@ -26,7 +26,7 @@ namespace SIMDPP_ARCH_NAMESPACE {
     always contains at least one native vector.
 */
 template<unsigned N>
-class int32<N, void> : public any_int32<N, int32<N,void>> {
+class SIMDPP_MAY_ALIAS int32<N, void> : public any_int32<N, int32<N,void>> {
 public:
     static const unsigned type_tag = SIMDPP_TAG_INT;
     using element_type = int32_t;
@@ -81,7 +81,7 @@ private:
     always contains at least one native vector.
 */
 template<unsigned N>
-class uint32<N, void> : public any_int32<N, uint32<N,void>> {
+class SIMDPP_MAY_ALIAS uint32<N, void> : public any_int32<N, uint32<N,void>> {
 public:
     static const unsigned type_tag = SIMDPP_TAG_UINT;
     using element_type = uint32_t;
@@ -136,7 +136,7 @@ private:
 /// Class representing a mask for 32-bit integer vector of arbitrary
 /// length.
 template<unsigned N>
-class mask_int32<N, void> : public any_int32<N, mask_int32<N,void>> {
+class SIMDPP_MAY_ALIAS mask_int32<N, void> : public any_int32<N, mask_int32<N,void>> {
 public:
     static const unsigned type_tag = SIMDPP_TAG_MASK_INT;
     using base_vector_type = mask_int32v;
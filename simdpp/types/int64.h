@@ -25,7 +25,7 @@ namespace SIMDPP_ARCH_NAMESPACE {
     always contains at least one native vector.
 */
 template<unsigned N>
-class int64<N, void> : public any_int64<N, int64<N,void>> {
+class SIMDPP_MAY_ALIAS int64<N, void> : public any_int64<N, int64<N,void>> {
 public:
     static const unsigned type_tag = SIMDPP_TAG_INT;
     using element_type = int64_t;
@@ -82,7 +82,7 @@ private:
     always contains at least one native vector.
 */
 template<unsigned N>
-class uint64<N, void> : public any_int64<N, uint64<N,void>> {
+class SIMDPP_MAY_ALIAS uint64<N, void> : public any_int64<N, uint64<N,void>> {
 public:
     static const unsigned type_tag = SIMDPP_TAG_UINT;
     using element_type = uint64_t;
@@ -136,7 +136,7 @@ private:
 /// Class representing a mask for 64-bit integer vector of arbitrary
 /// length.
 template<unsigned N>
-class mask_int64<N, void> : public any_int64<N, mask_int64<N,void>> {
+class SIMDPP_MAY_ALIAS mask_int64<N, void> : public any_int64<N, mask_int64<N,void>> {
 public:
     static const unsigned type_tag = SIMDPP_TAG_MASK_INT;
     using base_vector_type = mask_int64v;
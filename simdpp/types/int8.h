@@ -26,7 +26,7 @@ namespace SIMDPP_ARCH_NAMESPACE {
     always contains at least one native vector.
 */
 template<unsigned N>
-class int8<N, void> : public any_int8<N, int8<N, void>> {
+class SIMDPP_MAY_ALIAS int8<N, void> : public any_int8<N, int8<N, void>> {
 public:
     static const unsigned type_tag = SIMDPP_TAG_INT;
     using element_type = int8_t;
@@ -82,7 +82,7 @@ private:
     always contains at least one native vector.
 */
 template<unsigned N>
-class uint8<N, void> : public any_int8<N, uint8<N, void>> {
+class SIMDPP_MAY_ALIAS uint8<N, void> : public any_int8<N, uint8<N, void>> {
 public:
     static const unsigned type_tag = SIMDPP_TAG_UINT;
     using element_type = uint8_t;
@@ -137,7 +137,7 @@ private:
 /// Class representing a mask for 8-bit integer vector of arbitrary
 /// length.
 template<unsigned N>
-class mask_int8<N, void> : public any_int8<N, mask_int8<N,void>> {
+class SIMDPP_MAY_ALIAS mask_int8<N, void> : public any_int8<N, mask_int8<N,void>> {
 public:
     static const unsigned type_tag = SIMDPP_TAG_MASK_INT;
     using base_vector_type = mask_int8v;
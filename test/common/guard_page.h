@@ -0,0 +1,76 @@
+/*  Copyright (C) 2017  Povilas Kanapickas <povilas@radix.lt>
+
+    Distributed under the Boost Software License, Version 1.0.
+        (See accompanying file LICENSE_1_0.txt or copy at
+            http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#ifndef SIMDPP_TEST_COMMON_GUARD_PAGE_H
+#define SIMDPP_TEST_COMMON_GUARD_PAGE_H
+
+#include <cstddef>
+#include <cstdlib>
+#include <iostream>
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <sys/mman.h>
+#include <unistd.h>
+#define SIMDPP_TEST_HAS_GUARD_PAGE 1
+#else
+#define SIMDPP_TEST_HAS_GUARD_PAGE 0
+#endif
+
+/** A page of readable and writable memory that is immediately followed by a
+    page that can't be accessed. Any access past the end of the buffer faults,
+    which allows to test that functions don't read past the memory they are
+    allowed to touch. On systems without mmap() the buffer is followed by
+    ordinary memory and the check is ineffective.
+*/
+class GuardPage {
+public:
+    GuardPage()
+    {
+#if SIMDPP_TEST_HAS_GUARD_PAGE
+        size_ = static_cast<std::size_t>(sysconf(_SC_PAGESIZE));
+        void* p = mmap(nullptr, size_ * 2, PROT_READ | PROT_WRITE,
+                       MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+        if (p == MAP_FAILED || mprotect(static_cast<char*>(p) + size_,
+                                        size_, PROT_NONE) != 0) {
+            std::cerr << "Could not set up a guard page\n";
+            std::abort();
+        }
+        data_ = static_cast<char*>(p);
+#else
+        size_ = 4096;
+        storage_ = new char[size_ * 3];
+        std::size_t offset = reinterpret_cast<std::size_t>(storage_) % size_;
+        data_ = storage_ + (offset == 0 ? 0 : size_ - offset);
+#endif
+    }
+
+    ~GuardPage()
+    {
+#if SIMDPP_TEST_HAS_GUARD_PAGE
+        munmap(data_, size_ * 2);
+#else
+        delete[] storage_;
+#endif
+    }
+
+    GuardPage(const GuardPage&) = delete;
+    GuardPage& operator=(const GuardPage&) = delete;
+
+    /// Returns a pointer to the first inaccessible byte cast to T*. The
+    /// pointer is aligned to the page size.
+    template<class T>
+    T* end() const { return reinterpret_cast<T*>(data_ + size_); }
+
+private:
+    char* data_;
+    std::size_t size_;
+#if !SIMDPP_TEST_HAS_GUARD_PAGE
+    char* storage_;
+#endif
+};
+
+#endif
@@ -442,3 +442,28 @@ SIMDPP_INSTANTIATE_DISPATCHER(
     (template std::pair<int, int>
         test_dispatcher_ret_template2_nondeductible<int, int>())
 )
+
+template<class ArchTag>
+int test_dispatcher_functor::operator()(ArchTag, int arg) const
+{
+    return base + arg;
+}
+
+template<class ArchTag>
+simdpp::Arch test_dispatcher_functor::get_arch(ArchTag)
+{
+    return ArchTag::arch();
+}
+
+template<class ArchTag>
+void test_dispatcher_functor::accumulate(ArchTag, int arg, int arg2)
+{
+    base += arg + arg2;
+}
+
+SIMDPP_MAKE_MEMBER_DISPATCHER((int)(test_dispatcher_functor)(operator())
+                              ((int) arg)(const))
+SIMDPP_MAKE_MEMBER_DISPATCHER((simdpp::Arch)(test_dispatcher_functor)
+                              (get_arch)())
+SIMDPP_MAKE_MEMBER_DISPATCHER((void)(test_dispatcher_functor)(accumulate)
+                              ((int) arg, (int) arg2))
@@ -79,3 +79,19 @@ template<class T>
 std::pair<T, T> test_dispatcher_ret_template_nondeductible();
 template<class T, class U>
 std::pair<T, U> test_dispatcher_ret_template2_nondeductible();
+
+struct test_dispatcher_functor {
+    int base;
+
+    int operator()(int arg) const;
+    template<class ArchTag>
+    int operator()(ArchTag, int arg) const;
+
+    simdpp::Arch get_arch();
+    template<class ArchTag>
+    simdpp::Arch get_arch(ArchTag);
+
+    void accumulate(int arg, int arg2);
+    template<class ArchTag>
+    void accumulate(ArchTag, int arg, int arg2);
+};
@@ -0,0 +1,49 @@
+/*  Copyright (C) 2017  Povilas Kanapickas <povilas@radix.lt>
+
+    Distributed under the Boost Software License, Version 1.0.
+        (See accompanying file LICENSE_1_0.txt or copy at
+            http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+// The indirect function resolvers run before static initialization, thus the
+// instruction set must be queried directly from the processor
+#include <simdpp/dispatch/get_arch_raw_cpuid.h>
+#define SIMDPP_USER_ARCH_INFO ::simdpp::get_arch_raw_cpuid()
+#include "dispatcher_ifunc.h"
+#include <simdpp/simd.h>
+
+namespace SIMDPP_ARCH_NAMESPACE {
+
+simdpp::Arch test_ifunc_get_arch()
+{
+    return simdpp::this_compile_arch();
+}
+
+int test_ifunc_ret2(int arg, int arg2)
+{
+    return arg + arg2;
+}
+
+void test_ifunc_void1(int arg)
+{
+    g_test_ifunc_val = arg;
+}
+
+template<class T>
+simdpp::Arch test_ifunc_get_arch_template()
+{
+    return simdpp::this_compile_arch();
+}
+
+} // namespace SIMDPP_ARCH_NAMESPACE
+
+SIMDPP_MAKE_DISPATCHER((simdpp::Arch)(test_ifunc_get_arch)())
+SIMDPP_MAKE_DISPATCHER((int)(test_ifunc_ret2)((int) arg, (int) arg2))
+SIMDPP_MAKE_DISPATCHER((void)(test_ifunc_void1)((int) arg))
+
+SIMDPP_MAKE_DISPATCHER((template<class T>) (<T>)
+                       (simdpp::Arch) (test_ifunc_get_arch_template) ())
+
+SIMDPP_INSTANTIATE_DISPATCHER(
+    (template simdpp::Arch test_ifunc_get_arch_template<int>())
+)
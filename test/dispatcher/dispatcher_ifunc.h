@@ -0,0 +1,19 @@
+/*  Copyright (C) 2017  Povilas Kanapickas <povilas@radix.lt>
+
+    Distributed under the Boost Software License, Version 1.0.
+        (See accompanying file LICENSE_1_0.txt or copy at
+            http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#include <simdpp/dispatch/arch.h>
+
+extern int g_test_ifunc_val;
+
+simdpp::Arch test_ifunc_get_arch();
+int test_ifunc_ret2(int arg, int arg2);
+void test_ifunc_void1(int arg);
+
+// Uses the regular dispatch mechanism, because templates are never emitted
+// as indirect functions
+template<class T>
+simdpp::Arch test_ifunc_get_arch_template();
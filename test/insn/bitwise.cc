@@ -157,12 +157,32 @@ void test_bitwise_n(TestResultsSet& tc, TestReporter& tr)
     }
 }
 
+void test_popcnt_absolute(TestReporter& tr)
+{
+    using namespace simdpp;
+
+    // 64 + 1 + 2 + 0 bits in each group of four elements
+    uint64<16> a = make_uint(0xffffffffffffffff, 0x0000000000000001,
+                             0x8000000000000001, 0x0000000000000000);
+    TEST_EQUAL(tr, 4u * 67u, reduce_popcnt(a));
+    TEST_EQUAL(tr, 4u * 67u, reduce_popcnt(uint32<32>(a)));
+    TEST_EQUAL(tr, 4u * 67u, reduce_popcnt(uint8<128>(a)));
+}
+
 void test_bitwise(TestResults& res, TestReporter& tr)
 {
+    using namespace simdpp;
+
     TestResultsSet& tc = res.new_results_set("bitwise");
     test_bitwise_n<16>(tc, tr);
     test_bitwise_n<32>(tc, tr);
     test_bitwise_n<64>(tc, tr);
+
+    // reduce_popcnt accumulates the counts of several native vectors
+    test_popcnt_type<uint8<128>, uint32<32>>(tc);
+    test_popcnt_type<uint32<32>, uint32<32>>(tc);
+    test_popcnt_type<uint64<16>, uint32<32>>(tc);
+    test_popcnt_absolute(tr);
 }
 
 } // namespace SIMDPP_ARCH_NAMESPACE
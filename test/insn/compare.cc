@@ -87,6 +87,29 @@ void test_compare_n(TestResultsSet& tc)
         TEST_COMPARE_TESTER_HELPER(tc, uint32_n, sl, sr);
     }
 
+    // detect_conflicts
+    {
+        TestData<uint32<B/4>> s32;
+        s32.add(make_uint(0x11111111, 0x22222222, 0x33333333, 0x44444444));
+        s32.add(make_uint(0x11111111, 0x22222222, 0x11111111, 0x22222222));
+        s32.add(make_uint(0x00000000, 0x00000000, 0xffffffff, 0x00000000));
+        s32.add(make_uint(0xffffffff));
+
+        TEST_PUSH_ARRAY_OP1(tc, uint32<B/4>, detect_conflicts, s32);
+        TEST_PUSH_ARRAY_OP1(tc, int32<B/4>, detect_conflicts, s32);
+
+        TestData<uint64<B/8>> s64;
+        s64.add(make_uint(0x1111111111111111, 0x2222222222222222));
+        s64.add(make_uint(0x1111111111111111, 0x1111111111111111,
+                          0x2222222222222222, 0x1111111111111111));
+        s64.add(make_uint(0x0000000000000000, 0xffffffff00000000,
+                          0x00000000ffffffff, 0x0000000000000000));
+        s64.add(make_uint(0xffffffffffffffff));
+
+        TEST_PUSH_ARRAY_OP1(tc, uint64<B/8>, detect_conflicts, s64);
+        TEST_PUSH_ARRAY_OP1(tc, int64<B/8>, detect_conflicts, s64);
+    }
+
 #if SIMDPP_USE_NULL || SIMDPP_USE_AVX2 || SIMDPP_USE_NEON64
     //int64_n
     {
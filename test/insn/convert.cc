@@ -104,6 +104,22 @@ void test_convert_int16_n(TestResultsSet& ts)
     TEST_PUSH_ARRAY_OP1_T(ts, uint64_8n,  uint16_2n, to_uint64, s);
     TEST_PUSH_ARRAY_OP1_T(ts, float64_8n,  int16_2n, to_float64, s);
     TEST_PUSH_ARRAY_OP1_T(ts, float64_8n, uint16_2n, to_float64, s);
+
+    TEST_PUSH_ARRAY_OP1_T(ts,  int8_n,     int16_2n, to_int8_sat, s);
+    TEST_PUSH_ARRAY_OP1_T(ts,  int8_n,    uint16_2n, to_int8_sat, s);
+    TEST_PUSH_ARRAY_OP1_T(ts, uint8_n,     int16_2n, to_uint8_sat, s);
+    TEST_PUSH_ARRAY_OP1_T(ts, uint8_n,    uint16_2n, to_uint8_sat, s);
+
+    TestData<uint16_2n> sh;
+    sh.add(make_uint(0x0000, 0x0001, 0x03ff, 0x0400));
+    sh.add(make_uint(0x3c00, 0x7bff, 0x7c00, 0x7e00));
+    sh.add(make_uint(0x8000, 0x8001, 0xbc00, 0xfc00));
+    sh.add(make_uint(0x3f80, 0x4049, 0x7f80, 0xff80));
+
+    TEST_PUSH_ARRAY_OP1_T(ts, float32_4n, uint16_2n, float16_to_float32, s);
+    TEST_PUSH_ARRAY_OP1_T(ts, float32_4n, uint16_2n, float16_to_float32, sh);
+    TEST_PUSH_ARRAY_OP1_T(ts, float32_4n, uint16_2n, bfloat16_to_float32, s);
+    TEST_PUSH_ARRAY_OP1_T(ts, float32_4n, uint16_2n, bfloat16_to_float32, sh);
 }
 
 template<unsigned B>
@@ -164,6 +180,15 @@ void test_convert_int32_n(TestResultsSet& ts)
     TEST_PUSH_ARRAY_OP1_T(ts, uint64_8n,  uint32_4n, to_uint64, s);
     TEST_PUSH_ARRAY_OP1_T(ts, float64_8n,  int32_4n, to_float64, s);
     TEST_PUSH_ARRAY_OP1_T(ts, float64_8n, uint32_4n, to_float64, s);
+
+    TEST_PUSH_ARRAY_OP1_T(ts,  int8_n,     int32_4n, to_int8_sat, s);
+    TEST_PUSH_ARRAY_OP1_T(ts,  int8_n,    uint32_4n, to_int8_sat, s);
+    TEST_PUSH_ARRAY_OP1_T(ts, uint8_n,     int32_4n, to_uint8_sat, s);
+    TEST_PUSH_ARRAY_OP1_T(ts, uint8_n,    uint32_4n, to_uint8_sat, s);
+    TEST_PUSH_ARRAY_OP1_T(ts,  int16_2n,   int32_4n, to_int16_sat, s);
+    TEST_PUSH_ARRAY_OP1_T(ts,  int16_2n,  uint32_4n, to_int16_sat, s);
+    TEST_PUSH_ARRAY_OP1_T(ts, uint16_2n,   int32_4n, to_uint16_sat, s);
+    TEST_PUSH_ARRAY_OP1_T(ts, uint16_2n,  uint32_4n, to_uint16_sat, s);
 }
 
 template<unsigned B>
@@ -253,6 +278,19 @@ void test_convert_int64_n(TestResultsSet& ts)
     TEST_PUSH_ARRAY_OP1_T(ts, float64_8n, uint64_8n, to_float64, s);
 #endif
 
+    TEST_PUSH_ARRAY_OP1_T(ts,  int8_n,     int64_8n, to_int8_sat, s);
+    TEST_PUSH_ARRAY_OP1_T(ts,  int8_n,    uint64_8n, to_int8_sat, s);
+    TEST_PUSH_ARRAY_OP1_T(ts, uint8_n,     int64_8n, to_uint8_sat, s);
+    TEST_PUSH_ARRAY_OP1_T(ts, uint8_n,    uint64_8n, to_uint8_sat, s);
+    TEST_PUSH_ARRAY_OP1_T(ts,  int16_2n,   int64_8n, to_int16_sat, s);
+    TEST_PUSH_ARRAY_OP1_T(ts,  int16_2n,  uint64_8n, to_int16_sat, s);
+    TEST_PUSH_ARRAY_OP1_T(ts, uint16_2n,   int64_8n, to_uint16_sat, s);
+    TEST_PUSH_ARRAY_OP1_T(ts, uint16_2n,  uint64_8n, to_uint16_sat, s);
+    TEST_PUSH_ARRAY_OP1_T(ts,  int32_4n,   int64_8n, to_int32_sat, s);
+    TEST_PUSH_ARRAY_OP1_T(ts,  int32_4n,  uint64_8n, to_int32_sat, s);
+    TEST_PUSH_ARRAY_OP1_T(ts, uint32_4n,   int64_8n, to_uint32_sat, s);
+    TEST_PUSH_ARRAY_OP1_T(ts, uint32_4n,  uint64_8n, to_uint32_sat, s);
+
 #if SIMDPP_X86
     ts.unset_precision();
 #endif
@@ -325,6 +363,45 @@ void test_convert_float32_n(TestResultsSet& ts)
 #if SIMDPP_X86
     ts.unset_precision();
 #endif
+
+    TestData<float32_4n> sh;
+    sh.add(make_float(65504.0, 65520.0, 65536.0, 1e10));
+    sh.add(make_float(6e-8, 3e-8, 2.9e-8, 6.1e-5));
+    sh.add(make_float(1.0009765625, 1.00048828125, 1.00146484375, 0.1));
+    sh.add(make_float(-3.14159265, -1e-10, -1e-45, 1.5e-5));
+    sh.add(make_float(1.00390625, 1.001953125, 1.005859375, 3.0e38));
+
+    TEST_PUSH_ARRAY_OP1_T(ts, uint16_2n, float32_4n, float32_to_float16, sn);
+    TEST_PUSH_ARRAY_OP1_T(ts, uint16_2n, float32_4n, float32_to_float16, sh);
+    TEST_PUSH_ARRAY_OP1_T(ts, uint16_2n, float32_4n, float32_to_bfloat16, sn);
+    TEST_PUSH_ARRAY_OP1_T(ts, uint16_2n, float32_4n, float32_to_bfloat16, sh);
+
+    TestData<float32_4n> sr = sn;
+    sr.add(make_float(0.5, -0.5, 1.5, -1.5));
+    sr.add(make_float(2.5, -2.5, 2.75, -2.75));
+    sr.add(make_float(0.25, -0.25, 4194303.5, -4194303.5));
+
+    TEST_PUSH_ARRAY_OP1_T(ts,  int32_4n,   float32_4n, to_int32_round, sr);
+    TEST_PUSH_ARRAY_OP1_T(ts,  int32_4n,   float32_4n, to_int32_floor, sr);
+    TEST_PUSH_ARRAY_OP1_T(ts,  int32_4n,   float32_4n, to_int32_ceil, sr);
+#if SIMDPP_HAS_FLOAT32_TO_INT64_CONVERSION
+    TEST_PUSH_ARRAY_OP1_T(ts,  int64_8n,   float32_4n, to_int64_round, sr);
+    TEST_PUSH_ARRAY_OP1_T(ts,  int64_8n,   float32_4n, to_int64_floor, sr);
+    TEST_PUSH_ARRAY_OP1_T(ts,  int64_8n,   float32_4n, to_int64_ceil, sr);
+#endif
+
+    // saturating conversions are defined for out of range values and NaNs
+    float nanf = std::numeric_limits<float>::quiet_NaN();
+    float inff = std::numeric_limits<float>::infinity();
+    TestData<float32_4n> ss = sr;
+    ss.add(make_float(2147483520.0, 2147483648.0, -2147483648.0, -2147483904.0));
+    ss.add(make_float(1e20, -1e20, 3.0e38, -3.0e38));
+    ss.add(make_float(nanf, -nanf, inff, -inff));
+
+    TEST_PUSH_ARRAY_OP1_T(ts,  int32_4n,   float32_4n, to_int32_sat, ss);
+#if SIMDPP_HAS_FLOAT32_TO_INT64_CONVERSION
+    TEST_PUSH_ARRAY_OP1_T(ts,  int64_8n,   float32_4n, to_int64_sat, ss);
+#endif
 }
 
 template<unsigned B>
@@ -406,6 +483,39 @@ void test_convert_float64_n(TestResultsSet& ts)
 #if SIMDPP_X86
     ts.unset_precision();
 #endif
+
+    TestData<float64_8n> sr = sn;
+    sr.add(make_float(0.5, -0.5));
+    sr.add(make_float(1.5, -1.5));
+    sr.add(make_float(2.5, -2.5));
+    sr.add(make_float(0.25, -2.75));
+    sr.add(make_float(1073741823.5, -1073741823.5));
+
+    TEST_PUSH_ARRAY_OP1_T(ts,  int32_4n,   float64_8n, to_int32_round, sr);
+    TEST_PUSH_ARRAY_OP1_T(ts,  int32_4n,   float64_8n, to_int32_floor, sr);
+    TEST_PUSH_ARRAY_OP1_T(ts,  int32_4n,   float64_8n, to_int32_ceil, sr);
+#if SIMDPP_HAS_FLOAT64_TO_INT64_CONVERSION
+    TEST_PUSH_ARRAY_OP1_T(ts,  int64_8n,   float64_8n, to_int64_round, sr);
+    TEST_PUSH_ARRAY_OP1_T(ts,  int64_8n,   float64_8n, to_int64_floor, sr);
+    TEST_PUSH_ARRAY_OP1_T(ts,  int64_8n,   float64_8n, to_int64_ceil, sr);
+#endif
+
+    // saturating conversions are defined for out of range values and NaNs
+    double nan = std::numeric_limits<double>::quiet_NaN();
+    double inf = std::numeric_limits<double>::infinity();
+    TestData<float64_8n> ss = sr;
+    ss.add(make_float(2147483647.0, 2147483648.0));
+    ss.add(make_float(-2147483648.0, -2147483649.0));
+    ss.add(make_float(9223372036854774784.0, 9223372036854775808.0));
+    ss.add(make_float(-9223372036854775808.0, -1e19));
+    ss.add(make_float(1e300, -1e300));
+    ss.add(make_float(nan, -nan));
+    ss.add(make_float(inf, -inf));
+
+    TEST_PUSH_ARRAY_OP1_T(ts,  int32_4n,   float64_8n, to_int32_sat, ss);
+#if SIMDPP_HAS_FLOAT64_TO_INT64_CONVERSION
+    TEST_PUSH_ARRAY_OP1_T(ts,  int64_8n,   float64_8n, to_int64_sat, ss);
+#endif
 }
 
 void test_convert(TestResults& res)
@@ -8,6 +8,8 @@
 #include "../utils/test_helpers.h"
 #include "../utils/test_results.h"
 #include <simdpp/simd.h>
+#include <cmath>
+#include <limits>
 
 namespace SIMDPP_ARCH_NAMESPACE {
 
@@ -67,6 +69,7 @@ void test_math_float32_n(TestResultsSet& tc, const TestOptions& opts)
     TEST_PUSH_ARRAY_OP1(tc, float32_n, trunc, s);
     TEST_PUSH_ARRAY_OP1(tc, float32_n, floor, s);
     TEST_PUSH_ARRAY_OP1(tc, float32_n, ceil, s);
+    TEST_PUSH_ARRAY_OP1(tc, float32_n, round, s);
     tc.unset_fp_zero_equal();
 
 #if (SIMDPP_USE_FMA3 || SIMDPP_USE_FMA4 || SIMDPP_USE_NULL) && !SIMDPP_USE_AVX512F
@@ -95,6 +98,74 @@ void test_math_float32_n(TestResultsSet& tc, const TestOptions& opts)
 
     TEST_PUSH_ALL_COMB_OP1_T(tc, float, float32_n, reduce_min, snan);
     TEST_PUSH_ALL_COMB_OP1_T(tc, float, float32_n, reduce_max, snan);
+
+    TestData<float32_n> sround;
+    sround.add(make_float(0.5f, -0.5f, 1.5f, -1.5f));
+    sround.add(make_float(2.75f, -2.75f, 4194303.5f, -4194303.5f));
+
+    tc.set_fp_zero_equal();
+    TEST_PUSH_ARRAY_OP1(tc, float32_n, trunc, sround);
+    TEST_PUSH_ARRAY_OP1(tc, float32_n, floor, sround);
+    TEST_PUSH_ARRAY_OP1(tc, float32_n, ceil, sround);
+    TEST_PUSH_ARRAY_OP1(tc, float32_n, round, sround);
+    tc.unset_fp_zero_equal();
+
+    // Denormals are avoided as some architectures flush them to zero
+    TestData<float32_n> sexp;
+    sexp.add(make_float(0.0f, -0.0f, 1.0f, -1.0f));
+    sexp.add(make_float(0.5f, 2.0f, 10.0f, -10.0f));
+    sexp.add(make_float(0.1f, 3.5f, 123.456f, -0.3f));
+    sexp.add(make_float(88.0f, -87.0f, 100.0f, -110.0f));
+    sexp.add(make_float(1e30f, 1e-30f, 0.70710677f, 1.4142135f));
+    sexp.add(make_float(nanf, inff, -inff, 1.0f));
+
+    // The results depend on whether fused multiply-add is available
+    tc.set_precision(2);
+    TEST_PUSH_ARRAY_OP1(tc, float32_n, exp, sexp);
+    TEST_PUSH_ARRAY_OP1(tc, float32_n, exp2, sexp);
+    TEST_PUSH_ARRAY_OP1(tc, float32_n, exp_e, sexp);
+    TEST_PUSH_ARRAY_OP1(tc, float32_n, exp2_e, sexp);
+    TEST_PUSH_ARRAY_OP1(tc, float32_n, log, sexp);
+    TEST_PUSH_ARRAY_OP1(tc, float32_n, log2, sexp);
+    TEST_PUSH_ARRAY_OP1(tc, float32_n, log_e, sexp);
+    TEST_PUSH_ARRAY_OP1(tc, float32_n, log2_e, sexp);
+    tc.unset_precision();
+
+    TestData<float32_n> spow;
+    spow.add(make_float(0.0f, -0.0f, 1.0f, -1.0f));
+    spow.add(make_float(0.5f, 2.0f, -2.0f, 3.0f));
+    spow.add(make_float(-0.5f, 1.5f, -3.0f, 2.5f));
+    spow.add(make_float(nanf, inff, -inff, 0.1f));
+
+    tc.set_precision(1);
+    TEST_PUSH_ALL_COMB_OP2(tc, float32_n, pow, spow);
+    tc.unset_precision();
+
+    TestData<float32_n> strig;
+    strig.add(make_float(0.0f, -0.0f, 0.5f, -0.5f));
+    strig.add(make_float(1.0f, -1.0f, 0.7853982f, 2.0f));
+    strig.add(make_float(3.0f, -4.5f, 10.0f, -100.0f));
+    strig.add(make_float(1000.0f, 6000.5f, 0.1f, -3.1415927f));
+    strig.add(make_float(nanf, inff, -inff, 1.5f));
+
+    // The results depend on whether fused multiply-add is available
+    tc.set_precision(4);
+    TEST_PUSH_ARRAY_OP1(tc, float32_n, sin, strig);
+    TEST_PUSH_ARRAY_OP1(tc, float32_n, cos, strig);
+    TEST_PUSH_ARRAY_OP1(tc, float32_n, tan, strig);
+    TEST_PUSH_ARRAY_OP1(tc, float32_n, atan, strig);
+    TEST_PUSH_ARRAY_OP1(tc, float32_n, tanh, strig);
+    TEST_PUSH_ARRAY_OP1(tc, float32_n, sigmoid, strig);
+    TEST_PUSH_ALL_COMB_OP2(tc, float32_n, atan2, strig);
+
+    tc.reset_seq();
+    for (unsigned i = 0; i < strig.size(); i++) {
+        float32_n rs, rc;
+        sincos((float32_n) strig[i], rs, rc);
+        TEST_PUSH(tc, float32_n, rs);
+        TEST_PUSH(tc, float32_n, rc);
+    }
+    tc.unset_precision();
 }
 
 template<unsigned B>
@@ -135,6 +206,7 @@ void test_math_float64_n(TestResultsSet& tc, const TestOptions& opts)
     TEST_PUSH_ARRAY_OP1(tc, float64_n, trunc, s);
     TEST_PUSH_ARRAY_OP1(tc, float64_n, floor, s);
     TEST_PUSH_ARRAY_OP1(tc, float64_n, ceil, s);
+    TEST_PUSH_ARRAY_OP1(tc, float64_n, round, s);
     tc.unset_fp_zero_equal();
 
     TestData<float64_n> snan;
@@ -190,10 +262,278 @@ void test_math_float64_n(TestResultsSet& tc, const TestOptions& opts)
     tc.unset_precision();
     TEST_PUSH_ALL_COMB_OP1_T(tc, double, float64_n, reduce_min, snan);
     TEST_PUSH_ALL_COMB_OP1_T(tc, double, float64_n, reduce_max, snan);
+
+    TestData<float64_n> sround;
+    sround.add(make_float(0.5, -0.5));
+    sround.add(make_float(1.5, -1.5));
+    sround.add(make_float(2.75, -2.75));
+    sround.add(make_float(1125899906842623.5, -1125899906842623.5));
+
+    tc.set_fp_zero_equal();
+    TEST_PUSH_ARRAY_OP1(tc, float64_n, trunc, sround);
+    TEST_PUSH_ARRAY_OP1(tc, float64_n, floor, sround);
+    TEST_PUSH_ARRAY_OP1(tc, float64_n, ceil, sround);
+    TEST_PUSH_ARRAY_OP1(tc, float64_n, round, sround);
+    tc.unset_fp_zero_equal();
+
+    TestData<float64_n> sexp;
+    sexp.add(make_float(0.0, -0.0));
+    sexp.add(make_float(1.0, -1.0));
+    sexp.add(make_float(0.5, 2.0));
+    sexp.add(make_float(10.0, -10.0));
+    sexp.add(make_float(0.1, 123.456));
+    sexp.add(make_float(700.0, -700.0));
+    sexp.add(make_float(800.0, -800.0));
+    sexp.add(make_float(1e300, 1e-300));
+    sexp.add(make_float(0.7071067811865476, 1.4142135623730951));
+    sexp.add(make_float(nan, inf));
+    sexp.add(make_float(-inf, 1.0));
+
+    // The results depend on whether fused multiply-add is available
+    tc.set_precision(2);
+    TEST_PUSH_ARRAY_OP1(tc, float64_n, exp, sexp);
+    TEST_PUSH_ARRAY_OP1(tc, float64_n, exp2, sexp);
+    TEST_PUSH_ARRAY_OP1(tc, float64_n, exp_e, sexp);
+    TEST_PUSH_ARRAY_OP1(tc, float64_n, exp2_e, sexp);
+    TEST_PUSH_ARRAY_OP1(tc, float64_n, log, sexp);
+    TEST_PUSH_ARRAY_OP1(tc, float64_n, log2, sexp);
+    TEST_PUSH_ARRAY_OP1(tc, float64_n, log_e, sexp);
+    TEST_PUSH_ARRAY_OP1(tc, float64_n, log2_e, sexp);
+    tc.unset_precision();
+
+    TestData<float64_n> spow;
+    spow.add(make_float(0.0, -0.0));
+    spow.add(make_float(1.0, -1.0));
+    spow.add(make_float(0.5, 2.0));
+    spow.add(make_float(-2.0, 3.0));
+    spow.add(make_float(-0.5, 1.5));
+    spow.add(make_float(nan, inf));
+    spow.add(make_float(-inf, 0.1));
+
+    tc.set_precision(4);
+    TEST_PUSH_ALL_COMB_OP2(tc, float64_n, pow, spow);
+    tc.unset_precision();
+
+    TestData<float64_n> strig;
+    strig.add(make_float(0.0, -0.0));
+    strig.add(make_float(0.5, -0.5));
+    strig.add(make_float(1.0, -1.0));
+    strig.add(make_float(0.7853981633974483, 2.0));
+    strig.add(make_float(3.0, -4.5));
+    strig.add(make_float(10.0, -100.0));
+    strig.add(make_float(1000.0, 123456789.5));
+    strig.add(make_float(0.1, -3.141592653589793));
+    strig.add(make_float(nan, inf));
+    strig.add(make_float(-inf, 1.5));
+
+    // The results depend on whether fused multiply-add is available
+    tc.set_precision(4);
+    TEST_PUSH_ARRAY_OP1(tc, float64_n, sin, strig);
+    TEST_PUSH_ARRAY_OP1(tc, float64_n, cos, strig);
+    TEST_PUSH_ARRAY_OP1(tc, float64_n, tan, strig);
+    TEST_PUSH_ARRAY_OP1(tc, float64_n, atan, strig);
+    TEST_PUSH_ARRAY_OP1(tc, float64_n, tanh, strig);
+    TEST_PUSH_ARRAY_OP1(tc, float64_n, sigmoid, strig);
+    TEST_PUSH_ALL_COMB_OP2(tc, float64_n, atan2, strig);
+
+    tc.reset_seq();
+    for (unsigned i = 0; i < strig.size(); i++) {
+        float64_n rs, rc;
+        sincos((float64_n) strig[i], rs, rc);
+        TEST_PUSH(tc, float64_n, rs);
+        TEST_PUSH(tc, float64_n, rc);
+    }
+    tc.unset_precision();
+}
+
+// Returns the difference between r and the reference value in units in the
+// last place of the reference value
+template<class E>
+long double ulp_error(E r, long double ref)
+{
+    if (ref == 0)
+        return r == 0 ? 0 : std::numeric_limits<long double>::infinity();
+    int exp = std::ilogb(ref) - std::numeric_limits<E>::digits + 1;
+    return std::fabs(r - ref) / std::ldexp(1.0L, exp);
+}
+
+/*  Computes OP on K inputs generated by GEN(i) and checks that the results
+    are within MAX_ULP of REF computed in long double precision. The inputs
+    are chosen so that the results are finite normal numbers.
+*/
+#define TEST_ULP_OP1(TR, V, OP, REF, GEN, K, MAX_ULP)                           \
+{                                                                               \
+    using E = typename V::element_type;                                         \
+    SIMDPP_ALIGN(64) E in[V::length], out[V::length];                           \
+    for (unsigned i = 0; i < (K); i += V::length) {                             \
+        for (unsigned j = 0; j < V::length; j++)                                \
+            in[j] = (GEN)(i + j);                                               \
+        store(out, OP(load<V>(in)));                                            \
+        for (unsigned j = 0; j < V::length; j++) {                              \
+            long double err = ulp_error(out[j], REF((long double) in[j]));      \
+            TR.add_result(err <= (MAX_ULP));                                    \
+            if (err > (MAX_ULP)) {                                              \
+                TR.out() << __FILE__ << ":" << __LINE__ << ": " #OP "("        \
+                         << in[j] << ") error " << (double) err << " ULP\n";    \
+            }                                                                   \
+        }                                                                       \
+    }                                                                           \
+}
+
+// Returns x in range [lo, hi). The points are spread quasi-randomly so that
+// a small number of them covers the range well.
+static double spread(unsigned i, double lo, double hi)
+{
+    double f = i * 0.6180339887498949;
+    return lo + (hi - lo) * (f - std::floor(f));
+}
+
+template<class V>
+void test_math_exp_log_ulp(TestReporter& tr, double max_arg)
+{
+    using namespace simdpp;
+    using E = typename V::element_type;
+    const unsigned K = 4096;
+
+    // exp2 of the largest argument must not overflow
+    double max_exp = max_arg * 0.6931471805599453;
+    auto gen_exp = [=](unsigned i) { return E(spread(i, -max_exp, max_exp)); };
+    auto gen_exp2 = [=](unsigned i) { return E(spread(i, -max_arg, max_arg)); };
+    auto gen_log = [=](unsigned i) {
+        return E(std::exp2(spread(i, -max_arg, max_arg)));
+    };
+
+    TEST_ULP_OP1(tr, V, exp, std::exp, gen_exp, K, 1.5);
+    TEST_ULP_OP1(tr, V, exp2, std::exp2, gen_exp2, K, 1.5);
+    TEST_ULP_OP1(tr, V, log, std::log, gen_log, K, 1.0);
+    TEST_ULP_OP1(tr, V, log2, std::log2, gen_log, K, 2.0);
+}
+
+/*  The exponent is chosen so that |b * log2(a)| covers the whole range where
+    the result is a finite normal number. This includes bases close to 1 with
+    large exponents where the precision of log2(a) matters most.
+*/
+template<class V>
+void test_math_pow_ulp(TestReporter& tr, double max_arg, double max_ulp)
+{
+    using namespace simdpp;
+    using E = typename V::element_type;
+    const unsigned K = 4096;
+
+    SIMDPP_ALIGN(64) E a[V::length], b[V::length], r[V::length];
+    for (unsigned i = 0; i < K; i += V::length) {
+        for (unsigned j = 0; j < V::length; j++) {
+            a[j] = E(std::exp2(spread(i + j, -20.0, 20.0)));
+            double l = std::log2((double) a[j]);
+            b[j] = l == 0 ? E(1) : E(spread(K - i - j, -max_arg, max_arg) / l);
+        }
+        store(r, pow(load<V>(a), load<V>(b)));
+        for (unsigned j = 0; j < V::length; j++) {
+            long double ref = std::pow((long double) a[j], (long double) b[j]);
+            long double err = ulp_error(r[j], ref);
+            tr.add_result(err <= max_ulp);
+            if (err > max_ulp) {
+                tr.out() << __FILE__ << ":" << __LINE__ << ": pow(" << a[j]
+                         << ", " << b[j] << ") error " << (double) err
+                         << " ULP\n";
+            }
+        }
+    }
+}
+
+/*  Compares exp, exp2, log, log2 and pow against the long double functions
+    of the C library using the error bounds from the documentation. The check
+    is skipped if long double is not more precise than double.
+*/
+void test_math_ulp(TestReporter& tr)
+{
+    using namespace simdpp;
+    if (std::numeric_limits<long double>::digits < 64)
+        return;
+
+    std::streamsize precision = tr.out().precision(17);
+    test_math_exp_log_ulp<float32<8>>(tr, 125.0);
+    test_math_exp_log_ulp<float64<4>>(tr, 1020.0);
+    test_math_pow_ulp<float32<8>>(tr, 125.0, 1.0);
+    test_math_pow_ulp<float64<4>>(tr, 1020.0, 1.5);
+    tr.out().precision(precision);
+}
+
+/*  Checks sin, cos and tan against the C library from small arguments up to
+    max_arg and that the results are NaN above it. The allowed absolute error
+    is 4 times the machine epsilon, which also ensures that the results are
+    within [-1, 1] for sin and cos.
+*/
+template<class V>
+void test_math_trig_range(TestReporter& tr, double max_arg)
+{
+    using namespace simdpp;
+    using E = typename V::element_type;
+    const unsigned K = 4096;
+    const long double max_err = 4 * std::numeric_limits<E>::epsilon();
+    const double max_exp = std::log2(max_arg);
+    const double inf_exp = std::numeric_limits<E>::max_exponent;
+
+    SIMDPP_ALIGN(64) E a[V::length], s[V::length], c[V::length], t[V::length];
+    for (unsigned i = 0; i < K; i += V::length) {
+        for (unsigned j = 0; j < V::length; j++) {
+            unsigned n = i + j;
+            if (n == 0) {
+                a[j] = E(max_arg);
+            } else if (n == 1) {
+                a[j] = std::nextafter(E(max_arg), E(2 * max_arg));
+            } else if (n % 2 == 0) {
+                a[j] = E(std::exp2(spread(n, -4.0, max_exp)));
+            } else {
+                a[j] = E(std::exp2(spread(n, max_exp, inf_exp)));
+            }
+            if (n % 4 == 2)
+                a[j] = -a[j];
+        }
+        V rs, rc;
+        sincos(load<V>(a), rs, rc);
+        store(s, rs);
+        store(c, rc);
+        store(t, tan(load<V>(a)));
+        for (unsigned j = 0; j < V::length; j++) {
+            bool success;
+            if (std::fabs(a[j]) > max_arg) {
+                success = std::isnan(s[j]) && std::isnan(c[j]) &&
+                          std::isnan(t[j]);
+            } else {
+                long double x = a[j];
+                long double ref_t = std::tan(x);
+                success = std::fabs(s[j] - std::sin(x)) <= max_err &&
+                          std::fabs(c[j] - std::cos(x)) <= max_err &&
+                          std::fabs(t[j] - ref_t) <=
+                            max_err * std::fmax(1.0L, ref_t * ref_t);
+            }
+            tr.add_result(success);
+            if (!success) {
+                tr.out() << __FILE__ << ":" << __LINE__ << ": x = " << a[j]
+                         << " sin " << s[j] << " cos " << c[j]
+                         << " tan " << t[j] << "\n";
+            }
+        }
+    }
+}
+
+// Checks that odd functions preserve the sign of zero
+template<class V>
+void test_math_signed_zero(TestReporter& tr)
+{
+    using namespace simdpp;
+    using U = typename V::uint_vector_type;
+    V nz = splat<V>(-0.0);
+    TEST_EQUAL(tr, bit_cast<U>(nz), bit_cast<U>(V(sin(nz))));
+    TEST_EQUAL(tr, bit_cast<U>(nz), bit_cast<U>(V(tan(nz))));
+    TEST_EQUAL(tr, bit_cast<U>(nz), bit_cast<U>(V(tanh(nz))));
 }
 
-void test_math_fp(TestResults& res, const TestOptions& opts)
+void test_math_fp(TestResults& res, TestReporter& tr, const TestOptions& opts)
 {
+    using namespace simdpp;
+
     TestResultsSet& ts = res.new_results_set("math_fp");
     test_math_float32_n<16>(ts, opts);
     test_math_float64_n<16>(ts, opts);
@@ -201,6 +541,15 @@ void test_math_fp(TestResults& res, const TestOptions& opts)
     test_math_float64_n<32>(ts, opts);
     test_math_float32_n<64>(ts, opts);
     test_math_float64_n<64>(ts, opts);
+    test_math_ulp(tr);
+    {
+        std::streamsize precision = tr.out().precision(17);
+        test_math_trig_range<float32<8>>(tr, 8192.0);
+        test_math_trig_range<float64<4>>(tr, 1073741824.0);
+        tr.out().precision(precision);
+    }
+    test_math_signed_zero<float32<8>>(tr);
+    test_math_signed_zero<float64<4>>(tr);
 }
 
 } // namespace SIMDPP_ARCH_NAMESPACE
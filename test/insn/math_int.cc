@@ -8,9 +8,68 @@
 #include "../utils/test_helpers.h"
 #include "../utils/test_results.h"
 #include <simdpp/simd.h>
+#include <limits>
+#include <type_traits>
 
 namespace SIMDPP_ARCH_NAMESPACE {
 
+template<class V, class D, class T, unsigned N>
+void test_div_invariant(TestResultsSet& tc, const TestData<D>& s,
+                        const T (&divisors)[N])
+{
+    using namespace simdpp;
+    tc.reset_seq();
+    for (unsigned i = 0; i < N; i++) {
+        divider<T> d(divisors[i]);
+        for (unsigned j = 0; j < s.size(); j++) {
+            V a = (V) s[j];
+            TEST_PUSH(tc, V, div(a, d));
+            TEST_PUSH(tc, V, mod(a, d));
+        }
+    }
+}
+
+/*  Compares div() and mod() against scalar division. The smallest signed
+    value divided by -1 is expected to wrap around.
+*/
+template<class V>
+void test_div_absolute(TestReporter& tr)
+{
+    using namespace simdpp;
+    using T = typename V::element_type;
+    using U = typename std::make_unsigned<T>::type;
+    const unsigned bits = sizeof(T) * 8;
+    const T min = std::numeric_limits<T>::min();
+    const T max = std::numeric_limits<T>::max();
+
+    const T dividends[] = { min, T(min + 1), T(-100), T(-7), T(-1), 0, 1, 7,
+                            100, T(max / 3), T(max - 1), max };
+    const T divisors[] = { 1, T(-1), 2, 4, 64, T(U(1) << (bits - 2)),
+                           T(U(1) << (bits - 1)), T(-2), T(-64), 3, 7, 10,
+                           T(-3), T(max - 1), max };
+    const unsigned count = sizeof(dividends) / sizeof(dividends[0]);
+
+    for (T dv : divisors) {
+        divider<T> d(dv);
+        for (unsigned i = 0; i < count; i += V::length) {
+            SIMDPP_ALIGN(64) T a[V::length], q[V::length], r[V::length];
+            for (unsigned j = 0; j < V::length; j++) {
+                a[j] = dividends[(i + j) % count];
+                if (std::is_signed<T>::value && dv == T(-1)) {
+                    q[j] = T(U(0) - U(a[j]));
+                    r[j] = 0;
+                } else {
+                    q[j] = T(a[j] / dv);
+                    r[j] = T(a[j] % dv);
+                }
+            }
+            V va = load(a);
+            TEST_EQUAL(tr, div(va, d), load<V>(q));
+            TEST_EQUAL(tr, mod(va, d), load<V>(r));
+        }
+    }
+}
+
 template<unsigned B>
 void test_math_int8_n(TestResultsSet& tc)
 {
@@ -63,6 +122,11 @@ void test_math_int8_n(TestResultsSet& tc)
     TEST_PUSH_ALL_COMB_OP1_T(tc, int8_t, int8_n, reduce_min, s);
     TEST_PUSH_ALL_COMB_OP1_T(tc, uint8_t, uint8_n, reduce_max, s);
     TEST_PUSH_ALL_COMB_OP1_T(tc, int8_t, int8_n, reduce_max, s);
+
+    const int8_t div_s8[] = { 1, 2, 3, 7, 10, 64, 127, -1, -2, -3, -7, -128 };
+    const uint8_t div_u8[] = { 1, 2, 3, 7, 10, 128, 255 };
+    test_div_invariant<int8_n>(tc, s, div_s8);
+    test_div_invariant<uint8_n>(tc, s, div_u8);
 }
 
 template<unsigned B>
@@ -126,6 +190,12 @@ void test_math_int16_n(TestResultsSet& tc)
     TEST_PUSH_ALL_COMB_OP1_T(tc, int16_t, int16_n, reduce_min, s);
     TEST_PUSH_ALL_COMB_OP1_T(tc, uint16_t, uint16_n, reduce_max, s);
     TEST_PUSH_ALL_COMB_OP1_T(tc, int16_t, int16_n, reduce_max, s);
+
+    const int16_t div_s16[] = { 1, 2, 3, 7, 10, 641, 0x4000, 0x7fff,
+                                -1, -2, -7, -641, -0x8000 };
+    const uint16_t div_u16[] = { 1, 2, 3, 7, 10, 641, 0x8000, 0xffff };
+    test_div_invariant<int16_n>(tc, s, div_s16);
+    test_div_invariant<uint16_n>(tc, s, div_u16);
 }
 
 template<unsigned B>
@@ -169,6 +239,17 @@ void test_math_int32_n(TestResultsSet& tc)
 
     TEST_PUSH_ALL_COMB_OP2_T(tc, uint64<B/4>, uint32_n, mull, s);
     TEST_PUSH_ALL_COMB_OP2_T(tc, uint32_n, uint32_n, mul_lo, s);
+    TEST_PUSH_ALL_COMB_OP2(tc, int32_n, mul_hi, s);
+    TEST_PUSH_ALL_COMB_OP2(tc, uint32_n, mul_hi, s);
+
+    tc.reset_seq();
+    for (unsigned i = 0; i < s.size(); i++) {
+        for (unsigned j = 0; j < s.size(); j++) {
+            int32_n c = (int32_n) s[(i + j) % s.size()];
+            TEST_PUSH(tc, int32_n, dot_accumulate((uint8<B>) s[i], (int8<B>) s[j], c));
+            TEST_PUSH(tc, int32_n, dot_accumulate((int16<B/2>) s[i], (int16<B/2>) s[j], c));
+        }
+    }
 
     TEST_PUSH_ARRAY_OP1(tc, int32_n, neg, s);
     TEST_PUSH_ARRAY_OP1(tc, int32_n, abs, s);
@@ -185,6 +266,13 @@ void test_math_int32_n(TestResultsSet& tc)
     TEST_PUSH_ALL_COMB_OP1_T(tc, int32_t, int32_n, reduce_min, s);
     TEST_PUSH_ALL_COMB_OP1_T(tc, uint32_t, uint32_n, reduce_max, s);
     TEST_PUSH_ALL_COMB_OP1_T(tc, int32_t, int32_n, reduce_max, s);
+
+    const int32_t div_s32[] = { 1, 2, 3, 7, 10, 641, 1000000007, 0x7fffffff,
+                                -1, -2, -7, -641, -0x7fffffff - 1 };
+    const uint32_t div_u32[] = { 1, 2, 3, 7, 10, 641, 1000000007,
+                                 0x80000000, 0xffffffff };
+    test_div_invariant<int32_n>(tc, s, div_s32);
+    test_div_invariant<uint32_n>(tc, s, div_u32);
 }
 
 template<unsigned B>
@@ -218,6 +306,22 @@ void test_math_int64_n(TestResultsSet& tc)
     TEST_PUSH_ALL_COMB_OP2(tc, int64_n, sub, s);
     TEST_PUSH_ALL_COMB_OP2(tc, uint64_n, add, s);
     TEST_PUSH_ALL_COMB_OP2(tc, uint64_n, sub, s);
+    TEST_PUSH_ALL_COMB_OP2(tc, int64_n, mul_hi, s);
+    TEST_PUSH_ALL_COMB_OP2(tc, uint64_n, mul_hi, s);
+
+    tc.reset_seq();
+    for (unsigned i = 0; i < s.size(); i++) {
+        for (unsigned j = 0; j < s.size(); j++) {
+            uint64_n ulo, uhi;
+            int64_n slo, shi;
+            mul_wide((uint64_n) s[i], (uint64_n) s[j], ulo, uhi);
+            mul_wide((int64_n) s[i], (int64_n) s[j], slo, shi);
+            TEST_PUSH(tc, uint64_n, ulo);
+            TEST_PUSH(tc, uint64_n, uhi);
+            TEST_PUSH(tc, int64_n, slo);
+            TEST_PUSH(tc, int64_n, shi);
+        }
+    }
 
 #if SIMDPP_USE_NULL || SIMDPP_USE_AVX2 || SIMDPP_USE_NEON64 || SIMDPP_USE_ALTIVEC
     TEST_PUSH_ALL_COMB_OP2(tc, int64_n, min, s);
@@ -241,10 +345,20 @@ void test_math_int64_n(TestResultsSet& tc)
     TEST_PUSH_ALL_COMB_OP1_T(tc, uint64_t, uint64_n, reduce_max, s);
     TEST_PUSH_ALL_COMB_OP1_T(tc, int64_t, int64_n, reduce_max, s);
 #endif
+
+    const int64_t div_s64[] = { 1, 2, 3, 7, 10, 641, 1000000007,
+                                0x7fffffffffffffff, -1, -2, -7, -641,
+                                -0x7fffffffffffffff - 1 };
+    const uint64_t div_u64[] = { 1, 2, 3, 7, 10, 641, 1000000007,
+                                 0x8000000000000000, 0xffffffffffffffff };
+    test_div_invariant<int64_n>(tc, s, div_s64);
+    test_div_invariant<uint64_n>(tc, s, div_u64);
 }
 
-void test_math_int(TestResults& res)
+void test_math_int(TestResults& res, TestReporter& tr)
 {
+    using namespace simdpp;
+
     TestResultsSet& tc = res.new_results_set("math_int");
     test_math_int8_n<16>(tc);
     test_math_int16_n<16>(tc);
@@ -259,7 +373,15 @@ void test_math_int(TestResults& res)
     test_math_int32_n<64>(tc);
     test_math_int64_n<64>(tc);
 
-    using namespace simdpp;
+    test_div_absolute<int8<16>>(tr);
+    test_div_absolute<uint8<16>>(tr);
+    test_div_absolute<int16<8>>(tr);
+    test_div_absolute<uint16<8>>(tr);
+    test_div_absolute<int32<8>>(tr);
+    test_div_absolute<uint32<8>>(tr);
+    test_div_absolute<int64<4>>(tr);
+    test_div_absolute<uint64<4>>(tr);
+
     { // uint16
         // this one can't contain zeros
         // NOTE: no support for 32-byte vectors yet
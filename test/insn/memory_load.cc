@@ -8,7 +8,9 @@
 #include "../utils/test_helpers.h"
 #include "../utils/test_results.h"
 #include "../common/vectors.h"
+#include "../common/guard_page.h"
 #include <simdpp/simd.h>
+#include <cstring>
 
 namespace SIMDPP_ARCH_NAMESPACE {
 
@@ -97,6 +99,149 @@ void test_load_helper(TestResultsSet& tc, TestReporter& tr,
     TEST_NOT_EQUAL(tr, zero, rv[3]);
 }
 
+template<class V, class I, unsigned vnum>
+void test_load_gather_helper(TestResultsSet& tc, TestReporter& tr,
+                             const typename V::element_type* sdata)
+{
+    using namespace simdpp;
+    using E = typename V::element_type;
+    using IE = typename I::element_type;
+
+    SIMDPP_ALIGN(64) IE idata[V::length];
+    SIMDPP_ALIGN(64) E mdata[V::length];
+    SIMDPP_ALIGN(64) E edata[V::length];
+
+    tc.reset_seq();
+    for (unsigned j = 0; j < 4; j++) {
+        for (unsigned i = 0; i < V::length; i++) {
+            idata[i] = (i * 7 + j * 5 + 3) % (vnum * V::length);
+        }
+        I idx = load(idata);
+
+        for (unsigned i = 0; i < V::length; i++) {
+            edata[i] = sdata[idata[i]];
+        }
+        V r = load_gather(sdata, idx);
+        TEST_PUSH(tc, V, r);
+        TEST_EQUAL(tr, load<V>(edata), r);
+
+        for (unsigned i = 0; i < V::length; i++) {
+            bool selected = ((i + j) % 3) != 0;
+            mdata[i] = selected ? 1 : 0;
+            edata[i] = selected ? sdata[idata[i]] : 0;
+        }
+        typename V::mask_vector_type mask;
+        mask = cmp_neq(load<V>(mdata), (V) make_zero());
+        r = load_gather_masked(sdata, idx, mask);
+        TEST_PUSH(tc, V, r);
+        TEST_EQUAL(tr, load<V>(edata), r);
+    }
+}
+
+template<class V>
+void test_expand_load_helper(TestResultsSet& tc, TestReporter& tr,
+                             const typename V::element_type* sdata)
+{
+    using namespace simdpp;
+    using E = typename V::element_type;
+
+    SIMDPP_ALIGN(64) E mdata[V::length];
+    SIMDPP_ALIGN(64) E edata[V::length];
+
+    tc.reset_seq();
+    for (unsigned j = 0; j < 7; j++) {
+        // none, all and then an increasing number of selected elements
+        unsigned n = 0;
+        for (unsigned i = 0; i < V::length; i++) {
+            bool selected = j == 1 || (j > 1 && (i * 5 + j * 3) % 7 < j - 1);
+            mdata[i] = selected ? 1 : 0;
+            edata[i] = selected ? sdata[j + n++] : 0;
+        }
+        typename V::mask_vector_type mask;
+        mask = cmp_neq(load<V>(mdata), (V) make_zero());
+
+        V r = expand_load(sdata + j, mask);
+        TEST_PUSH(tc, V, r);
+        TEST_EQUAL(tr, load<V>(edata), r);
+    }
+}
+
+template<class V>
+void test_load_masked_helper(TestResultsSet& tc, TestReporter& tr,
+                             const typename V::element_type* sdata)
+{
+    using namespace simdpp;
+    using E = typename V::element_type;
+
+    SIMDPP_ALIGN(64) E mdata[V::length];
+    SIMDPP_ALIGN(64) E edata[V::length];
+
+    tc.reset_seq();
+    for (unsigned j = 0; j < 7; j++) {
+        // none, all and then an increasing number of selected elements
+        for (unsigned i = 0; i < V::length; i++) {
+            bool selected = j == 1 || (j > 1 && (i * 5 + j * 3) % 7 < j - 1);
+            mdata[i] = selected ? 1 : 0;
+            edata[i] = selected ? sdata[i] : 0;
+        }
+        typename V::mask_vector_type mask;
+        mask = cmp_neq(load<V>(mdata), (V) make_zero());
+
+        V r = load_masked(sdata, mask);
+        TEST_PUSH(tc, V, r);
+        TEST_EQUAL(tr, load<V>(edata), r);
+    }
+
+    // the native vectors without selected elements are placed on a page that
+    // can't be accessed
+    GuardPage page;
+    const unsigned base_length = V::base_vector_type::length;
+    for (unsigned k = 0; k <= V::vec_length; k++) {
+        unsigned n = k * base_length;
+        E* pdata = page.end<E>() - n;
+        std::memcpy(pdata, sdata, n * sizeof(E));
+        for (unsigned i = 0; i < V::length; i++) {
+            bool selected = i < n && (i % 3 != 1 || i + 1 == n);
+            mdata[i] = selected ? 1 : 0;
+            edata[i] = selected ? sdata[i] : 0;
+        }
+        typename V::mask_vector_type mask;
+        mask = cmp_neq(load<V>(mdata), (V) make_zero());
+
+        V r = load_masked(pdata, mask);
+        TEST_EQUAL(tr, load<V>(edata), r);
+    }
+}
+
+template<class V>
+void test_load_first_helper(TestResultsSet& tc, TestReporter& tr,
+                            const typename V::element_type* sdata)
+{
+    using namespace simdpp;
+    using E = typename V::element_type;
+
+    // the data is put right before a page that can't be accessed, so that
+    // the emulated implementations must avoid touching it
+    GuardPage page;
+
+    SIMDPP_ALIGN(64) E edata[V::length];
+
+    tc.reset_seq();
+    for (unsigned n = 0; n <= V::length; n++) {
+        for (unsigned i = 0; i < V::length; i++)
+            edata[i] = i < n ? sdata[i + 1] : 0;
+
+        V r = load_first<V>(sdata + 1, n);
+        TEST_PUSH(tc, V, r);
+        TEST_EQUAL(tr, load<V>(edata), r);
+
+        E* pdata = page.end<E>() - n;
+        std::memcpy(pdata, sdata + 1, n * sizeof(E));
+        r = load_first<V>(pdata, n);
+        TEST_EQUAL(tr, load<V>(edata), r);
+    }
+}
+
 template<unsigned B>
 void test_memory_load_n(TestResultsSet& tc, TestReporter& tr)
 {
@@ -118,6 +263,45 @@ void test_memory_load_n(TestResultsSet& tc, TestReporter& tr)
 
     test_load_helper<float32<B/4>, vnum>(tc, tr, v.pf32);
     test_load_helper<float64<B/8>, vnum>(tc, tr, v.pf64);
+
+    test_load_gather_helper<uint32<B/4>, int32<B/4>, vnum>(tc, tr, v.pu32);
+    test_load_gather_helper<uint64<B/8>, int64<B/8>, vnum>(tc, tr, v.pu64);
+    test_load_gather_helper<int32<B/4>, int32<B/4>, vnum>(tc, tr, v.pi32);
+    test_load_gather_helper<int64<B/8>, int64<B/8>, vnum>(tc, tr, v.pi64);
+    test_load_gather_helper<float32<B/4>, int32<B/4>, vnum>(tc, tr, v.pf32);
+    test_load_gather_helper<float64<B/8>, int64<B/8>, vnum>(tc, tr, v.pf64);
+
+    test_expand_load_helper<uint8<B>>(tc, tr, v.pu8);
+    test_expand_load_helper<uint16<B/2>>(tc, tr, v.pu16);
+    test_expand_load_helper<uint32<B/4>>(tc, tr, v.pu32);
+    test_expand_load_helper<uint64<B/8>>(tc, tr, v.pu64);
+    test_expand_load_helper<int8<B>>(tc, tr, v.pi8);
+    test_expand_load_helper<int16<B/2>>(tc, tr, v.pi16);
+    test_expand_load_helper<int32<B/4>>(tc, tr, v.pi32);
+    test_expand_load_helper<int64<B/8>>(tc, tr, v.pi64);
+    test_expand_load_helper<float32<B/4>>(tc, tr, v.pf32);
+    test_expand_load_helper<float64<B/8>>(tc, tr, v.pf64);
+
+    test_load_masked_helper<uint8<B>>(tc, tr, v.pu8);
+    test_load_masked_helper<uint16<B/2>>(tc, tr, v.pu16);
+    test_load_masked_helper<uint32<B/4>>(tc, tr, v.pu32);
+    test_load_masked_helper<uint64<B/8>>(tc, tr, v.pu64);
+    test_load_masked_helper<int8<B>>(tc, tr, v.pi8);
+    test_load_masked_helper<int16<B/2>>(tc, tr, v.pi16);
+    test_load_masked_helper<int32<B/4>>(tc, tr, v.pi32);
+    test_load_masked_helper<int64<B/8>>(tc, tr, v.pi64);
+    test_load_masked_helper<float32<B/4>>(tc, tr, v.pf32);
+    test_load_masked_helper<float64<B/8>>(tc, tr, v.pf64);
+    test_load_first_helper<uint8<B>>(tc, tr, v.pu8);
+    test_load_first_helper<uint16<B/2>>(tc, tr, v.pu16);
+    test_load_first_helper<uint32<B/4>>(tc, tr, v.pu32);
+    test_load_first_helper<uint64<B/8>>(tc, tr, v.pu64);
+    test_load_first_helper<int8<B>>(tc, tr, v.pi8);
+    test_load_first_helper<int16<B/2>>(tc, tr, v.pi16);
+    test_load_first_helper<int32<B/4>>(tc, tr, v.pi32);
+    test_load_first_helper<int64<B/8>>(tc, tr, v.pi64);
+    test_load_first_helper<float32<B/4>>(tc, tr, v.pf32);
+    test_load_first_helper<float64<B/8>>(tc, tr, v.pf64);
 }
 
 void test_memory_load(TestResults& res, TestReporter& tr)
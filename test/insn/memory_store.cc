@@ -49,6 +49,104 @@ void test_store_masked(TestResultsSet& tc, TestReporter& tr, const V* sv)
 
 }
 
+template<class V, class I, unsigned vnum>
+void test_store_scatter_helper(TestResultsSet& tc, TestReporter& tr,
+                               const V* sv)
+{
+    using namespace simdpp;
+    using E = typename V::element_type;
+    using IE = typename I::element_type;
+
+    const unsigned element_count = vnum * V::length;
+    const unsigned byte_count = vnum * V::length_bytes;
+
+    SIMDPP_ALIGN(64) E rdata[element_count];
+    SIMDPP_ALIGN(64) E edata[element_count];
+    SIMDPP_ALIGN(64) E sdata[V::length];
+    SIMDPP_ALIGN(64) E mdata[V::length];
+    SIMDPP_ALIGN(64) IE idata[V::length];
+
+    store(sdata, sv[0]);
+
+    tc.reset_seq();
+    for (unsigned j = 0; j < 4; j++) {
+        // the last iteration uses duplicate indices
+        unsigned modulo = j == 3 ? V::length / 2 + 1 : element_count;
+        for (unsigned i = 0; i < V::length; i++) {
+            idata[i] = (i * 7 + j * 5 + 3) % modulo;
+        }
+        I idx = load(idata);
+
+        std::memset(rdata, 0, byte_count);
+        std::memset(edata, 0, byte_count);
+        for (unsigned i = 0; i < V::length; i++) {
+            edata[idata[i]] = sdata[i];
+        }
+        store_scatter(rdata, idx, sv[0]);
+        TEST_PUSH_STORED(tc, V, rdata, vnum);
+        TEST_EQUAL_MEMORY(tr, edata, rdata, element_count);
+
+        std::memset(rdata, 0, byte_count);
+        std::memset(edata, 0, byte_count);
+        for (unsigned i = 0; i < V::length; i++) {
+            bool selected = ((i + j) % 3) != 0;
+            mdata[i] = selected ? 1 : 0;
+            if (selected)
+                edata[idata[i]] = sdata[i];
+        }
+        typename V::mask_vector_type mask;
+        mask = cmp_neq(load<V>(mdata), (V) make_zero());
+        store_scatter_masked(rdata, idx, sv[0], mask);
+        TEST_PUSH_STORED(tc, V, rdata, vnum);
+        TEST_EQUAL_MEMORY(tr, edata, rdata, element_count);
+    }
+}
+
+template<class V>
+void test_compress_helper(TestResultsSet& tc, TestReporter& tr, const V* sv)
+{
+    using namespace simdpp;
+    using E = typename V::element_type;
+
+    SIMDPP_ALIGN(64) E sdata[V::length];
+    SIMDPP_ALIGN(64) E mdata[V::length];
+    SIMDPP_ALIGN(64) E edata[V::length];
+    SIMDPP_ALIGN(64) E rdata[V::length + 1];
+    SIMDPP_ALIGN(64) E rdata_exp[V::length + 1];
+
+    store(sdata, sv[0]);
+
+    tc.reset_seq();
+    for (unsigned j = 0; j < 7; j++) {
+        // none, all and then an increasing number of selected elements
+        unsigned n = 0;
+        for (unsigned i = 0; i < V::length; i++) {
+            bool selected = j == 1 || (j > 1 && (i * 5 + j * 3) % 7 < j - 1);
+            mdata[i] = selected ? 1 : 0;
+            if (selected)
+                edata[n++] = sdata[i];
+        }
+        for (unsigned i = n; i < V::length; i++) {
+            edata[i] = 0;
+        }
+        typename V::mask_vector_type mask;
+        mask = cmp_neq(load<V>(mdata), (V) make_zero());
+
+        V r = compress(sv[0], mask);
+        TEST_PUSH(tc, V, r);
+        TEST_EQUAL(tr, load<V>(edata), r);
+
+        // the memory past the stored elements must not be modified
+        std::memset(rdata, 0x5a, sizeof(rdata));
+        std::memset(rdata_exp, 0x5a, sizeof(rdata_exp));
+        std::memcpy(rdata_exp + 1, edata, n * sizeof(E));
+
+        unsigned rn = compress_store(rdata + 1, sv[0], mask);
+        TEST_EQUAL(tr, n, rn);
+        TEST_EQUAL_MEMORY(tr, rdata_exp, rdata, V::length + 1);
+    }
+}
+
 template<class V, unsigned vnum>
 void test_store_helper(TestResultsSet& tc, TestReporter& tr, const V* sv)
 {
@@ -188,6 +286,24 @@ void test_memory_store_n(TestResultsSet& tc, TestReporter& tr)
     test_store_masked<int64<B/8>>(tc, tr, v.i64);
     test_store_masked<float32<B/4>>(tc, tr, v.f32);
     test_store_masked<float64<B/8>>(tc, tr, v.f64);
+
+    test_store_scatter_helper<uint32<B/4>, int32<B/4>, vnum>(tc, tr, v.u32);
+    test_store_scatter_helper<uint64<B/8>, int64<B/8>, vnum>(tc, tr, v.u64);
+    test_store_scatter_helper<int32<B/4>, int32<B/4>, vnum>(tc, tr, v.i32);
+    test_store_scatter_helper<int64<B/8>, int64<B/8>, vnum>(tc, tr, v.i64);
+    test_store_scatter_helper<float32<B/4>, int32<B/4>, vnum>(tc, tr, v.f32);
+    test_store_scatter_helper<float64<B/8>, int64<B/8>, vnum>(tc, tr, v.f64);
+
+    test_compress_helper<uint8<B>>(tc, tr, v.u8);
+    test_compress_helper<uint16<B/2>>(tc, tr, v.u16);
+    test_compress_helper<uint32<B/4>>(tc, tr, v.u32);
+    test_compress_helper<uint64<B/8>>(tc, tr, v.u64);
+    test_compress_helper<int8<B>>(tc, tr, v.i8);
+    test_compress_helper<int16<B/2>>(tc, tr, v.i16);
+    test_compress_helper<int32<B/4>>(tc, tr, v.i32);
+    test_compress_helper<int64<B/8>>(tc, tr, v.i64);
+    test_compress_helper<float32<B/4>>(tc, tr, v.f32);
+    test_compress_helper<float64<B/8>>(tc, tr, v.f64);
 }
 
 void test_memory_store(TestResults& res, TestReporter& tr)
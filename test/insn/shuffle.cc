@@ -197,6 +197,76 @@ void test_extract_bits(TestResultsSet& tc)
     }
 }
 
+template<class V>
+void test_extract_mask_bits(TestResultsSet& tc)
+{
+    using namespace simdpp;
+    using U = typename V::uint_vector_type;
+
+    for (unsigned el = 0; el < V::length; el++) {
+        simdpp::SIMDPP_ARCH_NAMESPACE::detail::mem_block<U> mu;
+        mu = make_zero();
+        mu[el] = ~typename U::element_type(0);
+        mu[(el * 7 + 3) % V::length] = ~typename U::element_type(0);
+        V v = V(U(mu));
+        TEST_PUSH(tc, uint64_t, extract_mask_bits(v));
+        TEST_PUSH(tc, uint64_t, extract_mask_bits(to_mask(v)));
+    }
+}
+
+template<unsigned B>
+void test_extract_mask_bits_n(TestResultsSet& tc)
+{
+    using namespace simdpp;
+
+    test_extract_mask_bits<int8<B>>(tc);
+    test_extract_mask_bits<uint16<B/2>>(tc);
+    test_extract_mask_bits<int32<B/4>>(tc);
+    test_extract_mask_bits<uint64<B/8>>(tc);
+    test_extract_mask_bits<float32<B/4>>(tc);
+    test_extract_mask_bits<float64<B/8>>(tc);
+}
+
+template<class V>
+void test_mask_test(TestResultsSet& tc)
+{
+    using namespace simdpp;
+    using U = typename V::uint_vector_type;
+
+    for (unsigned el = 0; el < V::length + 2; el++) {
+        simdpp::SIMDPP_ARCH_NAMESPACE::detail::mem_block<U> mu;
+        if (el == V::length) {
+            mu = make_zero();
+        } else if (el == V::length + 1) {
+            mu = make_ones();
+        } else {
+            mu = make_zero();
+            mu[el] = ~typename U::element_type(0);
+            mu[(el * 7 + 3) % V::length] = ~typename U::element_type(0);
+        }
+        auto m = to_mask(V(U(mu)));
+        TEST_PUSH(tc, uint32_t, any_true(m));
+        TEST_PUSH(tc, uint32_t, all_true(m));
+        TEST_PUSH(tc, uint32_t, none_true(m));
+        TEST_PUSH(tc, uint32_t, count_true(m));
+        TEST_PUSH(tc, uint32_t, find_first_set(m));
+        TEST_PUSH(tc, uint32_t, find_last_set(m));
+    }
+}
+
+template<unsigned B>
+void test_mask_test_n(TestResultsSet& tc)
+{
+    using namespace simdpp;
+
+    test_mask_test<uint8<B>>(tc);
+    test_mask_test<int16<B/2>>(tc);
+    test_mask_test<uint32<B/4>>(tc);
+    test_mask_test<int64<B/8>>(tc);
+    test_mask_test<float32<B/4>>(tc);
+    test_mask_test<float64<B/8>>(tc);
+}
+
 void test_shuffle(TestResults& res)
 {
     TestResultsSet& tc = res.new_results_set("shuffle");
@@ -210,6 +280,15 @@ void test_shuffle(TestResults& res)
     // extract bits
     test_extract_bits<uint16_t, uint8<16>>(tc);
     test_extract_bits<uint32_t, uint8<32>>(tc);
+
+    test_extract_mask_bits_n<16>(tc);
+    test_extract_mask_bits_n<32>(tc);
+    test_extract_mask_bits_n<64>(tc);
+
+    test_mask_test_n<16>(tc);
+    test_mask_test_n<32>(tc);
+    test_mask_test_n<64>(tc);
+    test_mask_test_n<128>(tc);
 }
 
 } // namespace SIMDPP_ARCH_NAMESPACE
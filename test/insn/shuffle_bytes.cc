@@ -292,8 +292,77 @@ struct Test_shuffle_zbytes16_x16 {
 };
 
 
+template<unsigned B>
+void test_permute_bytes_n(TestResultsSet& tc)
+{
+    using namespace simdpp;
+
+    Vectors<B,4> v;
+    for (unsigned i = 0; i < 4; ++i) {
+        uint8<B> idx = v.u8[(i + 1) % 4];
+        TEST_PUSH(tc, uint8<B>, permute_bytes(v.u8[i], idx));
+        TEST_PUSH(tc, int8<B>, permute_bytes(int8<B>(v.u8[i]), idx));
+
+        uint16<B/2> widx = v.u16[(i + 1) % 4];
+        TEST_PUSH(tc, uint16<B/2>, permute_words(v.u16[i], widx));
+        TEST_PUSH(tc, int16<B/2>, permute_words(int16<B/2>(v.u16[i]), widx));
+    }
+}
+
+template<unsigned T, unsigned B>
+void test_lookup_table_n(TestResultsSet& tc)
+{
+    using namespace simdpp;
+
+    Vectors<T,4> vt;
+    Vectors<B,4> vi;
+    for (unsigned i = 0; i < 4; ++i) {
+        uint8<B> idx = vi.u8[i];
+        TEST_PUSH(tc, uint8<B>, lookup_table(vt.u8[i], idx));
+        TEST_PUSH(tc, int8<B>, lookup_table(int8<T>(vt.u8[i]), idx));
+    }
+}
+
+// Tests the overload that takes two tables of T elements each
+template<unsigned T, unsigned B>
+void test_lookup_table2_n(TestResultsSet& tc)
+{
+    using namespace simdpp;
+
+    Vectors<T,4> vt;
+    Vectors<B,4> vi;
+    for (unsigned i = 0; i < 4; ++i) {
+        uint8<B> idx = vi.u8[i];
+        TEST_PUSH(tc, uint8<B>, lookup_table(vt.u8[i], vt.u8[(i + 1) % 4], idx));
+        TEST_PUSH(tc, int8<B>, lookup_table(int8<T>(vt.u8[i]),
+                                            int8<T>(vt.u8[(i + 1) % 4]), idx));
+    }
+}
+
 void test_shuffle_bytes(TestResults& res, TestReporter& tr)
 {
+    {
+        TestResultsSet& tc = res.new_results_set("permute_bytes");
+        test_permute_bytes_n<16>(tc);
+        test_permute_bytes_n<32>(tc);
+        test_permute_bytes_n<64>(tc);
+    }
+    {
+        TestResultsSet& tc = res.new_results_set("lookup_table");
+        test_lookup_table_n<16,16>(tc);
+        test_lookup_table_n<16,64>(tc);
+        test_lookup_table_n<64,16>(tc);
+        test_lookup_table_n<64,32>(tc);
+        test_lookup_table_n<128,32>(tc);
+        test_lookup_table_n<128,64>(tc);
+        test_lookup_table_n<256,16>(tc);
+        test_lookup_table_n<256,64>(tc);
+        test_lookup_table2_n<16,16>(tc);
+        test_lookup_table2_n<64,32>(tc);
+        test_lookup_table2_n<128,16>(tc);
+        test_lookup_table2_n<128,64>(tc);
+    }
+
 #if SIMDPP_USE_NULL || SIMDPP_USE_SSSE3 || SIMDPP_USE_NEON
     TestResultsSet& tc = res.new_results_set("shuffle_bytes");
 
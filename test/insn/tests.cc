@@ -64,8 +64,8 @@ void main_test_function(TestResults& res, TestReporter& tr, const TestOptions& o
     test_shuffle_bytes(res, tr);
 
     test_convert(res);
-    test_math_fp(res, opts);
-    test_math_int(res);
+    test_math_fp(res, tr, opts);
+    test_math_int(res, tr);
     test_compare(res);
     test_math_shift(res);
     test_transpose(res);
@@ -23,8 +23,8 @@ void test_compare(TestResults& res);
 void test_convert(TestResults& res);
 void test_construct(TestResults& res);
 void test_for_each(TestResults& res, TestReporter& tr);
-void test_math_fp(TestResults& res, const TestOptions& opts);
-void test_math_int(TestResults& res);
+void test_math_fp(TestResults& res, TestReporter& tr, const TestOptions& opts);
+void test_math_int(TestResults& res, TestReporter& tr);
 void test_math_shift(TestResults& res);
 void test_memory_load(TestResults& res, TestReporter& tr);
 void test_memory_store(TestResults& res, TestReporter& tr);
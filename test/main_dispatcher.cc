@@ -9,6 +9,7 @@
 #include <algorithm>
 #include <iostream>
 #include <string>
+#include <cstdint>
 #include <cstdlib>
 #include "utils/test_helpers.h"
 
@@ -18,6 +19,7 @@
 #include <simdpp/dispatch/get_arch_linux_cpuinfo.h>
 #include <simdpp/dispatch/get_arch_raw_cpuid.h>
 #include <simdpp/dispatch/get_arch_string_list.h>
+#include <simdpp/dispatch/registry.h>
 
 static simdpp::Arch g_supported_arch;
 
@@ -146,18 +148,35 @@ int main(int argc, char** argv)
 
     TestReporter tr(std::cerr);
 
+    // Select all dispatched functions in advance. The subsequent calls must
+    // use the same selection as if each dispatcher was resolved on first call.
+    simdpp::resolve_dispatchers();
+
     Arch selected = test_dispatcher_get_arch();
     if (selected != g_supported_arch) {
         tr.out() << "Wrong architecture selected: \n"
                  << "  Supported: "
-                 << std::hex << static_cast<unsigned>(g_supported_arch)
+                 << std::hex << static_cast<std::uint64_t>(g_supported_arch)
                  << "\n  Selected: "
-                 << std::hex << static_cast<unsigned>(selected) << "\n";
+                 << std::hex << static_cast<std::uint64_t>(selected) << "\n";
         tr.add_result(false);
         return EXIT_FAILURE;
     }
     tr.add_result(true);
 
+    // The registry must report the selected version of each dispatcher
+    bool found_info = false;
+    for (const simdpp::DispatcherInfo& info : simdpp::get_dispatchers_info()) {
+        TEST_EQUAL(tr, true, info.selected_arch_name != nullptr);
+        TEST_EQUAL(tr, true, !info.arch_names.empty());
+        if (std::string(info.name) == "test_dispatcher_get_arch") {
+            found_info = true;
+            TEST_EQUAL(tr, static_cast<std::uint64_t>(g_supported_arch),
+                       static_cast<std::uint64_t>(info.selected_arch));
+        }
+    }
+    TEST_EQUAL(tr, true, found_info);
+
     TEST_EQUAL(tr, 42, test_dispatcher_old_ret0());
     TEST_EQUAL(tr, 1, test_dispatcher_old_ret1(1));
     TEST_EQUAL(tr, 1+2, test_dispatcher_old_ret2(1, 2));
@@ -240,6 +259,91 @@ int main(int argc, char** argv)
     test_dispatcher_template2_pair_for_type<int, char>(tr);
     test_dispatcher_template2_pair_for_type<char, char>(tr);
 
+    test_dispatcher_functor functor;
+    functor.base = 10;
+    TEST_EQUAL(tr, 10+1, functor(1));
+    functor.accumulate(1, 2);
+    TEST_EQUAL(tr, 10+1+2, functor.base);
+    TEST_EQUAL(tr, static_cast<std::uint64_t>(g_supported_arch),
+               static_cast<std::uint64_t>(functor.get_arch()));
+
+    // Resolved pointers must refer to the selected versions directly
+    int (*resolved_ret2)(int, int) = simdpp::resolve(&test_dispatcher_ret2);
+    TEST_EQUAL(tr, true, resolved_ret2 != &test_dispatcher_ret2);
+    TEST_EQUAL(tr, 1+2, resolved_ret2(1, 2));
+
+    Arch (*resolved_get_arch)() = simdpp::resolve(&test_dispatcher_get_arch);
+    TEST_EQUAL(tr, static_cast<std::uint64_t>(g_supported_arch),
+               static_cast<std::uint64_t>(resolved_get_arch()));
+
+    std::pair<int, int> (*resolved_template)(const std::pair<int, int>&) =
+            simdpp::resolve(&test_dispatcher_ret_template_pair<int>);
+    intpair = resolved_template(std::pair<int, int>(1, 2));
+    TEST_EQUAL(tr, 1, intpair.first);
+    TEST_EQUAL(tr, 2, intpair.second);
+
+    int (*resolved_functor)(const test_dispatcher_functor*, int) =
+            simdpp::resolve<int (test_dispatcher_functor::*)(int) const>(
+                &test_dispatcher_functor::operator());
+    TEST_EQUAL(tr, true, resolved_functor != nullptr);
+    TEST_EQUAL(tr, 10+1+2+5, resolved_functor(&functor, 5));
+
+    // The architecture mask must affect the dispatchers that have already
+    // been resolved
+    simdpp::set_dispatch_arch_mask(Arch::NONE_NULL);
+    TEST_EQUAL(tr, static_cast<std::uint64_t>(Arch::NONE_NULL),
+               static_cast<std::uint64_t>(test_dispatcher_get_arch()));
+    simdpp::set_dispatch_arch_mask(~Arch::NONE_NULL);
+    TEST_EQUAL(tr, static_cast<std::uint64_t>(g_supported_arch),
+               static_cast<std::uint64_t>(test_dispatcher_get_arch()));
+
+#if SIMDPP_X86
+    TEST_EQUAL(tr, static_cast<std::uint64_t>(Arch::X86_SSE2 | Arch::X86_SSE3 |
+                                              Arch::X86_POPCNT_INSN),
+               static_cast<std::uint64_t>(
+                   simdpp::get_arch_string_list(" sse3,popcnt ", nullptr)));
+    TEST_EQUAL(tr, true, simdpp::test_arch_subset(
+                   simdpp::get_arch_string_list("avx512vpopcntdq", nullptr),
+                   Arch::X86_AVX2 | Arch::X86_AVX512F |
+                   Arch::X86_AVX512VPOPCNTDQ));
+
+    using simdpp::detail::DispatchRegistry;
+    TEST_EQUAL(tr, static_cast<std::uint64_t>(Arch::X86_SSE2 | Arch::X86_SSE3),
+               static_cast<std::uint64_t>(
+                   DispatchRegistry::parse_arch_mask("sse3,sse4.1")));
+    TEST_EQUAL(tr, static_cast<std::uint64_t>(Arch::NONE_NULL),
+               static_cast<std::uint64_t>(
+                   DispatchRegistry::parse_arch_mask(" null ")));
+
+    // Minor extensions must not outrank the major instruction sets even
+    // though their bits are larger
+    {
+        using simdpp::detail::FnVersion;
+        using simdpp::detail::VoidFunPtr;
+        VoidFunPtr fn = reinterpret_cast<VoidFunPtr>(&test_dispatcher_old_void0);
+        Arch a_avx2 = Arch::X86_SSE2 | Arch::X86_SSE3 | Arch::X86_SSSE3 |
+                Arch::X86_SSE4_1 | Arch::X86_AVX | Arch::X86_AVX2;
+        FnVersion versions[3] = {
+            { Arch::X86_SSE2 | Arch::X86_BMI2, fn, "bmi2" },
+            { a_avx2, fn, "avx2" },
+            { a_avx2 | Arch::X86_BMI2, fn, "avx2_bmi2" },
+        };
+        FnVersion v = simdpp::detail::select_version_any(
+                    versions, 3, a_avx2 | Arch::X86_BMI1);
+        TEST_EQUAL(tr, true, std::string("avx2") == v.arch_name);
+        v = simdpp::detail::select_version_any(
+                    versions, 3, a_avx2 | Arch::X86_BMI2);
+        TEST_EQUAL(tr, true, std::string("avx2_bmi2") == v.arch_name);
+    }
+#endif
+    // Unknown names must not disable all instruction sets
+    TEST_EQUAL(tr, static_cast<std::uint64_t>(~Arch::NONE_NULL),
+               static_cast<std::uint64_t>(
+                   simdpp::detail::DispatchRegistry::parse_arch_mask("sse4.1")));
+    TEST_EQUAL(tr, static_cast<std::uint64_t>(~Arch::NONE_NULL),
+               static_cast<std::uint64_t>(
+                   simdpp::detail::DispatchRegistry::parse_arch_mask("")));
+
     tr.report_summary();
     return tr.success() ? EXIT_SUCCESS : EXIT_FAILURE;
 }
@@ -0,0 +1,63 @@
+/*  Copyright (C) 2017  Povilas Kanapickas <povilas@radix.lt>
+
+    Distributed under the Boost Software License, Version 1.0.
+        (See accompanying file LICENSE_1_0.txt or copy at
+            http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#include "dispatcher/dispatcher_ifunc.h"
+#include <cstdint>
+#include <cstdlib>
+#include <iostream>
+#include <simdpp/dispatch/dispatcher.h>
+#include <simdpp/dispatch/registry.h>
+#include "utils/test_helpers.h"
+
+// Returned when the dispatchers fall back to the regular mechanism, which is
+// covered by test_dispatcher
+static const int SKIP_RETURN_CODE = 77;
+
+int g_test_ifunc_val;
+
+int main()
+{
+#if !SIMDPP_DETAIL_DISPATCH_IFUNC
+    std::cerr << "Indirect functions are not supported on this target\n";
+    return SKIP_RETURN_CODE;
+#else
+    using simdpp::Arch;
+
+    TestReporter tr(std::cerr);
+
+    // The indirect function dispatchers are not affected by the mask. Reset
+    // it so that the regular dispatchers select the same version even if
+    // SIMDPP_FORCE_ARCH is set in the environment.
+    simdpp::set_dispatch_arch_mask(~Arch::NONE_NULL);
+
+    Arch expected = test_ifunc_get_arch_template<int>();
+    Arch selected = test_ifunc_get_arch();
+    if (selected != expected) {
+        tr.out() << "Wrong architecture selected: \n"
+                 << "  Expected: "
+                 << std::hex << static_cast<std::uint64_t>(expected)
+                 << "\n  Selected: "
+                 << std::hex << static_cast<std::uint64_t>(selected) << "\n";
+        tr.add_result(false);
+        return EXIT_FAILURE;
+    }
+    tr.add_result(true);
+
+    // Indirect function dispatchers are not registered, thus resolve returns
+    // the dispatcher itself
+    TEST_EQUAL(tr, true, simdpp::resolve(&test_ifunc_ret2) == &test_ifunc_ret2);
+
+    TEST_EQUAL(tr, 1+2, test_ifunc_ret2(1, 2));
+
+    g_test_ifunc_val = 0;
+    test_ifunc_void1(5);
+    TEST_EQUAL(tr, 5, g_test_ifunc_val);
+
+    tr.report_summary();
+    return tr.success() ? EXIT_SUCCESS : EXIT_FAILURE;
+#endif
+}